@@ -113,6 +113,11 @@ if(OTBR_TREL)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TREL=1)
 endif()
 
+option(OTBR_TREL_PROBING "Enable probing the liveness and round-trip time of TREL peers." OFF)
+if(OTBR_TREL_PROBING)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TREL_PROBING=1)
+endif()
+
 option(OTBR_EPSKC "Enable ephemeral PSKc" ON)
 if (OTBR_EPSKC)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_EPSKC=1)
@@ -73,6 +73,18 @@ Application::Application(const std::string               &aInterfaceName,
     , mDBusAgent(MakeUnique<DBus::DBusAgent>(*mHost, *mPublisher))
 #endif
 {
+#if __linux__
+    mInfraLinkSelector.SetInfraLinkChangedCallback([this](const char *aInfraLink) {
+        mInfraLinkChanged = (aInfraLink != mBackboneInterfaceName);
+#if OTBR_ENABLE_MDNS
+        mPublisher->SetInfraIf(aInfraLink);
+#endif
+    });
+#endif
+#if OTBR_ENABLE_MDNS
+    mPublisher->SetInfraIf(mBackboneInterfaceName);
+#endif
+
     if (mHost->GetCoprocessorType() == OT_COPROCESSOR_RCP)
     {
         CreateRcpMode(aRestListenAddress, aRestListenPort, aMudManagerIp);
@@ -170,14 +182,10 @@ otbrError Application::Run(void)
             MainloopManager::GetInstance().Process(mainloop);
 
 #if __linux__
+            if (mInfraLinkChanged)
             {
-                const char *newInfraLink = mInfraLinkSelector.Select();
-
-                if (mBackboneInterfaceName != newInfraLink)
-                {
-                    error = OTBR_ERROR_INFRA_LINK_CHANGED;
-                    break;
-                }
+                error = OTBR_ERROR_INFRA_LINK_CHANGED;
+                break;
             }
 #endif
         }
@@ -238,7 +246,14 @@ void Application::CreateRcpMode(const std::string &aRestListenAddress, int aRest
     mUbusAgent = MakeUnique<ubus::UBusAgent>(rcpHost);
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    mRestWebServer = MakeUnique<rest::RestWebServer>(rcpHost, aRestListenAddress, aRestListenPort);
+    {
+        BackboneRouter::BackboneAgent *backboneAgent = nullptr;
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+        backboneAgent = mBackboneAgent.get();
+#endif
+        mRestWebServer = MakeUnique<rest::RestWebServer>(rcpHost, aRestListenAddress, aRestListenPort, backboneAgent);
+    }
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
     mVendorServer = vendor::VendorServer::newInstance(*this);
@@ -282,7 +297,22 @@ void Application::InitRcpMode(void)
     mRestWebServer->Init();
 #endif
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent->Init(*mBorderAgent);
+    {
+        AdvertisingProxy              *advertisingProxy = nullptr;
+        TrelDnssd::TrelDnssd          *trelDnssd        = nullptr;
+        BackboneRouter::BackboneAgent *backboneAgent    = nullptr;
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+        advertisingProxy = mAdvertisingProxy.get();
+#endif
+#if OTBR_ENABLE_TREL
+        trelDnssd = mTrelDnssd.get();
+#endif
+#if OTBR_ENABLE_BACKBONE_ROUTER
+        backboneAgent = mBackboneAgent.get();
+#endif
+        mDBusAgent->Init(*mBorderAgent, advertisingProxy, trelDnssd, backboneAgent);
+    }
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
     mVendorServer->Init();
@@ -314,7 +344,7 @@ void Application::DeinitRcpMode(void)
 void Application::InitNcpMode(void)
 {
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent->Init(*mBorderAgent);
+    mDBusAgent->Init(*mBorderAgent, nullptr, nullptr, nullptr);
 #endif
 }
 
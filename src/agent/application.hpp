@@ -270,6 +270,7 @@ private:
     std::string mInterfaceName;
 #if __linux__
     otbr::Utils::InfraLinkSelector mInfraLinkSelector;
+    bool                           mInfraLinkChanged = false;
 #endif
     const char                      *mBackboneInterfaceName;
     std::unique_ptr<Ncp::ThreadHost> mHost;
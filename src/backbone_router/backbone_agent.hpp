@@ -84,6 +84,16 @@ public:
      */
     void Init(void);
 
+#if OTBR_ENABLE_DUA_ROUTING
+    /**
+     * This method gets the ND Proxy counters.
+     *
+     * @param[out] aCounters  The ND Proxy counters.
+     *
+     */
+    void GetNdProxyCounters(NdProxyCounters &aCounters) const { mNdProxyManager.GetCounters(aCounters); }
+#endif
+
 private:
     void        OnBecomePrimary(void);
     void        OnResignPrimary(void);
@@ -35,63 +35,83 @@
 
 #if OTBR_ENABLE_DUA_ROUTING
 
+#include <net/if.h>
+#include <linux/rtnetlink.h>
+
 #include "common/code_utils.hpp"
 
 namespace otbr {
 
 namespace BackboneRouter {
 
+constexpr uint32_t DuaRoutingManager::kPolicyRouteTable;
+constexpr uint32_t DuaRoutingManager::kPolicyRulePriority;
+
 void DuaRoutingManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(!mEnabled);
-    mEnabled = true;
 
     mDomainPrefix = aDomainPrefix;
 
+    SuccessOrExit(error = mRtNetlink.Open());
+
     AddDefaultRouteToThread();
     AddPolicyRouteToBackbone();
+    error = mRtNetlink.Commit();
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        // Remove whatever part of the routing did get programmed, so that the next `Enable()` starts clean.
+        DelDefaultRouteToThread();
+        DelPolicyRouteToBackbone();
+        (void)mRtNetlink.Commit();
+        ExitNow();
+    }
+
+    mEnabled = true;
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::Disable(void)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(mEnabled);
     mEnabled = false;
 
     DelDefaultRouteToThread();
     DelPolicyRouteToBackbone();
+    error = mRtNetlink.Commit();
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::AddDefaultRouteToThread(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    mRtNetlink.AddRoute({mDomainPrefix, if_nametoindex(mInterfaceName.c_str()), RT_TABLE_MAIN, 1});
 }
 
 void DuaRoutingManager::DelDefaultRouteToThread(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    mRtNetlink.DeleteRoute({mDomainPrefix, if_nametoindex(mInterfaceName.c_str()), RT_TABLE_MAIN, 1});
 }
 
 void DuaRoutingManager::AddPolicyRouteToBackbone(void)
 {
     // Packets from Thread interface use route table "openthread"
-    SystemUtils::ExecuteCommand("ip -6 rule add iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    mRtNetlink.AddRule({mInterfaceName, kPolicyRouteTable, kPolicyRulePriority});
+    mRtNetlink.AddRoute({mDomainPrefix, if_nametoindex(mBackboneInterfaceName.c_str()), kPolicyRouteTable, 0});
 }
 
 void DuaRoutingManager::DelPolicyRouteToBackbone(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 rule del iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    mRtNetlink.DeleteRule({mInterfaceName, kPolicyRouteTable, kPolicyRulePriority});
+    mRtNetlink.DeleteRoute({mDomainPrefix, if_nametoindex(mBackboneInterfaceName.c_str()), kPolicyRouteTable, 0});
 }
 
 } // namespace BackboneRouter
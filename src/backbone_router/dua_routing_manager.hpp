@@ -44,7 +44,7 @@
 
 #include "common/code_utils.hpp"
 #include "ncp/rcp_host.hpp"
-#include "utils/system_utils.hpp"
+#include "utils/rt_netlink.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -89,15 +89,21 @@ public:
     void Disable(void);
 
 private:
+    // The "openthread" table in /etc/iproute2/rt_tables.
+    static constexpr uint32_t kPolicyRouteTable = 88;
+    // The priority `ip rule add` picks by default, just before the main table lookup.
+    static constexpr uint32_t kPolicyRulePriority = 32765;
+
     void AddDefaultRouteToThread(void);
     void DelDefaultRouteToThread(void);
     void AddPolicyRouteToBackbone(void);
     void DelPolicyRouteToBackbone(void);
 
-    Ip6Prefix   mDomainPrefix;
-    bool        mEnabled : 1;
-    std::string mInterfaceName;
-    std::string mBackboneInterfaceName;
+    Ip6Prefix        mDomainPrefix;
+    bool             mEnabled : 1;
+    std::string      mInterfaceName;
+    std::string      mBackboneInterfaceName;
+    Utils::RtNetlink mRtNetlink;
 };
 
 /**
@@ -40,10 +40,13 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include <assert.h>
+#include <errno.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
 #include <sys/ioctl.h>
+#include <stdio.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
 #if __linux__
@@ -53,6 +56,7 @@
 #endif
 
 #include "backbone_router/constants.hpp"
+#include "backbone_router/ns_filter.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
@@ -74,11 +78,11 @@ void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
     SuccessOrExit(error = UpdateMacAddress());
     SuccessOrExit(error = InitNetfilterQueue());
 
-    // Add ip6tables rule for unicast ICMPv6 messages
+    // Add ip6tables rule for unicast ICMPv6 messages, bypassing the queue when the agent is not listening.
     VerifyOrExit(SystemUtils::ExecuteCommand(
                      "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str()) == 0,
+                     "NFQUEUE --queue-num %u --queue-bypass",
+                     mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str(), kNfQueueNum) == 0,
                  error = OTBR_ERROR_ERRNO);
 
 exit:
@@ -103,8 +107,8 @@ void NdProxyManager::Disable(void)
     // Remove ip6tables rule for unicast ICMPv6 messages
     VerifyOrExit(SystemUtils::ExecuteCommand(
                      "ip6tables -t raw -D PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str()) == 0,
+                     "NFQUEUE --queue-num %u --queue-bypass",
+                     mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str(), kNfQueueNum) == 0,
                  error = OTBR_ERROR_ERRNO);
 
 exit:
@@ -149,45 +153,104 @@ exit:
     return;
 }
 
-void NdProxyManager::ProcessMulticastNeighborSolicition()
+void NdProxyManager::ProcessMulticastNeighborSolicition(void)
 {
-    struct msghdr     msghdr;
-    sockaddr_in6      sin6;
-    struct iovec      iovec;
-    ssize_t           len;
-    struct icmp6_hdr *icmp6header;
-    struct cmsghdr   *cmsghdr;
-    unsigned char     cbuf[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
-    uint8_t           packet[kMaxICMP6PacketSize];
-    otbrError         error = OTBR_ERROR_NONE;
-    bool              found = false;
+    sockaddr_in6    sources[kMaxNsBatchSize];
+    struct iovec    iovecs[kMaxNsBatchSize];
+    struct mmsghdr  msgs[kMaxNsBatchSize];
+    unsigned char   cbufs[kMaxNsBatchSize][CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int)) +
+                                          CMSG_SPACE(sizeof(struct timespec))];
+    uint8_t         packets[kMaxNsBatchSize][kMaxICMP6PacketSize];
+    int             received = 0;
+    struct timespec receiveTime;
+
+    mMulticastNsCounters.mWakeups++;
+
+    // Drain the queued NS messages in batches, bounded so that a flood can't starve the other mainloop processors.
+    for (uint8_t batch = 0; batch < kMaxNsBatchesPerWakeup; batch++)
+    {
+        for (uint8_t i = 0; i < kMaxNsBatchSize; i++)
+        {
+            iovecs[i].iov_base = packets[i];
+            iovecs[i].iov_len  = sizeof(packets[i]);
+
+            msgs[i].msg_hdr.msg_name       = &sources[i];
+            msgs[i].msg_hdr.msg_namelen    = sizeof(sources[i]);
+            msgs[i].msg_hdr.msg_iov        = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen     = 1;
+            msgs[i].msg_hdr.msg_control    = cbufs[i];
+            msgs[i].msg_hdr.msg_controllen = sizeof(cbufs[i]);
+            msgs[i].msg_hdr.msg_flags      = 0;
+            msgs[i].msg_len                = 0;
+        }
+
+        received = recvmmsg(mIcmp6RawSock, msgs, kMaxNsBatchSize, MSG_DONTWAIT, nullptr);
 
-    iovec.iov_len  = kMaxICMP6PacketSize;
-    iovec.iov_base = packet;
+        if (received < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("NdProxyManager: Failed to receive NS: %s", strerror(errno));
+            }
+            ExitNow();
+        }
+
+        mMulticastNsCounters.mPackets += received;
+
+        // Used in case the kernel didn't timestamp the packets.
+        clock_gettime(CLOCK_REALTIME, &receiveTime);
+
+        for (int i = 0; i < received; i++)
+        {
+            HandleMulticastNeighborSolicit(packets[i], msgs[i].msg_len, sources[i], msgs[i].msg_hdr, receiveTime);
+        }
+
+        VerifyOrExit(received == kMaxNsBatchSize);
+    }
 
-    msghdr.msg_name       = &sin6;
-    msghdr.msg_namelen    = sizeof(sin6);
-    msghdr.msg_iov        = &iovec;
-    msghdr.msg_iovlen     = 1;
-    msghdr.msg_control    = cbuf;
-    msghdr.msg_controllen = sizeof(cbuf);
+exit:
+    return;
+}
 
-    len = recvmsg(mIcmp6RawSock, &msghdr, 0);
+void NdProxyManager::HandleMulticastNeighborSolicit(const uint8_t         *aPacket,
+                                                    size_t                 aLength,
+                                                    const sockaddr_in6    &aSource,
+                                                    struct msghdr         &aMsgHdr,
+                                                    const struct timespec &aReceiveTime)
+{
+    const struct icmp6_hdr *icmp6header;
+    struct cmsghdr         *cmsghdr;
+    otbrError               error       = OTBR_ERROR_NONE;
+    bool                    found       = false;
+    struct timespec         receiveTime = aReceiveTime;
 
-    VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(aLength >= sizeof(struct icmp6_hdr), error = OTBR_ERROR_PARSE);
 
     {
-        Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        const Ip6Address                 &src    = *reinterpret_cast<const Ip6Address *>(&aSource.sin6_addr);
+        const struct nd_neighbor_solicit *ns     = reinterpret_cast<const struct nd_neighbor_solicit *>(aPacket);
+        const Ip6Address                 &target = *reinterpret_cast<const Ip6Address *>(&ns->nd_ns_target);
 
-        icmp6header = reinterpret_cast<icmp6_hdr *>(packet);
+        icmp6header = reinterpret_cast<const icmp6_hdr *>(aPacket);
 
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
+        VerifyOrExit(aLength >= sizeof(struct nd_neighbor_solicit), error = OTBR_ERROR_PARSE);
 
-        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        {
+            otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+        }
 
-        for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
+        for (cmsghdr = CMSG_FIRSTHDR(&aMsgHdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&aMsgHdr, cmsghdr))
         {
+            if (cmsghdr->cmsg_level == SOL_SOCKET && cmsghdr->cmsg_type == SCM_TIMESTAMPNS &&
+                cmsghdr->cmsg_len == CMSG_LEN(sizeof(struct timespec)))
+            {
+                memcpy(&receiveTime, CMSG_DATA(cmsghdr), sizeof(receiveTime));
+                continue;
+            }
+
             if (cmsghdr->cmsg_level != IPPROTO_IPV6)
             {
                 continue;
@@ -202,17 +265,14 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                     Ip6Address         &dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
                     uint32_t            ifindex = pktinfo->ipi6_ifindex;
 
-                    for (const Ip6Address &ipaddr : mNdProxySet)
+                    found = mNdProxySet.find(target) != mNdProxySet.end() &&
+                            target.ToSolicitedNodeMulticastAddress() == dst;
+
+                    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
                     {
-                        if (ipaddr.ToSolicitedNodeMulticastAddress() == dst)
-                        {
-                            found = true;
-                            break;
-                        }
+                        otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(),
+                                     ifindex, found ? "Y" : "N");
                     }
-
-                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(), ifindex,
-                                 found ? "Y" : "N");
                 }
                 break;
 
@@ -223,7 +283,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
                     otbrLogDebug("NdProxyManager: hops=%d (%s)", hops, hops == 255 ? "Good" : "Bad");
 
-                    VerifyOrExit(hops == 255);
+                    VerifyOrExit(hops == 255, error = OTBR_ERROR_PARSE);
                 }
                 break;
             }
@@ -231,18 +291,25 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
         VerifyOrExit(found, error = OTBR_ERROR_NOT_FOUND);
 
-        {
-            struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
-            Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
-
-            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
-                        target.ToString().c_str());
+        otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
+                    target.ToString().c_str());
 
-            SendNeighborAdvertisement(target, src);
+        if (SendNeighborAdvertisement(target, src) == OTBR_ERROR_NONE)
+        {
+            RecordNsToNaLatency(receiveTime);
         }
     }
 
 exit:
+    if (error == OTBR_ERROR_PARSE)
+    {
+        mCounters.mParseErrors++;
+    }
+    else if (error == OTBR_ERROR_NOT_FOUND)
+    {
+        mCounters.mTargetMisses++;
+    }
+
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
@@ -252,13 +319,27 @@ void NdProxyManager::ProcessUnicastNeighborSolicition(void)
     char      packet[kMaxICMP6PacketSize];
     ssize_t   len;
 
-    VerifyOrExit((len = recv(mUnicastNsQueueSock, packet, sizeof(packet), 0)) >= 0, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    // Handle all queued packets so that consecutive packets with the same verdict share one batch verdict.
+    for (uint8_t i = 0; i < kMaxNfQueueMsgsPerWakeup; i++)
+    {
+        len = recv(mUnicastNsQueueSock, packet, sizeof(packet), MSG_DONTWAIT);
 
-    error = OTBR_ERROR_NONE;
+        if (len < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_ERRNO);
+            break;
+        }
+
+        VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    }
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    mVerdictBatcher.Flush();
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("NdProxyManager: %s: %s", __FUNCTION__, otbrErrorString(error));
+    }
 }
 
 void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
@@ -278,29 +359,56 @@ void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEve
     {
         bool isNewInsert = mNdProxySet.insert(target).second;
 
+        if (aEvent == OT_BACKBONE_ROUTER_NDPROXY_ADDED)
+        {
+            mCounters.mDuaAdded++;
+        }
+        else
+        {
+            mCounters.mDuaRenewed++;
+        }
+
         if (isNewInsert)
         {
             JoinSolicitedNodeMulticastGroup(target);
+            UpdateNsFilter();
         }
 
         SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
         break;
     }
     case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
+        mCounters.mDuaRemoved++;
         mNdProxySet.erase(target);
         LeaveSolicitedNodeMulticastGroup(target);
+        UpdateNsFilter();
         break;
     case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
+        mCounters.mDuaCleared++;
         for (const Ip6Address &proxingTarget : mNdProxySet)
         {
             LeaveSolicitedNodeMulticastGroup(proxingTarget);
         }
         mNdProxySet.clear();
+        UpdateNsFilter();
         break;
     }
 }
 
-void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
+void NdProxyManager::UpdateNsFilter(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(IsEnabled());
+
+    // The filter only saves wakeups, received NS messages are still checked against `mNdProxySet`.
+    error = AttachNsFilter(mIcmp6RawSock, std::vector<Ip6Address>(mNdProxySet.begin(), mNdProxySet.end()));
+
+exit:
+    otbrLogResult(error, "NdProxyManager: Update NS filter with %zu targets", mNdProxySet.size());
+}
+
+otbrError NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
 {
     uint8_t                    packet[kMaxICMP6PacketSize];
     uint16_t                   len = 0;
@@ -342,7 +450,45 @@ void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const
                  error = OTBR_ERROR_ERRNO);
 
 exit:
+    if (error == OTBR_ERROR_NONE)
+    {
+        mCounters.mNaSent++;
+    }
+    else
+    {
+        mCounters.mNaFailures++;
+    }
+
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    return error;
+}
+
+void NdProxyManager::RecordNsToNaLatency(const struct timespec &aReceiveTime)
+{
+    struct timespec now;
+    int64_t         latencyUs;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    // Kernel timestamps use the realtime clock, which may step backwards.
+    latencyUs = (static_cast<int64_t>(now.tv_sec) - aReceiveTime.tv_sec) * 1000000 +
+                (static_cast<int64_t>(now.tv_nsec) - aReceiveTime.tv_nsec) / 1000;
+    latencyUs = std::max<int64_t>(latencyUs, 0);
+
+    mNsToNaLatency.Record(static_cast<uint32_t>(std::min<int64_t>(latencyUs, UINT32_MAX)));
+}
+
+void NdProxyManager::GetCounters(NdProxyCounters &aCounters) const
+{
+    aCounters                        = mCounters;
+    aCounters.mMulticastNsReceived   = mMulticastNsCounters.mPackets;
+    aCounters.mProxiedDuas           = static_cast<uint32_t>(mNdProxySet.size());
+    aCounters.mNfQueueVerdicts       = mVerdictBatcher.GetNumVerdicts();
+    aCounters.mNfQueueFailedVerdicts = mVerdictBatcher.GetNumFailedVerdicts();
+    mNsToNaLatency.GetPercentiles(aCounters.mNsToNaLatency);
+
+    // The queue state is left as zero when the queue is not bound.
+    (void)ReadNfQueueStats(aCounters);
 }
 
 otbrError NdProxyManager::UpdateMacAddress(void)
@@ -394,11 +540,23 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops)) == 0,
                  error = OTBR_ERROR_ERRNO);
 
+#ifdef SO_TIMESTAMPNS
+    // Kernel receive timestamps include the time NS messages spent queued, this also makes the kernel timestamp
+    // packets delivered to the netfilter queue.
+    if (setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) != 0)
+    {
+        otbrLogWarning("NdProxyManager: Failed to enable receive timestamps: %s", strerror(errno));
+    }
+#endif
+
     ICMP6_FILTER_SETBLOCKALL(&filter);
     ICMP6_FILTER_SETPASS(ND_NEIGHBOR_SOLICIT, &filter);
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
                  error = OTBR_ERROR_ERRNO);
+
+    UpdateNsFilter();
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -425,8 +583,18 @@ otbrError NdProxyManager::InitNetfilterQueue(void)
     VerifyOrExit(nfq_unbind_pf(mNfqHandler, AF_INET6) >= 0);
     VerifyOrExit(nfq_bind_pf(mNfqHandler, AF_INET6) >= 0);
 
-    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, 88, HandleNetfilterQueue, this)) != nullptr);
-    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, 0xffff) >= 0);
+    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, kNfQueueNum, HandleNetfilterQueue, this)) !=
+                 nullptr);
+    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, kNfQueueCopyRange) >= 0);
+    VerifyOrExit(nfq_set_queue_maxlen(mNfqQueueHandler, kNfQueueMaxLength) >= 0);
+
+    // Accept packets rather than drop them once the queue is full, so that a stalled agent doesn't black-hole the
+    // backbone unicast NS messages. Kernels before 3.6 don't support it.
+    if (nfq_set_queue_flags(mNfqQueueHandler, NFQA_CFG_F_FAIL_OPEN, NFQA_CFG_F_FAIL_OPEN) < 0)
+    {
+        otbrLogWarning("NdProxyManager: Failed to make the netfilter queue fail open");
+    }
+
     VerifyOrExit((mUnicastNsQueueSock = nfq_fd(mNfqHandler)) >= 0);
 
     error = OTBR_ERROR_NONE;
@@ -480,35 +648,52 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
     struct nfqnl_msg_packet_hdr *ph;
     unsigned char               *data;
     uint32_t                     id      = 0;
-    int                          ret     = 0;
     int                          len     = 0;
-    int                          verdict = NF_ACCEPT;
+    uint32_t                     verdict = NF_ACCEPT;
 
     Ip6Address        dst;
     Ip6Address        src;
     struct icmp6_hdr *icmp6header = nullptr;
     struct ip6_hdr   *ip6header   = nullptr;
     otbrError         error       = OTBR_ERROR_NONE;
+    struct timeval    timestamp;
+    struct timespec   receiveTime;
 
-    if ((ph = nfq_get_msg_packet_hdr(aNfData)) != nullptr)
-    {
-        id = ntohl(ph->packet_id);
-        otbrLogDebug("NdProxyManager: %s: id %d", __FUNCTION__, id);
-    }
+    OTBR_UNUSED_VARIABLE(aNfQueueHandler);
+
+    VerifyOrExit((ph = nfq_get_msg_packet_hdr(aNfData)) != nullptr, error = OTBR_ERROR_PARSE);
+    id = ntohl(ph->packet_id);
 
-    VerifyOrExit((len = nfq_get_payload(aNfData, &data)) > 0, error = OTBR_ERROR_PARSE);
+    VerifyOrExit((len = nfq_get_payload(aNfData, &data)) >= static_cast<int>(sizeof(struct ip6_hdr)),
+                 error = OTBR_ERROR_PARSE);
 
     ip6header = reinterpret_cast<struct ip6_hdr *>(data);
     src       = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_src);
     dst       = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_dst);
 
     VerifyOrExit(ip6header->ip6_nxt == IPPROTO_ICMPV6);
+    VerifyOrExit(len >= static_cast<int>(sizeof(struct ip6_hdr) + sizeof(struct nd_neighbor_solicit)),
+                 error = OTBR_ERROR_PARSE);
 
-    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
-                 dst.ToString().c_str());
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
+                     dst.ToString().c_str());
+    }
 
     icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
     VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
+    mCounters.mUnicastNsReceived++;
+
+    if (nfq_get_timestamp(aNfData, &timestamp) == 0)
+    {
+        receiveTime.tv_sec  = timestamp.tv_sec;
+        receiveTime.tv_nsec = timestamp.tv_usec * 1000;
+    }
+    else
+    {
+        clock_gettime(CLOCK_REALTIME, &receiveTime);
+    }
 
     VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
 
@@ -516,20 +701,74 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
         struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
         Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
 
-        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
-                     ip6header->ip6_hlim);
+        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        {
+            otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
+                         ip6header->ip6_hlim);
+        }
         VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
-        SendNeighborAdvertisement(target, src);
+        if (SendNeighborAdvertisement(target, src) == OTBR_ERROR_NONE)
+        {
+            RecordNsToNaLatency(receiveTime);
+        }
         verdict = NF_DROP;
     }
 
 exit:
-    ret = nfq_set_verdict(aNfQueueHandler, id, verdict, len, data);
+    if (error == OTBR_ERROR_PARSE)
+    {
+        mCounters.mParseErrors++;
+    }
+    else if (error == OTBR_ERROR_NOT_FOUND)
+    {
+        mCounters.mTargetMisses++;
+    }
 
-    otbrLogResult(error, "NdProxyManager: %s (nfq_set_verdict id  %d, ret %d verdict %d)", __FUNCTION__, id, ret,
-                  verdict);
+    // The verdict is issued by `ProcessUnicastNeighborSolicition()` together with the following packets.
+    if (ph != nullptr)
+    {
+        mVerdictBatcher.Add(id, verdict);
+    }
+
+    otbrLogDebug("NdProxyManager: %s: id %u, verdict %u: %s", __FUNCTION__, id, verdict, otbrErrorString(error));
+
+    return 0;
+}
+
+otbrError NdProxyManager::ReadNfQueueStats(NdProxyCounters &aCounters) const
+{
+    otbrError error = OTBR_ERROR_NOT_FOUND;
+    FILE     *file  = fopen("/proc/net/netfilter/nfnetlink_queue", "r");
+    unsigned  queueNum;
+    unsigned  peerPortId;
+    unsigned  queueTotal;
+    unsigned  copyMode;
+    unsigned  copyRange;
+    unsigned  queueDropped;
+    unsigned  userDropped;
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+
+    // Each line is: queue number, peer port id, queue length, copy mode, copy range, queue dropped, user dropped,
+    // id sequence and 1.
+    while (fscanf(file, "%u %u %u %u %u %u %u %*u %*d", &queueNum, &peerPortId, &queueTotal, &copyMode, &copyRange,
+                  &queueDropped, &userDropped) == 7)
+    {
+        if (queueNum == kNfQueueNum)
+        {
+            aCounters.mNfQueueLength      = queueTotal;
+            aCounters.mNfQueueDropped     = queueDropped;
+            aCounters.mNfQueueUserDropped = userDropped;
+            ExitNow(error = OTBR_ERROR_NONE);
+        }
+    }
 
-    return ret;
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    return error;
 }
 
 void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
@@ -46,13 +46,16 @@
 #include <libnetfilter_queue/libnetfilter_queue.h>
 #include <map>
 #include <netinet/in.h>
-#include <set>
 #include <string>
+#include <time.h>
+#include <unordered_set>
 #include <utility>
 
 #include <openthread/backbone_router_ftd.h>
 
+#include "backbone_router/nfq_verdict_batcher.hpp"
 #include "common/code_utils.hpp"
+#include "common/latency_histogram.hpp"
 #include "common/mainloop.hpp"
 #include "common/types.hpp"
 #include "ncp/rcp_host.hpp"
@@ -87,6 +90,11 @@ public:
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
         , mNfqQueueHandler(nullptr)
+        , mMulticastNsCounters()
+        , mCounters()
+        , mVerdictBatcher([this](uint32_t aPacketId, uint32_t aVerdict) {
+            return nfq_set_verdict_batch(mNfqQueueHandler, aPacketId, aVerdict);
+        })
     {
     }
 
@@ -131,38 +139,83 @@ public:
      */
     bool IsEnabled(void) const { return mIcmp6RawSock >= 0; }
 
+    /**
+     * This structure represents the counters of multicast Neighbor Solicitation reception.
+     *
+     */
+    struct MulticastNsCounters
+    {
+        uint64_t mWakeups; ///< The number of mainloop wakeups with a readable ICMPv6 socket.
+        uint64_t mPackets; ///< The number of Neighbor Solicitations received.
+    };
+
+    /**
+     * This method returns the counters of multicast Neighbor Solicitation reception.
+     *
+     * @returns The multicast Neighbor Solicitation counters.
+     *
+     */
+    const MulticastNsCounters &GetMulticastNsCounters(void) const { return mMulticastNsCounters; }
+
+    /**
+     * This method gets the ND Proxy counters, including the state of the netfilter queue of unicast Neighbor
+     * Solicitations.
+     *
+     * @param[out] aCounters  The ND Proxy counters.
+     *
+     */
+    void GetCounters(NdProxyCounters &aCounters) const;
+
 private:
     enum
     {
-        kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxICMP6PacketSize      = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxNsBatchSize          = 16,   ///< Max number of NS messages received by one `recvmmsg` call.
+        kMaxNsBatchesPerWakeup   = 8,    ///< Max number of `recvmmsg` calls per mainloop wakeup.
+        kNfQueueNum              = 88,   ///< The netfilter queue of unicast NS messages.
+        kNfQueueMaxLength        = 1024, ///< Max number of packets waiting for a verdict before failing open.
+        kNfQueueCopyRange        = 256,  ///< Max number of packet bytes copied to the agent.
+        kMaxNfQueueMsgsPerWakeup = 64,   ///< Max number of queued packets handled per mainloop wakeup.
     };
 
-    void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    otbrError  SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    void       RecordNsToNaLatency(const struct timespec &aReceiveTime);
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
     void       FiniIcmp6RawSocket(void);
     otbrError  InitNetfilterQueue(void);
     void       FiniNetfilterQueue(void);
     void       ProcessMulticastNeighborSolicition(void);
+    void       HandleMulticastNeighborSolicit(const uint8_t         *aPacket,
+                                              size_t                 aLength,
+                                              const sockaddr_in6    &aSource,
+                                              struct msghdr         &aMsgHdr,
+                                              const struct timespec &aReceiveTime);
+    void       UpdateNsFilter(void);
     void       ProcessUnicastNeighborSolicition(void);
     void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
     void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    otbrError  ReadNfQueueStats(NdProxyCounters &aCounters) const;
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg     *aNfMsg,
                                     struct nfq_data     *aNfData,
                                     void                *aContext);
     int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
 
-    otbr::Ncp::RcpHost  &mHost;
-    std::string          mBackboneInterfaceName;
-    std::set<Ip6Address> mNdProxySet;
-    uint32_t             mBackboneIfIndex;
-    int                  mIcmp6RawSock;
-    int                  mUnicastNsQueueSock;
-    struct nfq_handle   *mNfqHandler;      ///< A pointer to an NFQUEUE handler.
-    struct nfq_q_handle *mNfqQueueHandler; ///< A pointer to a newly created queue.
-    MacAddress           mMacAddress;
-    Ip6Prefix            mDomainPrefix;
+    otbr::Ncp::RcpHost            &mHost;
+    std::string                    mBackboneInterfaceName;
+    std::unordered_set<Ip6Address> mNdProxySet;
+    uint32_t                       mBackboneIfIndex;
+    int                            mIcmp6RawSock;
+    int                            mUnicastNsQueueSock;
+    struct nfq_handle             *mNfqHandler;      ///< A pointer to an NFQUEUE handler.
+    struct nfq_q_handle           *mNfqQueueHandler; ///< A pointer to a newly created queue.
+    MacAddress                     mMacAddress;
+    Ip6Prefix                      mDomainPrefix;
+    MulticastNsCounters            mMulticastNsCounters;
+    NdProxyCounters                mCounters;
+    LatencyHistogram               mNsToNaLatency;
+    NfqVerdictBatcher              mVerdictBatcher;
 };
 
 /**
@@ -0,0 +1,87 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements batching of netfilter queue verdicts.
+ */
+
+#define OTBR_LOG_TAG "NDPROXY"
+
+#include "backbone_router/nfq_verdict_batcher.hpp"
+
+#if OTBR_ENABLE_DUA_ROUTING
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+NfqVerdictBatcher::NfqVerdictBatcher(VerdictHandler aHandler)
+    : mHandler(std::move(aHandler))
+    , mHasPending(false)
+    , mPendingPacketId(0)
+    , mPendingVerdict(0)
+    , mNumVerdicts(0)
+    , mNumFailedVerdicts(0)
+{
+}
+
+void NfqVerdictBatcher::Add(uint32_t aPacketId, uint32_t aVerdict)
+{
+    if (mHasPending && mPendingVerdict != aVerdict)
+    {
+        Flush();
+    }
+
+    mHasPending      = true;
+    mPendingPacketId = aPacketId;
+    mPendingVerdict  = aVerdict;
+}
+
+void NfqVerdictBatcher::Flush(void)
+{
+    VerifyOrExit(mHasPending);
+
+    mHasPending = false;
+    mNumVerdicts++;
+
+    if (mHandler(mPendingPacketId, mPendingVerdict) < 0)
+    {
+        mNumFailedVerdicts++;
+        otbrLogWarning("NdProxyManager: Failed to set verdict %u up to packet %u", mPendingVerdict, mPendingPacketId);
+    }
+
+exit:
+    return;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DUA_ROUTING
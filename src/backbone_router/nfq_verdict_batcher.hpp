@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for batching netfilter queue verdicts.
+ */
+
+#ifndef OTBR_BACKBONE_ROUTER_NFQ_VERDICT_BATCHER_HPP_
+#define OTBR_BACKBONE_ROUTER_NFQ_VERDICT_BATCHER_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_DUA_ROUTING
+
+#include <stdint.h>
+
+#include <functional>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * This class coalesces the verdicts of consecutive queued packets.
+ *
+ * A netfilter queue batch verdict applies to every queued packet whose id is not larger than the given one, so a run
+ * of packets with the same verdict needs a single syscall. The verdict of a run is issued when a packet with another
+ * verdict arrives or when the batch is flushed.
+ *
+ */
+class NfqVerdictBatcher : private NonCopyable
+{
+public:
+    /**
+     * This function issues the verdict of all packets up to @p aPacketId, e.g. with `nfq_set_verdict_batch()`.
+     *
+     * @returns Zero on success, a negative value on failure.
+     *
+     */
+    using VerdictHandler = std::function<int(uint32_t aPacketId, uint32_t aVerdict)>;
+
+    /**
+     * This constructor initializes the batcher.
+     *
+     * @param[in] aHandler  The handler to issue batch verdicts.
+     *
+     */
+    explicit NfqVerdictBatcher(VerdictHandler aHandler);
+
+    /**
+     * This method adds the verdict of a packet.
+     *
+     * Packets must be added in the order they were received.
+     *
+     * @param[in] aPacketId  The id of the packet.
+     * @param[in] aVerdict   The verdict of the packet.
+     *
+     */
+    void Add(uint32_t aPacketId, uint32_t aVerdict);
+
+    /**
+     * This method issues the pending verdict, if any.
+     *
+     */
+    void Flush(void);
+
+    /**
+     * This method returns the number of issued batch verdicts.
+     *
+     * @returns The number of issued batch verdicts.
+     *
+     */
+    uint64_t GetNumVerdicts(void) const { return mNumVerdicts; }
+
+    /**
+     * This method returns the number of batch verdicts which failed to be issued.
+     *
+     * @returns The number of failed batch verdicts.
+     *
+     */
+    uint64_t GetNumFailedVerdicts(void) const { return mNumFailedVerdicts; }
+
+private:
+    VerdictHandler mHandler;
+    bool           mHasPending;
+    uint32_t       mPendingPacketId;
+    uint32_t       mPendingVerdict;
+    uint64_t       mNumVerdicts;
+    uint64_t       mNumFailedVerdicts;
+};
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DUA_ROUTING
+#endif // OTBR_BACKBONE_ROUTER_NFQ_VERDICT_BATCHER_HPP_
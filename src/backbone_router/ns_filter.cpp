@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the socket filter of ND Proxy Neighbor Solicitations.
+ */
+
+#include "backbone_router/ns_filter.hpp"
+
+#if OTBR_ENABLE_DUA_ROUTING
+
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <netinet/ip6.h>
+#include <sys/socket.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+namespace {
+
+// The data of an ICMPv6 raw socket starts at the ICMPv6 header, the IPv6 header is reached through `SKF_NET_OFF`.
+constexpr uint32_t kIcmp6TypeOffset = offsetof(struct icmp6_hdr, icmp6_type);
+constexpr uint32_t kNsTargetOffset  = offsetof(struct nd_neighbor_solicit, nd_ns_target);
+constexpr uint32_t kHopLimitOffset  = static_cast<uint32_t>(SKF_NET_OFF) + offsetof(struct ip6_hdr, ip6_hlim);
+constexpr uint32_t kAccept          = 0xffffffff;
+constexpr uint32_t kDrop            = 0;
+
+struct sock_filter MakeStatement(uint16_t aCode, uint32_t aK)
+{
+    struct sock_filter statement = BPF_STMT(aCode, aK);
+
+    return statement;
+}
+
+struct sock_filter MakeJump(uint16_t aCode, uint32_t aK, uint8_t aJumpTrue, uint8_t aJumpFalse)
+{
+    struct sock_filter jump = BPF_JUMP(aCode, aK, aJumpTrue, aJumpFalse);
+
+    return jump;
+}
+
+} // namespace
+
+void BuildNsFilter(const std::vector<Ip6Address> &aTargets, std::vector<struct sock_filter> &aProgram)
+{
+    static constexpr uint8_t kNumTargetWords = sizeof(Ip6Address) / sizeof(uint32_t);
+
+    aProgram.clear();
+
+    // Jumps of classic BPF are limited to 255 instructions, so every check returns right after itself instead of
+    // jumping to a shared accept or drop statement.
+    aProgram.push_back(MakeStatement(BPF_LD | BPF_B | BPF_ABS, kIcmp6TypeOffset));
+    aProgram.push_back(MakeJump(BPF_JMP | BPF_JEQ | BPF_K, ND_NEIGHBOR_SOLICIT, 1, 0));
+    aProgram.push_back(MakeStatement(BPF_RET | BPF_K, kDrop));
+    aProgram.push_back(MakeStatement(BPF_LD | BPF_B | BPF_ABS, kHopLimitOffset));
+    aProgram.push_back(MakeJump(BPF_JMP | BPF_JEQ | BPF_K, 255, 1, 0));
+    aProgram.push_back(MakeStatement(BPF_RET | BPF_K, kDrop));
+
+    if (aTargets.size() > kMaxNsFilterTargets)
+    {
+        aProgram.push_back(MakeStatement(BPF_RET | BPF_K, kAccept));
+        ExitNow();
+    }
+
+    // For each target, compare the four words of the NS target and accept on a full match, otherwise skip to the
+    // next target. `BPF_ABS` word loads are in host order of the big-endian packet data.
+    for (const Ip6Address &target : aTargets)
+    {
+        for (uint8_t i = 0; i < kNumTargetWords; i++)
+        {
+            const uint8_t *word  = &target.m8[i * sizeof(uint32_t)];
+            uint32_t       value = (static_cast<uint32_t>(word[0]) << 24) | (static_cast<uint32_t>(word[1]) << 16) |
+                             (static_cast<uint32_t>(word[2]) << 8) | static_cast<uint32_t>(word[3]);
+            uint8_t        skip  = static_cast<uint8_t>(2 * (kNumTargetWords - i) - 1);
+
+            aProgram.push_back(MakeStatement(BPF_LD | BPF_W | BPF_ABS, kNsTargetOffset + i * sizeof(uint32_t)));
+            aProgram.push_back(MakeJump(BPF_JMP | BPF_JEQ | BPF_K, value, 0, skip));
+        }
+
+        aProgram.push_back(MakeStatement(BPF_RET | BPF_K, kAccept));
+    }
+
+    aProgram.push_back(MakeStatement(BPF_RET | BPF_K, kDrop));
+
+exit:
+    return;
+}
+
+otbrError AttachNsFilter(int aSocket, const std::vector<Ip6Address> &aTargets)
+{
+    otbrError                       error = OTBR_ERROR_NONE;
+    std::vector<struct sock_filter> program;
+    struct sock_fprog               fprog;
+
+    BuildNsFilter(aTargets, program);
+
+    fprog.len    = static_cast<unsigned short>(program.size());
+    fprog.filter = program.data();
+
+    VerifyOrExit(setsockopt(aSocket, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DUA_ROUTING
@@ -0,0 +1,89 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the socket filter of ND Proxy Neighbor Solicitations.
+ */
+
+#ifndef OTBR_BACKBONE_ROUTER_NS_FILTER_HPP_
+#define OTBR_BACKBONE_ROUTER_NS_FILTER_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_DUA_ROUTING
+
+#include <stddef.h>
+
+#include <vector>
+
+#include <linux/filter.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * The maximum number of targets matched by the Neighbor Solicitation filter.
+ *
+ * Each target takes 9 instructions and a classic BPF program is limited to 4096 instructions. With more targets, the
+ * filter only checks the message type and hop limit.
+ *
+ */
+constexpr size_t kMaxNsFilterTargets = 256;
+
+/**
+ * This function builds a classic BPF program for an ICMPv6 raw socket that accepts only Neighbor Solicitations with
+ * hop limit 255 whose target address is one of @p aTargets.
+ *
+ * @param[in]  aTargets  The proxied target addresses.
+ * @param[out] aProgram  The BPF program.
+ *
+ */
+void BuildNsFilter(const std::vector<Ip6Address> &aTargets, std::vector<struct sock_filter> &aProgram);
+
+/**
+ * This function attaches the Neighbor Solicitation filter of @p aTargets to an ICMPv6 raw socket.
+ *
+ * Attaching replaces the previous filter atomically, so it is safe to call it whenever the targets change.
+ *
+ * @param[in] aSocket   The ICMPv6 raw socket.
+ * @param[in] aTargets  The proxied target addresses.
+ *
+ * @retval OTBR_ERROR_NONE   Successfully attached the filter.
+ * @retval OTBR_ERROR_ERRNO  Failed to attach the filter, `errno` is set.
+ *
+ */
+otbrError AttachNsFilter(int aSocket, const std::vector<Ip6Address> &aTargets);
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DUA_ROUTING
+#endif // OTBR_BACKBONE_ROUTER_NS_FILTER_HPP_
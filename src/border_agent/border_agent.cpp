@@ -38,6 +38,7 @@
 #include <arpa/inet.h>
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <netinet/in.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -70,7 +71,7 @@
 #include "common/types.hpp"
 #include "utils/hex.hpp"
 
-#if !(OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO)
+#if !(OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO || OTBR_ENABLE_MDNS_BUILTIN)
 #error "Border Agent feature requires at least one `OTBR_MDNS` implementation"
 #endif
 
@@ -288,6 +289,7 @@ void BorderAgent::Start(void)
 void BorderAgent::Stop(void)
 {
     otbrLogInfo("Stop Thread Border Agent");
+    CancelMeshCopServiceUpdate();
     UnpublishMeshCopService();
 }
 
@@ -369,6 +371,8 @@ void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
     switch (aState)
     {
     case Mdns::Publisher::State::kReady:
+        // The services registered before are gone when the publisher restarts.
+        mMeshCopServiceHash = 0;
         UpdateMeshCopService();
         break;
     default:
@@ -389,20 +393,19 @@ static uint64_t ConvertTimestampToUint64(const otTimestamp &aTimestamp)
 }
 
 #if OTBR_ENABLE_BORDER_ROUTING
-void AppendOmrTxtEntry(otInstance &aInstance, Mdns::Publisher::TxtList &aTxtList)
+void AppendOmrTxtEntry(otInstance &aInstance, Mdns::Publisher::TxtBuilder &aTxtBuilder)
 {
     otIp6Prefix       omrPrefix;
     otRoutePreference preference;
 
     if (OT_ERROR_NONE == otBorderRoutingGetFavoredOmrPrefix(&aInstance, &omrPrefix, &preference))
     {
-        std::vector<uint8_t> omrData;
+        uint8_t omrData[1 + OT_IP6_PREFIX_SIZE];
+        uint8_t omrPrefixLength = (omrPrefix.mLength + 7) / 8;
 
-        omrData.reserve(1 + OT_IP6_PREFIX_SIZE);
-        omrData.push_back(omrPrefix.mLength);
-        std::copy(omrPrefix.mPrefix.mFields.m8, omrPrefix.mPrefix.mFields.m8 + (omrPrefix.mLength + 7) / 8,
-                  std::back_inserter(omrData));
-        aTxtList.emplace_back("omr", omrData.data(), omrData.size());
+        omrData[0] = omrPrefix.mLength;
+        memcpy(&omrData[1], omrPrefix.mPrefix.mFields.m8, omrPrefixLength);
+        aTxtBuilder.AppendEntry("omr", omrData, 1 + omrPrefixLength);
     }
 }
 #endif
@@ -449,7 +452,7 @@ StateBitmap GetStateBitmap(otInstance &aInstance)
 }
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
-void AppendBbrTxtEntries(otInstance &aInstance, StateBitmap aState, Mdns::Publisher::TxtList &aTxtList)
+void AppendBbrTxtEntries(otInstance &aInstance, StateBitmap aState, Mdns::Publisher::TxtBuilder &aTxtBuilder)
 {
     if (aState.mBbrIsActive)
     {
@@ -457,15 +460,15 @@ void AppendBbrTxtEntries(otInstance &aInstance, StateBitmap aState, Mdns::Publis
         uint16_t               bbrPort = htobe16(BackboneRouter::BackboneAgent::kBackboneUdpPort);
 
         otBackboneRouterGetConfig(&aInstance, &bbrConfig);
-        aTxtList.emplace_back("sq", &bbrConfig.mSequenceNumber, sizeof(bbrConfig.mSequenceNumber));
-        aTxtList.emplace_back("bb", reinterpret_cast<const uint8_t *>(&bbrPort), sizeof(bbrPort));
+        aTxtBuilder.AppendEntry("sq", &bbrConfig.mSequenceNumber, sizeof(bbrConfig.mSequenceNumber));
+        aTxtBuilder.AppendEntry("bb", reinterpret_cast<const uint8_t *>(&bbrPort), sizeof(bbrPort));
     }
 
-    aTxtList.emplace_back("dn", otThreadGetDomainName(&aInstance));
+    aTxtBuilder.AppendEntry("dn", otThreadGetDomainName(&aInstance));
 }
 #endif
 
-void AppendActiveTimestampTxtEntry(otInstance &aInstance, Mdns::Publisher::TxtList &aTxtList)
+void AppendActiveTimestampTxtEntry(otInstance &aInstance, Mdns::Publisher::TxtBuilder &aTxtBuilder)
 {
     otError              error;
     otOperationalDataset activeDataset;
@@ -479,52 +482,65 @@ void AppendActiveTimestampTxtEntry(otInstance &aInstance, Mdns::Publisher::TxtLi
         uint64_t activeTimestampValue = ConvertTimestampToUint64(activeDataset.mActiveTimestamp);
 
         activeTimestampValue = htobe64(activeTimestampValue);
-        aTxtList.emplace_back("at", reinterpret_cast<uint8_t *>(&activeTimestampValue), sizeof(activeTimestampValue));
+        aTxtBuilder.AppendEntry("at", reinterpret_cast<uint8_t *>(&activeTimestampValue),
+                                sizeof(activeTimestampValue));
     }
 }
 
 void AppendVendorTxtEntries(const std::map<std::string, std::vector<uint8_t>> &aVendorEntries,
-                            Mdns::Publisher::TxtList                          &aTxtList)
+                            Mdns::Publisher::TxtBuilder                       &aTxtBuilder)
 {
+    // Vendor entries override standard entries with the same key in place.
     for (const auto &entry : aVendorEntries)
     {
-        const std::string          &key   = entry.first;
-        const std::vector<uint8_t> &value = entry.second;
-        bool                        found = false;
+        aTxtBuilder.SetEntry(entry.first.c_str(), entry.second.data(), entry.second.size());
+    }
+}
 
-        for (auto &addedEntry : aTxtList)
-        {
-            if (addedEntry.mKey == key)
-            {
-                addedEntry.mValue              = value;
-                addedEntry.mIsBooleanAttribute = false;
-                found                          = true;
-                break;
-            }
-        }
-        if (!found)
-        {
-            aTxtList.emplace_back(key.c_str(), value.data(), value.size());
-        }
+static uint64_t Fnv1aHash(uint64_t aHash, const void *aData, size_t aLength)
+{
+    static constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aHash = (aHash ^ static_cast<const uint8_t *>(aData)[i]) * kFnvPrime;
     }
+
+    return aHash;
+}
+
+static uint64_t HashMeshCopService(const std::string              &aInstanceName,
+                                   int                             aPort,
+                                   const Mdns::Publisher::TxtData &aTxtData)
+{
+    static constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+
+    uint64_t hash = kFnvOffsetBasis;
+
+    hash = Fnv1aHash(hash, aInstanceName.data(), aInstanceName.size());
+    hash = Fnv1aHash(hash, &aPort, sizeof(aPort));
+    hash = Fnv1aHash(hash, aTxtData.data(), aTxtData.size());
+
+    // 0 is reserved for an unpublished service.
+    return hash != 0 ? hash : 1;
 }
 
 void BorderAgent::PublishMeshCopService(void)
 {
-    StateBitmap              state;
-    uint32_t                 stateUint32;
-    otInstance              *instance    = mHost.GetInstance();
-    const otExtendedPanId   *extPanId    = otThreadGetExtendedPanId(instance);
-    const otExtAddress      *extAddr     = otLinkGetExtendedAddress(instance);
-    const char              *networkName = otThreadGetNetworkName(instance);
-    Mdns::Publisher::TxtList txtList{{"rv", "1"}};
-    Mdns::Publisher::TxtData txtData;
-    int                      port;
-    otbrError                error;
+    StateBitmap                 state;
+    uint32_t                    stateUint32;
+    otInstance                 *instance    = mHost.GetInstance();
+    const otExtendedPanId      *extPanId    = otThreadGetExtendedPanId(instance);
+    const otExtAddress         *extAddr     = otLinkGetExtendedAddress(instance);
+    const char                 *networkName = otThreadGetNetworkName(instance);
+    Mdns::Publisher::TxtBuilder txtBuilder(mMeshCopTxtData);
+    int                         port;
+    uint64_t                    serviceHash;
+    otbrError                   error;
 
     OTBR_UNUSED_VARIABLE(error);
 
-    otbrLogInfo("Publish meshcop service %s.%s.local.", mServiceInstanceName.c_str(), kBorderAgentServiceType);
+    txtBuilder.AppendEntry("rv", "1");
 
 #if OTBR_ENABLE_PUBLISH_MESHCOP_BA_ID
     {
@@ -534,7 +550,7 @@ void BorderAgent::PublishMeshCopService(void)
         error = otBorderAgentGetId(instance, &id);
         if (error == OT_ERROR_NONE)
         {
-            txtList.emplace_back("id", id.mId, sizeof(id));
+            txtBuilder.AppendEntry("id", id.mId, sizeof(id));
         }
         else
         {
@@ -545,44 +561,44 @@ void BorderAgent::PublishMeshCopService(void)
 
     if (!mVendorOui.empty())
     {
-        txtList.emplace_back("vo", mVendorOui.data(), mVendorOui.size());
+        txtBuilder.AppendEntry("vo", mVendorOui.data(), mVendorOui.size());
     }
     if (!mVendorName.empty())
     {
-        txtList.emplace_back("vn", mVendorName.c_str());
+        txtBuilder.AppendEntry("vn", mVendorName.c_str());
     }
     if (!mProductName.empty())
     {
-        txtList.emplace_back("mn", mProductName.c_str());
+        txtBuilder.AppendEntry("mn", mProductName.c_str());
     }
-    txtList.emplace_back("nn", networkName);
-    txtList.emplace_back("xp", extPanId->m8, sizeof(extPanId->m8));
-    txtList.emplace_back("tv", mHost.GetThreadVersion());
+    txtBuilder.AppendEntry("nn", networkName);
+    txtBuilder.AppendEntry("xp", extPanId->m8, sizeof(extPanId->m8));
+    txtBuilder.AppendEntry("tv", mHost.GetThreadVersion());
 
     // "xa" stands for Extended MAC Address (64-bit) of the Thread Interface of the Border Agent.
-    txtList.emplace_back("xa", extAddr->m8, sizeof(extAddr->m8));
+    txtBuilder.AppendEntry("xa", extAddr->m8, sizeof(extAddr->m8));
     state                 = GetStateBitmap(*instance);
     state.mEpskcSupported = GetEphemeralKeyEnabled();
     stateUint32           = htobe32(state.ToUint32());
-    txtList.emplace_back("sb", reinterpret_cast<uint8_t *>(&stateUint32), sizeof(stateUint32));
+    txtBuilder.AppendEntry("sb", reinterpret_cast<uint8_t *>(&stateUint32), sizeof(stateUint32));
 
     if (state.mThreadIfStatus == kThreadIfStatusActive)
     {
         uint32_t partitionId;
 
-        AppendActiveTimestampTxtEntry(*instance, txtList);
+        AppendActiveTimestampTxtEntry(*instance, txtBuilder);
         partitionId = otThreadGetPartitionId(instance);
-        txtList.emplace_back("pt", reinterpret_cast<uint8_t *>(&partitionId), sizeof(partitionId));
+        txtBuilder.AppendEntry("pt", reinterpret_cast<uint8_t *>(&partitionId), sizeof(partitionId));
     }
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    AppendBbrTxtEntries(*instance, state, txtList);
+    AppendBbrTxtEntries(*instance, state, txtBuilder);
 #endif
 #if OTBR_ENABLE_BORDER_ROUTING
-    AppendOmrTxtEntry(*instance, txtList);
+    AppendOmrTxtEntry(*instance, txtBuilder);
 #endif
 
-    AppendVendorTxtEntries(mMeshCopTxtUpdate, txtList);
+    AppendVendorTxtEntries(mMeshCopTxtUpdate, txtBuilder);
 
     if (otBorderAgentGetState(instance) != OT_BORDER_AGENT_STATE_STOPPED)
     {
@@ -597,11 +613,28 @@ void BorderAgent::PublishMeshCopService(void)
         port = kBorderAgentServiceDummyPort;
     }
 
-    error = Mdns::Publisher::EncodeTxtData(txtList, txtData);
+    error = txtBuilder.Finish();
     assert(error == OTBR_ERROR_NONE);
 
+    serviceHash = HashMeshCopService(mServiceInstanceName, port, mMeshCopTxtData);
+
+    if (serviceHash == mMeshCopServiceHash)
+    {
+        mMeshCopUpdateCounters.mSuppressed++;
+        otbrLogDebug("Meshcop service %s.%s.local. is unchanged", mServiceInstanceName.c_str(),
+                     kBorderAgentServiceType);
+        ExitNow();
+    }
+
+    mMeshCopServiceHash = serviceHash;
+    mMeshCopUpdateCounters.mIssued++;
+
+    otbrLogInfo("Publish meshcop service %s.%s.local. (issued %" PRIu32 ", suppressed %" PRIu32 ")",
+                mServiceInstanceName.c_str(), kBorderAgentServiceType, mMeshCopUpdateCounters.mIssued,
+                mMeshCopUpdateCounters.mSuppressed);
+
     mPublisher.PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentServiceType,
-                              Mdns::Publisher::SubTypeList{}, port, txtData, [this](otbrError aError) {
+                              Mdns::Publisher::SubTypeList{}, port, mMeshCopTxtData, [this](otbrError aError) {
                                   if (aError == OTBR_ERROR_ABORTED)
                                   {
                                       // OTBR_ERROR_ABORTED is thrown when an ongoing service registration is
@@ -615,6 +648,11 @@ void BorderAgent::PublishMeshCopService(void)
                                       otbrLogResult(aError, "Result of publish meshcop service %s.%s.local",
                                                     mServiceInstanceName.c_str(), kBorderAgentServiceType);
                                   }
+                                  if (aError != OTBR_ERROR_NONE && aError != OTBR_ERROR_ABORTED)
+                                  {
+                                      // Make sure the next update publishes the service again.
+                                      mMeshCopServiceHash = 0;
+                                  }
                                   if (aError == OTBR_ERROR_DUPLICATED)
                                   {
                                       // Try to unpublish current service in case we are trying to register
@@ -625,12 +663,17 @@ void BorderAgent::PublishMeshCopService(void)
                                       PublishMeshCopService();
                                   }
                               });
+
+exit:
+    return;
 }
 
 void BorderAgent::UnpublishMeshCopService(void)
 {
     otbrLogInfo("Unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(), kBorderAgentServiceType);
 
+    mMeshCopServiceHash = 0;
+
     mPublisher.UnpublishService(mServiceInstanceName, kBorderAgentServiceType, [this](otbrError aError) {
         otbrLogResult(aError, "Result of unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(),
                       kBorderAgentServiceType);
@@ -639,6 +682,9 @@ void BorderAgent::UnpublishMeshCopService(void)
 
 void BorderAgent::UpdateMeshCopService(void)
 {
+    // This update covers any pending debounced update.
+    CancelMeshCopServiceUpdate();
+
     VerifyOrExit(IsEnabled());
     VerifyOrExit(mPublisher.IsStarted());
     PublishMeshCopService();
@@ -647,6 +693,40 @@ exit:
     return;
 }
 
+void BorderAgent::ScheduleMeshCopServiceUpdate(void)
+{
+    static constexpr uint32_t kDebounceMs = OTBR_MESHCOP_SERVICE_UPDATE_DEBOUNCE_MS;
+
+    if (kDebounceMs == 0)
+    {
+        UpdateMeshCopService();
+        ExitNow();
+    }
+
+    if (mMeshCopUpdateTaskId != 0)
+    {
+        mMeshCopUpdateCounters.mCoalesced++;
+        ExitNow();
+    }
+
+    mMeshCopUpdateTaskId = mTaskRunner.Post(Milliseconds(kDebounceMs), [this]() {
+        mMeshCopUpdateTaskId = 0;
+        UpdateMeshCopService();
+    });
+
+exit:
+    return;
+}
+
+void BorderAgent::CancelMeshCopServiceUpdate(void)
+{
+    if (mMeshCopUpdateTaskId != 0)
+    {
+        mTaskRunner.Cancel(mMeshCopUpdateTaskId);
+        mMeshCopUpdateTaskId = 0;
+    }
+}
+
 #if OTBR_ENABLE_DBUS_SERVER
 void BorderAgent::HandleUpdateVendorMeshCoPTxtEntries(std::map<std::string, std::vector<uint8_t>> aUpdate)
 {
@@ -664,10 +744,11 @@ void BorderAgent::HandleThreadStateChanged(otChangedFlags aFlags)
         otbrLogInfo("Thread is %s", (IsThreadStarted() ? "up" : "down"));
     }
 
+    // Thread state changes come in bursts during partition merges and network data churn, so they are coalesced.
     if (aFlags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_THREAD_NETWORK_NAME |
                   OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE | OT_CHANGED_THREAD_NETDATA))
     {
-        UpdateMeshCopService();
+        ScheduleMeshCopServiceUpdate();
     }
 
 exit:
@@ -43,6 +43,7 @@
 #include "backbone_router/backbone_agent.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
 #include "sdp_proxy/advertising_proxy.hpp"
@@ -61,6 +62,16 @@
 #define OTBR_MESHCOP_SERVICE_INSTANCE_NAME (OTBR_VENDOR_NAME " " OTBR_PRODUCT_NAME)
 #endif
 
+/**
+ * The time in milliseconds to coalesce Thread state changes before the MeshCoP service is republished.
+ *
+ * Set to 0 to republish immediately on every change.
+ *
+ */
+#ifndef OTBR_MESHCOP_SERVICE_UPDATE_DEBOUNCE_MS
+#define OTBR_MESHCOP_SERVICE_UPDATE_DEBOUNCE_MS 500
+#endif
+
 namespace otbr {
 
 /**
@@ -166,12 +177,22 @@ public:
      */
     void AddEphemeralKeyChangedCallback(EphemeralKeyChangedCallback aCallback);
 
+    /**
+     * This method returns the counters of MeshCoP service updates.
+     *
+     * @returns The MeshCoP service update counters.
+     *
+     */
+    const MeshCopUpdateCounters &GetMeshCopUpdateCounters(void) const { return mMeshCopUpdateCounters; }
+
 private:
     void Start(void);
     void Stop(void);
     bool IsEnabled(void) const { return mIsEnabled; }
     void PublishMeshCopService(void);
     void UpdateMeshCopService(void);
+    void ScheduleMeshCopServiceUpdate(void);
+    void CancelMeshCopServiceUpdate(void);
     void UnpublishMeshCopService(void);
 #if OTBR_ENABLE_DBUS_SERVER
     void HandleUpdateVendorMeshCoPTxtEntries(std::map<std::string, std::vector<uint8_t>> aUpdate);
@@ -193,6 +214,13 @@ private:
     bool                mIsEphemeralKeyEnabled;
 
     std::map<std::string, std::vector<uint8_t>> mMeshCopTxtUpdate;
+    Mdns::Publisher::TxtData                    mMeshCopTxtData; // Reused across MeshCoP publishes.
+
+    // The hash of the instance name, port and TXT data of the published MeshCoP service, 0 if it's not published.
+    uint64_t              mMeshCopServiceHash = 0;
+    TaskRunner            mTaskRunner;
+    TaskRunner::TaskId    mMeshCopUpdateTaskId = 0;
+    MeshCopUpdateCounters mMeshCopUpdateCounters;
 
     std::vector<uint8_t> mVendorOui;
 
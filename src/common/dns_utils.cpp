@@ -28,85 +28,146 @@
 
 #include "common/dns_utils.hpp"
 
-#include <assert.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 
-static bool NameEndsWithDot(const std::string &aName)
+static constexpr size_t kTransportLabelLength = 4; // The length of "_tcp" or "_udp".
+
+static inline char ToLowerAscii(char aChar)
 {
-    return !aName.empty() && aName.back() == '.';
+    return (aChar >= 'A' && aChar <= 'Z') ? static_cast<char>(aChar - 'A' + 'a') : aChar;
 }
 
-DnsNameInfo SplitFullDnsName(const std::string &aName)
+static bool IsTransportLabel(const char *aLabel, size_t aLength)
 {
-    size_t      transportPos;
-    DnsNameInfo nameInfo;
-    std::string fullName = aName;
+    return aLength == kTransportLabelLength &&
+           (memcmp(aLabel, "_udp", kTransportLabelLength) == 0 || memcmp(aLabel, "_tcp", kTransportLabelLength) == 0);
+}
+
+bool DnsName::Part::EqualsCaseInsensitive(const Part &aOther) const
+{
+    bool equal = (mLength == aOther.mLength);
 
-    if (!NameEndsWithDot(fullName))
+    for (size_t i = 0; equal && i < mLength; i++)
     {
-        fullName += '.';
+        equal = (ToLowerAscii(mData[i]) == ToLowerAscii(aOther.mData[i]));
     }
 
-    transportPos = fullName.rfind("._udp.");
+    return equal;
+}
+
+bool DnsName::Part::EqualsCaseInsensitive(const char *aString) const
+{
+    return EqualsCaseInsensitive(Part(aString, strlen(aString)));
+}
+
+size_t DnsName::Part::HashCaseInsensitive(void) const
+{
+    // 32-bit FNV-1a, which is good enough for the short names and cheap to compute.
+    uint32_t hash = 2166136261u;
 
-    if (transportPos == std::string::npos)
+    for (size_t i = 0; i < mLength; i++)
     {
-        transportPos = fullName.rfind("._tcp.");
+        hash = (hash ^ static_cast<uint8_t>(ToLowerAscii(mData[i]))) * 16777619u;
     }
 
-    if (transportPos == std::string::npos)
+    return hash;
+}
+
+DnsName::DnsName(const char *aName, size_t aLength)
+{
+    size_t labelStart     = 0;
+    size_t prevLabelStart = 0;
+    size_t firstDot;
+    size_t transport;   // The start of the last transport label preceded by another label.
+    size_t service = 0; // The start of the label preceding the transport label.
+
+    if (aLength > 0 && aName[aLength - 1] == '.')
     {
-        // host.domain or domain
-        size_t dotPos = fullName.find_first_of('.');
+        --aLength;
+    }
 
-        assert(dotPos != std::string::npos);
+    firstDot  = aLength;
+    transport = aLength;
+
+    mFullName = Part(aName, aLength);
+
+    for (size_t i = 0; i <= aLength; i++)
+    {
+        if (i < aLength && aName[i] != '.')
+        {
+            continue;
+        }
 
+        if (labelStart > 0 && IsTransportLabel(aName + labelStart, i - labelStart))
+        {
+            transport = labelStart;
+            service   = prevLabelStart;
+        }
+
+        if (i < firstDot)
+        {
+            firstDot = i;
+        }
+
+        prevLabelStart = labelStart;
+        labelStart     = i + 1;
+    }
+
+    if (transport == aLength)
+    {
         // host.domain
-        nameInfo.mHostName = fullName.substr(0, dotPos);
-        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+        mHostName = Part(aName, firstDot);
+        mDomain   = firstDot < aLength ? Part(aName + firstDot + 1, aLength - firstDot - 1) : Part();
     }
     else
     {
-        // service or service instance
-        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+        size_t domain = transport + kTransportLabelLength + 1;
 
-        nameInfo.mDomain = fullName.substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
+        mDomain      = domain < aLength ? Part(aName + domain, aLength - domain) : Part();
+        mServiceName = Part(aName + service, transport + kTransportLabelLength - service);
 
-        if (dotPos == std::string::npos)
-        {
-            // service.domain
-            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
-        }
-        else
+        if (service > 0)
         {
             // instance.service.domain
-            nameInfo.mInstanceName = fullName.substr(0, dotPos);
-            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+            mInstanceName = Part(aName, service - 1);
         }
     }
+}
 
-    if (!NameEndsWithDot(nameInfo.mDomain))
-    {
-        nameInfo.mDomain += '.';
-    }
+DnsNameInfo DnsName::ToNameInfo(void) const
+{
+    DnsNameInfo nameInfo;
+
+    nameInfo.mInstanceName.assign(mInstanceName.GetData(), mInstanceName.GetLength());
+    nameInfo.mServiceName.assign(mServiceName.GetData(), mServiceName.GetLength());
+    nameInfo.mHostName.assign(mHostName.GetData(), mHostName.GetLength());
+    nameInfo.mDomain.reserve(mDomain.GetLength() + 1);
+    nameInfo.mDomain.assign(mDomain.GetData(), mDomain.GetLength());
+    nameInfo.mDomain += '.';
 
     return nameInfo;
 }
 
+DnsNameInfo SplitFullDnsName(const std::string &aName)
+{
+    return DnsName(aName).ToNameInfo();
+}
+
 otbrError SplitFullServiceInstanceName(const std::string &aFullName,
                                        std::string       &aInstanceName,
                                        std::string       &aType,
                                        std::string       &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError error = OTBR_ERROR_NONE;
+    DnsName   name(aFullName);
 
-    VerifyOrExit(nameInfo.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(name.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aInstanceName = std::move(nameInfo.mInstanceName);
-    aType         = std::move(nameInfo.mServiceName);
-    aDomain       = std::move(nameInfo.mDomain);
+    aInstanceName = name.GetInstanceName().ToString();
+    aType         = name.GetServiceName().ToString();
+    aDomain       = name.GetDomain().ToString() + '.';
 
 exit:
     return error;
@@ -114,13 +175,13 @@ exit:
 
 otbrError SplitFullServiceName(const std::string &aFullName, std::string &aType, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError error = OTBR_ERROR_NONE;
+    DnsName   name(aFullName);
 
-    VerifyOrExit(nameInfo.IsService(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(name.IsService(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aType   = std::move(nameInfo.mServiceName);
-    aDomain = std::move(nameInfo.mDomain);
+    aType   = name.GetServiceName().ToString();
+    aDomain = name.GetDomain().ToString() + '.';
 
 exit:
     return error;
@@ -128,13 +189,13 @@ exit:
 
 otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError error = OTBR_ERROR_NONE;
+    DnsName   name(aFullName);
 
-    VerifyOrExit(nameInfo.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(name.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aHostName = std::move(nameInfo.mHostName);
-    aDomain   = std::move(nameInfo.mDomain);
+    aHostName = name.GetHostName().ToString();
+    aDomain   = name.GetDomain().ToString() + '.';
 
 exit:
     return error;
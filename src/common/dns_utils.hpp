@@ -36,6 +36,10 @@
 
 #include "openthread-br/config.h"
 
+#include <string>
+
+#include <stddef.h>
+
 #include "common/types.hpp"
 
 /**
@@ -76,6 +80,182 @@ struct DnsNameInfo
     bool IsHost(void) const { return mServiceName.empty(); }
 };
 
+/**
+ * This class represents a full DNS name split into name components.
+ *
+ * The name is parsed in a single pass into views over the original characters, so no substring is allocated.
+ * The characters must outlive the `DnsName` object. The components are the same as the ones of `DnsNameInfo`
+ * except that the domain never includes the trailing dot.
+ *
+ * @sa SplitFullDnsName
+ *
+ */
+class DnsName
+{
+public:
+    /**
+     * This class represents a part of a DNS name, which does not own its characters.
+     *
+     */
+    class Part
+    {
+    public:
+        /**
+         * This constructor initializes an empty part.
+         *
+         */
+        Part(void)
+            : mData("")
+            , mLength(0)
+        {
+        }
+
+        /**
+         * This constructor initializes a part.
+         *
+         * @param[in] aData    A pointer to the characters.
+         * @param[in] aLength  The number of characters.
+         *
+         */
+        Part(const char *aData, size_t aLength)
+            : mData(aData)
+            , mLength(aLength)
+        {
+        }
+
+        /**
+         * This method returns a pointer to the characters, which are not null-terminated.
+         *
+         * @returns A pointer to the characters.
+         *
+         */
+        const char *GetData(void) const { return mData; }
+
+        /**
+         * This method returns the number of characters.
+         *
+         * @returns The number of characters.
+         *
+         */
+        size_t GetLength(void) const { return mLength; }
+
+        /**
+         * This method indicates whether the part is empty.
+         *
+         * @returns Whether the part is empty.
+         *
+         */
+        bool IsEmpty(void) const { return mLength == 0; }
+
+        /**
+         * This method copies the part into a string.
+         *
+         * @returns The string.
+         *
+         */
+        std::string ToString(void) const { return std::string(mData, mLength); }
+
+        /**
+         * This method compares the part with another one, ignoring ASCII case.
+         *
+         * @param[in] aOther  The other part.
+         *
+         * @returns Whether the parts are equal.
+         *
+         */
+        bool EqualsCaseInsensitive(const Part &aOther) const;
+
+        /**
+         * This method compares the part with a null-terminated string, ignoring ASCII case.
+         *
+         * @param[in] aString  The string.
+         *
+         * @returns Whether the part and the string are equal.
+         *
+         */
+        bool EqualsCaseInsensitive(const char *aString) const;
+
+        /**
+         * This method hashes the part so that parts equal ignoring ASCII case have the same hash.
+         *
+         * @returns The hash.
+         *
+         */
+        size_t HashCaseInsensitive(void) const;
+
+    private:
+        const char *mData;
+        size_t      mLength;
+    };
+
+    /**
+     * This constructor parses a full DNS name.
+     *
+     * @param[in] aName    A pointer to the characters of the name, with or without the trailing dot.
+     * @param[in] aLength  The number of characters.
+     *
+     */
+    DnsName(const char *aName, size_t aLength);
+
+    /**
+     * This constructor parses a full DNS name.
+     *
+     * @param[in] aName  The name, with or without the trailing dot.
+     *
+     */
+    explicit DnsName(const std::string &aName)
+        : DnsName(aName.data(), aName.size())
+    {
+    }
+
+    explicit DnsName(std::string &&aName) = delete; ///< A temporary string would not outlive the views.
+
+    /**
+     * This method returns if the DNS name is a service instance.
+     *
+     * @returns Whether the DNS name is a service instance.
+     *
+     */
+    bool IsServiceInstance(void) const { return !mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a service.
+     *
+     * @returns Whether the DNS name is a service.
+     *
+     */
+    bool IsService(void) const { return !mServiceName.IsEmpty() && mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a host.
+     *
+     * @returns Whether the DNS name is a host.
+     *
+     */
+    bool IsHost(void) const { return mServiceName.IsEmpty(); }
+
+    const Part &GetFullName(void) const { return mFullName; }         ///< Returns the name without the trailing dot.
+    const Part &GetInstanceName(void) const { return mInstanceName; } ///< Returns the instance name.
+    const Part &GetServiceName(void) const { return mServiceName; }   ///< Returns the service name.
+    const Part &GetHostName(void) const { return mHostName; }         ///< Returns the host name.
+    const Part &GetDomain(void) const { return mDomain; }             ///< Returns the domain without the trailing dot.
+
+    /**
+     * This method copies the name components into a `DnsNameInfo` structure.
+     *
+     * @returns The `DnsNameInfo` structure, whose domain ends with a dot.
+     *
+     */
+    DnsNameInfo ToNameInfo(void) const;
+
+private:
+    Part mFullName;
+    Part mInstanceName;
+    Part mServiceName;
+    Part mHostName;
+    Part mDomain;
+};
+
 /**
  * This method splits a full DNS name into name components.
  *
@@ -0,0 +1,151 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a fixed-bucket latency histogram.
+ */
+
+#include "common/latency_histogram.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+void LatencyHistogram::Clear(void)
+{
+    memset(mBuckets, 0, sizeof(mBuckets));
+    mCount = 0;
+    mMax   = 0;
+}
+
+void LatencyHistogram::Record(uint32_t aLatency)
+{
+    uint32_t &bucket = mBuckets[BucketIndexOf(aLatency)];
+
+    if (bucket != UINT32_MAX)
+    {
+        ++bucket;
+        ++mCount;
+    }
+
+    if (aLatency > mMax)
+    {
+        mMax = aLatency;
+    }
+}
+
+uint32_t LatencyHistogram::GetPercentile(uint8_t aPercent) const
+{
+    uint32_t value = 0;
+    uint64_t target;
+    uint64_t accumulated = 0;
+
+    VerifyOrExit(mCount > 0);
+
+    if (aPercent > 100)
+    {
+        aPercent = 100;
+    }
+
+    // The rank of the sample at `aPercent`, rounded up and at least 1.
+    target = (static_cast<uint64_t>(mCount) * aPercent + 99) / 100;
+    target = (target == 0) ? 1 : target;
+
+    for (uint16_t i = 0; i < kNumBuckets; i++)
+    {
+        accumulated += mBuckets[i];
+
+        if (accumulated >= target)
+        {
+            value = BucketUpperBound(i);
+            break;
+        }
+    }
+
+    if (value > mMax)
+    {
+        value = mMax;
+    }
+
+exit:
+    return value;
+}
+
+void LatencyHistogram::GetPercentiles(LatencyPercentiles &aPercentiles) const
+{
+    aPercentiles.mCount = mCount;
+    aPercentiles.mP50   = GetPercentile(50);
+    aPercentiles.mP90   = GetPercentile(90);
+    aPercentiles.mP99   = GetPercentile(99);
+    aPercentiles.mMax   = mMax;
+}
+
+uint16_t LatencyHistogram::BucketIndexOf(uint32_t aValue)
+{
+    uint16_t index;
+    uint8_t  magnitude = 0;
+
+    VerifyOrExit(aValue >= kLinearLimit, index = static_cast<uint16_t>(aValue));
+
+    for (uint32_t value = aValue; value > 1; value >>= 1)
+    {
+        magnitude++;
+    }
+
+    VerifyOrExit(magnitude < kMaxMagnitude, index = kNumBuckets - 1);
+
+    // `magnitude` >= `kSubBucketBits + 1` here, so the sub-bucket is taken from the
+    // `kSubBucketBits` bits following the most significant bit.
+    index = static_cast<uint16_t>(kLinearLimit + (magnitude - kSubBucketBits - 1) * kSubBucketCount +
+                                  ((aValue >> (magnitude - kSubBucketBits)) & (kSubBucketCount - 1)));
+
+exit:
+    return index;
+}
+
+uint32_t LatencyHistogram::BucketUpperBound(uint16_t aIndex)
+{
+    uint32_t bound;
+    uint16_t offset;
+    uint8_t  shift;
+
+    VerifyOrExit(aIndex >= kLinearLimit, bound = aIndex);
+    VerifyOrExit(aIndex < kNumBuckets - 1, bound = UINT32_MAX);
+
+    offset = aIndex - kLinearLimit;
+    shift  = static_cast<uint8_t>(offset / kSubBucketCount + 1);
+    bound  = ((kSubBucketCount + offset % kSubBucketCount + 1) << shift) - 1;
+
+exit:
+    return bound;
+}
+
+} // namespace otbr
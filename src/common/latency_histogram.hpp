@@ -0,0 +1,131 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a fixed-bucket latency histogram.
+ */
+
+#ifndef OTBR_COMMON_LATENCY_HISTOGRAM_HPP_
+#define OTBR_COMMON_LATENCY_HISTOGRAM_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a fixed-size, HDR-style latency histogram.
+ *
+ * Values below `kLinearLimit` are recorded exactly. Larger values are recorded into
+ * `kSubBucketCount` logarithmic sub-buckets per power of two, which bounds the relative
+ * error of a reported percentile to 1/`kSubBucketCount`. Values beyond the last bucket
+ * are clamped into it, while the exact maximum is tracked separately.
+ *
+ */
+class LatencyHistogram
+{
+public:
+    /**
+     * Default constructor.
+     *
+     */
+    LatencyHistogram(void) { Clear(); }
+
+    /**
+     * This method clears all recorded samples.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method records a latency sample.
+     *
+     * @param[in] aLatency  The latency (in the caller's unit, typically milliseconds).
+     *
+     */
+    void Record(uint32_t aLatency);
+
+    /**
+     * This method returns the number of recorded samples.
+     *
+     * @returns The number of recorded samples.
+     *
+     */
+    uint32_t GetCount(void) const { return mCount; }
+
+    /**
+     * This method returns the maximum recorded sample.
+     *
+     * @returns The maximum recorded sample, or 0 if no samples are recorded.
+     *
+     */
+    uint32_t GetMax(void) const { return mMax; }
+
+    /**
+     * This method returns the value at a given percentile.
+     *
+     * The returned value is the upper bound of the bucket holding the percentile,
+     * capped by the maximum recorded sample.
+     *
+     * @param[in] aPercent  The percentile, in the range [0, 100].
+     *
+     * @returns The value at @p aPercent, or 0 if no samples are recorded.
+     *
+     */
+    uint32_t GetPercentile(uint8_t aPercent) const;
+
+    /**
+     * This method computes the p50/p90/p99/max summary of the histogram.
+     *
+     * @param[out] aPercentiles  A reference to output the summary.
+     *
+     */
+    void GetPercentiles(LatencyPercentiles &aPercentiles) const;
+
+private:
+    static constexpr uint8_t  kSubBucketBits  = 3;
+    static constexpr uint32_t kSubBucketCount = 1u << kSubBucketBits;
+    static constexpr uint32_t kLinearLimit    = 2 * kSubBucketCount;
+    static constexpr uint8_t  kMaxMagnitude   = 20; // Samples >= 2^20 are clamped into the last bucket.
+    static constexpr uint16_t kNumBuckets     = kLinearLimit + (kMaxMagnitude - kSubBucketBits - 1) * kSubBucketCount;
+
+    static uint16_t BucketIndexOf(uint32_t aValue);
+    static uint32_t BucketUpperBound(uint16_t aIndex);
+
+    uint32_t mBuckets[kNumBuckets];
+    uint32_t mCount;
+    uint32_t mMax;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_LATENCY_HISTOGRAM_HPP_
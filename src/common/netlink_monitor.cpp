@@ -0,0 +1,712 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the netlink monitor.
+ */
+
+#if __linux__
+
+#define OTBR_LOG_TAG "NLMON"
+
+#include "common/netlink_monitor.hpp"
+
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+constexpr size_t   NetlinkMonitor::kMaxMessageSize;
+constexpr int      NetlinkMonitor::kReceiveBufferSize;
+constexpr size_t   NetlinkMonitor::kMaxDatagramsPerProcess;
+constexpr uint32_t NetlinkMonitor::kDumpTimeoutMilliseconds;
+constexpr time_t   NetlinkMonitor::kResyncRetrySeconds;
+
+NetlinkMonitor::~NetlinkMonitor(void)
+{
+    Close();
+}
+
+otbrError NetlinkMonitor::Open(void)
+{
+    otbrError   error             = OTBR_ERROR_NONE;
+    int         receiveBufferSize = kReceiveBufferSize;
+    timeval     timeout           = {kDumpTimeoutMilliseconds / 1000, (kDumpTimeoutMilliseconds % 1000) * 1000};
+    sockaddr_nl addr;
+
+    VerifyOrExit(mSocket == -1);
+
+    mSocket = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    VerifyOrExit(mSocket != -1, error = OTBR_ERROR_ERRNO);
+
+    // A full dump of a large route table arrives faster than the mainloop drains it.
+    if (setsockopt(mSocket, SOL_SOCKET, SO_RCVBUF, &receiveBufferSize, sizeof(receiveBufferSize)) != 0)
+    {
+        otbrLogWarning("Failed to set netlink receive buffer size: %s", strerror(errno));
+    }
+
+    // Dumps block until the kernel is done, events are received with `MSG_DONTWAIT`.
+    VerifyOrExit(setsockopt(mSocket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV6_IFADDR | RTMGRP_IPV6_ROUTE;
+    VerifyOrExit(bind(mSocket, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0, error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = Dump());
+
+    otbrLogInfo("Netlink monitor started: %zu links, %zu addresses, %zu routes", mLinks.size(), mAddresses.size(),
+                mRoutes.size());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to open netlink monitor: %s", strerror(errno));
+        Close();
+    }
+
+    return error;
+}
+
+void NetlinkMonitor::Close(void)
+{
+    if (mSocket != -1)
+    {
+        close(mSocket);
+        mSocket = -1;
+    }
+
+    mLinks.clear();
+    mAddresses.clear();
+    mRoutes.clear();
+    mResyncRequired = false;
+}
+
+NetlinkMonitor::SubscriberId NetlinkMonitor::AddLinkSubscriber(LinkCallback aCallback)
+{
+    SubscriberId subscriberId = mNextSubscriberId++;
+
+    mLinkSubscribers.emplace(subscriberId, std::move(aCallback));
+
+    return subscriberId;
+}
+
+NetlinkMonitor::SubscriberId NetlinkMonitor::AddAddressSubscriber(AddressCallback aCallback)
+{
+    SubscriberId subscriberId = mNextSubscriberId++;
+
+    mAddressSubscribers.emplace(subscriberId, std::move(aCallback));
+
+    return subscriberId;
+}
+
+NetlinkMonitor::SubscriberId NetlinkMonitor::AddRouteSubscriber(RouteCallback aCallback)
+{
+    SubscriberId subscriberId = mNextSubscriberId++;
+
+    mRouteSubscribers.emplace(subscriberId, std::move(aCallback));
+
+    return subscriberId;
+}
+
+void NetlinkMonitor::RemoveSubscriber(SubscriberId aSubscriberId)
+{
+    mLinkSubscribers.erase(aSubscriberId);
+    mAddressSubscribers.erase(aSubscriberId);
+    mRouteSubscribers.erase(aSubscriberId);
+}
+
+const NetlinkMonitor::Link *NetlinkMonitor::FindLink(uint32_t aIndex) const
+{
+    auto it = mLinks.find(aIndex);
+
+    return it != mLinks.end() ? &it->second.mObject : nullptr;
+}
+
+const NetlinkMonitor::Link *NetlinkMonitor::FindLink(const char *aName) const
+{
+    const Link *link = nullptr;
+
+    for (const auto &entry : mLinks)
+    {
+        if (entry.second.mObject.mName == aName)
+        {
+            link = &entry.second.mObject;
+            break;
+        }
+    }
+
+    return link;
+}
+
+std::vector<NetlinkMonitor::Address> NetlinkMonitor::GetAddresses(uint32_t aIfIndex) const
+{
+    std::vector<Address> addresses;
+
+    for (auto it = mAddresses.lower_bound(AddressKey(aIfIndex, Ip6Address()));
+         it != mAddresses.end() && std::get<0>(it->first) == aIfIndex; ++it)
+    {
+        addresses.push_back(it->second.mObject);
+    }
+
+    return addresses;
+}
+
+std::vector<NetlinkMonitor::Route> NetlinkMonitor::GetRoutes(uint32_t aTable) const
+{
+    std::vector<Route> routes;
+
+    for (auto it = mRoutes.lower_bound(RouteKey(aTable, Ip6Address(), 0, 0, 0, Ip6Address()));
+         it != mRoutes.end() && std::get<0>(it->first) == aTable; ++it)
+    {
+        routes.push_back(it->second.mObject);
+    }
+
+    return routes;
+}
+
+void NetlinkMonitor::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(mSocket != -1);
+
+    FD_SET(mSocket, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(mSocket, aMainloop.mMaxFd);
+
+    if (mResyncRequired)
+    {
+        timeval retry = {kResyncRetrySeconds, 0};
+
+        if (timercmp(&retry, &aMainloop.mTimeout, <))
+        {
+            aMainloop.mTimeout = retry;
+        }
+    }
+
+exit:
+    return;
+}
+
+void NetlinkMonitor::Process(const MainloopContext &aMainloop)
+{
+    VerifyOrExit(mSocket != -1);
+
+    if (FD_ISSET(mSocket, &aMainloop.mReadFdSet))
+    {
+        for (size_t i = 0; i < kMaxDatagramsPerProcess; i++)
+        {
+            ssize_t length = recv(mSocket, mBuffer, sizeof(mBuffer), MSG_DONTWAIT);
+
+            if (length < 0)
+            {
+                if (errno == ENOBUFS)
+                {
+                    otbrLogWarning("Netlink events were dropped, resynchronizing");
+                    mResyncRequired = true;
+                    continue;
+                }
+
+                if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                {
+                    otbrLogWarning("Failed to receive netlink messages: %s", strerror(errno));
+                }
+
+                break;
+            }
+
+            HandleMessages(mBuffer, static_cast<size_t>(length));
+        }
+    }
+
+    if (mResyncRequired)
+    {
+        Resync();
+    }
+
+exit:
+    return;
+}
+
+void NetlinkMonitor::Resync(void)
+{
+    mResyncRequired = (Dump() != OTBR_ERROR_NONE);
+
+    if (mResyncRequired)
+    {
+        otbrLogWarning("Failed to resynchronize netlink cache: %s", strerror(errno));
+    }
+}
+
+otbrError NetlinkMonitor::Dump(void)
+{
+    otbrError error;
+
+    ++mGeneration;
+
+    SuccessOrExit(error = Dump(RTM_GETLINK));
+    SuccessOrExit(error = Dump(RTM_GETADDR));
+    SuccessOrExit(error = Dump(RTM_GETROUTE));
+
+    // Routes and addresses go before the links they refer to.
+    RemoveStaleObjects(mRoutes, mRouteSubscribers);
+    RemoveStaleObjects(mAddresses, mAddressSubscribers);
+    RemoveStaleObjects(mLinks, mLinkSubscribers);
+
+exit:
+    return error;
+}
+
+otbrError NetlinkMonitor::Dump(uint16_t aType)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    struct
+    {
+        nlmsghdr mHeader;
+        union
+        {
+            ifinfomsg mLink;
+            ifaddrmsg mAddress;
+            rtmsg     mRoute;
+        };
+    } request;
+
+    memset(&request, 0, sizeof(request));
+
+    switch (aType)
+    {
+    case RTM_GETLINK:
+        request.mHeader.nlmsg_len = NLMSG_LENGTH(sizeof(ifinfomsg));
+        request.mLink.ifi_family  = AF_UNSPEC;
+        break;
+    case RTM_GETADDR:
+        request.mHeader.nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
+        request.mAddress.ifa_family = AF_INET6;
+        break;
+    default:
+        request.mHeader.nlmsg_len = NLMSG_LENGTH(sizeof(rtmsg));
+        request.mRoute.rtm_family = AF_INET6;
+        break;
+    }
+
+    request.mHeader.nlmsg_type  = aType;
+    request.mHeader.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.mHeader.nlmsg_seq   = ++mSequence;
+
+    mDumpSequence = request.mHeader.nlmsg_seq;
+    mDumpDone     = false;
+    mDumpError    = 0;
+
+    VerifyOrExit(send(mSocket, &request, request.mHeader.nlmsg_len, 0) != -1, error = OTBR_ERROR_ERRNO);
+
+    // Events received while dumping are applied as usual, the cache converges either way.
+    while (!mDumpDone)
+    {
+        ssize_t length = recv(mSocket, mBuffer, sizeof(mBuffer), 0);
+
+        if (length < 0)
+        {
+            VerifyOrExit(errno == EINTR, error = OTBR_ERROR_ERRNO);
+            continue;
+        }
+
+        HandleMessages(mBuffer, static_cast<size_t>(length));
+    }
+
+    VerifyOrExit(mDumpError == 0, errno = -mDumpError, error = OTBR_ERROR_ERRNO);
+
+exit:
+    mDumpSequence = 0;
+    return error;
+}
+
+void NetlinkMonitor::HandleMessages(const uint8_t *aBuffer, size_t aLength)
+{
+    ssize_t length = static_cast<ssize_t>(aLength);
+
+    for (const nlmsghdr *header = reinterpret_cast<const nlmsghdr *>(aBuffer);
+         NLMSG_OK(header, static_cast<size_t>(length)); header = NLMSG_NEXT(header, length))
+    {
+        switch (header->nlmsg_type)
+        {
+        case RTM_NEWLINK:
+        case RTM_DELLINK:
+            HandleLinkMessage(*header);
+            break;
+        case RTM_NEWADDR:
+        case RTM_DELADDR:
+            HandleAddressMessage(*header);
+            break;
+        case RTM_NEWROUTE:
+        case RTM_DELROUTE:
+            HandleRouteMessage(*header);
+            break;
+        case NLMSG_DONE:
+            if (mDumpSequence != 0 && header->nlmsg_seq == mDumpSequence)
+            {
+                mDumpDone = true;
+            }
+            break;
+        case NLMSG_ERROR:
+        {
+            const nlmsgerr *errMsg = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(header));
+
+            otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
+
+            if (mDumpSequence != 0 && header->nlmsg_seq == mDumpSequence)
+            {
+                mDumpError = errMsg->error;
+                mDumpDone  = true;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+void NetlinkMonitor::HandleLinkMessage(const nlmsghdr &aHeader)
+{
+    const ifinfomsg *ifinfo = reinterpret_cast<const ifinfomsg *>(NLMSG_DATA(&aHeader));
+    Link             link{};
+    int              rtaLength;
+
+    VerifyOrExit(aHeader.nlmsg_len >= NLMSG_LENGTH(sizeof(ifinfomsg)));
+
+    // Bridge port notifications share the link group but don't create or delete links.
+    VerifyOrExit(ifinfo->ifi_family != AF_BRIDGE);
+
+    if (aHeader.nlmsg_type == RTM_DELLINK)
+    {
+        RemoveLink(static_cast<uint32_t>(ifinfo->ifi_index));
+        ExitNow();
+    }
+
+    link.mIndex = static_cast<uint32_t>(ifinfo->ifi_index);
+    link.mFlags = ifinfo->ifi_flags;
+    rtaLength   = static_cast<int>(IFLA_PAYLOAD(&aHeader));
+
+    for (const rtattr *rta = IFLA_RTA(ifinfo); RTA_OK(rta, rtaLength); rta = RTA_NEXT(rta, rtaLength))
+    {
+        switch (rta->rta_type)
+        {
+        case IFLA_IFNAME:
+            link.mName.assign(reinterpret_cast<const char *>(RTA_DATA(rta)),
+                              strnlen(reinterpret_cast<const char *>(RTA_DATA(rta)), RTA_PAYLOAD(rta)));
+            break;
+        case IFLA_MTU:
+            VerifyOrExit(RTA_PAYLOAD(rta) >= sizeof(link.mMtu));
+            memcpy(&link.mMtu, RTA_DATA(rta), sizeof(link.mMtu));
+            break;
+        default:
+            break;
+        }
+    }
+
+    VerifyOrExit(!link.mName.empty());
+
+    if (UpdateObject(mLinks, link.mIndex, link, mLinkSubscribers))
+    {
+        otbrLogInfo("Link %s index %u flags 0x%x mtu %u", link.mName.c_str(), link.mIndex, link.mFlags, link.mMtu);
+    }
+
+exit:
+    return;
+}
+
+void NetlinkMonitor::HandleAddressMessage(const nlmsghdr &aHeader)
+{
+    const ifaddrmsg *ifaddr     = reinterpret_cast<const ifaddrmsg *>(NLMSG_DATA(&aHeader));
+    const rtattr    *addressRta = nullptr;
+    Address          address{};
+    AddressKey       key;
+    bool             changed;
+    int              rtaLength;
+
+    VerifyOrExit(aHeader.nlmsg_len >= NLMSG_LENGTH(sizeof(ifaddrmsg)));
+    VerifyOrExit(ifaddr->ifa_family == AF_INET6);
+
+    address.mIfIndex      = ifaddr->ifa_index;
+    address.mPrefixLength = ifaddr->ifa_prefixlen;
+    address.mScope        = ifaddr->ifa_scope;
+    address.mFlags        = ifaddr->ifa_flags;
+    rtaLength             = static_cast<int>(IFA_PAYLOAD(&aHeader));
+
+    for (const rtattr *rta = IFA_RTA(ifaddr); RTA_OK(rta, rtaLength); rta = RTA_NEXT(rta, rtaLength))
+    {
+        switch (rta->rta_type)
+        {
+        case IFA_LOCAL:
+            // On point-to-point links `IFA_LOCAL` is the local address and `IFA_ADDRESS` is the peer's.
+            addressRta = rta;
+            break;
+        case IFA_ADDRESS:
+            if (addressRta == nullptr)
+            {
+                addressRta = rta;
+            }
+            break;
+        case IFA_FLAGS:
+            VerifyOrExit(RTA_PAYLOAD(rta) >= sizeof(address.mFlags));
+            memcpy(&address.mFlags, RTA_DATA(rta), sizeof(address.mFlags));
+            break;
+        default:
+            break;
+        }
+    }
+
+    VerifyOrExit(addressRta != nullptr && RTA_PAYLOAD(addressRta) >= sizeof(address.mAddress.m8));
+    memcpy(address.mAddress.m8, RTA_DATA(addressRta), sizeof(address.mAddress.m8));
+    key = AddressKey(address.mIfIndex, address.mAddress);
+
+    if (aHeader.nlmsg_type == RTM_NEWADDR)
+    {
+        changed = UpdateObject(mAddresses, key, address, mAddressSubscribers);
+    }
+    else
+    {
+        changed = RemoveObject(mAddresses, key, mAddressSubscribers);
+    }
+
+    if (changed && otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        otbrLogDebug("Address %s/%u on link %u %s", address.mAddress.ToString().c_str(), address.mPrefixLength,
+                     address.mIfIndex, aHeader.nlmsg_type == RTM_NEWADDR ? "updated" : "removed");
+    }
+
+exit:
+    return;
+}
+
+void NetlinkMonitor::HandleRouteMessage(const nlmsghdr &aHeader)
+{
+    const rtmsg *rtm = reinterpret_cast<const rtmsg *>(NLMSG_DATA(&aHeader));
+    Route        route{};
+    bool         changed;
+    int          rtaLength;
+
+    VerifyOrExit(aHeader.nlmsg_len >= NLMSG_LENGTH(sizeof(rtmsg)));
+    VerifyOrExit(rtm->rtm_family == AF_INET6);
+
+    // Cloned routes are per-destination exceptions, there may be one for every peer.
+    VerifyOrExit(!(rtm->rtm_flags & RTM_F_CLONED));
+
+    route.mDestination.mLength = rtm->rtm_dst_len;
+    route.mTable               = rtm->rtm_table;
+    route.mProtocol            = rtm->rtm_protocol;
+    route.mType                = rtm->rtm_type;
+    rtaLength                  = static_cast<int>(RTM_PAYLOAD(&aHeader));
+
+    for (const rtattr *rta = RTM_RTA(rtm); RTA_OK(rta, rtaLength); rta = RTA_NEXT(rta, rtaLength))
+    {
+        switch (rta->rta_type)
+        {
+        case RTA_DST:
+            VerifyOrExit(RTA_PAYLOAD(rta) >= sizeof(route.mDestination.mPrefix.m8));
+            memcpy(route.mDestination.mPrefix.m8, RTA_DATA(rta), sizeof(route.mDestination.mPrefix.m8));
+            break;
+        case RTA_GATEWAY:
+            VerifyOrExit(RTA_PAYLOAD(rta) >= sizeof(route.mGateway.m8));
+            memcpy(route.mGateway.m8, RTA_DATA(rta), sizeof(route.mGateway.m8));
+            break;
+        case RTA_OIF:
+            VerifyOrExit(RTA_PAYLOAD(rta) >= sizeof(route.mIfIndex));
+            memcpy(&route.mIfIndex, RTA_DATA(rta), sizeof(route.mIfIndex));
+            break;
+        case RTA_PRIORITY:
+            VerifyOrExit(RTA_PAYLOAD(rta) >= sizeof(route.mPriority));
+            memcpy(&route.mPriority, RTA_DATA(rta), sizeof(route.mPriority));
+            break;
+        case RTA_TABLE:
+            VerifyOrExit(RTA_PAYLOAD(rta) >= sizeof(route.mTable));
+            memcpy(&route.mTable, RTA_DATA(rta), sizeof(route.mTable));
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (aHeader.nlmsg_type == RTM_NEWROUTE)
+    {
+        changed = UpdateObject(mRoutes, GetRouteKey(route), route, mRouteSubscribers);
+    }
+    else
+    {
+        changed = RemoveObject(mRoutes, GetRouteKey(route), mRouteSubscribers);
+    }
+
+    if (changed && otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        otbrLogDebug("Route %s table %u link %u metric %u %s", route.mDestination.ToString().c_str(), route.mTable,
+                     route.mIfIndex, route.mPriority, aHeader.nlmsg_type == RTM_NEWROUTE ? "updated" : "removed");
+    }
+
+exit:
+    return;
+}
+
+void NetlinkMonitor::RemoveLink(uint32_t aIndex)
+{
+    std::vector<AddressKey> addressKeys;
+    std::vector<RouteKey>   routeKeys;
+
+    VerifyOrExit(mLinks.find(aIndex) != mLinks.end());
+
+    // Kernels do not always report the IPv6 addresses and routes which go away with the link.
+    for (const auto &entry : mAddresses)
+    {
+        if (entry.second.mObject.mIfIndex == aIndex)
+        {
+            addressKeys.push_back(entry.first);
+        }
+    }
+
+    for (const auto &entry : mRoutes)
+    {
+        if (entry.second.mObject.mIfIndex == aIndex)
+        {
+            routeKeys.push_back(entry.first);
+        }
+    }
+
+    for (const RouteKey &key : routeKeys)
+    {
+        RemoveObject(mRoutes, key, mRouteSubscribers);
+    }
+
+    for (const AddressKey &key : addressKeys)
+    {
+        RemoveObject(mAddresses, key, mAddressSubscribers);
+    }
+
+    otbrLogInfo("Link index %u removed", aIndex);
+    RemoveObject(mLinks, aIndex, mLinkSubscribers);
+
+exit:
+    return;
+}
+
+template <typename Key, typename Object, typename Callback>
+bool NetlinkMonitor::UpdateObject(std::map<Key, Entry<Object>>     &aCache,
+                                  const Key                        &aKey,
+                                  const Object                     &aObject,
+                                  std::map<SubscriberId, Callback> &aSubscribers)
+{
+    auto   it      = aCache.find(aKey);
+    Change change  = kAdded;
+    bool   changed = true;
+
+    if (it == aCache.end())
+    {
+        aCache.emplace(aKey, Entry<Object>{aObject, mGeneration});
+    }
+    else
+    {
+        it->second.mGeneration = mGeneration;
+        VerifyOrExit(!(it->second.mObject == aObject), changed = false);
+
+        it->second.mObject = aObject;
+        change             = kChanged;
+    }
+
+    Notify(aSubscribers, change, aObject);
+
+exit:
+    return changed;
+}
+
+template <typename Key, typename Object, typename Callback>
+bool NetlinkMonitor::RemoveObject(std::map<Key, Entry<Object>>     &aCache,
+                                  const Key                        &aKey,
+                                  std::map<SubscriberId, Callback> &aSubscribers)
+{
+    auto   it      = aCache.find(aKey);
+    bool   removed = (it != aCache.end());
+    Object object;
+
+    VerifyOrExit(removed);
+
+    object = std::move(it->second.mObject);
+    aCache.erase(it);
+    Notify(aSubscribers, kRemoved, object);
+
+exit:
+    return removed;
+}
+
+template <typename Key, typename Object, typename Callback>
+void NetlinkMonitor::RemoveStaleObjects(std::map<Key, Entry<Object>>     &aCache,
+                                        std::map<SubscriberId, Callback> &aSubscribers)
+{
+    for (auto it = aCache.begin(); it != aCache.end();)
+    {
+        if (it->second.mGeneration != mGeneration)
+        {
+            Object object = std::move(it->second.mObject);
+
+            it = aCache.erase(it);
+            Notify(aSubscribers, kRemoved, object);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+template <typename Callback, typename Object>
+void NetlinkMonitor::Notify(std::map<SubscriberId, Callback> &aSubscribers, Change aChange, const Object &aObject)
+{
+    // Callbacks may add or remove subscribers, so look up the next one after each call.
+    for (auto it = aSubscribers.begin(); it != aSubscribers.end();)
+    {
+        SubscriberId subscriberId = it->first;
+        Callback     callback     = it->second;
+
+        callback(aChange, aObject);
+        it = aSubscribers.upper_bound(subscriberId);
+    }
+}
+
+NetlinkMonitor::RouteKey NetlinkMonitor::GetRouteKey(const Route &aRoute)
+{
+    return RouteKey(aRoute.mTable, aRoute.mDestination.mPrefix, aRoute.mDestination.mLength, aRoute.mPriority,
+                    aRoute.mIfIndex, aRoute.mGateway);
+}
+
+} // namespace otbr
+
+#endif // __linux__
@@ -0,0 +1,350 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the netlink monitor shared by modules that track kernel links, addresses and
+ *   routes.
+ */
+
+#ifndef OTBR_COMMON_NETLINK_MONITOR_HPP_
+#define OTBR_COMMON_NETLINK_MONITOR_HPP_
+
+#include "openthread-br/config.h"
+
+#if __linux__
+
+#include <stdint.h>
+#include <time.h>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/types.hpp"
+
+struct nlmsghdr;
+
+namespace otbr {
+
+/**
+ * This class implements a netlink monitor which mirrors the kernel links, IPv6 addresses and IPv6 routes.
+ *
+ * A single NETLINK_ROUTE socket subscribed to the link, IPv6 address and IPv6 route multicast groups is shared by all
+ * modules. The monitor dumps the kernel tables when opened, keeps them in memory and notifies subscribers of typed
+ * changes from the mainloop. If the kernel drops events because the socket buffer overflowed, the tables are dumped
+ * again and only the differences are reported.
+ *
+ * Memory use is dominated by the route cache. On a 64-bit target each cached route costs about 160 bytes including
+ * the map node, so a full IPv6 Internet table of 200,000 routes needs about 30 MiB, and the initial dump of such a
+ * table blocks the caller for the time the kernel takes to produce it. Cloned (cache) routes are not tracked. Links
+ * and addresses cost about 100 bytes each.
+ *
+ */
+class NetlinkMonitor : public MainloopProcessor, private NonCopyable
+{
+public:
+    /**
+     * This enumeration represents the kind of change reported to subscribers.
+     *
+     */
+    enum Change : uint8_t
+    {
+        kAdded,   ///< The object was added.
+        kChanged, ///< The object was updated in place.
+        kRemoved, ///< The object was removed.
+    };
+
+    /**
+     * This structure represents a network link.
+     *
+     */
+    struct Link
+    {
+        uint32_t    mIndex; ///< The interface index.
+        std::string mName;  ///< The interface name.
+        uint32_t    mFlags; ///< The `IFF_*` flags.
+        uint32_t    mMtu;   ///< The MTU.
+
+        bool operator==(const Link &aOther) const
+        {
+            return mIndex == aOther.mIndex && mName == aOther.mName && mFlags == aOther.mFlags && mMtu == aOther.mMtu;
+        }
+    };
+
+    /**
+     * This structure represents an IPv6 address assigned to a link.
+     *
+     */
+    struct Address
+    {
+        uint32_t   mIfIndex;      ///< The index of the link the address is assigned to.
+        Ip6Address mAddress;      ///< The IPv6 address.
+        uint8_t    mPrefixLength; ///< The prefix length.
+        uint8_t    mScope;        ///< The `RT_SCOPE_*` scope.
+        uint32_t   mFlags;        ///< The `IFA_F_*` flags.
+
+        bool operator==(const Address &aOther) const
+        {
+            return mIfIndex == aOther.mIfIndex && mAddress == aOther.mAddress &&
+                   mPrefixLength == aOther.mPrefixLength && mScope == aOther.mScope && mFlags == aOther.mFlags;
+        }
+    };
+
+    /**
+     * This structure represents an IPv6 route.
+     *
+     */
+    struct Route
+    {
+        Ip6Prefix  mDestination; ///< The destination prefix.
+        Ip6Address mGateway;     ///< The gateway, unspecified for on-link routes.
+        uint32_t   mIfIndex;     ///< The output interface index, zero if none.
+        uint32_t   mTable;       ///< The routing table.
+        uint32_t   mPriority;    ///< The route metric.
+        uint8_t    mProtocol;    ///< The `RTPROT_*` protocol which installed the route.
+        uint8_t    mType;        ///< The `RTN_*` route type.
+
+        bool operator==(const Route &aOther) const
+        {
+            return mDestination == aOther.mDestination && mGateway == aOther.mGateway && mIfIndex == aOther.mIfIndex &&
+                   mTable == aOther.mTable && mPriority == aOther.mPriority && mProtocol == aOther.mProtocol &&
+                   mType == aOther.mType;
+        }
+    };
+
+    using SubscriberId    = uint64_t;
+    using LinkCallback    = std::function<void(Change aChange, const Link &aLink)>;
+    using AddressCallback = std::function<void(Change aChange, const Address &aAddress)>;
+    using RouteCallback   = std::function<void(Change aChange, const Route &aRoute)>;
+
+    /**
+     * This method returns the netlink monitor shared by the process.
+     *
+     */
+    static NetlinkMonitor &GetInstance(void)
+    {
+        static NetlinkMonitor sNetlinkMonitor;
+        return sNetlinkMonitor;
+    }
+
+    /**
+     * This constructor initializes a netlink monitor which is not yet connected to the kernel.
+     *
+     */
+    NetlinkMonitor(void) = default;
+
+    /**
+     * This destructor closes the netlink socket.
+     *
+     */
+    ~NetlinkMonitor(void) override;
+
+    /**
+     * This method opens the netlink socket and dumps the current kernel tables into the cache.
+     *
+     * Subscribers registered before this call are notified of every dumped object as added. Calling this method on an
+     * opened monitor does nothing.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully opened the monitor.
+     * @retval OTBR_ERROR_ERRNO  Failed to open the socket or to dump the kernel tables.
+     *
+     */
+    otbrError Open(void);
+
+    /**
+     * This method closes the netlink socket and clears the cache without notifying subscribers.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method indicates whether the monitor is connected to the kernel.
+     *
+     */
+    bool IsOpen(void) const { return mSocket != -1; }
+
+    /**
+     * This method subscribes to link changes.
+     *
+     * Callbacks are invoked from the mainloop. They may add or remove subscribers.
+     *
+     * @param[in] aCallback  The callback to invoke for each link change.
+     *
+     * @returns  The Subscriber ID for the callback.
+     *
+     */
+    SubscriberId AddLinkSubscriber(LinkCallback aCallback);
+
+    /**
+     * This method subscribes to IPv6 address changes.
+     *
+     * @param[in] aCallback  The callback to invoke for each address change.
+     *
+     * @returns  The Subscriber ID for the callback.
+     *
+     */
+    SubscriberId AddAddressSubscriber(AddressCallback aCallback);
+
+    /**
+     * This method subscribes to IPv6 route changes.
+     *
+     * @param[in] aCallback  The callback to invoke for each route change.
+     *
+     * @returns  The Subscriber ID for the callback.
+     *
+     */
+    SubscriberId AddRouteSubscriber(RouteCallback aCallback);
+
+    /**
+     * This method cancels a subscription.
+     *
+     * @param[in] aSubscriberId  The Subscriber ID previously returned by one of the `Add*Subscriber()` methods.
+     *
+     */
+    void RemoveSubscriber(SubscriberId aSubscriberId);
+
+    /**
+     * This method looks up a cached link by its index.
+     *
+     * @param[in] aIndex  The interface index.
+     *
+     * @returns  A pointer to the link, or nullptr if there is no such link.
+     *
+     */
+    const Link *FindLink(uint32_t aIndex) const;
+
+    /**
+     * This method looks up a cached link by its name.
+     *
+     * @param[in] aName  The interface name.
+     *
+     * @returns  A pointer to the link, or nullptr if there is no such link.
+     *
+     */
+    const Link *FindLink(const char *aName) const;
+
+    /**
+     * This method returns the cached IPv6 addresses assigned to a link.
+     *
+     * @param[in] aIfIndex  The interface index.
+     *
+     */
+    std::vector<Address> GetAddresses(uint32_t aIfIndex) const;
+
+    /**
+     * This method returns the cached IPv6 routes of a routing table.
+     *
+     * @param[in] aTable  The routing table, e.g. `RT_TABLE_MAIN`.
+     *
+     */
+    std::vector<Route> GetRoutes(uint32_t aTable) const;
+
+    /**
+     * This method applies a buffer of netlink messages to the cache and notifies subscribers.
+     *
+     * This is what the monitor does with each datagram it receives. It is public so that captured netlink traffic
+     * can be replayed.
+     *
+     * @param[in] aBuffer  A pointer to the netlink messages.
+     * @param[in] aLength  The length of @p aBuffer in bytes.
+     *
+     */
+    void HandleMessages(const uint8_t *aBuffer, size_t aLength);
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
+private:
+    static constexpr size_t   kMaxMessageSize          = 32768;
+    static constexpr int      kReceiveBufferSize       = 1024 * 1024;
+    static constexpr size_t   kMaxDatagramsPerProcess  = 64;
+    static constexpr uint32_t kDumpTimeoutMilliseconds = 1000;
+    static constexpr time_t   kResyncRetrySeconds      = 1;
+
+    // Cached objects are tagged with the generation of the last dump or event that reported them, so that objects
+    // which are gone after a resync can be found.
+    template <typename Object> struct Entry
+    {
+        Object   mObject;
+        uint32_t mGeneration;
+    };
+
+    using AddressKey = std::tuple<uint32_t, Ip6Address>;
+    using RouteKey   = std::tuple<uint32_t, Ip6Address, uint8_t, uint32_t, uint32_t, Ip6Address>;
+
+    static RouteKey GetRouteKey(const Route &aRoute);
+
+    otbrError Dump(void);
+    otbrError Dump(uint16_t aType);
+    void      Resync(void);
+    void      HandleLinkMessage(const nlmsghdr &aHeader);
+    void      HandleAddressMessage(const nlmsghdr &aHeader);
+    void      HandleRouteMessage(const nlmsghdr &aHeader);
+    void      RemoveLink(uint32_t aIndex);
+
+    template <typename Key, typename Object, typename Callback>
+    bool UpdateObject(std::map<Key, Entry<Object>>     &aCache,
+                      const Key                        &aKey,
+                      const Object                     &aObject,
+                      std::map<SubscriberId, Callback> &aSubscribers);
+    template <typename Key, typename Object, typename Callback>
+    bool RemoveObject(std::map<Key, Entry<Object>>     &aCache,
+                      const Key                        &aKey,
+                      std::map<SubscriberId, Callback> &aSubscribers);
+    template <typename Key, typename Object, typename Callback>
+    void RemoveStaleObjects(std::map<Key, Entry<Object>> &aCache, std::map<SubscriberId, Callback> &aSubscribers);
+    template <typename Callback, typename Object>
+    static void Notify(std::map<SubscriberId, Callback> &aSubscribers, Change aChange, const Object &aObject);
+
+    int                                     mSocket           = -1;
+    uint32_t                                mSequence         = 0;
+    uint32_t                                mDumpSequence     = 0;
+    bool                                    mDumpDone         = false;
+    int                                     mDumpError        = 0;
+    bool                                    mResyncRequired   = false;
+    uint32_t                                mGeneration       = 0;
+    SubscriberId                            mNextSubscriberId = 1;
+    std::map<uint32_t, Entry<Link>>         mLinks;
+    std::map<AddressKey, Entry<Address>>    mAddresses;
+    std::map<RouteKey, Entry<Route>>        mRoutes;
+    std::map<SubscriberId, LinkCallback>    mLinkSubscribers;
+    std::map<SubscriberId, AddressCallback> mAddressSubscribers;
+    std::map<SubscriberId, RouteCallback>   mRouteSubscribers;
+    uint8_t                                 mBuffer[kMaxMessageSize];
+};
+
+} // namespace otbr
+
+#endif // __linux__
+
+#endif // OTBR_COMMON_NETLINK_MONITOR_HPP_
@@ -39,6 +39,7 @@
 #include <netinet/in.h>
 #include <stdint.h>
 #include <string.h>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -507,6 +508,32 @@ struct MdnsResponseCounters
     uint32_t mInvalidState;   ///< The number of 'invalid state' responses
 };
 
+/**
+ * This structure represents a percentile summary of a latency distribution.
+ *
+ */
+struct LatencyPercentiles
+{
+    uint32_t mCount; ///< The number of samples
+    uint32_t mP50;   ///< The 50th percentile latency in milliseconds
+    uint32_t mP90;   ///< The 90th percentile latency in milliseconds
+    uint32_t mP99;   ///< The 99th percentile latency in milliseconds
+    uint32_t mMax;   ///< The maximum latency in milliseconds
+};
+
+/**
+ * This structure represents the latency percentiles of mDNS operations.
+ *
+ */
+struct MdnsLatencyPercentiles
+{
+    LatencyPercentiles mHostRegistration;    ///< The latency percentiles of host registrations
+    LatencyPercentiles mKeyRegistration;     ///< The latency percentiles of key registrations
+    LatencyPercentiles mServiceRegistration; ///< The latency percentiles of service registrations
+    LatencyPercentiles mHostResolution;      ///< The latency percentiles of host resolutions
+    LatencyPercentiles mServiceResolution;   ///< The latency percentiles of service resolutions
+};
+
 struct MdnsTelemetryInfo
 {
     static constexpr uint32_t kEmaFactorNumerator   = 1;
@@ -527,6 +554,76 @@ struct MdnsTelemetryInfo
     uint32_t mServiceRegistrationEmaLatency; ///< The EMA latency of service registrations in milliseconds
     uint32_t mHostResolutionEmaLatency;      ///< The EMA latency of host resolutions in milliseconds
     uint32_t mServiceResolutionEmaLatency;   ///< The EMA latency of service resolutions in milliseconds
+
+    MdnsLatencyPercentiles mLatencyPercentiles; ///< The latency percentiles of all operations
+};
+
+/**
+ * This structure represents the counters of the SRP Advertising Proxy.
+ *
+ */
+struct AdvertisingProxyCounters
+{
+    uint32_t           mQueuedUpdates;     ///< The number of updates waiting for an in-flight slot
+    uint32_t           mInFlightUpdates;   ///< The number of updates being advertised
+    uint32_t           mCompletedUpdates;  ///< The number of updates advertised successfully
+    uint32_t           mFailedUpdates;     ///< The number of updates failed to be advertised
+    uint32_t           mExpiredUpdates;    ///< The number of updates timed out by the SRP server before completion
+    LatencyPercentiles mUpdateLatency;     ///< The latency percentiles from receiving to completing an update
+    uint32_t           mRepublishDuration; ///< The duration of the last full republish in milliseconds
+    uint32_t           mRepublishMaxStall; ///< The longest mainloop stall of the last full republish in microseconds
+    uint32_t           mIssuedPublishes;   ///< The number of host and service (un)publishes issued to mDNS
+    uint32_t           mSkippedPublishes;  ///< The number of host and service (un)publishes skipped as unchanged
+};
+
+/**
+ * This structure represents the counters of the Backbone Router ND Proxy.
+ *
+ */
+struct NdProxyCounters
+{
+    uint64_t           mMulticastNsReceived;   ///< The number of multicast Neighbor Solicitations received
+    uint64_t           mUnicastNsReceived;     ///< The number of unicast Neighbor Solicitations received from NFQUEUE
+    uint64_t           mNaSent;                ///< The number of Neighbor Advertisements sent
+    uint64_t           mNaFailures;            ///< The number of Neighbor Advertisements failed to be sent
+    uint64_t           mParseErrors;           ///< The number of malformed Neighbor Solicitations
+    uint64_t           mTargetMisses;          ///< The number of Neighbor Solicitations for a target not being proxied
+    uint32_t           mProxiedDuas;           ///< The number of DUAs being proxied
+    uint32_t           mDuaAdded;              ///< The number of DUA registrations
+    uint32_t           mDuaRenewed;            ///< The number of DUA registration renewals
+    uint32_t           mDuaRemoved;            ///< The number of DUA removals
+    uint32_t           mDuaCleared;            ///< The number of times all DUAs were cleared
+    LatencyPercentiles mNsToNaLatency;         ///< The latency percentiles from receiving a NS to sending the NA in us
+    uint32_t           mNfQueueLength;         ///< The number of unicast Neighbor Solicitations waiting for a verdict
+    uint32_t           mNfQueueDropped;        ///< The number of unicast NS dropped as NFQUEUE was full
+    uint32_t           mNfQueueUserDropped;    ///< The number of unicast NS which NFQUEUE failed to pass to the agent
+    uint64_t           mNfQueueVerdicts;       ///< The number of batch verdicts issued to NFQUEUE
+    uint64_t           mNfQueueFailedVerdicts; ///< The number of batch verdicts failed to be issued
+};
+
+/**
+ * This structure represents the counters of the TUN packet path between the host and the NCP.
+ *
+ */
+struct TunCounters
+{
+    uint64_t mTxPackets; ///< The number of packets forwarded from the host to the NCP
+    uint64_t mTxBytes;   ///< The number of bytes forwarded from the host to the NCP
+    uint64_t mTxDrops;   ///< The number of packets from the host dropped as the NCP could not accept them
+    uint64_t mRxPackets; ///< The number of packets forwarded from the NCP to the host
+    uint64_t mRxBytes;   ///< The number of bytes forwarded from the NCP to the host
+    uint64_t mRxDrops;   ///< The number of packets from the NCP dropped as the TUN queue could not accept them
+};
+
+/**
+ * This structure represents the counters of the Border Agent MeshCoP service updates.
+ *
+ */
+struct MeshCopUpdateCounters
+{
+    uint32_t mIssued     = 0; ///< The number of times the MeshCoP service was (re)published
+    uint32_t mSuppressed = 0; ///< The number of updates skipped because the service was unchanged
+    uint32_t mCoalesced  = 0; ///< The number of Thread state changes merged into a pending update
 };
 
 static constexpr size_t kVendorOuiLength      = 3;
@@ -545,4 +642,33 @@ otError OtbrErrorToOtError(otbrError aError);
 
 } // namespace otbr
 
+namespace std {
+
+/**
+ * This structure hashes an Ip6 address, so that it can be used as key of unordered containers.
+ *
+ */
+template <> struct hash<otbr::Ip6Address>
+{
+    size_t operator()(const otbr::Ip6Address &aAddress) const
+    {
+        // Addresses of a set usually share the prefix, so the interface identifier half is mixed in as well.
+        return std::hash<uint64_t>()(aAddress.m64[0] ^ (aAddress.m64[1] * 0x9e3779b97f4a7c15ULL));
+    }
+};
+
+/**
+ * This structure hashes an Ip6 address info by its address, so that it can be used as key of unordered containers.
+ *
+ */
+template <> struct hash<otbr::Ip6AddressInfo>
+{
+    size_t operator()(const otbr::Ip6AddressInfo &aAddressInfo) const
+    {
+        return std::hash<otbr::Ip6Address>()(otbr::Ip6Address(aAddressInfo.mAddress));
+    }
+};
+
+} // namespace std
+
 #endif // OTBR_COMMON_TYPES_HPP_
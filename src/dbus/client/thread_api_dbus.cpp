@@ -676,11 +676,47 @@ ClientError ThreadApiDBus::GetTrelInfo(TrelInfo &aTrelInfo)
 }
 #endif
 
+#if OTBR_ENABLE_TREL_PROBING
+ClientError ThreadApiDBus::GetTrelPeerStats(std::vector<TrelPeerStats> &aStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_TREL_PEER_STATS, aStats);
+}
+#endif
+
 ClientError ThreadApiDBus::GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetryInfo)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO, aMdnsTelemetryInfo);
 }
 
+ClientError ThreadApiDBus::GetMdnsLatencyPercentiles(MdnsLatencyPercentiles &aPercentiles)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MDNS_LATENCY_PERCENTILES, aPercentiles);
+}
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+ClientError ThreadApiDBus::GetAdvertisingProxyCounters(AdvertisingProxyCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_ADVERTISING_PROXY_COUNTERS, aCounters);
+}
+#endif
+
+#if OTBR_ENABLE_DUA_ROUTING
+ClientError ThreadApiDBus::GetNdProxyCounters(NdProxyCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_ND_PROXY_COUNTERS, aCounters);
+}
+#endif
+
+ClientError ThreadApiDBus::GetTunCounters(TunCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_TUN_COUNTERS, aCounters);
+}
+
+ClientError ThreadApiDBus::GetMeshCopUpdateCounters(MeshCopUpdateCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MESHCOP_UPDATE_COUNTERS, aCounters);
+}
+
 ClientError ThreadApiDBus::GetNat64State(Nat64ComponentState &aState)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_NAT64_STATE, aState);
@@ -807,6 +807,20 @@ public:
     ClientError GetTrelInfo(TrelInfo &aTrelInfo);
 #endif
 
+#if OTBR_ENABLE_TREL_PROBING
+    /**
+     * This method gets the probing statistics of the TREL peer addresses.
+     *
+     * @param[out] aStats  The probing statistics of the TREL peer addresses.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetTrelPeerStats(std::vector<TrelPeerStats> &aStats);
+#endif
+
     /**
      * This method gets the MDNS telemetry information.
      *
@@ -819,6 +833,70 @@ public:
      */
     ClientError GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetryInfo);
 
+    /**
+     * This method gets the latency percentiles of MDNS operations.
+     *
+     * @param[out] aPercentiles  The latency percentiles of MDNS operations.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetMdnsLatencyPercentiles(MdnsLatencyPercentiles &aPercentiles);
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This method gets the SRP Advertising Proxy counters.
+     *
+     * @param[out] aCounters  The SRP Advertising Proxy counters.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetAdvertisingProxyCounters(AdvertisingProxyCounters &aCounters);
+#endif
+
+#if OTBR_ENABLE_DUA_ROUTING
+    /**
+     * This method gets the Backbone Router ND Proxy counters.
+     *
+     * @param[out] aCounters  The ND Proxy counters.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetNdProxyCounters(NdProxyCounters &aCounters);
+#endif
+
+    /**
+     * This method gets the counters of the TUN packet path between the host and the NCP.
+     *
+     * @param[out] aCounters  The TUN counters.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetTunCounters(TunCounters &aCounters);
+
+    /**
+     * This method gets the counters of the Border Agent MeshCoP service updates.
+     *
+     * @param[out] aCounters  The MeshCoP service update counters.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetMeshCopUpdateCounters(MeshCopUpdateCounters &aCounters);
+
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     /**
      * This method gets the DNS-SD counters.
@@ -102,6 +102,7 @@
 #define OTBR_DBUS_PROPERTY_RADIO_REGION "RadioRegion"
 #define OTBR_DBUS_PROPERTY_SRP_SERVER_INFO "SrpServerInfo"
 #define OTBR_DBUS_PROPERTY_TREL_INFO "TrelInfo"
+#define OTBR_DBUS_PROPERTY_TREL_PEER_STATS "TrelPeerStats"
 #define OTBR_DBUS_PROPERTY_DNSSD_COUNTERS "DnssdCounters"
 #define OTBR_DBUS_PROPERTY_OTBR_VERSION "OtbrVersion"
 #define OTBR_DBUS_PROPERTY_OT_HOST_VERSION "OtHostVersion"
@@ -109,6 +110,11 @@
 #define OTBR_DBUS_PROPERTY_THREAD_VERSION "ThreadVersion"
 #define OTBR_DBUS_PROPERTY_EUI64 "Eui64"
 #define OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO "MdnsTelemetryInfo"
+#define OTBR_DBUS_PROPERTY_MDNS_LATENCY_PERCENTILES "MdnsLatencyPercentiles"
+#define OTBR_DBUS_PROPERTY_ADVERTISING_PROXY_COUNTERS "AdvertisingProxyCounters"
+#define OTBR_DBUS_PROPERTY_ND_PROXY_COUNTERS "NdProxyCounters"
+#define OTBR_DBUS_PROPERTY_TUN_COUNTERS "TunCounters"
+#define OTBR_DBUS_PROPERTY_MESHCOP_UPDATE_COUNTERS "MeshCopUpdateCounters"
 #define OTBR_DBUS_PROPERTY_RADIO_SPINEL_METRICS "RadioSpinelMetrics"
 #define OTBR_DBUS_PROPERTY_RCP_INTERFACE_METRICS "RcpInterfaceMetrics"
 #define OTBR_DBUS_PROPERTY_UPTIME "Uptime"
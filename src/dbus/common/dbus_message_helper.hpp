@@ -87,8 +87,20 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo &aSrpSer
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo &aSrpServerInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsResponseCounters &aMdnsResponseCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsResponseCounters &aMdnsResponseCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const LatencyPercentiles &aLatencyPercentiles);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, LatencyPercentiles &aLatencyPercentiles);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTelemetryInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyPercentiles &aMdnsLatencyPercentiles);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyPercentiles &aMdnsLatencyPercentiles);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const AdvertisingProxyCounters &aAdvertisingProxyCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, AdvertisingProxyCounters &aAdvertisingProxyCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const NdProxyCounters &aNdProxyCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, NdProxyCounters &aNdProxyCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TunCounters &aTunCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TunCounters &aTunCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MeshCopUpdateCounters &aMeshCopUpdateCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MeshCopUpdateCounters &aMeshCopUpdateCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const DnssdCounters &aDnssdCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, DnssdCounters &aDnssdCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics);
@@ -119,6 +131,8 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo &aTrelInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo &aTrelInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo::TrelPacketCounters &aCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo::TrelPacketCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelPeerStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelPeerStats &aStats);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -284,6 +298,45 @@ template <> struct DBusTypeTrait<MdnsTelemetryInfo>
     static constexpr const char *TYPE_AS_STRING = "((uuuuuuuu)(uuuuuuuu)(uuuuuuuu)(uuuuuuuu)uuuu)";
 };
 
+template <> struct DBusTypeTrait<MdnsLatencyPercentiles>
+{
+    // struct of { struct of { uint32, uint32, uint32, uint32, uint32 },
+    //             struct of { uint32, uint32, uint32, uint32, uint32 },
+    //             struct of { uint32, uint32, uint32, uint32, uint32 },
+    //             struct of { uint32, uint32, uint32, uint32, uint32 },
+    //             struct of { uint32, uint32, uint32, uint32, uint32 } }
+    static constexpr const char *TYPE_AS_STRING = "((uuuuu)(uuuuu)(uuuuu)(uuuuu)(uuuuu))";
+};
+
+template <> struct DBusTypeTrait<AdvertisingProxyCounters>
+{
+    // struct of { uint32, uint32, uint32, uint32, uint32,
+    //             struct of { uint32, uint32, uint32, uint32, uint32 },
+    //             uint32, uint32, uint32, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(uuuuu(uuuuu)uuuu)";
+};
+
+template <> struct DBusTypeTrait<NdProxyCounters>
+{
+    // struct of { uint64, uint64, uint64, uint64, uint64, uint64,
+    //             uint32, uint32, uint32, uint32, uint32,
+    //             struct of { uint32, uint32, uint32, uint32, uint32 },
+    //             uint32, uint32, uint32, uint64, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(ttttttuuuuu(uuuuu)uuutt)";
+};
+
+template <> struct DBusTypeTrait<TunCounters>
+{
+    // struct of { uint64, uint64, uint64, uint64, uint64, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(tttttt)";
+};
+
+template <> struct DBusTypeTrait<MeshCopUpdateCounters>
+{
+    // struct of { uint32, uint32, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(uuu)";
+};
+
 template <> struct DBusTypeTrait<DnssdCounters>
 {
     // struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32 }
@@ -401,6 +454,18 @@ template <> struct DBusTypeTrait<TrelInfo::TrelPacketCounters>
     static constexpr const char *TYPE_AS_STRING = "(ttttt)";
 };
 
+template <> struct DBusTypeTrait<TrelPeerStats>
+{
+    // struct of { string, array of uint8, uint32, uint32, uint32, bool, bool }
+    static constexpr const char *TYPE_AS_STRING = "(sayuuubb)";
+};
+
+template <> struct DBusTypeTrait<std::vector<TrelPeerStats>>
+{
+    // array of struct of { string, array of uint8, uint32, uint32, uint32, bool, bool }
+    static constexpr const char *TYPE_AS_STRING = "a(sayuuubb)";
+};
+
 template <> struct DBusTypeTrait<InfraLinkInfo>
 {
     // struct of { string, bool, bool, bool, uint32, uint32, uint32 }
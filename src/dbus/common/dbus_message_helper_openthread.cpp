@@ -692,6 +692,42 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const LatencyPercentiles &aLatencyPercentiles)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyPercentiles.mCount));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyPercentiles.mP50));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyPercentiles.mP90));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyPercentiles.mP99));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyPercentiles.mMax));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, LatencyPercentiles &aLatencyPercentiles)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatencyPercentiles.mCount));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatencyPercentiles.mP50));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatencyPercentiles.mP90));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatencyPercentiles.mP99));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatencyPercentiles.mMax));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo)
 {
     DBusMessageIter sub;
@@ -736,6 +772,218 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyPercentiles &aMdnsLatencyPercentiles)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyPercentiles.mHostRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyPercentiles.mKeyRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyPercentiles.mServiceRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyPercentiles.mHostResolution));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyPercentiles.mServiceResolution));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyPercentiles &aMdnsLatencyPercentiles)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyPercentiles.mHostRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyPercentiles.mKeyRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyPercentiles.mServiceRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyPercentiles.mHostResolution));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyPercentiles.mServiceResolution));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const AdvertisingProxyCounters &aAdvertisingProxyCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mQueuedUpdates));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mInFlightUpdates));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mCompletedUpdates));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mFailedUpdates));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mExpiredUpdates));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mUpdateLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mRepublishDuration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mRepublishMaxStall));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mIssuedPublishes));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aAdvertisingProxyCounters.mSkippedPublishes));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, AdvertisingProxyCounters &aAdvertisingProxyCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mQueuedUpdates));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mInFlightUpdates));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mCompletedUpdates));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mFailedUpdates));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mExpiredUpdates));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mUpdateLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mRepublishDuration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mRepublishMaxStall));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mIssuedPublishes));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aAdvertisingProxyCounters.mSkippedPublishes));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const NdProxyCounters &aNdProxyCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mMulticastNsReceived));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mUnicastNsReceived));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mNaSent));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mNaFailures));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mParseErrors));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mTargetMisses));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mProxiedDuas));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mDuaAdded));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mDuaRenewed));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mDuaRemoved));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mDuaCleared));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mNsToNaLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mNfQueueLength));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mNfQueueDropped));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mNfQueueUserDropped));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mNfQueueVerdicts));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aNdProxyCounters.mNfQueueFailedVerdicts));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, NdProxyCounters &aNdProxyCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mMulticastNsReceived));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mUnicastNsReceived));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mNaSent));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mNaFailures));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mParseErrors));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mTargetMisses));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mProxiedDuas));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mDuaAdded));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mDuaRenewed));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mDuaRemoved));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mDuaCleared));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mNsToNaLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mNfQueueLength));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mNfQueueDropped));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mNfQueueUserDropped));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mNfQueueVerdicts));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aNdProxyCounters.mNfQueueFailedVerdicts));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TunCounters &aTunCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aTunCounters.mTxPackets));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aTunCounters.mTxBytes));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aTunCounters.mTxDrops));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aTunCounters.mRxPackets));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aTunCounters.mRxBytes));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aTunCounters.mRxDrops));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TunCounters &aTunCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aTunCounters.mTxPackets));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aTunCounters.mTxBytes));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aTunCounters.mTxDrops));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aTunCounters.mRxPackets));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aTunCounters.mRxBytes));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aTunCounters.mRxDrops));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MeshCopUpdateCounters &aMeshCopUpdateCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMeshCopUpdateCounters.mIssued));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMeshCopUpdateCounters.mSuppressed));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMeshCopUpdateCounters.mCoalesced));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MeshCopUpdateCounters &aMeshCopUpdateCounters)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMeshCopUpdateCounters.mIssued));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMeshCopUpdateCounters.mSuppressed));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMeshCopUpdateCounters.mCoalesced));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics)
 {
     DBusMessageIter sub;
@@ -1258,5 +1506,45 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelPeerStats &aStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mInstanceName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mAddress));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mTxProbes));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mRxReplies));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mSmoothedRttUs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mIsAlive));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aStats.mIsBest));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelPeerStats &aStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mInstanceName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mAddress));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mTxProbes));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mRxReplies));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mSmoothedRttUs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mIsAlive));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aStats.mIsBest));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
@@ -719,6 +719,17 @@ struct TrelInfo
     TrelPacketCounters mTrelCounters; ///< The TREL counters.
 };
 
+struct TrelPeerStats
+{
+    std::string mInstanceName;  ///< The instance name of the TREL peer.
+    Ip6Address  mAddress;       ///< The probed address of the TREL peer.
+    uint32_t    mTxProbes;      ///< Number of probes sent to the address.
+    uint32_t    mRxReplies;     ///< Number of probe replies received from the address.
+    uint32_t    mSmoothedRttUs; ///< The smoothed round-trip time in microseconds, 0 if unknown.
+    bool        mIsAlive;       ///< Whether the address answers probes.
+    bool        mIsBest;        ///< Whether the address is used to reach the TREL peer.
+};
+
 } // namespace DBus
 } // namespace otbr
 
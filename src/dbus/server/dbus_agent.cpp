@@ -53,7 +53,10 @@ DBusAgent::DBusAgent(otbr::Ncp::ThreadHost &aHost, Mdns::Publisher &aPublisher)
 {
 }
 
-void DBusAgent::Init(otbr::BorderAgent &aBorderAgent)
+void DBusAgent::Init(otbr::BorderAgent                   &aBorderAgent,
+                     otbr::AdvertisingProxy              *aAdvertisingProxy,
+                     otbr::TrelDnssd::TrelDnssd          *aTrelDnssd,
+                     otbr::BackboneRouter::BackboneAgent *aBackboneAgent)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -71,7 +74,8 @@ void DBusAgent::Init(otbr::BorderAgent &aBorderAgent)
     {
     case OT_COPROCESSOR_RCP:
         mThreadObject = MakeUnique<DBusThreadObjectRcp>(*mConnection, mInterfaceName,
-                                                        static_cast<Ncp::RcpHost &>(mHost), &mPublisher, aBorderAgent);
+                                                        static_cast<Ncp::RcpHost &>(mHost), &mPublisher, aBorderAgent,
+                                                        aAdvertisingProxy, aTrelDnssd, aBackboneAgent);
         break;
 
     case OT_COPROCESSOR_NCP:
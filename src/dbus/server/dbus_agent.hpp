@@ -68,8 +68,16 @@ public:
     /**
      * This method initializes the dbus agent.
      *
+     * @param[in] aBorderAgent       A reference to the Border Agent.
+     * @param[in] aAdvertisingProxy  A pointer to the Advertising Proxy, or nullptr if it's not enabled.
+     * @param[in] aTrelDnssd         A pointer to the TREL DNS-SD, or nullptr if it's not enabled.
+     * @param[in] aBackboneAgent     A pointer to the Backbone agent, or nullptr if it's not enabled.
+     *
      */
-    void Init(otbr::BorderAgent &aBorderAgent);
+    void Init(otbr::BorderAgent                   &aBorderAgent,
+              otbr::AdvertisingProxy              *aAdvertisingProxy,
+              otbr::TrelDnssd::TrelDnssd          *aTrelDnssd,
+              otbr::BackboneRouter::BackboneAgent *aBackboneAgent);
 
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
@@ -57,6 +57,8 @@ otbrError DBusThreadObjectNcp::Init(void)
 
     RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                                     std::bind(&DBusThreadObjectNcp::AsyncGetDeviceRoleHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TUN_COUNTERS,
+                               std::bind(&DBusThreadObjectNcp::GetTunCountersHandler, this, _1));
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOIN_METHOD,
                    std::bind(&DBusThreadObjectNcp::JoinHandler, this, _1));
@@ -97,6 +99,17 @@ exit:
     }
 }
 
+otError DBusThreadObjectNcp::GetTunCountersHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mHost.GetTunCounters()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 void DBusThreadObjectNcp::JoinHandler(DBusRequest &aRequest)
 {
     std::vector<uint8_t>     dataset;
@@ -80,8 +80,9 @@ public:
     otbrError Init(void) override;
 
 private:
-    void AsyncGetDeviceRoleHandler(DBusRequest &aRequest);
-    void ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent);
+    void    AsyncGetDeviceRoleHandler(DBusRequest &aRequest);
+    void    ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent);
+    otError GetTunCountersHandler(DBusMessageIter &aIter);
 
     void JoinHandler(DBusRequest &aRequest);
     void LeaveHandler(DBusRequest &aRequest);
@@ -46,12 +46,15 @@
 #include <openthread/trel.h>
 #include <openthread/platform/radio.h>
 
+#include "backbone_router/backbone_agent.hpp"
 #include "common/api_strings.hpp"
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object_rcp.hpp"
+#include "sdp_proxy/advertising_proxy.hpp"
+#include "trel_dnssd/trel_dnssd.hpp"
 #if OTBR_ENABLE_FEATURE_FLAGS
 #include "proto/feature_flag.pb.h"
 #endif
@@ -101,15 +104,21 @@ static std::string GetNat64StateName(otNat64State aState)
 namespace otbr {
 namespace DBus {
 
-DBusThreadObjectRcp::DBusThreadObjectRcp(DBusConnection     &aConnection,
-                                         const std::string  &aInterfaceName,
-                                         otbr::Ncp::RcpHost &aHost,
-                                         Mdns::Publisher    *aPublisher,
-                                         otbr::BorderAgent  &aBorderAgent)
+DBusThreadObjectRcp::DBusThreadObjectRcp(DBusConnection                      &aConnection,
+                                         const std::string                   &aInterfaceName,
+                                         otbr::Ncp::RcpHost                  &aHost,
+                                         Mdns::Publisher                     *aPublisher,
+                                         otbr::BorderAgent                   &aBorderAgent,
+                                         otbr::AdvertisingProxy              *aAdvertisingProxy,
+                                         otbr::TrelDnssd::TrelDnssd          *aTrelDnssd,
+                                         otbr::BackboneRouter::BackboneAgent *aBackboneAgent)
     : DBusObject(&aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mHost(aHost)
     , mPublisher(aPublisher)
     , mBorderAgent(aBorderAgent)
+    , mAdvertisingProxy(aAdvertisingProxy)
+    , mTrelDnssd(aTrelDnssd)
+    , mBackboneAgent(aBackboneAgent)
 {
 }
 
@@ -261,6 +270,14 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetSrpServerInfoHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO,
                                std::bind(&DBusThreadObjectRcp::GetMdnsTelemetryInfoHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MDNS_LATENCY_PERCENTILES,
+                               std::bind(&DBusThreadObjectRcp::GetMdnsLatencyPercentilesHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ADVERTISING_PROXY_COUNTERS,
+                               std::bind(&DBusThreadObjectRcp::GetAdvertisingProxyCountersHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ND_PROXY_COUNTERS,
+                               std::bind(&DBusThreadObjectRcp::GetNdProxyCountersHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MESHCOP_UPDATE_COUNTERS,
+                               std::bind(&DBusThreadObjectRcp::GetMeshCopUpdateCountersHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNSSD_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetDnssdCountersHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OTBR_VERSION,
@@ -297,6 +314,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetInfraLinkInfo, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TREL_INFO,
                                std::bind(&DBusThreadObjectRcp::GetTrelInfoHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TREL_PEER_STATS,
+                               std::bind(&DBusThreadObjectRcp::GetTrelPeerStatsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNS_UPSTREAM_QUERY_STATE,
                                std::bind(&DBusThreadObjectRcp::GetDnsUpstreamQueryState, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_DATA,
@@ -1418,6 +1437,65 @@ exit:
     return error;
 }
 
+otError DBusThreadObjectRcp::GetMdnsLatencyPercentilesHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mPublisher->GetMdnsTelemetryInfo().mLatencyPercentiles) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+exit:
+    return error;
+}
+
+otError DBusThreadObjectRcp::GetAdvertisingProxyCountersHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mAdvertisingProxy != nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mAdvertisingProxy->GetCounters()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else  // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    OTBR_UNUSED_VARIABLE(aIter);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+}
+
+otError DBusThreadObjectRcp::GetNdProxyCountersHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_DUA_ROUTING
+    otError         error = OT_ERROR_NONE;
+    NdProxyCounters counters;
+
+    VerifyOrExit(mBackboneAgent != nullptr, error = OT_ERROR_INVALID_STATE);
+    mBackboneAgent->GetNdProxyCounters(counters);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else  // OTBR_ENABLE_DUA_ROUTING
+    OTBR_UNUSED_VARIABLE(aIter);
+    OTBR_UNUSED_VARIABLE(mBackboneAgent);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif // OTBR_ENABLE_DUA_ROUTING
+}
+
+otError DBusThreadObjectRcp::GetMeshCopUpdateCountersHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mBorderAgent.GetMeshCopUpdateCounters()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+exit:
+    return error;
+}
+
 otError DBusThreadObjectRcp::GetDnssdCountersHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
@@ -1474,6 +1552,43 @@ exit:
 #endif // OTBR_ENABLE_TREL
 }
 
+otError DBusThreadObjectRcp::GetTrelPeerStatsHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_TREL_PROBING
+    otError                                           error = OT_ERROR_NONE;
+    std::vector<TrelDnssd::TrelPeerProber::PeerStats> peerStats;
+    std::vector<TrelPeerStats>                        trelPeerStats;
+
+    VerifyOrExit(mTrelDnssd != nullptr, error = OT_ERROR_INVALID_STATE);
+
+    mTrelDnssd->GetPeerStats(peerStats);
+
+    for (const auto &stats : peerStats)
+    {
+        TrelPeerStats entry;
+
+        entry.mInstanceName = stats.mInstanceName;
+        std::copy(std::begin(stats.mAddress.m8), std::end(stats.mAddress.m8), entry.mAddress.begin());
+        entry.mTxProbes      = stats.mTxProbes;
+        entry.mRxReplies     = stats.mRxReplies;
+        entry.mSmoothedRttUs = static_cast<uint32_t>(stats.mSmoothedRtt.count());
+        entry.mIsAlive       = stats.IsAlive();
+        entry.mIsBest        = stats.mIsBest;
+        trelPeerStats.push_back(std::move(entry));
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, trelPeerStats) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else  // OTBR_ENABLE_TREL_PROBING
+    OTBR_UNUSED_VARIABLE(aIter);
+    OTBR_UNUSED_VARIABLE(mTrelDnssd);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif // OTBR_ENABLE_TREL_PROBING
+}
+
 otError DBusThreadObjectRcp::GetTelemetryDataHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_TELEMETRY_DATA_API
@@ -46,6 +46,17 @@
 #include "ncp/rcp_host.hpp"
 
 namespace otbr {
+
+class AdvertisingProxy;
+
+namespace TrelDnssd {
+class TrelDnssd;
+}
+
+namespace BackboneRouter {
+class BackboneAgent;
+}
+
 namespace DBus {
 
 /**
@@ -67,14 +78,20 @@ public:
      * @param[in] aInterfaceName  The dbus interface name.
      * @param[in] aHost           The Thread controller
      * @param[in] aPublisher      The Mdns::Publisher
-     * @param[in] aBorderAgent    The Border Agent
+     * @param[in] aBorderAgent       The Border Agent
+     * @param[in] aAdvertisingProxy  The Advertising Proxy, or nullptr if it's not enabled
+     * @param[in] aTrelDnssd         The TREL DNS-SD, or nullptr if it's not enabled
+     * @param[in] aBackboneAgent     The Backbone agent, or nullptr if it's not enabled
      *
      */
-    DBusThreadObjectRcp(DBusConnection     &aConnection,
-                        const std::string  &aInterfaceName,
-                        otbr::Ncp::RcpHost &aHost,
-                        Mdns::Publisher    *aPublisher,
-                        otbr::BorderAgent  &aBorderAgent);
+    DBusThreadObjectRcp(DBusConnection                      &aConnection,
+                        const std::string                   &aInterfaceName,
+                        otbr::Ncp::RcpHost                  &aHost,
+                        Mdns::Publisher                     *aPublisher,
+                        otbr::BorderAgent                   &aBorderAgent,
+                        otbr::AdvertisingProxy              *aAdvertisingProxy,
+                        otbr::TrelDnssd::TrelDnssd          *aTrelDnssd,
+                        otbr::BackboneRouter::BackboneAgent *aBackboneAgent);
 
     otbrError Init(void) override;
 
@@ -157,6 +174,10 @@ private:
     otError GetRadioRegionHandler(DBusMessageIter &aIter);
     otError GetSrpServerInfoHandler(DBusMessageIter &aIter);
     otError GetMdnsTelemetryInfoHandler(DBusMessageIter &aIter);
+    otError GetMdnsLatencyPercentilesHandler(DBusMessageIter &aIter);
+    otError GetAdvertisingProxyCountersHandler(DBusMessageIter &aIter);
+    otError GetNdProxyCountersHandler(DBusMessageIter &aIter);
+    otError GetMeshCopUpdateCountersHandler(DBusMessageIter &aIter);
     otError GetDnssdCountersHandler(DBusMessageIter &aIter);
     otError GetOtbrVersionHandler(DBusMessageIter &aIter);
     otError GetOtHostVersionHandler(DBusMessageIter &aIter);
@@ -166,6 +187,7 @@ private:
     otError GetRcpInterfaceMetricsHandler(DBusMessageIter &aIter);
     otError GetUptimeHandler(DBusMessageIter &aIter);
     otError GetTrelInfoHandler(DBusMessageIter &aIter);
+    otError GetTrelPeerStatsHandler(DBusMessageIter &aIter);
     otError GetRadioCoexMetrics(DBusMessageIter &aIter);
     otError GetBorderRoutingCountersHandler(DBusMessageIter &aIter);
     otError GetNat64State(DBusMessageIter &aIter);
@@ -186,6 +208,9 @@ private:
     std::unordered_map<std::string, PropertyHandlerType> mGetPropertyHandlers;
     otbr::Mdns::Publisher                               *mPublisher;
     otbr::BorderAgent                                   &mBorderAgent;
+    otbr::AdvertisingProxy                              *mAdvertisingProxy;
+    otbr::TrelDnssd::TrelDnssd                          *mTrelDnssd;
+    otbr::BackboneRouter::BackboneAgent                 *mBackboneAgent;
 };
 
 /**
@@ -0,0 +1,544 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the DNS message codec used by the built-in mDNS responder.
+ */
+
+#include "mdns/dns_message.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <ctype.h>
+#include <string.h>
+#include <strings.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+namespace {
+
+constexpr uint8_t  kMaxLabelLength       = 63;
+constexpr size_t   kMaxNameLength        = 1024; // In presentation format, escapes included.
+constexpr uint8_t  kMaxCompressionJumps  = 64;
+constexpr uint16_t kCompressionFlags     = 0xc0;
+constexpr uint16_t kMaxCompressionOffset = 0x3fff;
+constexpr uint16_t kClassTopBit          = 0x8000; // The QU bit of a question, the cache-flush bit of a record.
+
+uint16_t ReadUint16(const uint8_t *aBuffer)
+{
+    return static_cast<uint16_t>((aBuffer[0] << 8) | aBuffer[1]);
+}
+
+uint32_t ReadUint32(const uint8_t *aBuffer)
+{
+    return (static_cast<uint32_t>(ReadUint16(aBuffer)) << 16) | ReadUint16(aBuffer + 2);
+}
+
+// Reads a possibly compressed name at `aOffset` and moves `aOffset` past it.
+otbrError ReadName(const uint8_t *aBuffer, size_t aLength, size_t &aOffset, std::string &aName)
+{
+    otbrError error  = OTBR_ERROR_PARSE;
+    size_t    offset = aOffset;
+    bool      jumped = false;
+    uint8_t   jumps  = 0;
+
+    aName.clear();
+
+    while (true)
+    {
+        uint8_t labelLength;
+
+        VerifyOrExit(offset < aLength);
+        labelLength = aBuffer[offset];
+
+        if ((labelLength & kCompressionFlags) == kCompressionFlags)
+        {
+            size_t pointer;
+
+            VerifyOrExit(offset + 1 < aLength);
+            pointer = ReadUint16(&aBuffer[offset]) & kMaxCompressionOffset;
+
+            // Only allows pointing backwards so that the name always terminates.
+            VerifyOrExit(pointer < offset && ++jumps <= kMaxCompressionJumps);
+
+            if (!jumped)
+            {
+                aOffset = offset + sizeof(uint16_t);
+                jumped  = true;
+            }
+
+            offset = pointer;
+        }
+        else if ((labelLength & kCompressionFlags) != 0)
+        {
+            ExitNow();
+        }
+        else if (labelLength == 0)
+        {
+            if (!jumped)
+            {
+                aOffset = offset + 1;
+            }
+
+            break;
+        }
+        else
+        {
+            VerifyOrExit(offset + 1 + labelLength <= aLength);
+
+            if (!aName.empty())
+            {
+                aName.push_back('.');
+            }
+
+            aName += EscapeLabel(std::string(reinterpret_cast<const char *>(&aBuffer[offset + 1]), labelLength));
+            VerifyOrExit(aName.size() <= kMaxNameLength);
+
+            offset += 1 + labelLength;
+        }
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+otbrError ReadQuestion(const uint8_t *aBuffer, size_t aLength, size_t &aOffset, Question &aQuestion)
+{
+    otbrError error;
+    uint16_t  rrClass;
+
+    SuccessOrExit(error = ReadName(aBuffer, aLength, aOffset, aQuestion.mName));
+    VerifyOrExit(aOffset + 2 * sizeof(uint16_t) <= aLength, error = OTBR_ERROR_PARSE);
+
+    aQuestion.mType            = ReadUint16(&aBuffer[aOffset]);
+    rrClass                    = ReadUint16(&aBuffer[aOffset + sizeof(uint16_t)]);
+    aQuestion.mClass           = rrClass & ~kClassTopBit;
+    aQuestion.mUnicastResponse = (rrClass & kClassTopBit) != 0;
+    aOffset += 2 * sizeof(uint16_t);
+
+exit:
+    return error;
+}
+
+otbrError ReadRecord(const uint8_t *aBuffer, size_t aLength, size_t &aOffset, ResourceRecord &aRecord)
+{
+    static constexpr size_t kFixedFieldsSize = 3 * sizeof(uint16_t) + sizeof(uint32_t);
+    static constexpr size_t kSrvFieldsSize   = 3 * sizeof(uint16_t);
+
+    otbrError error;
+    uint16_t  rrClass;
+    size_t    rdataOffset;
+    size_t    rdataEnd;
+
+    SuccessOrExit(error = ReadName(aBuffer, aLength, aOffset, aRecord.mName));
+    VerifyOrExit(aOffset + kFixedFieldsSize <= aLength, error = OTBR_ERROR_PARSE);
+
+    aRecord.mType       = ReadUint16(&aBuffer[aOffset]);
+    rrClass             = ReadUint16(&aBuffer[aOffset + 2]);
+    aRecord.mClass      = rrClass & ~kClassTopBit;
+    aRecord.mCacheFlush = (rrClass & kClassTopBit) != 0;
+    aRecord.mTtl        = ReadUint32(&aBuffer[aOffset + 4]);
+    rdataOffset         = aOffset + kFixedFieldsSize;
+    rdataEnd            = rdataOffset + ReadUint16(&aBuffer[aOffset + 8]);
+    VerifyOrExit(rdataEnd <= aLength, error = OTBR_ERROR_PARSE);
+
+    switch (aRecord.mType)
+    {
+    case kRrTypePtr:
+        SuccessOrExit(error = ReadName(aBuffer, rdataEnd, rdataOffset, aRecord.mTarget));
+        break;
+
+    case kRrTypeSrv:
+        VerifyOrExit(rdataOffset + kSrvFieldsSize <= rdataEnd, error = OTBR_ERROR_PARSE);
+        aRecord.mPriority = ReadUint16(&aBuffer[rdataOffset]);
+        aRecord.mWeight   = ReadUint16(&aBuffer[rdataOffset + 2]);
+        aRecord.mPort     = ReadUint16(&aBuffer[rdataOffset + 4]);
+        rdataOffset += kSrvFieldsSize;
+        SuccessOrExit(error = ReadName(aBuffer, rdataEnd, rdataOffset, aRecord.mTarget));
+        break;
+
+    default:
+        aRecord.mData.assign(&aBuffer[rdataOffset], &aBuffer[rdataEnd]);
+        break;
+    }
+
+    aOffset = rdataEnd;
+
+exit:
+    return error;
+}
+
+void AppendUncompressedName(std::vector<uint8_t> &aBuffer, const std::string &aName)
+{
+    std::string rest = aName;
+
+    while (!rest.empty())
+    {
+        std::string label = SplitFirstLabel(std::string(rest), rest);
+
+        aBuffer.push_back(static_cast<uint8_t>(label.size()));
+        aBuffer.insert(aBuffer.end(), label.begin(), label.end());
+    }
+
+    aBuffer.push_back(0);
+}
+
+} // namespace
+
+constexpr uint16_t Message::kFlagResponse;
+constexpr uint16_t Message::kFlagAuthoritative;
+constexpr uint16_t Message::kFlagTruncated;
+
+bool ResourceRecord::HasName(const std::string &aName) const
+{
+    return NameEquals(mName, aName);
+}
+
+bool ResourceRecord::Answers(const Question &aQuestion) const
+{
+    return (aQuestion.mType == kRrTypeAny || aQuestion.mType == mType) &&
+           (aQuestion.mClass == kRrClassAny || aQuestion.mClass == mClass) && HasName(aQuestion.mName);
+}
+
+bool ResourceRecord::IsSameAs(const ResourceRecord &aOther) const
+{
+    return mType == aOther.mType && mClass == aOther.mClass && HasName(aOther.mName) &&
+           NameEquals(mTarget, aOther.mTarget) && mPriority == aOther.mPriority && mWeight == aOther.mWeight &&
+           mPort == aOther.mPort && mData == aOther.mData;
+}
+
+int ResourceRecord::Compare(const ResourceRecord &aOther) const
+{
+    int                  result;
+    std::vector<uint8_t> rdata;
+    std::vector<uint8_t> otherRdata;
+
+    VerifyOrExit(mClass == aOther.mClass, result = (mClass < aOther.mClass ? -1 : 1));
+    VerifyOrExit(mType == aOther.mType, result = (mType < aOther.mType ? -1 : 1));
+
+    AppendRdata(rdata);
+    aOther.AppendRdata(otherRdata);
+
+    if (std::lexicographical_compare(rdata.begin(), rdata.end(), otherRdata.begin(), otherRdata.end()))
+    {
+        result = -1;
+    }
+    else
+    {
+        result = (rdata == otherRdata) ? 0 : 1;
+    }
+
+exit:
+    return result;
+}
+
+void ResourceRecord::AppendRdata(std::vector<uint8_t> &aBuffer) const
+{
+    switch (mType)
+    {
+    case kRrTypePtr:
+        AppendUncompressedName(aBuffer, mTarget);
+        break;
+
+    case kRrTypeSrv:
+        for (uint16_t value : {mPriority, mWeight, mPort})
+        {
+            aBuffer.push_back(static_cast<uint8_t>(value >> 8));
+            aBuffer.push_back(static_cast<uint8_t>(value & 0xff));
+        }
+
+        AppendUncompressedName(aBuffer, mTarget);
+        break;
+
+    default:
+        aBuffer.insert(aBuffer.end(), mData.begin(), mData.end());
+        break;
+    }
+}
+
+otbrError Message::Parse(const uint8_t *aBuffer, size_t aLength)
+{
+    static constexpr size_t kHeaderSize = 12;
+
+    otbrError error  = OTBR_ERROR_NONE;
+    size_t    offset = kHeaderSize;
+    uint16_t  questionCount;
+    uint16_t  answerCount;
+    uint16_t  authorityCount;
+    uint16_t  additionalCount;
+
+    VerifyOrExit(aLength >= kHeaderSize, error = OTBR_ERROR_PARSE);
+
+    mId             = ReadUint16(&aBuffer[0]);
+    mFlags          = ReadUint16(&aBuffer[2]);
+    questionCount   = ReadUint16(&aBuffer[4]);
+    answerCount     = ReadUint16(&aBuffer[6]);
+    authorityCount  = ReadUint16(&aBuffer[8]);
+    additionalCount = ReadUint16(&aBuffer[10]);
+
+    mQuestions.clear();
+    mAnswers.clear();
+    mAuthorities.clear();
+    mAdditionals.clear();
+
+    for (uint16_t i = 0; i < questionCount; i++)
+    {
+        mQuestions.emplace_back();
+        SuccessOrExit(error = ReadQuestion(aBuffer, aLength, offset, mQuestions.back()));
+    }
+
+    {
+        struct
+        {
+            std::vector<ResourceRecord> *mRecords;
+            uint16_t                     mCount;
+        } sections[] = {{&mAnswers, answerCount}, {&mAuthorities, authorityCount}, {&mAdditionals, additionalCount}};
+
+        for (auto &section : sections)
+        {
+            for (uint16_t i = 0; i < section.mCount; i++)
+            {
+                section.mRecords->emplace_back();
+                SuccessOrExit(error = ReadRecord(aBuffer, aLength, offset, section.mRecords->back()));
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
+MessageWriter::MessageWriter(uint16_t aId, uint16_t aFlags, size_t aMaxSize)
+    : mCounts{0, 0, 0, 0}
+    , mSection(kQuestion)
+    , mMaxSize(aMaxSize)
+{
+    AppendUint16(aId);
+    AppendUint16(aFlags);
+    mBuffer.resize(kHeaderSize, 0);
+}
+
+bool MessageWriter::AppendQuestion(const Question &aQuestion)
+{
+    size_t rollbackSize = mBuffer.size();
+
+    assert(mSection == kQuestion);
+
+    AppendName(aQuestion.mName, /* aCompress */ true);
+    AppendUint16(aQuestion.mType);
+    AppendUint16(aQuestion.mClass | (aQuestion.mUnicastResponse ? kClassTopBit : 0));
+
+    return Commit(kQuestion, rollbackSize);
+}
+
+bool MessageWriter::AppendRecord(Section aSection, const ResourceRecord &aRecord)
+{
+    size_t rollbackSize = mBuffer.size();
+    size_t rdataOffset;
+
+    assert(aSection != kQuestion && aSection >= mSection);
+
+    AppendName(aRecord.mName, /* aCompress */ true);
+    AppendUint16(aRecord.mType);
+    AppendUint16(aRecord.mClass | (aRecord.mCacheFlush ? kClassTopBit : 0));
+    AppendUint32(aRecord.mTtl);
+    AppendUint16(0); // RDLENGTH, filled in below.
+    rdataOffset = mBuffer.size();
+
+    switch (aRecord.mType)
+    {
+    case kRrTypePtr:
+        AppendName(aRecord.mTarget, /* aCompress */ true);
+        break;
+
+    case kRrTypeSrv:
+        // RFC 6762 section 18.14 allows compressing the SRV target in mDNS.
+        AppendUint16(aRecord.mPriority);
+        AppendUint16(aRecord.mWeight);
+        AppendUint16(aRecord.mPort);
+        AppendName(aRecord.mTarget, /* aCompress */ true);
+        break;
+
+    default:
+        mBuffer.insert(mBuffer.end(), aRecord.mData.begin(), aRecord.mData.end());
+        break;
+    }
+
+    mBuffer[rdataOffset - 2] = static_cast<uint8_t>((mBuffer.size() - rdataOffset) >> 8);
+    mBuffer[rdataOffset - 1] = static_cast<uint8_t>((mBuffer.size() - rdataOffset) & 0xff);
+
+    return Commit(aSection, rollbackSize);
+}
+
+void MessageWriter::AddFlags(uint16_t aFlags)
+{
+    mBuffer[2] |= static_cast<uint8_t>(aFlags >> 8);
+    mBuffer[3] |= static_cast<uint8_t>(aFlags & 0xff);
+}
+
+bool MessageWriter::IsEmpty(void) const
+{
+    return mCounts[kQuestion] == 0 && mCounts[kAnswer] == 0 && mCounts[kAuthority] == 0 &&
+           mCounts[kAdditional] == 0;
+}
+
+void MessageWriter::AppendUint16(uint16_t aValue)
+{
+    mBuffer.push_back(static_cast<uint8_t>(aValue >> 8));
+    mBuffer.push_back(static_cast<uint8_t>(aValue & 0xff));
+}
+
+void MessageWriter::AppendUint32(uint32_t aValue)
+{
+    AppendUint16(static_cast<uint16_t>(aValue >> 16));
+    AppendUint16(static_cast<uint16_t>(aValue & 0xffff));
+}
+
+void MessageWriter::AppendName(const std::string &aName, bool aCompress)
+{
+    std::string rest = aName;
+
+    while (!rest.empty())
+    {
+        std::string key = ToLowerName(rest);
+        auto        it  = mNameOffsets.find(key);
+        std::string label;
+
+        if (aCompress && it != mNameOffsets.end())
+        {
+            AppendUint16((kCompressionFlags << 8) | it->second);
+            ExitNow();
+        }
+
+        if (mBuffer.size() <= kMaxCompressionOffset)
+        {
+            mNameOffsets[key] = static_cast<uint16_t>(mBuffer.size());
+        }
+
+        label = SplitFirstLabel(std::string(rest), rest);
+        label.resize(std::min<size_t>(label.size(), kMaxLabelLength));
+
+        mBuffer.push_back(static_cast<uint8_t>(label.size()));
+        mBuffer.insert(mBuffer.end(), label.begin(), label.end());
+    }
+
+    mBuffer.push_back(0);
+
+exit:
+    return;
+}
+
+bool MessageWriter::Commit(Section aSection, size_t aRollbackSize)
+{
+    bool committed = (mBuffer.size() <= mMaxSize);
+
+    if (committed)
+    {
+        size_t countOffset = 4 + sizeof(uint16_t) * aSection;
+
+        mCounts[aSection]++;
+        mSection                 = aSection;
+        mBuffer[countOffset]     = static_cast<uint8_t>(mCounts[aSection] >> 8);
+        mBuffer[countOffset + 1] = static_cast<uint8_t>(mCounts[aSection] & 0xff);
+    }
+    else
+    {
+        mBuffer.resize(aRollbackSize);
+
+        for (auto it = mNameOffsets.begin(); it != mNameOffsets.end();)
+        {
+            it = (it->second >= aRollbackSize) ? mNameOffsets.erase(it) : std::next(it);
+        }
+    }
+
+    return committed;
+}
+
+std::string EscapeLabel(const std::string &aLabel)
+{
+    std::string escaped;
+
+    for (char c : aLabel)
+    {
+        if (c == '.' || c == '\\')
+        {
+            escaped.push_back('\\');
+        }
+
+        escaped.push_back(c);
+    }
+
+    return escaped;
+}
+
+std::string SplitFirstLabel(const std::string &aName, std::string &aRest)
+{
+    std::string label;
+    size_t      i = 0;
+
+    for (; i < aName.size() && aName[i] != '.'; i++)
+    {
+        if (aName[i] == '\\' && i + 1 < aName.size())
+        {
+            i++;
+        }
+
+        label.push_back(aName[i]);
+    }
+
+    aRest = (i < aName.size()) ? aName.substr(i + 1) : std::string();
+
+    return label;
+}
+
+bool NameEquals(const std::string &aName, const std::string &aOther)
+{
+    return aName.size() == aOther.size() && strncasecmp(aName.c_str(), aOther.c_str(), aName.size()) == 0;
+}
+
+std::string ToLowerName(const std::string &aName)
+{
+    std::string lower = aName;
+
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](char c) { return static_cast<char>(tolower(static_cast<unsigned char>(c))); });
+
+    return lower;
+}
+
+} // namespace Mdns
+
+} // namespace otbr
@@ -0,0 +1,303 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the DNS message codec used by the built-in mDNS responder.
+ */
+
+#ifndef OTBR_AGENT_MDNS_DNS_MESSAGE_HPP_
+#define OTBR_AGENT_MDNS_DNS_MESSAGE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * DNS resource record types.
+ *
+ */
+enum RrType : uint16_t
+{
+    kRrTypeA    = 1,   ///< IPv4 address.
+    kRrTypePtr  = 12,  ///< Domain name pointer.
+    kRrTypeTxt  = 16,  ///< Text strings.
+    kRrTypeKey  = 25,  ///< Security key.
+    kRrTypeAaaa = 28,  ///< IPv6 address.
+    kRrTypeSrv  = 33,  ///< Service locator.
+    kRrTypeNsec = 47,  ///< Next secure.
+    kRrTypeAny  = 255, ///< Any type (query only).
+};
+
+constexpr uint16_t kRrClassIn  = 1;   ///< The Internet class.
+constexpr uint16_t kRrClassAny = 255; ///< Any class (query only).
+
+/**
+ * This structure represents a question of a DNS message.
+ *
+ * Names are in presentation format without the trailing dot, e.g. "_srv._udp.local", with
+ * dots and backslashes inside a label escaped by a backslash.
+ *
+ */
+struct Question
+{
+    std::string mName;                    ///< The name queried for.
+    uint16_t    mType            = 0;     ///< The record type queried for.
+    uint16_t    mClass           = 0;     ///< The class, without the unicast-response bit.
+    bool        mUnicastResponse = false; ///< Whether a unicast response is preferred (the QU bit).
+};
+
+/**
+ * This structure represents a resource record of a DNS message.
+ *
+ */
+struct ResourceRecord
+{
+    std::string mName;               ///< The owner name.
+    uint16_t    mType       = 0;     ///< The record type.
+    uint16_t    mClass      = 0;     ///< The class, without the cache-flush bit.
+    bool        mCacheFlush = false; ///< Whether the cache-flush bit is set.
+    uint32_t    mTtl        = 0;     ///< The TTL in seconds.
+
+    // RDATA. The domain name of a PTR or SRV record is kept in `mTarget` and the
+    // other SRV fields in `mPriority`, `mWeight` and `mPort`. Any other RDATA is
+    // kept as raw bytes in `mData`.
+    std::string          mTarget;
+    uint16_t             mPriority = 0;
+    uint16_t             mWeight   = 0;
+    uint16_t             mPort     = 0;
+    std::vector<uint8_t> mData;
+
+    /**
+     * This method indicates whether the record has the given owner name (case-insensitive).
+     *
+     */
+    bool HasName(const std::string &aName) const;
+
+    /**
+     * This method indicates whether the record answers a given question.
+     *
+     */
+    bool Answers(const Question &aQuestion) const;
+
+    /**
+     * This method indicates whether the record has the same name, type, class and RDATA as another one.
+     *
+     * The TTL and the cache-flush bit are not compared.
+     *
+     */
+    bool IsSameAs(const ResourceRecord &aOther) const;
+
+    /**
+     * This method compares the class, type and RDATA of two records as defined for the
+     * simultaneous probe tiebreaking in RFC 6762 section 8.2.
+     *
+     * @returns A negative value, zero or a positive value if this record is lexicographically
+     *          earlier than, equal to or later than @p aOther.
+     *
+     */
+    int Compare(const ResourceRecord &aOther) const;
+
+    /**
+     * This method appends the uncompressed RDATA to a buffer.
+     *
+     */
+    void AppendRdata(std::vector<uint8_t> &aBuffer) const;
+};
+
+/**
+ * This class represents a parsed DNS message.
+ *
+ */
+class Message
+{
+public:
+    static constexpr uint16_t kFlagResponse      = 0x8000; ///< The QR bit.
+    static constexpr uint16_t kFlagAuthoritative = 0x0400; ///< The AA bit.
+    static constexpr uint16_t kFlagTruncated     = 0x0200; ///< The TC bit.
+
+    uint16_t                    mId    = 0;
+    uint16_t                    mFlags = 0;
+    std::vector<Question>       mQuestions;
+    std::vector<ResourceRecord> mAnswers;
+    std::vector<ResourceRecord> mAuthorities;
+    std::vector<ResourceRecord> mAdditionals;
+
+    /**
+     * This method indicates whether the message is a response.
+     *
+     */
+    bool IsResponse(void) const { return (mFlags & kFlagResponse) != 0; }
+
+    /**
+     * This method parses a message from its wire format.
+     *
+     * @param[in] aBuffer  A pointer to the message.
+     * @param[in] aLength  The length of the message.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully parsed the message.
+     * @retval OTBR_ERROR_PARSE  The message is malformed.
+     *
+     */
+    otbrError Parse(const uint8_t *aBuffer, size_t aLength);
+};
+
+/**
+ * This class builds a DNS message in its wire format with name compression.
+ *
+ * Sections must be filled in order: questions, answers, authorities and additionals.
+ *
+ */
+class MessageWriter
+{
+public:
+    /**
+     * This enumeration represents the sections of a message.
+     *
+     */
+    enum Section : uint8_t
+    {
+        kQuestion,
+        kAnswer,
+        kAuthority,
+        kAdditional,
+    };
+
+    /**
+     * This constructor initializes an empty message.
+     *
+     * @param[in] aId       The message ID.
+     * @param[in] aFlags    The message flags.
+     * @param[in] aMaxSize  The maximum size of the message.
+     *
+     */
+    MessageWriter(uint16_t aId, uint16_t aFlags, size_t aMaxSize);
+
+    /**
+     * This method appends a question.
+     *
+     * @retval TRUE   Successfully appended the question.
+     * @retval FALSE  The question doesn't fit, the message is left unchanged.
+     *
+     */
+    bool AppendQuestion(const Question &aQuestion);
+
+    /**
+     * This method appends a resource record.
+     *
+     * @param[in] aSection  The section of the record, any but `kQuestion`.
+     * @param[in] aRecord   The record.
+     *
+     * @retval TRUE   Successfully appended the record.
+     * @retval FALSE  The record doesn't fit, the message is left unchanged.
+     *
+     */
+    bool AppendRecord(Section aSection, const ResourceRecord &aRecord);
+
+    /**
+     * This method sets additional flags in the message header, e.g. the TC bit.
+     *
+     */
+    void AddFlags(uint16_t aFlags);
+
+    /**
+     * This method returns the number of entries in a section.
+     *
+     */
+    uint16_t GetCount(Section aSection) const { return mCounts[aSection]; }
+
+    /**
+     * This method indicates whether the message has neither questions nor records.
+     *
+     */
+    bool IsEmpty(void) const;
+
+    /**
+     * This method returns the message in its wire format.
+     *
+     */
+    const std::vector<uint8_t> &GetBuffer(void) const { return mBuffer; }
+
+private:
+    static constexpr size_t kHeaderSize = 12;
+
+    void AppendUint16(uint16_t aValue);
+    void AppendUint32(uint32_t aValue);
+    void AppendName(const std::string &aName, bool aCompress);
+    bool Commit(Section aSection, size_t aRollbackSize);
+
+    std::vector<uint8_t>            mBuffer;
+    std::map<std::string, uint16_t> mNameOffsets; // Lowercase name suffix -> offset.
+    uint16_t                        mCounts[kAdditional + 1];
+    Section                         mSection;
+    size_t                          mMaxSize;
+};
+
+/**
+ * This function escapes dots and backslashes in a single DNS label.
+ *
+ */
+std::string EscapeLabel(const std::string &aLabel);
+
+/**
+ * This function returns the first label of a name, unescaped.
+ *
+ * @param[in]  aName   The name in presentation format.
+ * @param[out] aRest   The remaining labels of the name.
+ *
+ */
+std::string SplitFirstLabel(const std::string &aName, std::string &aRest);
+
+/**
+ * This function compares two names case-insensitively.
+ *
+ */
+bool NameEquals(const std::string &aName, const std::string &aOther);
+
+/**
+ * This function returns the lowercase form of a name, as used to index names.
+ *
+ */
+std::string ToLowerName(const std::string &aName);
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_DNS_MESSAGE_HPP_
@@ -0,0 +1,230 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements interning of DNS names of mDNS registrations.
+ */
+
+#include "mdns/intern_table.hpp"
+
+#include <assert.h>
+#include <ctype.h>
+
+namespace otbr {
+
+namespace Mdns {
+
+constexpr NameTable::NameId NameTable::kNullNameId;
+
+NameTable::NameId NameTable::Acquire(const char *aName, size_t aLength)
+{
+    uint32_t hash = Hash(aName, aLength);
+    size_t   slot;
+    NameId   id;
+
+    if (!mSlots.empty())
+    {
+        slot = FindSlot(aName, aLength, hash);
+
+        if (mSlots[slot] != kNullNameId && mSlots[slot] != kTombstone)
+        {
+            id = mSlots[slot];
+            mEntries[id - 1].mRefCount++;
+            ExitNow();
+        }
+    }
+
+    // Keep the load factor (including tombstones) below 3/4.
+    if ((mUsedSlots + 1) * 4 > mSlots.size() * 3)
+    {
+        Rehash(mSize * 4);
+    }
+
+    if (!mFreeIds.empty())
+    {
+        id = mFreeIds.back();
+        mFreeIds.pop_back();
+        mEntries[id - 1].mName.assign(aName, aLength);
+    }
+    else
+    {
+        mEntries.push_back(Entry{std::string(aName, aLength), 0, 0});
+        id = static_cast<NameId>(mEntries.size());
+    }
+
+    mEntries[id - 1].mHash     = hash;
+    mEntries[id - 1].mRefCount = 1;
+
+    // `FindSlot` returns the first empty slot in the probe sequence for a missing name.
+    slot = FindSlot(aName, aLength, hash);
+
+    if (mSlots[slot] == kNullNameId)
+    {
+        mUsedSlots++;
+    }
+
+    mSlots[slot] = id;
+    mSize++;
+
+exit:
+    return id;
+}
+
+void NameTable::Release(NameId aId)
+{
+    size_t slot;
+
+    VerifyOrExit(aId != kNullNameId);
+
+    {
+        Entry &entry = mEntries[aId - 1];
+
+        assert(entry.mRefCount > 0);
+        VerifyOrExit(--entry.mRefCount == 0);
+
+        slot = FindSlot(entry.mName.data(), entry.mName.size(), entry.mHash);
+        assert(mSlots[slot] == aId);
+        mSlots[slot] = kTombstone;
+
+        // Free the characters now, the entry is recycled by the next `Acquire`.
+        std::string().swap(entry.mName);
+    }
+
+    mFreeIds.push_back(aId);
+    mSize--;
+
+exit:
+    return;
+}
+
+NameTable::NameId NameTable::Find(const char *aName, size_t aLength) const
+{
+    NameId id = kNullNameId;
+
+    VerifyOrExit(mSize > 0);
+    id = mSlots[FindSlot(aName, aLength, Hash(aName, aLength))];
+    id = (id == kTombstone) ? kNullNameId : id;
+
+exit:
+    return id;
+}
+
+uint32_t NameTable::Hash(const char *aName, size_t aLength)
+{
+    // FNV-1a over the lowercase name.
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        hash ^= static_cast<uint8_t>(tolower(static_cast<unsigned char>(aName[i])));
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+bool NameTable::Equals(const std::string &aName, const char *aOther, size_t aLength)
+{
+    bool equals = (aName.size() == aLength);
+
+    for (size_t i = 0; equals && i < aLength; i++)
+    {
+        equals = (tolower(static_cast<unsigned char>(aName[i])) == tolower(static_cast<unsigned char>(aOther[i])));
+    }
+
+    return equals;
+}
+
+size_t NameTable::FindSlot(const char *aName, size_t aLength, uint32_t aHash) const
+{
+    size_t mask  = mSlots.size() - 1;
+    size_t slot  = aHash & mask;
+    size_t empty = SIZE_MAX;
+
+    // Returns the slot holding the name if present, otherwise the first reusable
+    // (tombstone or empty) slot in the probe sequence.
+    while (mSlots[slot] != kNullNameId)
+    {
+        NameId id = mSlots[slot];
+
+        if (id == kTombstone)
+        {
+            empty = (empty == SIZE_MAX) ? slot : empty;
+        }
+        else if (mEntries[id - 1].mHash == aHash && Equals(mEntries[id - 1].mName, aName, aLength))
+        {
+            ExitNow(empty = slot);
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    empty = (empty == SIZE_MAX) ? slot : empty;
+
+exit:
+    return empty;
+}
+
+void NameTable::Rehash(size_t aCapacity)
+{
+    size_t capacity = kMinSlotCapacity;
+
+    while (capacity < aCapacity)
+    {
+        capacity <<= 1;
+    }
+
+    mSlots.assign(capacity, kNullNameId);
+    mUsedSlots = 0;
+
+    for (size_t i = 0; i < mEntries.size(); i++)
+    {
+        const Entry &entry = mEntries[i];
+        size_t       slot;
+
+        if (entry.mRefCount == 0)
+        {
+            continue;
+        }
+
+        slot = entry.mHash & (capacity - 1);
+
+        while (mSlots[slot] != kNullNameId)
+        {
+            slot = (slot + 1) & (capacity - 1);
+        }
+
+        mSlots[slot] = static_cast<NameId>(i + 1);
+        mUsedSlots++;
+    }
+}
+
+} // namespace Mdns
+
+} // namespace otbr
@@ -0,0 +1,509 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for interning DNS names and payloads of mDNS registrations.
+ */
+
+#ifndef OTBR_AGENT_MDNS_INTERN_TABLE_HPP_
+#define OTBR_AGENT_MDNS_INTERN_TABLE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements a case-insensitive intern table of DNS names.
+ *
+ * Each distinct name (compared case-insensitively per RFC 1035 section 2.3.3) is assigned a
+ * small integer ID which stays valid until the last reference to it is released. Lookups hash
+ * the name in place and never allocate. The table itself is a flat, open-addressing hash table
+ * with linear probing.
+ *
+ */
+class NameTable : private NonCopyable
+{
+public:
+    typedef uint32_t NameId;
+
+    static constexpr NameId kNullNameId = 0; ///< The ID which never refers to a name.
+
+    /**
+     * This method interns a name and takes a reference to it.
+     *
+     * @param[in] aName    A pointer to the name characters.
+     * @param[in] aLength  The name length.
+     *
+     * @returns The ID of the name.
+     *
+     */
+    NameId Acquire(const char *aName, size_t aLength);
+
+    /**
+     * This method interns a name and takes a reference to it.
+     *
+     * @param[in] aName  The name.
+     *
+     * @returns The ID of the name.
+     *
+     */
+    NameId Acquire(const std::string &aName) { return Acquire(aName.data(), aName.size()); }
+
+    /**
+     * This method releases a reference previously taken by `Acquire`.
+     *
+     * The name is removed from the table when its last reference is released.
+     *
+     * @param[in] aId  The ID of the name, or `kNullNameId`.
+     *
+     */
+    void Release(NameId aId);
+
+    /**
+     * This method looks up a name without interning it.
+     *
+     * @param[in] aName    A pointer to the name characters.
+     * @param[in] aLength  The name length.
+     *
+     * @returns The ID of the name, or `kNullNameId` if the name is not in the table.
+     *
+     */
+    NameId Find(const char *aName, size_t aLength) const;
+
+    /**
+     * This method looks up a name without interning it.
+     *
+     * @param[in] aName  The name.
+     *
+     * @returns The ID of the name, or `kNullNameId` if the name is not in the table.
+     *
+     */
+    NameId Find(const std::string &aName) const { return Find(aName.data(), aName.size()); }
+
+    /**
+     * This method returns the spelling of an interned name, as it was first acquired.
+     *
+     * @param[in] aId  The ID of an interned name.
+     *
+     * @returns The interned name.
+     *
+     */
+    const std::string &GetName(NameId aId) const { return mEntries[aId - 1].mName; }
+
+    /**
+     * This method returns the number of names in the table.
+     *
+     * @returns The number of names in the table.
+     *
+     */
+    size_t GetSize(void) const { return mSize; }
+
+private:
+    static constexpr NameId kTombstone       = UINT32_MAX;
+    static constexpr size_t kMinSlotCapacity = 16;
+
+    struct Entry
+    {
+        std::string mName;
+        uint32_t    mHash;
+        uint32_t    mRefCount;
+    };
+
+    static uint32_t Hash(const char *aName, size_t aLength);
+    static bool     Equals(const std::string &aName, const char *aOther, size_t aLength);
+
+    size_t FindSlot(const char *aName, size_t aLength, uint32_t aHash) const;
+    void   Rehash(size_t aCapacity);
+
+    std::vector<Entry>  mEntries; // Indexed by `NameId - 1`.
+    std::vector<NameId> mFreeIds;
+    std::vector<NameId> mSlots;
+    size_t              mSize      = 0;
+    size_t              mUsedSlots = 0; // Includes tombstones.
+};
+
+/**
+ * This class template implements a flat, open-addressing hash map keyed by 64-bit IDs.
+ *
+ * Keys and values are stored inline in one slot array which is probed linearly, so a lookup
+ * touches a few adjacent slots instead of chasing bucket nodes. Key 0 and `UINT64_MAX` are
+ * reserved. The method names follow the standard containers so that the map can replace a
+ * `std::unordered_map` at existing call sites.
+ *
+ * Erased and cleared values are moved out of the table before they are destroyed, so a value's
+ * destructor may modify the map.
+ *
+ */
+template <typename Value> class FlatIdMap : private NonCopyable
+{
+public:
+    typedef uint64_t              Key;
+    typedef std::pair<Key, Value> Slot;
+
+    template <typename SlotPointer> class IteratorBase
+    {
+    public:
+        IteratorBase(SlotPointer aSlot, SlotPointer aEnd)
+            : mSlot(aSlot)
+            , mEnd(aEnd)
+        {
+            SkipUnusedSlots();
+        }
+
+        typename std::remove_pointer<SlotPointer>::type &operator*(void) const { return *mSlot; }
+        SlotPointer                                      operator->(void) const { return mSlot; }
+
+        IteratorBase &operator++(void)
+        {
+            ++mSlot;
+            SkipUnusedSlots();
+            return *this;
+        }
+
+        bool operator==(const IteratorBase &aOther) const { return mSlot == aOther.mSlot; }
+        bool operator!=(const IteratorBase &aOther) const { return mSlot != aOther.mSlot; }
+
+    private:
+        void SkipUnusedSlots(void)
+        {
+            while (mSlot != mEnd && !IsUsed(mSlot->first))
+            {
+                ++mSlot;
+            }
+        }
+
+        SlotPointer mSlot;
+        SlotPointer mEnd;
+    };
+
+    typedef IteratorBase<Slot *>       Iterator;
+    typedef IteratorBase<const Slot *> ConstIterator;
+
+    Iterator      begin(void) { return Iterator(mSlots.data(), mSlots.data() + mSlots.size()); }
+    Iterator      end(void) { return Iterator(mSlots.data() + mSlots.size(), mSlots.data() + mSlots.size()); }
+    ConstIterator begin(void) const { return ConstIterator(mSlots.data(), mSlots.data() + mSlots.size()); }
+    ConstIterator end(void) const
+    {
+        return ConstIterator(mSlots.data() + mSlots.size(), mSlots.data() + mSlots.size());
+    }
+
+    /**
+     * This method returns the number of entries in the map.
+     *
+     */
+    size_t size(void) const { return mSize; }
+
+    /**
+     * This method looks up an entry.
+     *
+     * @param[in] aKey  The key.
+     *
+     * @returns An iterator to the entry, or `end()` if there is no entry for @p aKey.
+     *
+     */
+    Iterator find(Key aKey)
+    {
+        size_t slot = FindSlot(aKey);
+
+        return (IsUsed(aKey) && slot != kNotFound && mSlots[slot].first == aKey)
+                   ? Iterator(&mSlots[slot], mSlots.data() + mSlots.size())
+                   : end();
+    }
+
+    /**
+     * This method adds an entry unless the key is already present.
+     *
+     * @param[in] aKey    The key, neither 0 nor `UINT64_MAX`.
+     * @param[in] aValue  The value.
+     *
+     * @returns An iterator to the entry for @p aKey, and whether it was added.
+     *
+     */
+    std::pair<Iterator, bool> emplace(Key aKey, Value aValue)
+    {
+        Iterator it    = find(aKey);
+        bool     added = (it == end());
+        size_t   slot;
+
+        assert(aKey != kEmptyKey && aKey != kTombstoneKey);
+        VerifyOrExit(added);
+
+        // Keep the load factor (including tombstones) below 3/4.
+        if ((mUsedSlots + 1) * 4 > mSlots.size() * 3)
+        {
+            Rehash(mSize * 4);
+        }
+
+        slot = FindSlot(aKey);
+
+        if (mSlots[slot].first == kEmptyKey)
+        {
+            mUsedSlots++;
+        }
+
+        mSlots[slot].first  = aKey;
+        mSlots[slot].second = std::move(aValue);
+        mSize++;
+        it = Iterator(&mSlots[slot], mSlots.data() + mSlots.size());
+
+    exit:
+        return std::make_pair(it, added);
+    }
+
+    /**
+     * This method removes an entry.
+     *
+     * @param[in] aIterator  An iterator to the entry.
+     *
+     */
+    void erase(Iterator aIterator)
+    {
+        Value value = std::move(aIterator->second);
+
+        aIterator->first  = kTombstoneKey;
+        aIterator->second = Value();
+        mSize--;
+
+        // `value` is destroyed on return, once the map is consistent.
+    }
+
+    /**
+     * This method removes all entries.
+     *
+     */
+    void clear(void)
+    {
+        std::vector<Slot> slots;
+
+        slots.swap(mSlots);
+        mSize      = 0;
+        mUsedSlots = 0;
+
+        // `slots` is destroyed on return, once the map is consistent.
+    }
+
+private:
+    static constexpr Key    kEmptyKey        = 0;
+    static constexpr Key    kTombstoneKey    = UINT64_MAX;
+    static constexpr size_t kNotFound        = SIZE_MAX;
+    static constexpr size_t kMinSlotCapacity = 16;
+
+    static bool   IsUsed(Key aKey) { return aKey != kEmptyKey && aKey != kTombstoneKey; }
+    static size_t Hash(Key aKey) { return static_cast<size_t>((aKey * 0x9e3779b97f4a7c15ULL) >> 32); }
+
+    // Returns the slot holding the key if present, otherwise the first reusable (tombstone or
+    // empty) slot in the probe sequence.
+    size_t FindSlot(Key aKey) const
+    {
+        size_t mask  = mSlots.size() - 1;
+        size_t slot  = Hash(aKey) & mask;
+        size_t empty = kNotFound;
+
+        VerifyOrExit(!mSlots.empty());
+
+        while (mSlots[slot].first != kEmptyKey)
+        {
+            if (mSlots[slot].first == kTombstoneKey)
+            {
+                empty = (empty == kNotFound) ? slot : empty;
+            }
+            else if (mSlots[slot].first == aKey)
+            {
+                ExitNow(empty = slot);
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        empty = (empty == kNotFound) ? slot : empty;
+
+    exit:
+        return empty;
+    }
+
+    void Rehash(size_t aCapacity)
+    {
+        std::vector<Slot> slots;
+        size_t            capacity = kMinSlotCapacity;
+
+        while (capacity < aCapacity)
+        {
+            capacity <<= 1;
+        }
+
+        slots.swap(mSlots);
+        mSlots.resize(capacity);
+        mUsedSlots = 0;
+
+        for (Slot &entry : slots)
+        {
+            size_t slot;
+
+            if (!IsUsed(entry.first))
+            {
+                continue;
+            }
+
+            slot = Hash(entry.first) & (capacity - 1);
+
+            while (mSlots[slot].first != kEmptyKey)
+            {
+                slot = (slot + 1) & (capacity - 1);
+            }
+
+            mSlots[slot] = std::move(entry);
+            mUsedSlots++;
+        }
+    }
+
+    std::vector<Slot> mSlots;
+    size_t            mSize      = 0;
+    size_t            mUsedSlots = 0; // Includes tombstones.
+};
+
+template <typename Value> constexpr typename FlatIdMap<Value>::Key FlatIdMap<Value>::kEmptyKey;
+template <typename Value> constexpr typename FlatIdMap<Value>::Key FlatIdMap<Value>::kTombstoneKey;
+template <typename Value> constexpr size_t                         FlatIdMap<Value>::kNotFound;
+template <typename Value> constexpr size_t                         FlatIdMap<Value>::kMinSlotCapacity;
+
+/**
+ * This class template implements a table of shared, immutable payloads.
+ *
+ * Equal payloads shared through the same table are backed by a single copy which is freed
+ * with its last reference.
+ *
+ */
+template <typename Payload> class PayloadTable : private NonCopyable
+{
+public:
+    typedef std::shared_ptr<const Payload> PayloadPtr;
+
+    /**
+     * This method returns a shared copy of a payload.
+     *
+     * @param[in] aPayload  The payload.
+     * @param[in] aHash     The hash value of @p aPayload.
+     *
+     * @returns A shared pointer to an immutable payload equal to @p aPayload.
+     *
+     */
+    PayloadPtr Share(const Payload &aPayload, size_t aHash)
+    {
+        PayloadPtr payload;
+        auto       range = mPayloads.equal_range(aHash);
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            payload = it->second.mPayload.lock();
+
+            if (payload != nullptr && *payload == aPayload)
+            {
+                ExitNow();
+            }
+        }
+
+        payload = PayloadPtr(new Payload(aPayload), Deleter(*this, aHash));
+        mPayloads.emplace(aHash, Entry{payload.get(), payload});
+
+    exit:
+        return payload;
+    }
+
+    /**
+     * This method returns the number of distinct payloads in the table.
+     *
+     * @returns The number of distinct payloads in the table.
+     *
+     */
+    size_t GetSize(void) const { return mPayloads.size(); }
+
+private:
+    struct Entry
+    {
+        const Payload               *mRaw;
+        std::weak_ptr<const Payload> mPayload;
+    };
+
+    class Deleter
+    {
+    public:
+        Deleter(PayloadTable &aTable, size_t aHash)
+            : mTable(&aTable)
+            , mHash(aHash)
+        {
+        }
+
+        void operator()(const Payload *aPayload) const
+        {
+            mTable->Remove(aPayload, mHash);
+            delete aPayload;
+        }
+
+    private:
+        PayloadTable *mTable;
+        size_t        mHash;
+    };
+
+    void Remove(const Payload *aPayload, size_t aHash)
+    {
+        auto range = mPayloads.equal_range(aHash);
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second.mRaw == aPayload)
+            {
+                mPayloads.erase(it);
+                break;
+            }
+        }
+    }
+
+    std::unordered_multimap<size_t, Entry> mPayloads;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_INTERN_TABLE_HPP_
@@ -38,6 +38,7 @@
 #if OTBR_ENABLE_MDNS
 
 #include <assert.h>
+#include <strings.h>
 
 #include <algorithm>
 #include <functional>
@@ -49,6 +50,40 @@ namespace otbr {
 
 namespace Mdns {
 
+static constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+
+static uint32_t HashBytes(uint32_t aHash, const void *aBytes, size_t aLength)
+{
+    // FNV-1a.
+    const uint8_t *bytes = static_cast<const uint8_t *>(aBytes);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aHash ^= bytes[i];
+        aHash *= 16777619u;
+    }
+
+    return aHash;
+}
+
+static size_t HashTxtData(const Publisher::TxtData &aTxtData)
+{
+    return HashBytes(kFnvOffsetBasis, aTxtData.data(), aTxtData.size());
+}
+
+static size_t HashSubTypeList(const Publisher::SubTypeList &aSubTypeList)
+{
+    uint32_t hash = kFnvOffsetBasis;
+
+    for (const std::string &subType : aSubTypeList)
+    {
+        // Includes the terminating null character to separate the subtypes.
+        hash = HashBytes(hash, subType.c_str(), subType.size() + 1);
+    }
+
+    return hash;
+}
+
 void Publisher::PublishService(const std::string &aHostName,
                                const std::string &aName,
                                const std::string &aType,
@@ -110,109 +145,311 @@ void Publisher::OnHostResolveFailed(std::string aHostName, int32_t aErrorCode)
 
 otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t> &aTxtData)
 {
-    otbrError error = OTBR_ERROR_NONE;
-
-    aTxtData.clear();
+    TxtBuilder builder(aTxtData);
 
     for (const TxtEntry &txtEntry : aTxtList)
     {
-        size_t entryLength = txtEntry.mKey.length();
-
-        if (!txtEntry.mIsBooleanAttribute)
+        if (txtEntry.mIsBooleanAttribute)
+        {
+            builder.AppendBooleanAttribute(txtEntry.mKey.c_str());
+        }
+        else
         {
-            entryLength += txtEntry.mValue.size() + sizeof(uint8_t); // for `=` char.
+            builder.AppendEntry(txtEntry.mKey.c_str(), txtEntry.mValue.data(), txtEntry.mValue.size());
         }
+    }
 
-        VerifyOrExit(entryLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
+    return builder.Finish();
+}
 
-        aTxtData.push_back(static_cast<uint8_t>(entryLength));
-        aTxtData.insert(aTxtData.end(), txtEntry.mKey.begin(), txtEntry.mKey.end());
+otbrError Publisher::DecodeTxtData(Publisher::TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength)
+{
+    otbrError         error = OTBR_ERROR_NONE;
+    TxtView           view(aTxtData, aTxtLength);
+    TxtView::Iterator iterator = TxtView::kIteratorInit;
+    TxtView::Entry    entry;
+
+    aTxtList.clear();
 
-        if (!txtEntry.mIsBooleanAttribute)
+    while ((error = view.GetNextEntry(iterator, entry)) == OTBR_ERROR_NONE)
+    {
+        if (entry.mIsBooleanAttribute)
+        {
+            aTxtList.emplace_back(entry.mKey, entry.mKeyLength);
+        }
+        else
         {
-            aTxtData.push_back('=');
-            aTxtData.insert(aTxtData.end(), txtEntry.mValue.begin(), txtEntry.mValue.end());
+            aTxtList.emplace_back(entry.mKey, entry.mKeyLength, entry.mValue, entry.mValueLength);
         }
     }
 
-    if (aTxtData.empty())
+    if (error == OTBR_ERROR_NOT_FOUND)
     {
-        aTxtData.push_back(0);
+        error = OTBR_ERROR_NONE;
     }
 
-exit:
     return error;
 }
 
-otbrError Publisher::DecodeTxtData(Publisher::TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength)
+constexpr Publisher::TxtView::Iterator Publisher::TxtView::kIteratorInit;
+
+bool Publisher::TxtView::Entry::KeyMatches(const char *aKey) const
 {
-    otbrError error = OTBR_ERROR_NONE;
+    return strlen(aKey) == mKeyLength && strncasecmp(aKey, mKey, mKeyLength) == 0;
+}
 
-    aTxtList.clear();
+otbrError Publisher::TxtView::GetNextEntry(Iterator &aIterator, Entry &aEntry) const
+{
+    otbrError error = OTBR_ERROR_NOT_FOUND;
 
-    for (uint16_t r = 0; r < aTxtLength;)
+    while (aIterator < mTxtLength)
     {
-        uint16_t entrySize = aTxtData[r];
-        uint16_t keyStart  = r + 1;
+        uint16_t entrySize = mTxtData[aIterator];
+        uint16_t keyStart  = aIterator + 1;
         uint16_t entryEnd  = keyStart + entrySize;
         uint16_t keyEnd    = keyStart;
 
-        VerifyOrExit(entryEnd <= aTxtLength, error = OTBR_ERROR_PARSE);
+        VerifyOrExit(entryEnd <= mTxtLength, error = OTBR_ERROR_PARSE);
+        aIterator = entryEnd;
 
-        while (keyEnd < entryEnd && aTxtData[keyEnd] != '=')
+        while (keyEnd < entryEnd && mTxtData[keyEnd] != '=')
         {
             keyEnd++;
         }
 
+        if (keyEnd == keyStart)
+        {
+            // Skip empty entries and entries with an empty key.
+            continue;
+        }
+
+        aEntry.mKey       = reinterpret_cast<const char *>(&mTxtData[keyStart]);
+        aEntry.mKeyLength = static_cast<uint8_t>(keyEnd - keyStart);
+
         if (keyEnd == entryEnd)
         {
-            if (keyEnd > keyStart)
-            {
-                // No `=`, treat as a boolean attribute.
-                aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart);
-            }
+            // No `=`, treat as a boolean attribute.
+            aEntry.mValue              = nullptr;
+            aEntry.mValueLength        = 0;
+            aEntry.mIsBooleanAttribute = true;
         }
         else
         {
             uint16_t valStart = keyEnd + 1; // To skip over `=`
 
-            aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart,
-                                  &aTxtData[valStart], entryEnd - valStart);
+            aEntry.mValue              = &mTxtData[valStart];
+            aEntry.mValueLength        = static_cast<uint8_t>(entryEnd - valStart);
+            aEntry.mIsBooleanAttribute = false;
         }
 
-        r += entrySize + 1;
+        ExitNow(error = OTBR_ERROR_NONE);
     }
 
 exit:
     return error;
 }
 
+otbrError Publisher::TxtView::FindEntry(const char *aKey, Entry &aEntry) const
+{
+    otbrError error;
+    Iterator  iterator = kIteratorInit;
+
+    while ((error = GetNextEntry(iterator, aEntry)) == OTBR_ERROR_NONE)
+    {
+        if (aEntry.KeyMatches(aKey))
+        {
+            break;
+        }
+    }
+
+    return error;
+}
+
+Publisher::TxtBuilder::TxtBuilder(TxtData &aTxtData)
+    : mTxtData(aTxtData)
+    , mError(OTBR_ERROR_NONE)
+{
+    mTxtData.clear();
+}
+
+otbrError Publisher::TxtBuilder::AppendEntry(const char *aKey, const uint8_t *aValue, size_t aValueLength)
+{
+    return InsertEntry(mTxtData.size(), aKey, strlen(aKey), aValue, aValueLength, /* aIsBooleanAttribute */ false);
+}
+
+otbrError Publisher::TxtBuilder::AppendBooleanAttribute(const char *aKey)
+{
+    return InsertEntry(mTxtData.size(), aKey, strlen(aKey), nullptr, 0, /* aIsBooleanAttribute */ true);
+}
+
+otbrError Publisher::TxtBuilder::SetEntry(const char *aKey, const uint8_t *aValue, size_t aValueLength)
+{
+    TxtView           view(mTxtData);
+    TxtView::Iterator iterator = TxtView::kIteratorInit;
+    TxtView::Entry    entry;
+    size_t            position = mTxtData.size();
+
+    while (view.GetNextEntry(iterator, entry) == OTBR_ERROR_NONE)
+    {
+        if (entry.KeyMatches(aKey))
+        {
+            // The length byte of an entry immediately precedes its key.
+            position = static_cast<size_t>(reinterpret_cast<const uint8_t *>(entry.mKey) - mTxtData.data()) - 1;
+            break;
+        }
+    }
+
+    return InsertEntry(position, aKey, strlen(aKey), aValue, aValueLength, /* aIsBooleanAttribute */ false,
+                       iterator - position);
+}
+
+otbrError Publisher::TxtBuilder::InsertEntry(size_t         aPosition,
+                                             const char    *aKey,
+                                             size_t         aKeyLength,
+                                             const uint8_t *aValue,
+                                             size_t         aValueLength,
+                                             bool           aIsBooleanAttribute,
+                                             size_t         aReplacedLength)
+{
+    otbrError         error       = OTBR_ERROR_NONE;
+    size_t            entryLength = aKeyLength;
+    TxtData::iterator it;
+
+    if (!aIsBooleanAttribute)
+    {
+        entryLength += aValueLength + sizeof(uint8_t); // for `=` char.
+    }
+
+    VerifyOrExit(entryLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
+
+    it = mTxtData.erase(mTxtData.begin() + aPosition, mTxtData.begin() + aPosition + aReplacedLength);
+    it = mTxtData.insert(it, static_cast<uint8_t>(entryLength)) + 1;
+    it = mTxtData.insert(it, aKey, aKey + aKeyLength) + aKeyLength;
+
+    if (!aIsBooleanAttribute)
+    {
+        it = mTxtData.insert(it, '=') + 1;
+        mTxtData.insert(it, aValue, aValue + aValueLength);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE && mError == OTBR_ERROR_NONE)
+    {
+        mError = error;
+    }
+
+    return error;
+}
+
+otbrError Publisher::TxtBuilder::Finish(void)
+{
+    if (mTxtData.empty())
+    {
+        mTxtData.push_back(0);
+    }
+
+    return mError;
+}
+
 void Publisher::RemoveSubscriptionCallbacks(uint64_t aSubscriberId)
 {
-    mDiscoverCallbacks.remove_if(
-        [aSubscriberId](const DiscoverCallback &aCallback) { return (aCallback.mId == aSubscriberId); });
+    for (DiscoverCallbackMap::iterator it = mDiscoverCallbacks.begin(); it != mDiscoverCallbacks.end(); ++it)
+    {
+        DiscoverCallbackList &callbacks = it->second;
+
+        for (DiscoverCallbackList::iterator callback = callbacks.begin(); callback != callbacks.end(); ++callback)
+        {
+            if (callback->mId != aSubscriberId || callback->mRemoved)
+            {
+                continue;
+            }
+
+            if (mDispatchDepth > 0)
+            {
+                // The callback may be running right now, so it is only erased once dispatching ends.
+                callback->mRemoved   = true;
+                mHasRemovedCallbacks = true;
+            }
+            else
+            {
+                callbacks.erase(callback);
+
+                if (callbacks.empty())
+                {
+                    mDiscoverCallbacks.erase(it);
+                }
+            }
+
+            ExitNow();
+        }
+    }
+
+exit:
+    return;
 }
 
 uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanceCallback aInstanceCallback,
                                              Publisher::DiscoveredHostCallback            aHostCallback)
+{
+    return AddSubscriptionCallbacks(/* aServiceType */ "", std::move(aInstanceCallback), std::move(aHostCallback));
+}
+
+uint64_t Publisher::AddSubscriptionCallbacks(const std::string                           &aServiceType,
+                                             Publisher::DiscoveredServiceInstanceCallback aInstanceCallback,
+                                             Publisher::DiscoveredHostCallback            aHostCallback)
 {
     uint64_t id = mNextSubscriberId++;
 
     assert(id > 0);
-    mDiscoverCallbacks.emplace_back(id, aInstanceCallback, aHostCallback);
+    mDiscoverCallbacks[aServiceType].emplace_back(id, std::move(aInstanceCallback), std::move(aHostCallback));
 
     return id;
 }
 
-void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
+bool Publisher::ServiceTypeLess::operator()(const std::string &aLhs, const std::string &aRhs) const
+{
+    return strcasecmp(aLhs.c_str(), aRhs.c_str()) < 0;
+}
+
+void Publisher::EndDispatch(void)
 {
-    bool checkToInvoke = false;
+    assert(mDispatchDepth > 0);
+
+    VerifyOrExit(--mDispatchDepth == 0);
+
+    mDeferredReleases.clear();
+
+    VerifyOrExit(mHasRemovedCallbacks);
+    mHasRemovedCallbacks = false;
+
+    for (DiscoverCallbackMap::iterator it = mDiscoverCallbacks.begin(); it != mDiscoverCallbacks.end();)
+    {
+        it->second.remove_if([](const DiscoverCallback &aCallback) { return aCallback.mRemoved; });
+
+        if (it->second.empty())
+        {
+            it = mDiscoverCallbacks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+exit:
+    return;
+}
+
+void Publisher::OnServiceResolved(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    // Only subscribers which exist when the event arrives receive it.
+    const uint64_t lastSubscriberId = mNextSubscriberId - 1;
 
     otbrLogInfo("Service %s is resolved successfully: %s %s host %s addresses %zu", aType.c_str(),
                 aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
                 aInstanceInfo.mAddresses.size());
 
-    if (!aInstanceInfo.mRemoved)
+    if (!aInstanceInfo.mRemoved && otbrLogGetLevel() >= OTBR_LOG_INFO)
     {
         std::string addressesString;
 
@@ -239,39 +476,35 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, OTBR_ERROR_NONE);
     UpdateServiceInstanceResolutionEmaLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
 
-    // The `mDiscoverCallbacks` list can get updated as the callbacks
-    // are invoked. We first mark `mShouldInvoke` on all non-null
-    // service callbacks. We clear it before invoking the callback
-    // and restart the iteration over the `mDiscoverCallbacks` list
-    // to find the next one to signal, since the list may have changed.
+    // Deliver to the subscribers of this service type, then to those of all types.
+    BeginDispatch();
+    InvokeServiceCallbacks(aType, lastSubscriberId, aType, aInstanceInfo);
+    InvokeServiceCallbacks(/* aSubscribedType */ "", lastSubscriberId, aType, aInstanceInfo);
+    EndDispatch();
+}
 
-    for (DiscoverCallback &callback : mDiscoverCallbacks)
-    {
-        if (callback.mServiceCallback != nullptr)
-        {
-            callback.mShouldInvoke = true;
-            checkToInvoke          = true;
-        }
-    }
+void Publisher::InvokeServiceCallbacks(const std::string            &aSubscribedType,
+                                       uint64_t                      aLastSubscriberId,
+                                       const std::string            &aType,
+                                       const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    DiscoverCallbackMap::iterator it = mDiscoverCallbacks.find(aSubscribedType);
 
-    while (checkToInvoke)
-    {
-        checkToInvoke = false;
+    VerifyOrExit(it != mDiscoverCallbacks.end());
 
-        for (DiscoverCallback &callback : mDiscoverCallbacks)
+    for (DiscoverCallback &callback : it->second)
+    {
+        if (callback.mId <= aLastSubscriberId && !callback.mRemoved && callback.mServiceCallback != nullptr)
         {
-            if (callback.mShouldInvoke)
-            {
-                callback.mShouldInvoke = false;
-                checkToInvoke          = true;
-                callback.mServiceCallback(aType, aInstanceInfo);
-                break;
-            }
+            callback.mServiceCallback(aType, aInstanceInfo);
         }
     }
+
+exit:
+    return;
 }
 
-void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::string aInstanceName)
+void Publisher::OnServiceRemoved(uint32_t aNetifIndex, const std::string &aType, const std::string &aInstanceName)
 {
     DiscoveredInstanceInfo instanceInfo;
 
@@ -284,9 +517,9 @@ void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::s
     OnServiceResolved(aType, instanceInfo);
 }
 
-void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfo aHostInfo)
+void Publisher::OnHostResolved(const std::string &aHostName, const Publisher::DiscoveredHostInfo &aHostInfo)
 {
-    bool checkToInvoke = false;
+    const uint64_t lastSubscriberId = mNextSubscriberId - 1;
 
     otbrLogInfo("Host %s is resolved successfully: host %s addresses %zu ttl %u", aHostName.c_str(),
                 aHostInfo.mHostName.c_str(), aHostInfo.mAddresses.size(), aHostInfo.mTtl);
@@ -299,36 +532,20 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, OTBR_ERROR_NONE);
     UpdateHostResolutionEmaLatency(aHostName, OTBR_ERROR_NONE);
 
-    // The `mDiscoverCallbacks` list can get updated as the callbacks
-    // are invoked. We first mark `mShouldInvoke` on all non-null
-    // host callbacks. We clear it before invoking the callback
-    // and restart the iteration over the `mDiscoverCallbacks` list
-    // to find the next one to signal, since the list may have changed.
+    BeginDispatch();
 
-    for (DiscoverCallback &callback : mDiscoverCallbacks)
+    for (DiscoverCallbackMap::value_type &entry : mDiscoverCallbacks)
     {
-        if (callback.mHostCallback != nullptr)
-        {
-            callback.mShouldInvoke = true;
-            checkToInvoke          = true;
-        }
-    }
-
-    while (checkToInvoke)
-    {
-        checkToInvoke = false;
-
-        for (DiscoverCallback &callback : mDiscoverCallbacks)
+        for (DiscoverCallback &callback : entry.second)
         {
-            if (callback.mShouldInvoke)
+            if (callback.mId <= lastSubscriberId && !callback.mRemoved && callback.mHostCallback != nullptr)
             {
-                callback.mShouldInvoke = false;
-                checkToInvoke          = true;
                 callback.mHostCallback(aHostName, aHostInfo);
-                break;
             }
         }
     }
+
+    EndDispatch();
 }
 
 Publisher::SubTypeList Publisher::SortSubTypeList(SubTypeList aSubTypeList)
@@ -343,27 +560,50 @@ Publisher::AddressList Publisher::SortAddressList(AddressList aAddressList)
     return aAddressList;
 }
 
-std::string Publisher::MakeFullServiceName(const std::string &aName, const std::string &aType)
+std::string Publisher::MakeFullName(const std::string &aName)
 {
-    return aName + "." + aType + ".local";
+    return aName + ".local";
 }
 
-std::string Publisher::MakeFullName(const std::string &aName)
+bool Publisher::FindServiceTypeOffset(const std::string &aName, size_t &aTypeOffset)
 {
-    return aName + ".local";
+    // Matches "<instance>.<_service>.<_udp|_tcp>" with a non-empty instance label.
+    size_t protocolDot = aName.rfind('.');
+    size_t serviceDot;
+    bool   found = false;
+
+    VerifyOrExit(protocolDot != std::string::npos && protocolDot > 0);
+    VerifyOrExit(strcasecmp(aName.c_str() + protocolDot + 1, "_udp") == 0 ||
+                 strcasecmp(aName.c_str() + protocolDot + 1, "_tcp") == 0);
+
+    serviceDot = aName.rfind('.', protocolDot - 1);
+    VerifyOrExit(serviceDot != std::string::npos && serviceDot > 0 && aName[serviceDot + 1] == '_');
+
+    aTypeOffset = serviceDot + 1;
+    found       = true;
+
+exit:
+    return found;
 }
 
 void Publisher::AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg)
 {
-    mServiceRegistrations.emplace(MakeFullServiceName(aServiceReg->mName, aServiceReg->mType), std::move(aServiceReg));
+    RegistrationKey key = aServiceReg->GetKey();
+
+    mServiceRegistrations.emplace(key, std::move(aServiceReg));
 }
 
 void Publisher::RemoveServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError)
 {
-    auto                   it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    NameTable::NameId      nameId = mNameTable.Find(aName);
+    NameTable::NameId      typeId = mNameTable.Find(aType);
+    auto                   it     = mServiceRegistrations.end();
     ServiceRegistrationPtr serviceReg;
 
     otbrLogInfo("Removing service %s.%s", aName.c_str(), aType.c_str());
+    VerifyOrExit(nameId != NameTable::kNullNameId && typeId != NameTable::kNullNameId);
+
+    it = mServiceRegistrations.find(MakeRegistrationKey(nameId, typeId));
     VerifyOrExit(it != mServiceRegistrations.end());
 
     // Keep the ServiceRegistration around before calling `Complete`
@@ -379,16 +619,41 @@ exit:
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    ServiceRegistration *serviceReg = nullptr;
+    NameTable::NameId    nameId     = mNameTable.Find(aName);
+    NameTable::NameId    typeId     = mNameTable.Find(aType);
+    auto                 it         = mServiceRegistrations.end();
+
+    VerifyOrExit(nameId != NameTable::kNullNameId && typeId != NameTable::kNullNameId);
 
-    return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
+    it = mServiceRegistrations.find(MakeRegistrationKey(nameId, typeId));
+    VerifyOrExit(it != mServiceRegistrations.end());
+    serviceReg = it->second.get();
+
+exit:
+    return serviceReg;
 }
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aNameAndType)
 {
-    auto it = mServiceRegistrations.find(MakeFullName(aNameAndType));
+    ServiceRegistration *serviceReg = nullptr;
+    size_t               typeOffset;
+    NameTable::NameId    nameId;
+    NameTable::NameId    typeId;
+    auto                 it = mServiceRegistrations.end();
+
+    VerifyOrExit(FindServiceTypeOffset(aNameAndType, typeOffset));
+
+    nameId = mNameTable.Find(aNameAndType.data(), typeOffset - 1);
+    typeId = mNameTable.Find(aNameAndType.data() + typeOffset, aNameAndType.size() - typeOffset);
+    VerifyOrExit(nameId != NameTable::kNullNameId && typeId != NameTable::kNullNameId);
 
-    return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
+    it = mServiceRegistrations.find(MakeRegistrationKey(nameId, typeId));
+    VerifyOrExit(it != mServiceRegistrations.end());
+    serviceReg = it->second.get();
+
+exit:
+    return serviceReg;
 }
 
 Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const std::string &aHostName,
@@ -471,12 +736,14 @@ exit:
 
 void Publisher::AddHostRegistration(HostRegistrationPtr &&aHostReg)
 {
-    mHostRegistrations.emplace(MakeFullHostName(aHostReg->mName), std::move(aHostReg));
+    RegistrationKey key = aHostReg->GetKey();
+
+    mHostRegistrations.emplace(key, std::move(aHostReg));
 }
 
 void Publisher::RemoveHostRegistration(const std::string &aName, otbrError aError)
 {
-    auto                it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto                it = mHostRegistrations.find(mNameTable.Find(aName));
     HostRegistrationPtr hostReg;
 
     otbrLogInfo("Removing host %s", aName.c_str());
@@ -496,7 +763,7 @@ exit:
 
 Publisher::HostRegistration *Publisher::FindHostRegistration(const std::string &aName)
 {
-    auto it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto it = mHostRegistrations.find(mNameTable.Find(aName));
 
     return it != mHostRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -540,16 +807,20 @@ exit:
 
 void Publisher::AddKeyRegistration(KeyRegistrationPtr &&aKeyReg)
 {
-    mKeyRegistrations.emplace(MakeFullKeyName(aKeyReg->mName), std::move(aKeyReg));
+    RegistrationKey key = aKeyReg->GetKey();
+
+    mKeyRegistrations.emplace(key, std::move(aKeyReg));
 }
 
 void Publisher::RemoveKeyRegistration(const std::string &aName, otbrError aError)
 {
-    auto               it = mKeyRegistrations.find(MakeFullKeyName(aName));
+    KeyRegistration   *keyRegToRemove = FindKeyRegistration(aName);
     KeyRegistrationPtr keyReg;
+    auto               it = mKeyRegistrations.end();
 
     otbrLogInfo("Removing key %s", aName.c_str());
-    VerifyOrExit(it != mKeyRegistrations.end());
+    VerifyOrExit(keyRegToRemove != nullptr);
+    it = mKeyRegistrations.find(keyRegToRemove->GetKey());
 
     // Keep the KeyRegistration around before calling `Complete`
     // to invoke the callback. This is for avoiding invalid access
@@ -565,16 +836,48 @@ exit:
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName)
 {
-    auto it = mKeyRegistrations.find(MakeFullKeyName(aName));
+    KeyRegistration  *keyReg = nullptr;
+    size_t            typeOffset;
+    NameTable::NameId nameId;
+    NameTable::NameId typeId = NameTable::kNullNameId;
+    auto              it     = mKeyRegistrations.end();
 
-    return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
+    if (FindServiceTypeOffset(aName, typeOffset))
+    {
+        nameId = mNameTable.Find(aName.data(), typeOffset - 1);
+        typeId = mNameTable.Find(aName.data() + typeOffset, aName.size() - typeOffset);
+        VerifyOrExit(typeId != NameTable::kNullNameId);
+    }
+    else
+    {
+        nameId = mNameTable.Find(aName);
+    }
+
+    VerifyOrExit(nameId != NameTable::kNullNameId);
+
+    it = mKeyRegistrations.find(MakeRegistrationKey(nameId, typeId));
+    VerifyOrExit(it != mKeyRegistrations.end());
+    keyReg = it->second.get();
+
+exit:
+    return keyReg;
 }
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mKeyRegistrations.find(MakeFullServiceName(aName, aType));
+    KeyRegistration  *keyReg = nullptr;
+    NameTable::NameId nameId = mNameTable.Find(aName);
+    NameTable::NameId typeId = mNameTable.Find(aType);
+    auto              it     = mKeyRegistrations.end();
+
+    VerifyOrExit(nameId != NameTable::kNullNameId && typeId != NameTable::kNullNameId);
+
+    it = mKeyRegistrations.find(MakeRegistrationKey(nameId, typeId));
+    VerifyOrExit(it != mKeyRegistrations.end());
+    keyReg = it->second.get();
 
-    return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
+exit:
+    return keyReg;
 }
 
 Publisher::Registration::~Registration(void)
@@ -582,6 +885,35 @@ Publisher::Registration::~Registration(void)
     TriggerCompleteCallback(OTBR_ERROR_ABORTED);
 }
 
+Publisher::ServiceRegistration::ServiceRegistration(std::string      aHostName,
+                                                    std::string      aName,
+                                                    std::string      aType,
+                                                    SubTypeList      aSubTypeList,
+                                                    uint16_t         aPort,
+                                                    const TxtData   &aTxtData,
+                                                    ResultCallback &&aCallback,
+                                                    Publisher       *aPublisher)
+    : Registration(std::move(aCallback), aPublisher)
+    , mHostName(std::move(aHostName))
+    , mName(std::move(aName))
+    , mType(std::move(aType))
+    , mPort(aPort)
+{
+    SubTypeList sortedSubTypeList = SortSubTypeList(std::move(aSubTypeList));
+
+    mSubTypeList = mPublisher->mSubTypeListTable.Share(sortedSubTypeList, HashSubTypeList(sortedSubTypeList));
+    mTxtData     = mPublisher->mTxtDataTable.Share(aTxtData, HashTxtData(aTxtData));
+    mNameId      = mPublisher->mNameTable.Acquire(mName);
+    mTypeId      = mPublisher->mNameTable.Acquire(mType);
+}
+
+Publisher::ServiceRegistration::~ServiceRegistration(void)
+{
+    OnComplete(OTBR_ERROR_ABORTED);
+    mPublisher->mNameTable.Release(mNameId);
+    mPublisher->mNameTable.Release(mTypeId);
+}
+
 bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
                                                 const std::string &aName,
                                                 const std::string &aType,
@@ -589,8 +921,8 @@ bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
                                                 uint16_t           aPort,
                                                 const TxtData     &aTxtData) const
 {
-    return !(mHostName == aHostName && mName == aName && mType == aType && mSubTypeList == aSubTypeList &&
-             mPort == aPort && mTxtData == aTxtData);
+    return !(mHostName == aHostName && mName == aName && mType == aType && *mSubTypeList == aSubTypeList &&
+             mPort == aPort && *mTxtData == aTxtData);
 }
 
 void Publisher::ServiceRegistration::Complete(otbrError aError)
@@ -608,6 +940,23 @@ void Publisher::ServiceRegistration::OnComplete(otbrError aError)
     }
 }
 
+Publisher::HostRegistration::HostRegistration(std::string      aName,
+                                              AddressList      aAddresses,
+                                              ResultCallback &&aCallback,
+                                              Publisher       *aPublisher)
+    : Registration(std::move(aCallback), aPublisher)
+    , mName(std::move(aName))
+    , mAddresses(SortAddressList(std::move(aAddresses)))
+    , mNameId(aPublisher->mNameTable.Acquire(mName))
+{
+}
+
+Publisher::HostRegistration::~HostRegistration(void)
+{
+    OnComplete(OTBR_ERROR_ABORTED);
+    mPublisher->mNameTable.Release(mNameId);
+}
+
 bool Publisher::HostRegistration::IsOutdated(const std::string &aName, const AddressList &aAddresses) const
 {
     return !(mName == aName && mAddresses == aAddresses);
@@ -628,6 +977,35 @@ void Publisher::HostRegistration::OnComplete(otbrError aError)
     }
 }
 
+Publisher::KeyRegistration::KeyRegistration(std::string      aName,
+                                            KeyData          aKeyData,
+                                            ResultCallback &&aCallback,
+                                            Publisher       *aPublisher)
+    : Registration(std::move(aCallback), aPublisher)
+    , mName(std::move(aName))
+    , mKeyData(std::move(aKeyData))
+    , mTypeId(NameTable::kNullNameId)
+{
+    size_t typeOffset;
+
+    if (FindServiceTypeOffset(mName, typeOffset))
+    {
+        mNameId = mPublisher->mNameTable.Acquire(mName.data(), typeOffset - 1);
+        mTypeId = mPublisher->mNameTable.Acquire(mName.data() + typeOffset, mName.size() - typeOffset);
+    }
+    else
+    {
+        mNameId = mPublisher->mNameTable.Acquire(mName);
+    }
+}
+
+Publisher::KeyRegistration::~KeyRegistration(void)
+{
+    OnComplete(OTBR_ERROR_ABORTED);
+    mPublisher->mNameTable.Release(mNameId);
+    mPublisher->mNameTable.Release(mTypeId);
+}
+
 bool Publisher::KeyRegistration::IsOutdated(const std::string &aName, const KeyData &aKeyData) const
 {
     return !(mName == aName && mKeyData == aKeyData);
@@ -700,6 +1078,20 @@ exit:
     return;
 }
 
+void Publisher::UpdateLatencyHistogram(LatencyHistogram   &aHistogram,
+                                       LatencyPercentiles &aPercentiles,
+                                       uint32_t            aLatency,
+                                       otbrError           aError)
+{
+    VerifyOrExit(aError != OTBR_ERROR_ABORTED);
+
+    aHistogram.Record(aLatency);
+    aHistogram.GetPercentiles(aPercentiles);
+
+exit:
+    return;
+}
+
 void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
                                                     const std::string &aType,
                                                     otbrError          aError)
@@ -710,6 +1102,8 @@ void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstance
     {
         uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mServiceRegistrationEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mServiceRegistrationLatencyHistogram,
+                               mTelemetryInfo.mLatencyPercentiles.mServiceRegistration, latency, aError);
         mServiceRegistrationBeginTime.erase(it);
     }
 }
@@ -722,6 +1116,8 @@ void Publisher::UpdateHostRegistrationEmaLatency(const std::string &aHostName, o
     {
         uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mHostRegistrationEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mHostRegistrationLatencyHistogram, mTelemetryInfo.mLatencyPercentiles.mHostRegistration,
+                               latency, aError);
         mHostRegistrationBeginTime.erase(it);
     }
 }
@@ -734,6 +1130,8 @@ void Publisher::UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otb
     {
         uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mKeyRegistrationEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mKeyRegistrationLatencyHistogram, mTelemetryInfo.mLatencyPercentiles.mKeyRegistration,
+                               latency, aError);
         mKeyRegistrationBeginTime.erase(it);
     }
 }
@@ -748,6 +1146,8 @@ void Publisher::UpdateServiceInstanceResolutionEmaLatency(const std::string &aIn
     {
         uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mServiceResolutionEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mServiceResolutionLatencyHistogram,
+                               mTelemetryInfo.mLatencyPercentiles.mServiceResolution, latency, aError);
         mServiceInstanceResolutionBeginTime.erase(it);
     }
 }
@@ -760,6 +1160,8 @@ void Publisher::UpdateHostResolutionEmaLatency(const std::string &aHostName, otb
     {
         uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mHostResolutionEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mHostResolutionLatencyHistogram, mTelemetryInfo.mLatencyPercentiles.mHostResolution,
+                               latency, aError);
         mHostResolutionBeginTime.erase(it);
     }
 }
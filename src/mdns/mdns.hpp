@@ -37,7 +37,7 @@
 #include "openthread-br/config.h"
 
 #ifndef OTBR_ENABLE_MDNS
-#define OTBR_ENABLE_MDNS (OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD)
+#define OTBR_ENABLE_MDNS (OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_BUILTIN)
 #endif
 
 #include <functional>
@@ -45,14 +45,17 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sys/select.h>
 
 #include "common/callback.hpp"
 #include "common/code_utils.hpp"
+#include "common/latency_histogram.hpp"
 #include "common/time.hpp"
 #include "common/types.hpp"
+#include "mdns/intern_table.hpp"
 
 namespace otbr {
 
@@ -125,6 +128,198 @@ public:
     typedef std::vector<Ip6Address>  AddressList;
     typedef std::vector<uint8_t>     KeyData;
 
+    /**
+     * This class provides a non-owning, read-only view of encoded TXT data.
+     *
+     * Entries are parsed in place while iterating, so no key or value is copied. The viewed buffer must outlive the
+     * view and any `Entry` read from it.
+     *
+     */
+    class TxtView
+    {
+    public:
+        /**
+         * This structure represents a TXT entry which points into the viewed buffer.
+         *
+         */
+        struct Entry
+        {
+            const char    *mKey;                ///< The key (not null-terminated).
+            uint8_t        mKeyLength;          ///< The key length.
+            const uint8_t *mValue;              ///< The value, or `nullptr` for a boolean attribute.
+            uint8_t        mValueLength;        ///< The value length.
+            bool           mIsBooleanAttribute; ///< This entry is boolean attribute (encoded as `key` without `=`).
+
+            /**
+             * This method indicates whether the key of this entry matches a given key, ignoring case.
+             *
+             * @param[in] aKey  A null-terminated key.
+             *
+             * @returns Whether the keys match.
+             *
+             */
+            bool KeyMatches(const char *aKey) const;
+        };
+
+        /**
+         * This type represents an iterator position. Initialize it to `kIteratorInit` before the first
+         * call to `GetNextEntry()`.
+         *
+         */
+        typedef uint16_t Iterator;
+
+        static constexpr Iterator kIteratorInit = 0;
+
+        /**
+         * The constructor of a TXT view.
+         *
+         * @param[in] aTxtData    A pointer to TXT data.
+         * @param[in] aTxtLength  The TXT data length.
+         *
+         */
+        TxtView(const uint8_t *aTxtData, uint16_t aTxtLength)
+            : mTxtData(aTxtData)
+            , mTxtLength(aTxtLength)
+        {
+        }
+
+        /**
+         * The constructor of a TXT view over an encoded TXT data buffer.
+         *
+         * @param[in] aTxtData  The TXT data buffer.
+         *
+         */
+        explicit TxtView(const TxtData &aTxtData)
+            : TxtView(aTxtData.data(), static_cast<uint16_t>(aTxtData.size()))
+        {
+        }
+
+        /**
+         * This method reads the next TXT entry. Empty entries and entries with an empty key are skipped.
+         *
+         * @param[in,out] aIterator  The iterator position.
+         * @param[out]    aEntry     The entry read.
+         *
+         * @retval OTBR_ERROR_NONE       Successfully read the next entry.
+         * @retval OTBR_ERROR_NOT_FOUND  There are no more entries.
+         * @retval OTBR_ERROR_PARSE      The TXT data has invalid format.
+         *
+         */
+        otbrError GetNextEntry(Iterator &aIterator, Entry &aEntry) const;
+
+        /**
+         * This method finds the first TXT entry with a given key. Keys are compared ignoring case as
+         * required by RFC 6763.
+         *
+         * @param[in]  aKey    A null-terminated key.
+         * @param[out] aEntry  The entry found.
+         *
+         * @retval OTBR_ERROR_NONE       Successfully found the entry.
+         * @retval OTBR_ERROR_NOT_FOUND  There is no entry with @p aKey.
+         * @retval OTBR_ERROR_PARSE      The TXT data has invalid format.
+         *
+         */
+        otbrError FindEntry(const char *aKey, Entry &aEntry) const;
+
+    private:
+        const uint8_t *mTxtData;
+        uint16_t       mTxtLength;
+    };
+
+    /**
+     * This class writes TXT entries directly into a caller-provided TXT data buffer.
+     *
+     * The buffer is cleared on construction but keeps its capacity, so a buffer reused across encodings stops
+     * allocating once it has grown to its working size.
+     *
+     */
+    class TxtBuilder
+    {
+    public:
+        /**
+         * The constructor of a TXT builder.
+         *
+         * @param[out] aTxtData  The TXT data buffer to write into. Will be cleared.
+         *
+         */
+        explicit TxtBuilder(TxtData &aTxtData);
+
+        /**
+         * This method appends a key/value entry.
+         *
+         * @param[in] aKey          A null-terminated key.
+         * @param[in] aValue        A pointer to the value.
+         * @param[in] aValueLength  The value length.
+         *
+         * @retval OTBR_ERROR_NONE          Successfully appended the entry.
+         * @retval OTBR_ERROR_INVALID_ARGS  The entry is too long.
+         *
+         */
+        otbrError AppendEntry(const char *aKey, const uint8_t *aValue, size_t aValueLength);
+
+        /**
+         * This method appends a key/value entry with a null-terminated string value.
+         *
+         * @param[in] aKey    A null-terminated key.
+         * @param[in] aValue  A null-terminated value.
+         *
+         * @retval OTBR_ERROR_NONE          Successfully appended the entry.
+         * @retval OTBR_ERROR_INVALID_ARGS  The entry is too long.
+         *
+         */
+        otbrError AppendEntry(const char *aKey, const char *aValue)
+        {
+            return AppendEntry(aKey, reinterpret_cast<const uint8_t *>(aValue), strlen(aValue));
+        }
+
+        /**
+         * This method appends a boolean attribute.
+         *
+         * @param[in] aKey  A null-terminated key.
+         *
+         * @retval OTBR_ERROR_NONE          Successfully appended the entry.
+         * @retval OTBR_ERROR_INVALID_ARGS  The entry is too long.
+         *
+         */
+        otbrError AppendBooleanAttribute(const char *aKey);
+
+        /**
+         * This method sets the value of the first entry with a given key in place, or appends a new
+         * entry if there is none.
+         *
+         * @param[in] aKey          A null-terminated key.
+         * @param[in] aValue        A pointer to the value.
+         * @param[in] aValueLength  The value length.
+         *
+         * @retval OTBR_ERROR_NONE          Successfully set the entry.
+         * @retval OTBR_ERROR_INVALID_ARGS  The entry is too long.
+         *
+         */
+        otbrError SetEntry(const char *aKey, const uint8_t *aValue, size_t aValueLength);
+
+        /**
+         * This method finishes the TXT data. An empty TXT data is encoded as a single empty string
+         * as required by RFC 6763. No entries should be added afterwards.
+         *
+         * @retval OTBR_ERROR_NONE          All entries were written.
+         * @retval OTBR_ERROR_INVALID_ARGS  At least one entry was too long and has been left out.
+         *
+         */
+        otbrError Finish(void);
+
+    private:
+        otbrError InsertEntry(size_t         aPosition,
+                              const char    *aKey,
+                              size_t         aKeyLength,
+                              const uint8_t *aValue,
+                              size_t         aValueLength,
+                              bool           aIsBooleanAttribute,
+                              size_t         aReplacedLength = 0);
+
+        TxtData  &mTxtData;
+        otbrError mError;
+    };
+
     /**
      * This structure represents information of a discovered service instance.
      *
@@ -215,6 +410,17 @@ public:
      */
     virtual bool IsStarted(void) const = 0;
 
+    /**
+     * This method sets the infrastructure network interface to publish and discover services on.
+     *
+     * A started publisher moves to the new interface and reports `State::kReady` again once it's there, so
+     * the records must be published again. Backends delegating to a system mDNS daemon ignore it.
+     *
+     * @param[in] aInfraIfName  The name of the infrastructure network interface.
+     *
+     */
+    virtual void SetInfraIf(const std::string &aInfraIfName) { OTBR_UNUSED_VARIABLE(aInfraIfName); }
+
     /**
      * This method publishes or updates a service.
      *
@@ -357,6 +563,9 @@ public:
     /**
      * This method sets the callbacks for subscriptions.
      *
+     * Callbacks may add or remove subscription callbacks. Callbacks added while an event is
+     * being delivered do not receive that event.
+     *
      * @param[in] aInstanceCallback  The callback function to receive discovered service instances.
      * @param[in] aHostCallback      The callback function to receive discovered hosts.
      *
@@ -366,6 +575,20 @@ public:
     uint64_t AddSubscriptionCallbacks(DiscoveredServiceInstanceCallback aInstanceCallback,
                                       DiscoveredHostCallback            aHostCallback);
 
+    /**
+     * This method sets the callbacks for subscriptions, receiving only service instances of a given type.
+     *
+     * @param[in] aServiceType       The service type, e.g. "_trel._udp". Compared ignoring case.
+     * @param[in] aInstanceCallback  The callback function to receive discovered service instances.
+     * @param[in] aHostCallback      The callback function to receive discovered hosts.
+     *
+     * @returns  The Subscriber ID for the callbacks.
+     *
+     */
+    uint64_t AddSubscriptionCallbacks(const std::string                &aServiceType,
+                                      DiscoveredServiceInstanceCallback aInstanceCallback,
+                                      DiscoveredHostCallback            aHostCallback);
+
     /**
      * This method cancels callbacks for subscriptions.
      *
@@ -469,38 +692,35 @@ protected:
         }
     };
 
+    // The key of a registration, made of the interned IDs of its name and, for service
+    // instances, its service type.
+    typedef uint64_t RegistrationKey;
+
     // TODO: We may need a registration ID to fetch the information of a registration.
     class ServiceRegistration : public Registration
     {
     public:
-        std::string mHostName;
-        std::string mName;
-        std::string mType;
-        SubTypeList mSubTypeList;
-        uint16_t    mPort;
-        TxtData     mTxtData;
+        std::string                        mHostName;
+        std::string                        mName;
+        std::string                        mType;
+        std::shared_ptr<const SubTypeList> mSubTypeList; // Sorted, shared with equal registrations.
+        uint16_t                           mPort;
+        std::shared_ptr<const TxtData>     mTxtData; // Shared with equal registrations.
 
         ServiceRegistration(std::string      aHostName,
                             std::string      aName,
                             std::string      aType,
                             SubTypeList      aSubTypeList,
                             uint16_t         aPort,
-                            TxtData          aTxtData,
+                            const TxtData   &aTxtData,
                             ResultCallback &&aCallback,
-                            Publisher       *aPublisher)
-            : Registration(std::move(aCallback), aPublisher)
-            , mHostName(std::move(aHostName))
-            , mName(std::move(aName))
-            , mType(std::move(aType))
-            , mSubTypeList(SortSubTypeList(std::move(aSubTypeList)))
-            , mPort(aPort)
-            , mTxtData(std::move(aTxtData))
-        {
-        }
-        ~ServiceRegistration(void) override { OnComplete(OTBR_ERROR_ABORTED); }
+                            Publisher       *aPublisher);
+        ~ServiceRegistration(void) override;
 
         void Complete(otbrError aError);
 
+        RegistrationKey GetKey(void) const { return MakeRegistrationKey(mNameId, mTypeId); }
+
         // Tells whether this `ServiceRegistration` object is outdated comparing to the given parameters.
         bool IsOutdated(const std::string &aHostName,
                         const std::string &aName,
@@ -511,6 +731,9 @@ protected:
 
     private:
         void OnComplete(otbrError aError);
+
+        NameTable::NameId mNameId;
+        NameTable::NameId mTypeId;
     };
 
     class HostRegistration : public Registration
@@ -519,22 +742,20 @@ protected:
         std::string mName;
         AddressList mAddresses;
 
-        HostRegistration(std::string aName, AddressList aAddresses, ResultCallback &&aCallback, Publisher *aPublisher)
-            : Registration(std::move(aCallback), aPublisher)
-            , mName(std::move(aName))
-            , mAddresses(SortAddressList(std::move(aAddresses)))
-        {
-        }
-
-        ~HostRegistration(void) override { OnComplete(OTBR_ERROR_ABORTED); }
+        HostRegistration(std::string aName, AddressList aAddresses, ResultCallback &&aCallback, Publisher *aPublisher);
+        ~HostRegistration(void) override;
 
         void Complete(otbrError aError);
 
+        RegistrationKey GetKey(void) const { return mNameId; }
+
         // Tells whether this `HostRegistration` object is outdated comparing to the given parameters.
         bool IsOutdated(const std::string &aName, const AddressList &aAddresses) const;
 
     private:
         void OnComplete(otbrError aError);
+
+        NameTable::NameId mNameId;
     };
 
     class KeyRegistration : public Registration
@@ -543,35 +764,43 @@ protected:
         std::string mName;
         KeyData     mKeyData;
 
-        KeyRegistration(std::string aName, KeyData aKeyData, ResultCallback &&aCallback, Publisher *aPublisher)
-            : Registration(std::move(aCallback), aPublisher)
-            , mName(std::move(aName))
-            , mKeyData(std::move(aKeyData))
-        {
-        }
-
-        ~KeyRegistration(void) { OnComplete(OTBR_ERROR_ABORTED); }
+        KeyRegistration(std::string aName, KeyData aKeyData, ResultCallback &&aCallback, Publisher *aPublisher);
+        ~KeyRegistration(void) override;
 
         void Complete(otbrError aError);
 
+        RegistrationKey GetKey(void) const { return MakeRegistrationKey(mNameId, mTypeId); }
+
         // Tells whether this `KeyRegistration` object is outdated comparing to the given parameters.
         bool IsOutdated(const std::string &aName, const KeyData &aKeyData) const;
 
     private:
         void OnComplete(otbrError aError);
+
+        // A key record of a service instance is keyed by its instance and type IDs,
+        // otherwise `mTypeId` is `kNullNameId`.
+        NameTable::NameId mNameId;
+        NameTable::NameId mTypeId;
     };
 
     using ServiceRegistrationPtr = std::unique_ptr<ServiceRegistration>;
-    using ServiceRegistrationMap = std::map<std::string, ServiceRegistrationPtr>;
+    using ServiceRegistrationMap = FlatIdMap<ServiceRegistrationPtr>;
     using HostRegistrationPtr    = std::unique_ptr<HostRegistration>;
-    using HostRegistrationMap    = std::map<std::string, HostRegistrationPtr>;
+    using HostRegistrationMap    = FlatIdMap<HostRegistrationPtr>;
     using KeyRegistrationPtr     = std::unique_ptr<KeyRegistration>;
-    using KeyRegistrationMap     = std::map<std::string, KeyRegistrationPtr>;
+    using KeyRegistrationMap     = FlatIdMap<KeyRegistrationPtr>;
+
+    static RegistrationKey MakeRegistrationKey(NameTable::NameId aNameId, NameTable::NameId aTypeId)
+    {
+        return (static_cast<RegistrationKey>(aNameId) << 32) | aTypeId;
+    }
+
+    // Finds the offset of the service type in a service instance name like "ins._srv._udp".
+    static bool FindServiceTypeOffset(const std::string &aName, size_t &aTypeOffset);
 
     static SubTypeList SortSubTypeList(SubTypeList aSubTypeList);
     static AddressList SortAddressList(AddressList aAddressList);
     static std::string MakeFullName(const std::string &aName);
-    static std::string MakeFullServiceName(const std::string &aName, const std::string &aType);
     static std::string MakeFullHostName(const std::string &aName) { return MakeFullName(aName); }
     static std::string MakeFullKeyName(const std::string &aName) { return MakeFullName(aName); }
 
@@ -602,12 +831,24 @@ protected:
     ServiceRegistration *FindServiceRegistration(const std::string &aName, const std::string &aType);
     ServiceRegistration *FindServiceRegistration(const std::string &aNameAndType);
 
-    void OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo);
+    // Backends pass fields of their subscription objects to `OnServiceResolved()`,
+    // `OnServiceRemoved()` and `OnHostResolved()`. A subscriber may unsubscribe while
+    // these are dispatching, so backends free subscription objects with
+    // `ReleaseAfterDispatch()`, which keeps them alive until dispatching ends.
+    void OnServiceResolved(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
     void OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode);
-    void OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::string aInstanceName);
-    void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo);
+    void OnServiceRemoved(uint32_t aNetifIndex, const std::string &aType, const std::string &aInstanceName);
+    void OnHostResolved(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
     void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode);
 
+    template <typename T> void ReleaseAfterDispatch(std::unique_ptr<T> aObject)
+    {
+        if (mDispatchDepth > 0)
+        {
+            mDeferredReleases.emplace_back(std::move(aObject));
+        }
+    }
+
     // Handles the cases that there is already a registration for the same service.
     // If the returned callback is completed, current registration should be considered
     // success and no further action should be performed.
@@ -638,6 +879,10 @@ protected:
 
     static void UpdateMdnsResponseCounters(MdnsResponseCounters &aCounters, otbrError aError);
     static void UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError);
+    static void UpdateLatencyHistogram(LatencyHistogram   &aHistogram,
+                                       LatencyPercentiles &aPercentiles,
+                                       uint32_t            aLatency,
+                                       otbrError           aError);
 
     void UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
                                              const std::string &aType,
@@ -652,6 +897,11 @@ protected:
     static void AddAddress(AddressList &aAddressList, const Ip6Address &aAddress);
     static void RemoveAddress(AddressList &aAddressList, const Ip6Address &aAddress);
 
+    // The intern tables must outlive the registrations referring to them.
+    NameTable                 mNameTable;
+    PayloadTable<TxtData>     mTxtDataTable;
+    PayloadTable<SubTypeList> mSubTypeListTable;
+
     ServiceRegistrationMap mServiceRegistrations;
     HostRegistrationMap    mHostRegistrations;
     KeyRegistrationMap     mKeyRegistrations;
@@ -664,19 +914,44 @@ protected:
             : mId(aId)
             , mServiceCallback(std::move(aServiceCallback))
             , mHostCallback(std::move(aHostCallback))
-            , mShouldInvoke(false)
+            , mRemoved(false)
         {
         }
 
         uint64_t                          mId;
         DiscoveredServiceInstanceCallback mServiceCallback;
         DiscoveredHostCallback            mHostCallback;
-        bool                              mShouldInvoke;
+        bool                              mRemoved; // Removed while dispatching, erased once dispatching ends.
+    };
+
+    struct ServiceTypeLess
+    {
+        bool operator()(const std::string &aLhs, const std::string &aRhs) const;
     };
 
+    // A `std::list` keeps a callback in place while it runs, even if it adds subscribers.
+    typedef std::list<DiscoverCallback>                                  DiscoverCallbackList;
+    typedef std::map<std::string, DiscoverCallbackList, ServiceTypeLess> DiscoverCallbackMap;
+
+    void BeginDispatch(void) { mDispatchDepth++; }
+    void EndDispatch(void);
+    void InvokeServiceCallbacks(const std::string            &aSubscribedType,
+                                uint64_t                      aLastSubscriberId,
+                                const std::string            &aType,
+                                const DiscoveredInstanceInfo &aInstanceInfo);
+
     uint64_t mNextSubscriberId = 1;
 
-    std::list<DiscoverCallback> mDiscoverCallbacks;
+    // Service type -> subscribers of that type. The empty type holds subscribers of all types.
+    //
+    // Subscriber IDs are increasing, so they double as epochs: an event is only delivered to
+    // subscribers whose ID is not newer than the last ID assigned when the event arrived.
+    DiscoverCallbackMap mDiscoverCallbacks;
+    uint32_t            mDispatchDepth       = 0;
+    bool                mHasRemovedCallbacks = false;
+
+    // Backend objects freed while dispatching, destroyed once dispatching ends.
+    std::vector<std::shared_ptr<void>> mDeferredReleases;
 
     // {instance name, service type} -> the timepoint to begin service registration
     std::map<std::pair<std::string, std::string>, Timepoint> mServiceRegistrationBeginTime;
@@ -690,6 +965,13 @@ protected:
     std::map<std::string, Timepoint> mHostResolutionBeginTime;
 
     MdnsTelemetryInfo mTelemetryInfo{};
+
+    // Latency distributions backing the percentile summaries in `mTelemetryInfo`.
+    LatencyHistogram mHostRegistrationLatencyHistogram;
+    LatencyHistogram mKeyRegistrationLatencyHistogram;
+    LatencyHistogram mServiceRegistrationLatencyHistogram;
+    LatencyHistogram mHostResolutionLatencyHistogram;
+    LatencyHistogram mServiceResolutionLatencyHistogram;
 };
 
 /**
@@ -524,8 +524,20 @@ void PublisherAvahi::Stop(void)
 {
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
+    mKeyRegistrations.clear();
 
+    for (std::unique_ptr<ServiceSubscription> &service : mSubscribedServices)
+    {
+        service->Release();
+        ReleaseAfterDispatch(std::move(service));
+    }
     mSubscribedServices.clear();
+
+    for (std::unique_ptr<HostSubscription> &host : mSubscribedHosts)
+    {
+        host->Release();
+        ReleaseAfterDispatch(std::move(host));
+    }
     mSubscribedHosts.clear();
 
     if (mClient)
@@ -1046,6 +1058,7 @@ void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::str
 
         mSubscribedServices.erase(it);
         service->Release();
+        ReleaseAfterDispatch(std::move(service));
     }
 
     otbrLogInfo("Unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
@@ -1105,6 +1118,7 @@ void PublisherAvahi::UnsubscribeHost(const std::string &aHostName)
 
         mSubscribedHosts.erase(it);
         host->Release();
+        ReleaseAfterDispatch(std::move(host));
     }
 
     otbrLogInfo("Unsubscribe host %s (remaining %zu)", aHostName.c_str(), mSubscribedHosts.size());
@@ -1408,7 +1422,7 @@ void PublisherAvahi::ServiceResolver::HandleResolveHostResult(AvahiRecordBrowser
 exit:
     if (resolved)
     {
-        // NOTE: This `HostSubscrption` object may be freed in `OnHostResolved`.
+        // NOTE: This `ServiceResolver` object may be released in `OnServiceResolved`.
         mPublisherAvahi->OnServiceResolved(mType, mInstanceInfo);
     }
     else if (avahiError != AVAHI_OK)
@@ -1436,7 +1450,8 @@ void PublisherAvahi::ServiceSubscription::RemoveServiceResolver(const std::strin
 
     for (auto resolver : mServiceResolvers[aInstanceName])
     {
-        delete resolver;
+        resolver->Release();
+        mPublisherAvahi->ReleaseAfterDispatch(std::unique_ptr<ServiceResolver>(resolver));
     }
 
     mServiceResolvers.erase(aInstanceName);
@@ -1446,6 +1461,21 @@ exit:
     return;
 }
 
+void PublisherAvahi::ServiceResolver::Release(void)
+{
+    if (mServiceResolver != nullptr)
+    {
+        avahi_service_resolver_free(mServiceResolver);
+        mServiceResolver = nullptr;
+    }
+
+    if (mRecordBrowser != nullptr)
+    {
+        avahi_record_browser_free(mRecordBrowser);
+        mRecordBrowser = nullptr;
+    }
+}
+
 void PublisherAvahi::HostSubscription::Release(void)
 {
     if (mRecordBrowser != nullptr)
@@ -1544,7 +1574,7 @@ void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiRecordBrowser
 exit:
     if (resolved)
     {
-        // NOTE: This `HostSubscrption` object may be freed in `OnHostResolved`.
+        // NOTE: This `HostSubscrption` object may be released in `OnHostResolved`.
         mPublisherAvahi->OnHostResolved(mHostName, mHostInfo);
     }
     else if (avahiError != AVAHI_OK)
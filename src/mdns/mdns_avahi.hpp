@@ -234,17 +234,9 @@ private:
 
     struct ServiceResolver
     {
-        ~ServiceResolver()
-        {
-            if (mServiceResolver)
-            {
-                avahi_service_resolver_free(mServiceResolver);
-            }
-            if (mRecordBrowser)
-            {
-                avahi_record_browser_free(mRecordBrowser);
-            }
-        }
+        ~ServiceResolver() { Release(); }
+
+        void Release(void);
 
         static void HandleResolveServiceResult(AvahiServiceResolver  *aServiceResolver,
                                                AvahiIfIndex           aInterfaceIndex,
@@ -0,0 +1,2280 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the built-in mDNS publisher.
+ */
+
+#define OTBR_LOG_TAG "MDNS"
+
+#include "mdns/mdns_builtin.hpp"
+
+#include <algorithm>
+
+#include <arpa/inet.h>
+#include <assert.h>
+#include <errno.h>
+#include <ifaddrs.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+namespace {
+
+const char kMdnsGroupIp6[]    = "ff02::fb";
+const char kMdnsGroupIp4[]    = "224.0.0.251";
+const char kServicesName[]    = "_services._dns-sd._udp.local";
+const char kDefaultHostName[] = "otbr";
+
+constexpr uint16_t kOpcodeRcodeMask           = 0x780f;
+constexpr size_t   kMaxReceiveSize            = 9000; // RFC 6762 section 17.
+constexpr uint32_t kProbeIntervalMs           = 250;
+constexpr uint32_t kAnnounceIntervalMs        = 1000;
+constexpr uint32_t kProbeConflictDelayMs      = 1000;
+constexpr uint32_t kMinMulticastIntervalMs    = 1000;
+constexpr uint32_t kMinProbeDefenseIntervalMs = 250;
+constexpr uint32_t kFirstQueryIntervalMs      = 1000;
+constexpr uint32_t kMaxQueryIntervalMs        = 60 * 60 * 1000;
+constexpr uint32_t kCacheFlushDelayMs         = 1000;
+constexpr uint32_t kAddressCheckIntervalMs    = 5000;
+
+ResourceRecord MakeRecord(const std::string &aName, uint16_t aType, uint32_t aTtl)
+{
+    ResourceRecord record;
+
+    record.mName  = aName;
+    record.mType  = aType;
+    record.mClass = kRrClassIn;
+    record.mTtl   = aTtl;
+
+    return record;
+}
+
+ResourceRecord MakePtrRecord(const std::string &aName, const std::string &aTarget, uint32_t aTtl)
+{
+    ResourceRecord record = MakeRecord(aName, kRrTypePtr, aTtl);
+
+    record.mTarget = aTarget;
+
+    return record;
+}
+
+uint16_t GetSourcePort(const sockaddr_storage &aSource)
+{
+    return ntohs(aSource.ss_family == AF_INET6 ? reinterpret_cast<const sockaddr_in6 &>(aSource).sin6_port
+                                               : reinterpret_cast<const sockaddr_in &>(aSource).sin_port);
+}
+
+bool ContainsRecord(const std::vector<ResourceRecord> &aRecords, const ResourceRecord &aRecord)
+{
+    return std::any_of(aRecords.begin(), aRecords.end(),
+                       [&aRecord](const ResourceRecord &aOther) { return aOther.IsSameAs(aRecord); });
+}
+
+} // namespace
+
+constexpr uint16_t PublisherBuiltin::kMdnsPort;
+constexpr uint32_t PublisherBuiltin::kHostRecordTtl;
+constexpr uint32_t PublisherBuiltin::kOtherRecordTtl;
+constexpr uint32_t PublisherBuiltin::kLegacyUnicastTtl;
+constexpr size_t   PublisherBuiltin::kMaxMessageSize;
+constexpr size_t   PublisherBuiltin::kMaxCacheEntries;
+constexpr uint8_t  PublisherBuiltin::kNumProbes;
+constexpr uint8_t  PublisherBuiltin::kNumAnnouncements;
+constexpr uint8_t  PublisherBuiltin::kNumRefreshes;
+
+PublisherBuiltin::PublisherBuiltin(StateCallback aCallback)
+    : mState(State::kIdle)
+    , mStateCallback(std::move(aCallback))
+    , mInfraIfIndex(0)
+    , mSockets{-1, -1}
+    , mNextGroupId(1)
+    , mSubscriptionsDirty(false)
+    , mNextFireTime(Timepoint::max())
+    , mRandom(static_cast<std::default_random_engine::result_type>(Clock::now().time_since_epoch().count()))
+{
+}
+
+PublisherBuiltin::~PublisherBuiltin(void)
+{
+    Stop();
+}
+
+void PublisherBuiltin::SetInfraIf(const std::string &aInfraIfName)
+{
+    VerifyOrExit(aInfraIfName != mInfraIfName);
+
+    mInfraIfName = aInfraIfName;
+    VerifyOrExit(mState == State::kReady);
+
+    // Stopping sends the goodbyes on the old interface. The users of the
+    // publisher publish their records again once it's ready on the new one.
+    otbrLogInfo("Infrastructure interface changed to %s, restarting mDNS responder", mInfraIfName.c_str());
+    Stop();
+    mStateCallback(State::kIdle);
+    (void)Start();
+
+exit:
+    return;
+}
+
+otbrError PublisherBuiltin::Start(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char      hostName[HOST_NAME_MAX + 1];
+
+    VerifyOrExit(mState != State::kReady);
+
+    SuccessOrExit(error = SelectInfraIf());
+    SuccessOrExit(error = OpenSocket(kIp6));
+
+    if (OpenSocket(kIp4) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("mDNS over IPv4 is disabled on %s", mInfraIfName.c_str());
+    }
+
+    if (gethostname(hostName, sizeof(hostName)) == 0)
+    {
+        hostName[sizeof(hostName) - 1] = '\0';
+        mLocalHostName                 = std::string(hostName, strcspn(hostName, "."));
+    }
+
+    if (mLocalHostName.empty())
+    {
+        mLocalHostName = kDefaultHostName;
+    }
+
+    otbrLogInfo("Started mDNS responder on %s (index %" PRIu32 ") as host %s", mInfraIfName.c_str(), mInfraIfIndex,
+                mLocalHostName.c_str());
+
+    mState = State::kReady;
+    PublishLocalHost();
+    mNextAddressCheck = Clock::now() + Milliseconds(kAddressCheckIntervalMs);
+    ScheduleTimer(mNextAddressCheck);
+
+    mStateCallback(State::kReady);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to start mDNS responder: %s", otbrErrorString(error));
+        CloseSockets();
+    }
+
+    return error;
+}
+
+bool PublisherBuiltin::IsStarted(void) const
+{
+    return mState == State::kReady;
+}
+
+void PublisherBuiltin::Stop(void)
+{
+    VerifyOrExit(mState == State::kReady);
+
+    // Destroying the registrations and the local host withdraws their
+    // records, so the goodbyes are sent before the sockets are closed.
+    mServiceRegistrations.clear();
+    mHostRegistrations.clear();
+    mKeyRegistrations.clear();
+    mLocalHostGroup.reset();
+    FlushGoodbyes();
+
+    mSubscribedServices.clear();
+    mSubscribedHosts.clear();
+    mQueries.clear();
+    mCache.clear();
+    mGroupResults.clear();
+
+    for (std::vector<PendingAnswer> &pendingAnswers : mPendingAnswers)
+    {
+        pendingAnswers.clear();
+    }
+
+    mSubscriptionsDirty = false;
+    mNextFireTime       = Timepoint::max();
+
+    CloseSockets();
+    mState = State::kIdle;
+
+exit:
+    return;
+}
+
+otbrError PublisherBuiltin::SelectInfraIf(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    ifaddrs  *ifAddrs;
+
+    if (mInfraIfName.empty() && getifaddrs(&ifAddrs) == 0)
+    {
+        // Picks the first multicast capable interface if none is given.
+        for (ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr; ifAddr = ifAddr->ifa_next)
+        {
+            if ((ifAddr->ifa_flags & IFF_UP) && (ifAddr->ifa_flags & IFF_MULTICAST) &&
+                !(ifAddr->ifa_flags & IFF_LOOPBACK))
+            {
+                mInfraIfName = ifAddr->ifa_name;
+                break;
+            }
+        }
+
+        freeifaddrs(ifAddrs);
+    }
+
+    VerifyOrExit(!mInfraIfName.empty(), error = OTBR_ERROR_INVALID_ARGS);
+
+    mInfraIfIndex = if_nametoindex(mInfraIfName.c_str());
+    VerifyOrExit(mInfraIfIndex != 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("No usable infrastructure interface: %s", mInfraIfName.c_str());
+    }
+
+    return error;
+}
+
+otbrError PublisherBuiltin::OpenSocket(Family aFamily)
+{
+    otbrError error = OTBR_ERROR_ERRNO;
+    int       fd    = socket(aFamily == kIp6 ? AF_INET6 : AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    int       one   = 1;
+    int       hops  = 255;
+
+    VerifyOrExit(fd >= 0);
+    VerifyOrExit(setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) == 0);
+    VerifyOrExit(setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) == 0);
+
+    if (aFamily == kIp6)
+    {
+        sockaddr_in6 sockAddr;
+        ipv6_mreq    mreq;
+        int          loop = 0;
+
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &one, sizeof(one)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_RECVPKTINFO, &one, sizeof(one)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_MULTICAST_IF, &mInfraIfIndex, sizeof(mInfraIfIndex)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &loop, sizeof(loop)) == 0);
+
+        memset(&sockAddr, 0, sizeof(sockAddr));
+        sockAddr.sin6_family = AF_INET6;
+        sockAddr.sin6_port   = htons(kMdnsPort);
+        VerifyOrExit(bind(fd, reinterpret_cast<sockaddr *>(&sockAddr), sizeof(sockAddr)) == 0);
+
+        memset(&mreq, 0, sizeof(mreq));
+        inet_pton(AF_INET6, kMdnsGroupIp6, &mreq.ipv6mr_multiaddr);
+        mreq.ipv6mr_interface = mInfraIfIndex;
+        VerifyOrExit(setsockopt(fd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0);
+    }
+    else
+    {
+        sockaddr_in sockAddr;
+        ip_mreqn    mreq;
+        uint8_t     ttl  = 255;
+        uint8_t     loop = 0;
+
+        memset(&mreq, 0, sizeof(mreq));
+        inet_pton(AF_INET, kMdnsGroupIp4, &mreq.imr_multiaddr);
+        mreq.imr_ifindex = static_cast<int>(mInfraIfIndex);
+
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_PKTINFO, &one, sizeof(one)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF, &mreq, sizeof(mreq)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_TTL, &hops, sizeof(hops)) == 0);
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) == 0);
+
+        memset(&sockAddr, 0, sizeof(sockAddr));
+        sockAddr.sin_family = AF_INET;
+        sockAddr.sin_port   = htons(kMdnsPort);
+        VerifyOrExit(bind(fd, reinterpret_cast<sockaddr *>(&sockAddr), sizeof(sockAddr)) == 0);
+
+        VerifyOrExit(setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) == 0);
+    }
+
+    mSockets[aFamily] = fd;
+    fd                = -1;
+    error             = OTBR_ERROR_NONE;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to open mDNS %s socket: %s", aFamily == kIp6 ? "IPv6" : "IPv4", strerror(errno));
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+void PublisherBuiltin::CloseSockets(void)
+{
+    for (int &fd : mSockets)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+            fd = -1;
+        }
+    }
+}
+
+void PublisherBuiltin::GetMulticastAddress(Family aFamily, sockaddr_storage &aAddress)
+{
+    memset(&aAddress, 0, sizeof(aAddress));
+
+    if (aFamily == kIp6)
+    {
+        sockaddr_in6 &sockAddr = reinterpret_cast<sockaddr_in6 &>(aAddress);
+
+        sockAddr.sin6_family = AF_INET6;
+        sockAddr.sin6_port   = htons(kMdnsPort);
+        inet_pton(AF_INET6, kMdnsGroupIp6, &sockAddr.sin6_addr);
+    }
+    else
+    {
+        sockaddr_in &sockAddr = reinterpret_cast<sockaddr_in &>(aAddress);
+
+        sockAddr.sin_family = AF_INET;
+        sockAddr.sin_port   = htons(kMdnsPort);
+        inet_pton(AF_INET, kMdnsGroupIp4, &sockAddr.sin_addr);
+    }
+}
+
+void PublisherBuiltin::Update(MainloopContext &aMainloop)
+{
+    Timepoint now = Clock::now();
+
+    VerifyOrExit(mState == State::kReady);
+
+    FlushGoodbyes();
+
+    for (int fd : mSockets)
+    {
+        if (fd >= 0)
+        {
+            FD_SET(fd, &aMainloop.mReadFdSet);
+            aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+        }
+    }
+
+    if (mSubscriptionsDirty || !mGroupResults.empty() || mNextFireTime <= now)
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+    else if (mNextFireTime != Timepoint::max())
+    {
+        auto delay = std::chrono::duration_cast<Microseconds>(mNextFireTime - now);
+
+        if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
+        {
+            aMainloop.mTimeout = ToTimeval(delay);
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::Process(const MainloopContext &aMainloop)
+{
+    VerifyOrExit(mState == State::kReady);
+
+    for (uint8_t family = kIp6; family < kNumFamilies; family++)
+    {
+        if (mSockets[family] >= 0 && FD_ISSET(mSockets[family], &aMainloop.mReadFdSet))
+        {
+            ReceiveMessages(static_cast<Family>(family));
+        }
+    }
+
+    if (Clock::now() >= mNextFireTime)
+    {
+        HandleTimers();
+    }
+
+    if (mSubscriptionsDirty)
+    {
+        EvaluateSubscriptions();
+    }
+
+    DeliverGroupResults();
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::ReceiveMessages(Family aFamily)
+{
+    uint8_t buffer[kMaxReceiveSize];
+    uint8_t control[CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(in_pktinfo))];
+
+    while (mSockets[aFamily] >= 0)
+    {
+        sockaddr_storage source;
+        iovec            iov;
+        msghdr           msg;
+        ssize_t          length;
+        uint32_t         ifIndex = 0;
+        Message          message;
+
+        iov.iov_base = buffer;
+        iov.iov_len  = sizeof(buffer);
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name       = &source;
+        msg.msg_namelen    = sizeof(source);
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+
+        length = recvmsg(mSockets[aFamily], &msg, 0);
+
+        if (length < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                otbrLogWarning("Failed to receive mDNS message: %s", strerror(errno));
+            }
+            break;
+        }
+
+        for (cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO)
+            {
+                in6_pktinfo pktInfo;
+
+                memcpy(&pktInfo, CMSG_DATA(cmsg), sizeof(pktInfo));
+                ifIndex = pktInfo.ipi6_ifindex;
+            }
+            else if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO)
+            {
+                in_pktinfo pktInfo;
+
+                memcpy(&pktInfo, CMSG_DATA(cmsg), sizeof(pktInfo));
+                ifIndex = static_cast<uint32_t>(pktInfo.ipi_ifindex);
+            }
+        }
+
+        if (ifIndex != mInfraIfIndex || (msg.msg_flags & MSG_TRUNC))
+        {
+            continue;
+        }
+
+        if (message.Parse(buffer, static_cast<size_t>(length)) != OTBR_ERROR_NONE)
+        {
+            otbrLogDebug("Dropped a malformed mDNS message of %zd bytes", length);
+            continue;
+        }
+
+        // RFC 6762 section 18.3 and 18.11: messages with a non-zero
+        // OPCODE or RCODE are silently ignored.
+        if (message.mFlags & kOpcodeRcodeMask)
+        {
+            continue;
+        }
+
+        if (message.IsResponse())
+        {
+            // RFC 6762 section 11: responses not from port 5353 are ignored.
+            if (GetSourcePort(source) == kMdnsPort)
+            {
+                HandleResponse(aFamily, message);
+            }
+        }
+        else
+        {
+            HandleQuery(aFamily, message, source);
+        }
+    }
+}
+
+void PublisherBuiltin::SendMessage(Family aFamily, const std::vector<uint8_t> &aMessage, const sockaddr &aDest)
+{
+    socklen_t destLength = (aDest.sa_family == AF_INET6) ? sizeof(sockaddr_in6) : sizeof(sockaddr_in);
+
+    VerifyOrExit(mSockets[aFamily] >= 0);
+
+    if (sendto(mSockets[aFamily], aMessage.data(), aMessage.size(), 0, &aDest, destLength) < 0)
+    {
+        otbrLogWarning("Failed to send mDNS message: %s", strerror(errno));
+    }
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::HandleQuery(Family aFamily, const Message &aQuery, const sockaddr_storage &aSource)
+{
+    Timepoint                   now       = Clock::now();
+    bool                        isLegacy  = (GetSourcePort(aSource) != kMdnsPort);
+    bool                        isProbe   = !aQuery.mAuthorities.empty();
+    bool                        allUnique = true;
+    std::vector<OwnedRecord *>  multicastAnswers;
+    std::vector<ResourceRecord> unicastAnswers;
+
+    // Known answers may arrive in follow-up packets of a truncated query
+    // (RFC 6762 section 7.2), so they also suppress pending answers.
+    for (const ResourceRecord &knownAnswer : aQuery.mAnswers)
+    {
+        std::vector<PendingAnswer> &pendingAnswers = mPendingAnswers[aFamily];
+
+        pendingAnswers.erase(std::remove_if(pendingAnswers.begin(), pendingAnswers.end(),
+                                            [&knownAnswer](const PendingAnswer &aPending) {
+                                                return IsKnownAnswer(aPending.mRecord, {knownAnswer});
+                                            }),
+                             pendingAnswers.end());
+    }
+
+    if (isProbe)
+    {
+        HandleProbeTiebreak(aQuery);
+    }
+
+    for (const Question &question : aQuery.mQuestions)
+    {
+        auto range = mRecordIndex.equal_range(ToLowerName(question.mName));
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            OwnedRecord &owned        = *it->second;
+            uint32_t     quarterTtlMs = owned.mRecord.mTtl * 250;
+
+            if (!owned.mGroup->IsEstablished() || !owned.mRecord.Answers(question) ||
+                IsKnownAnswer(owned.mRecord, aQuery.mAnswers))
+            {
+                continue;
+            }
+
+            if (isLegacy || (question.mUnicastResponse && WasMulticastWithin(owned, aFamily, now, quarterTtlMs)))
+            {
+                if (!ContainsRecord(unicastAnswers, owned.mRecord))
+                {
+                    unicastAnswers.push_back(owned.mRecord);
+                }
+            }
+            else if (std::find(multicastAnswers.begin(), multicastAnswers.end(), &owned) == multicastAnswers.end())
+            {
+                multicastAnswers.push_back(&owned);
+                allUnique = allUnique && owned.mUnique;
+            }
+        }
+    }
+
+    if (!unicastAnswers.empty())
+    {
+        SendResponse(aFamily, std::move(unicastAnswers), reinterpret_cast<const sockaddr &>(aSource),
+                     isLegacy ? &aQuery : nullptr);
+    }
+
+    if (!multicastAnswers.empty())
+    {
+        Milliseconds delay(0);
+
+        // RFC 6762 section 6: unique answers are sent immediately, shared
+        // answers after 20-120 ms and answers to truncated queries after
+        // 400-500 ms to collect the remaining known answers.
+        if (aQuery.mFlags & Message::kFlagTruncated)
+        {
+            delay = RandomDelay(400, 500);
+        }
+        else if (!allUnique)
+        {
+            delay = RandomDelay(20, 120);
+        }
+
+        for (OwnedRecord *owned : multicastAnswers)
+        {
+            uint32_t minIntervalMs = isProbe ? kMinProbeDefenseIntervalMs : kMinMulticastIntervalMs;
+
+            if (!WasMulticastWithin(*owned, aFamily, now, minIntervalMs))
+            {
+                QueueAnswer(aFamily, owned->mRecord, now + delay);
+            }
+        }
+    }
+}
+
+void PublisherBuiltin::HandleProbeTiebreak(const Message &aQuery)
+{
+    for (auto &entry : mGroups)
+    {
+        RecordGroup &group = *entry.second;
+
+        if (group.mState != RecordGroup::kProbing)
+        {
+            continue;
+        }
+
+        for (const OwnedRecord &owned : group.mRecords)
+        {
+            std::vector<const ResourceRecord *> ours;
+            std::vector<const ResourceRecord *> theirs;
+            auto compare = [](const ResourceRecord *aFirst, const ResourceRecord *aSecond) {
+                return aFirst->Compare(*aSecond) < 0;
+            };
+            int result = 0;
+
+            if (!owned.mUnique)
+            {
+                continue;
+            }
+
+            for (const ResourceRecord &record : aQuery.mAuthorities)
+            {
+                if (record.HasName(owned.mRecord.mName))
+                {
+                    theirs.push_back(&record);
+                }
+            }
+
+            if (theirs.empty())
+            {
+                continue;
+            }
+
+            for (const OwnedRecord &other : group.mRecords)
+            {
+                if (other.mUnique && other.mRecord.HasName(owned.mRecord.mName))
+                {
+                    ours.push_back(&other.mRecord);
+                }
+            }
+
+            // RFC 6762 section 8.2: the sorted sets of records are compared
+            // lexicographically and the host with the earlier data defers.
+            std::sort(ours.begin(), ours.end(), compare);
+            std::sort(theirs.begin(), theirs.end(), compare);
+
+            for (size_t i = 0; result == 0 && i < std::min(ours.size(), theirs.size()); i++)
+            {
+                result = ours[i]->Compare(*theirs[i]);
+            }
+
+            if (result == 0)
+            {
+                result = static_cast<int>(ours.size()) - static_cast<int>(theirs.size());
+            }
+
+            if (result < 0)
+            {
+                otbrLogInfo("Lost simultaneous probe tiebreak for %s, probing again", owned.mRecord.mName.c_str());
+                group.RestartProbing(Milliseconds(kProbeConflictDelayMs));
+                break;
+            }
+        }
+    }
+}
+
+void PublisherBuiltin::HandleResponse(Family aFamily, const Message &aResponse)
+{
+    Timepoint now = Clock::now();
+
+    for (const std::vector<ResourceRecord> *section : {&aResponse.mAnswers, &aResponse.mAdditionals})
+    {
+        for (const ResourceRecord &record : *section)
+        {
+            std::vector<PendingAnswer> &pendingAnswers = mPendingAnswers[aFamily];
+
+            CheckConflict(record);
+
+            // RFC 6762 section 7.4: duplicate answer suppression.
+            if (section == &aResponse.mAnswers)
+            {
+                pendingAnswers.erase(std::remove_if(pendingAnswers.begin(), pendingAnswers.end(),
+                                                    [&record](const PendingAnswer &aPending) {
+                                                        return IsKnownAnswer(aPending.mRecord, {record});
+                                                    }),
+                                     pendingAnswers.end());
+            }
+
+            AddToCache(record, now);
+        }
+    }
+}
+
+void PublisherBuiltin::CheckConflict(const ResourceRecord &aRecord)
+{
+    std::vector<RecordGroup *> groups;
+    bool                       isOwned = false;
+    auto                       range   = mRecordIndex.equal_range(ToLowerName(aRecord.mName));
+
+    VerifyOrExit(aRecord.mTtl > 0);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        OwnedRecord &owned = *it->second;
+
+        if (!owned.mUnique || owned.mRecord.mType != aRecord.mType || owned.mRecord.mClass != aRecord.mClass)
+        {
+            continue;
+        }
+
+        isOwned = isOwned || owned.mRecord.IsSameAs(aRecord);
+
+        if (std::find(groups.begin(), groups.end(), owned.mGroup) == groups.end())
+        {
+            groups.push_back(owned.mGroup);
+        }
+    }
+
+    VerifyOrExit(!isOwned);
+
+    for (RecordGroup *group : groups)
+    {
+        switch (group->mState)
+        {
+        case RecordGroup::kProbing:
+            otbrLogWarning("Name conflict on %s while probing", aRecord.mName.c_str());
+            group->mState = RecordGroup::kIdle;
+            mGroupResults.emplace_back(group->mId, OTBR_ERROR_DUPLICATED);
+            break;
+
+        case RecordGroup::kAnnouncing:
+        case RecordGroup::kAnnounced:
+            // RFC 6762 section 9: verify the records by probing again.
+            otbrLogWarning("Conflicting record for %s received, probing again", aRecord.mName.c_str());
+            group->RestartProbing(Milliseconds::zero());
+            break;
+
+        case RecordGroup::kIdle:
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::SendResponse(Family                      aFamily,
+                                    std::vector<ResourceRecord> aAnswers,
+                                    const sockaddr             &aDest,
+                                    const Message              *aLegacyQuery)
+{
+    std::vector<ResourceRecord> additionals;
+
+    for (const ResourceRecord &answer : aAnswers)
+    {
+        if (answer.mType == kRrTypePtr)
+        {
+            AddOwnedRecords(answer.mTarget, kRrTypeSrv, aAnswers, additionals);
+            AddOwnedRecords(answer.mTarget, kRrTypeTxt, aAnswers, additionals);
+        }
+    }
+
+    for (size_t i = 0; i < aAnswers.size() + additionals.size(); i++)
+    {
+        const ResourceRecord &record = (i < aAnswers.size()) ? aAnswers[i] : additionals[i - aAnswers.size()];
+
+        if (record.mType == kRrTypeSrv)
+        {
+            AddOwnedRecords(record.mTarget, kRrTypeAaaa, aAnswers, additionals);
+            AddOwnedRecords(record.mTarget, kRrTypeA, aAnswers, additionals);
+        }
+    }
+
+    if (aLegacyQuery != nullptr)
+    {
+        // RFC 6762 section 6.7: legacy unicast responses use short TTLs
+        // and never set the cache-flush bit.
+        for (std::vector<ResourceRecord> *records : {&aAnswers, &additionals})
+        {
+            for (ResourceRecord &record : *records)
+            {
+                record.mTtl        = std::min(record.mTtl, kLegacyUnicastTtl);
+                record.mCacheFlush = false;
+            }
+        }
+    }
+
+    SendRecords(aFamily, aAnswers, additionals, aDest, aLegacyQuery);
+}
+
+void PublisherBuiltin::SendRecords(Family                             aFamily,
+                                   const std::vector<ResourceRecord> &aAnswers,
+                                   const std::vector<ResourceRecord> &aAdditionals,
+                                   const sockaddr                    &aDest,
+                                   const Message                     *aLegacyQuery)
+{
+    uint16_t                       id = (aLegacyQuery != nullptr) ? aLegacyQuery->mId : 0;
+    std::unique_ptr<MessageWriter> writer;
+
+    auto newWriter = [&]() {
+        writer = MakeUnique<MessageWriter>(id, Message::kFlagResponse | Message::kFlagAuthoritative,
+                                           kMaxMessageSize);
+
+        if (aLegacyQuery != nullptr)
+        {
+            for (const Question &question : aLegacyQuery->mQuestions)
+            {
+                writer->AppendQuestion(question);
+            }
+        }
+    };
+
+    newWriter();
+
+    for (const ResourceRecord &answer : aAnswers)
+    {
+        if (writer->AppendRecord(MessageWriter::kAnswer, answer))
+        {
+            continue;
+        }
+
+        if (writer->GetCount(MessageWriter::kAnswer) > 0)
+        {
+            SendMessage(aFamily, writer->GetBuffer(), aDest);
+            newWriter();
+        }
+
+        if (!writer->AppendRecord(MessageWriter::kAnswer, answer))
+        {
+            otbrLogWarning("Record %s is too large to send", answer.mName.c_str());
+        }
+    }
+
+    // Additional records are best effort and only sent when they fit.
+    for (const ResourceRecord &additional : aAdditionals)
+    {
+        writer->AppendRecord(MessageWriter::kAdditional, additional);
+    }
+
+    if (writer->GetCount(MessageWriter::kAnswer) > 0)
+    {
+        SendMessage(aFamily, writer->GetBuffer(), aDest);
+    }
+}
+
+void PublisherBuiltin::QueueAnswer(Family aFamily, const ResourceRecord &aRecord, Timepoint aDeadline)
+{
+    std::vector<PendingAnswer> &pendingAnswers = mPendingAnswers[aFamily];
+    auto it = std::find_if(pendingAnswers.begin(), pendingAnswers.end(),
+                           [&aRecord](const PendingAnswer &aPending) { return aPending.mRecord.IsSameAs(aRecord); });
+
+    if (it == pendingAnswers.end())
+    {
+        pendingAnswers.push_back({aRecord, aDeadline});
+    }
+    else
+    {
+        it->mDeadline = std::min(it->mDeadline, aDeadline);
+    }
+
+    ScheduleTimer(aDeadline);
+}
+
+void PublisherBuiltin::ProcessPendingAnswers(Timepoint aNow)
+{
+    for (uint8_t family = kIp6; family < kNumFamilies; family++)
+    {
+        std::vector<PendingAnswer> &pendingAnswers = mPendingAnswers[family];
+        std::vector<ResourceRecord> answers;
+        sockaddr_storage            dest;
+
+        for (auto it = pendingAnswers.begin(); it != pendingAnswers.end();)
+        {
+            if (it->mDeadline <= aNow)
+            {
+                OwnedRecord *owned = FindOwnedRecord(it->mRecord);
+
+                if (owned != nullptr)
+                {
+                    owned->mLastMulticast[family] = aNow;
+                    answers.push_back(std::move(it->mRecord));
+                }
+
+                it = pendingAnswers.erase(it);
+            }
+            else
+            {
+                ScheduleTimer(it->mDeadline);
+                ++it;
+            }
+        }
+
+        if (!answers.empty())
+        {
+            GetMulticastAddress(static_cast<Family>(family), dest);
+            SendResponse(static_cast<Family>(family), std::move(answers), reinterpret_cast<const sockaddr &>(dest),
+                         nullptr);
+        }
+    }
+}
+
+void PublisherBuiltin::HandleTimers(void)
+{
+    Timepoint now = Clock::now();
+
+    mNextFireTime = Timepoint::max();
+
+    ProcessCache(now);
+    ProcessGroups(now);
+    ProcessQueries(now);
+    ProcessPendingAnswers(now);
+
+    if (now >= mNextAddressCheck)
+    {
+        CheckLocalHostAddresses();
+        mNextAddressCheck = now + Milliseconds(kAddressCheckIntervalMs);
+    }
+
+    ScheduleTimer(mNextAddressCheck);
+}
+
+void PublisherBuiltin::ScheduleTimer(Timepoint aTime)
+{
+    mNextFireTime = std::min(mNextFireTime, aTime);
+}
+
+void PublisherBuiltin::ProcessGroups(Timepoint aNow)
+{
+    for (auto &entry : mGroups)
+    {
+        RecordGroup &group = *entry.second;
+
+        if (group.mState == RecordGroup::kProbing && group.mNextTx <= aNow)
+        {
+            if (group.mTxCount < kNumProbes)
+            {
+                SendProbe(group);
+                group.mTxCount++;
+                group.mNextTx = aNow + Milliseconds(kProbeIntervalMs);
+            }
+            else
+            {
+                otbrLogInfo("Probing of record group %" PRIu64 " succeeded", group.mId);
+                group.mState   = RecordGroup::kAnnouncing;
+                group.mTxCount = 0;
+                mGroupResults.emplace_back(group.mId, OTBR_ERROR_NONE);
+            }
+        }
+
+        if (group.mState == RecordGroup::kAnnouncing && group.mNextTx <= aNow)
+        {
+            SendAnnouncement(group, aNow);
+            group.mTxCount++;
+            group.mNextTx = aNow + Milliseconds(kAnnounceIntervalMs);
+
+            if (group.mTxCount >= kNumAnnouncements)
+            {
+                group.mState = RecordGroup::kAnnounced;
+            }
+        }
+
+        if (group.mState == RecordGroup::kProbing || group.mState == RecordGroup::kAnnouncing)
+        {
+            ScheduleTimer(group.mNextTx);
+        }
+    }
+}
+
+void PublisherBuiltin::SendProbe(const RecordGroup &aGroup)
+{
+    MessageWriter            writer(0, 0, kMaxMessageSize);
+    std::vector<std::string> names;
+
+    for (const OwnedRecord &owned : aGroup.mRecords)
+    {
+        if (owned.mUnique && std::none_of(names.begin(), names.end(), [&owned](const std::string &aName) {
+                return owned.mRecord.HasName(aName);
+            }))
+        {
+            Question question;
+
+            question.mName            = owned.mRecord.mName;
+            question.mType            = kRrTypeAny;
+            question.mClass           = kRrClassIn;
+            question.mUnicastResponse = (aGroup.mTxCount == 0);
+
+            writer.AppendQuestion(question);
+            names.push_back(owned.mRecord.mName);
+        }
+    }
+
+    for (const OwnedRecord &owned : aGroup.mRecords)
+    {
+        if (owned.mUnique)
+        {
+            ResourceRecord record = owned.mRecord;
+
+            // RFC 6762 section 10.2: no cache-flush bit in the authority section of probes.
+            record.mCacheFlush = false;
+            writer.AppendRecord(MessageWriter::kAuthority, record);
+        }
+    }
+
+    for (uint8_t family = kIp6; family < kNumFamilies; family++)
+    {
+        sockaddr_storage dest;
+
+        GetMulticastAddress(static_cast<Family>(family), dest);
+        SendMessage(static_cast<Family>(family), writer.GetBuffer(), reinterpret_cast<const sockaddr &>(dest));
+    }
+}
+
+void PublisherBuiltin::SendAnnouncement(RecordGroup &aGroup, Timepoint aNow)
+{
+    std::vector<ResourceRecord> records;
+
+    for (OwnedRecord &owned : aGroup.mRecords)
+    {
+        records.push_back(owned.mRecord);
+    }
+
+    VerifyOrExit(!records.empty());
+
+    for (uint8_t family = kIp6; family < kNumFamilies; family++)
+    {
+        sockaddr_storage dest;
+
+        for (OwnedRecord &owned : aGroup.mRecords)
+        {
+            owned.mLastMulticast[family] = aNow;
+        }
+
+        GetMulticastAddress(static_cast<Family>(family), dest);
+        SendResponse(static_cast<Family>(family), records, reinterpret_cast<const sockaddr &>(dest), nullptr);
+    }
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::FlushGoodbyes(void)
+{
+    std::vector<ResourceRecord> goodbyes;
+
+    for (ResourceRecord &record : mPendingGoodbyes)
+    {
+        // A record which is owned again or a unique record which got replaced
+        // by a new one (announced with the cache-flush bit) needs no goodbye.
+        if (!IsRecordReowned(record) && !ContainsRecord(goodbyes, record))
+        {
+            record.mTtl = 0;
+            goodbyes.push_back(std::move(record));
+        }
+    }
+
+    mPendingGoodbyes.clear();
+    VerifyOrExit(!goodbyes.empty());
+
+    for (uint8_t family = kIp6; family < kNumFamilies; family++)
+    {
+        sockaddr_storage dest;
+
+        GetMulticastAddress(static_cast<Family>(family), dest);
+        SendRecords(static_cast<Family>(family), goodbyes, {}, reinterpret_cast<const sockaddr &>(dest), nullptr);
+    }
+
+exit:
+    return;
+}
+
+bool PublisherBuiltin::IsRecordReowned(const ResourceRecord &aRecord) const
+{
+    auto range = mRecordIndex.equal_range(ToLowerName(aRecord.mName));
+
+    return std::any_of(range.first, range.second,
+                       [&aRecord](const std::pair<const std::string, OwnedRecord *> &aEntry) {
+                           const OwnedRecord &owned = *aEntry.second;
+
+                           return owned.mRecord.IsSameAs(aRecord) ||
+                                  (owned.mUnique && owned.mRecord.mType == aRecord.mType);
+                       });
+}
+
+bool PublisherBuiltin::HasPendingGoodbye(const std::string &aName) const
+{
+    return std::any_of(mPendingGoodbyes.begin(), mPendingGoodbyes.end(),
+                       [&aName](const ResourceRecord &aRecord) { return aRecord.HasName(aName); });
+}
+
+PublisherBuiltin::OwnedRecord *PublisherBuiltin::FindOwnedRecord(const ResourceRecord &aRecord)
+{
+    OwnedRecord *found = nullptr;
+    auto         range = mRecordIndex.equal_range(ToLowerName(aRecord.mName));
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second->mRecord.IsSameAs(aRecord))
+        {
+            found = it->second;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void PublisherBuiltin::AddOwnedRecords(const std::string                 &aName,
+                                       uint16_t                           aType,
+                                       const std::vector<ResourceRecord> &aExcluded,
+                                       std::vector<ResourceRecord>       &aRecords) const
+{
+    auto range = mRecordIndex.equal_range(ToLowerName(aName));
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const OwnedRecord &owned = *it->second;
+
+        if (owned.mGroup->IsEstablished() && owned.mRecord.mType == aType &&
+            !ContainsRecord(aExcluded, owned.mRecord) && !ContainsRecord(aRecords, owned.mRecord))
+        {
+            aRecords.push_back(owned.mRecord);
+        }
+    }
+}
+
+bool PublisherBuiltin::WasMulticastWithin(const OwnedRecord &aOwned,
+                                          Family             aFamily,
+                                          Timepoint          aNow,
+                                          uint32_t           aIntervalMs)
+{
+    Timepoint lastMulticast = aOwned.mLastMulticast[aFamily];
+
+    return lastMulticast != Timepoint::min() && aNow - lastMulticast < Milliseconds(aIntervalMs);
+}
+
+void PublisherBuiltin::DeliverGroupResults(void)
+{
+    std::vector<std::pair<uint64_t, otbrError>> results;
+
+    results.swap(mGroupResults);
+
+    for (const auto &result : results)
+    {
+        // The handlers may destroy any group, so the groups are looked up by their IDs.
+        auto it = mGroups.find(result.first);
+
+        if (it != mGroups.end() && it->second->mResultHandler != nullptr)
+        {
+            RecordGroup::ResultHandler handler = it->second->mResultHandler;
+
+            handler(result.second);
+        }
+    }
+}
+
+void PublisherBuiltin::ProcessQueries(Timepoint aNow)
+{
+    std::vector<const ActiveQuery *> dueQueries;
+
+    for (auto &entry : mQueries)
+    {
+        ActiveQuery &query = entry.second;
+
+        if (query.mNextTx <= aNow)
+        {
+            dueQueries.push_back(&query);
+            query.mNextTx   = aNow + query.mInterval;
+            query.mInterval = std::min(query.mInterval * 2, Milliseconds(kMaxQueryIntervalMs));
+        }
+
+        ScheduleTimer(query.mNextTx);
+    }
+
+    VerifyOrExit(!dueQueries.empty());
+
+    for (uint8_t family = kIp6; family < kNumFamilies; family++)
+    {
+        std::unique_ptr<MessageWriter> writer = MakeUnique<MessageWriter>(0, 0, kMaxMessageSize);
+        std::vector<ResourceRecord>    knownAnswers;
+        sockaddr_storage               dest;
+
+        VerifyOrExit(mSockets[family] >= 0);
+        GetMulticastAddress(static_cast<Family>(family), dest);
+
+        // RFC 6762 section 7.2: known answers which don't fit are sent in
+        // follow-up packets, with the TC bit set on all but the last one.
+        auto flush = [&]() {
+            for (const ResourceRecord &knownAnswer : knownAnswers)
+            {
+                if (!writer->AppendRecord(MessageWriter::kAnswer, knownAnswer) && !writer->IsEmpty())
+                {
+                    writer->AddFlags(Message::kFlagTruncated);
+                    SendMessage(static_cast<Family>(family), writer->GetBuffer(),
+                                reinterpret_cast<const sockaddr &>(dest));
+                    writer = MakeUnique<MessageWriter>(0, 0, kMaxMessageSize);
+                    writer->AppendRecord(MessageWriter::kAnswer, knownAnswer);
+                }
+            }
+
+            if (!writer->IsEmpty())
+            {
+                SendMessage(static_cast<Family>(family), writer->GetBuffer(), reinterpret_cast<const sockaddr &>(dest));
+            }
+
+            writer = MakeUnique<MessageWriter>(0, 0, kMaxMessageSize);
+            knownAnswers.clear();
+        };
+
+        for (const ActiveQuery *query : dueQueries)
+        {
+            if (!writer->AppendQuestion(query->mQuestion))
+            {
+                flush();
+                writer->AppendQuestion(query->mQuestion);
+            }
+
+            CollectKnownAnswers(query->mQuestion, aNow, knownAnswers);
+        }
+
+        flush();
+    }
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::CollectKnownAnswers(const Question              &aQuestion,
+                                           Timepoint                    aNow,
+                                           std::vector<ResourceRecord> &aKnownAnswers) const
+{
+    auto range = mCache.equal_range(ToLowerName(aQuestion.mName));
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const CacheEntry &entry = it->second;
+        Milliseconds      remaining;
+
+        if (entry.mFlushed || !entry.mRecord.Answers(aQuestion))
+        {
+            continue;
+        }
+
+        // RFC 6762 section 7.1: only records with more than half of their TTL remaining.
+        remaining = std::chrono::duration_cast<Milliseconds>(entry.mExpireTime - aNow);
+
+        if (remaining > Milliseconds(static_cast<uint64_t>(entry.mRecord.mTtl) * 500))
+        {
+            ResourceRecord knownAnswer = entry.mRecord;
+
+            knownAnswer.mTtl        = static_cast<uint32_t>(remaining.count() / 1000);
+            knownAnswer.mCacheFlush = false;
+            aKnownAnswers.push_back(std::move(knownAnswer));
+        }
+    }
+}
+
+void PublisherBuiltin::AddToCache(const ResourceRecord &aRecord, Timepoint aNow)
+{
+    std::string key   = ToLowerName(aRecord.mName);
+    auto        range = mCache.equal_range(key);
+    CacheEntry *found = nullptr;
+
+    VerifyOrExit(aRecord.mClass == kRrClassIn);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        CacheEntry &entry = it->second;
+
+        if (entry.mRecord.IsSameAs(aRecord))
+        {
+            found = &entry;
+        }
+        else if (aRecord.mCacheFlush && aRecord.mTtl > 0 && entry.mRecord.mType == aRecord.mType &&
+                 !entry.mFlushed && entry.mReceiveTime + Milliseconds(kCacheFlushDelayMs) < aNow)
+        {
+            // RFC 6762 section 10.2: other records of the unique record set
+            // received more than one second ago expire in one second.
+            entry.mExpireTime = aNow + Milliseconds(kCacheFlushDelayMs);
+            entry.mFlushed    = true;
+            ScheduleTimer(entry.mExpireTime);
+        }
+    }
+
+    if (aRecord.mTtl == 0)
+    {
+        // RFC 6762 section 10.1: goodbye records expire in one second.
+        if (found != nullptr && !found->mFlushed)
+        {
+            found->mExpireTime = aNow + Milliseconds(kCacheFlushDelayMs);
+            found->mFlushed    = true;
+            ScheduleTimer(found->mExpireTime);
+            mSubscriptionsDirty = true;
+        }
+
+        ExitNow();
+    }
+
+    if (found == nullptr)
+    {
+        VerifyOrExit(mCache.size() < kMaxCacheEntries, otbrLogDebug("mDNS cache is full, dropped %s", key.c_str()));
+        found = &mCache.emplace(key, CacheEntry())->second;
+    }
+
+    found->mRecord       = aRecord;
+    found->mReceiveTime  = aNow;
+    found->mExpireTime   = aNow + std::chrono::seconds(aRecord.mTtl);
+    found->mRefreshCount = 0;
+    found->mFlushed      = false;
+    ScheduleTimer(found->mExpireTime);
+
+    mSubscriptionsDirty = true;
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::ProcessCache(Timepoint aNow)
+{
+    for (auto it = mCache.begin(); it != mCache.end();)
+    {
+        CacheEntry &entry = it->second;
+        auto        query = mQueries.find(QueryKey(it->first, entry.mRecord.mType));
+
+        if (entry.mExpireTime <= aNow)
+        {
+            it                  = mCache.erase(it);
+            mSubscriptionsDirty = true;
+            continue;
+        }
+
+        // RFC 6762 section 5.2: records of active queries are refreshed at
+        // 80%, 85%, 90% and 95% of their TTL.
+        if (!entry.mFlushed && entry.mRefreshCount < kNumRefreshes && query != mQueries.end())
+        {
+            Timepoint refreshTime = GetRefreshTime(entry);
+
+            if (refreshTime <= aNow)
+            {
+                query->second.mNextTx = aNow;
+                entry.mRefreshCount++;
+                refreshTime = GetRefreshTime(entry);
+            }
+
+            if (entry.mRefreshCount < kNumRefreshes)
+            {
+                ScheduleTimer(refreshTime);
+            }
+        }
+
+        ScheduleTimer(entry.mExpireTime);
+        ++it;
+    }
+}
+
+Timepoint PublisherBuiltin::GetRefreshTime(const CacheEntry &aEntry)
+{
+    uint32_t percent = 80 + 5 * aEntry.mRefreshCount;
+
+    return aEntry.mReceiveTime + Milliseconds(static_cast<uint64_t>(aEntry.mRecord.mTtl) * 10 * percent);
+}
+
+void PublisherBuiltin::PublishLocalHost(void)
+{
+    std::vector<ResourceRecord> records;
+
+    CollectLocalAddresses(records);
+
+    mLocalHostGroup = MakeUnique<RecordGroup>(*this);
+
+    for (ResourceRecord &record : records)
+    {
+        mLocalHostGroup->AddRecord(std::move(record), /* aUnique */ true);
+    }
+
+    mLocalHostGroup->Start([this](otbrError aError) { HandleLocalHostResult(aError); });
+}
+
+void PublisherBuiltin::HandleLocalHostResult(otbrError aError)
+{
+    std::vector<std::pair<std::string, std::string>> waitingServices;
+
+    if (aError != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to publish local host %s: %s", mLocalHostName.c_str(), otbrErrorString(aError));
+    }
+
+    for (const auto &entry : mServiceRegistrations)
+    {
+        const ServiceRegistration &serviceReg = *entry.second;
+
+        if (serviceReg.mHostName.empty() && !serviceReg.IsCompleted())
+        {
+            waitingServices.emplace_back(serviceReg.mName, serviceReg.mType);
+        }
+    }
+
+    // The callbacks may change the registrations, so they are looked up again.
+    for (const auto &service : waitingServices)
+    {
+        auto *serviceReg =
+            static_cast<BuiltinServiceRegistration *>(FindServiceRegistration(service.first, service.second));
+
+        if (serviceReg == nullptr)
+        {
+            continue;
+        }
+
+        if (aError != OTBR_ERROR_NONE)
+        {
+            RemoveServiceRegistration(service.first, service.second, aError);
+        }
+        else if (serviceReg->IsEstablished())
+        {
+            serviceReg->HandleResult(OTBR_ERROR_NONE);
+        }
+    }
+}
+
+void PublisherBuiltin::CheckLocalHostAddresses(void)
+{
+    std::vector<ResourceRecord> records;
+    bool                        changed;
+
+    CollectLocalAddresses(records);
+
+    changed = (mLocalHostGroup == nullptr || records.size() != mLocalHostGroup->mRecords.size());
+
+    for (size_t i = 0; !changed && i < records.size(); i++)
+    {
+        changed = !records[i].IsSameAs(mLocalHostGroup->mRecords[i].mRecord);
+    }
+
+    if (changed)
+    {
+        otbrLogInfo("Addresses of %s changed, republishing local host", mInfraIfName.c_str());
+        PublishLocalHost();
+    }
+}
+
+void PublisherBuiltin::CollectLocalAddresses(std::vector<ResourceRecord> &aRecords) const
+{
+    std::string hostName = GetLocalHostFullName();
+    ifaddrs    *ifAddrs;
+
+    VerifyOrExit(getifaddrs(&ifAddrs) == 0);
+
+    for (ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr; ifAddr = ifAddr->ifa_next)
+    {
+        ResourceRecord record;
+
+        if (ifAddr->ifa_addr == nullptr || mInfraIfName != ifAddr->ifa_name)
+        {
+            continue;
+        }
+
+        if (ifAddr->ifa_addr->sa_family == AF_INET6)
+        {
+            const in6_addr &address = reinterpret_cast<const sockaddr_in6 *>(ifAddr->ifa_addr)->sin6_addr;
+
+            record = MakeRecord(hostName, kRrTypeAaaa, kHostRecordTtl);
+            record.mData.assign(address.s6_addr, address.s6_addr + sizeof(address.s6_addr));
+        }
+        else if (ifAddr->ifa_addr->sa_family == AF_INET && mSockets[kIp4] >= 0)
+        {
+            const in_addr &address = reinterpret_cast<const sockaddr_in *>(ifAddr->ifa_addr)->sin_addr;
+            const uint8_t *bytes   = reinterpret_cast<const uint8_t *>(&address.s_addr);
+
+            record = MakeRecord(hostName, kRrTypeA, kHostRecordTtl);
+            record.mData.assign(bytes, bytes + sizeof(address.s_addr));
+        }
+        else
+        {
+            continue;
+        }
+
+        record.mCacheFlush = true;
+        aRecords.push_back(std::move(record));
+    }
+
+    freeifaddrs(ifAddrs);
+
+    std::sort(aRecords.begin(), aRecords.end(),
+              [](const ResourceRecord &aFirst, const ResourceRecord &aSecond) { return aFirst.Compare(aSecond) < 0; });
+
+exit:
+    return;
+}
+
+std::string PublisherBuiltin::MakeInstanceFullName(const std::string &aName, const std::string &aType) const
+{
+    return EscapeLabel(aName.empty() ? mLocalHostName : aName) + "." + MakeFullName(aType);
+}
+
+std::string PublisherBuiltin::MakeKeyFullName(const std::string &aName) const
+{
+    size_t      typeOffset;
+    std::string fullName;
+
+    if (FindServiceTypeOffset(aName, typeOffset))
+    {
+        fullName = MakeInstanceFullName(aName.substr(0, typeOffset - 1), aName.substr(typeOffset));
+    }
+    else
+    {
+        fullName = MakeFullKeyName(aName);
+    }
+
+    return fullName;
+}
+
+Milliseconds PublisherBuiltin::RandomDelay(uint32_t aMinMs, uint32_t aMaxMs)
+{
+    std::uniform_int_distribution<uint32_t> distribution(aMinMs, aMaxMs);
+
+    return Milliseconds(distribution(mRandom));
+}
+
+bool PublisherBuiltin::IsKnownAnswer(const ResourceRecord &aRecord, const std::vector<ResourceRecord> &aKnownAnswers)
+{
+    // RFC 6762 section 7.1: a known answer suppresses the record if its
+    // TTL is at least half of the true TTL.
+    return std::any_of(aKnownAnswers.begin(), aKnownAnswers.end(), [&aRecord](const ResourceRecord &aKnownAnswer) {
+        return aKnownAnswer.IsSameAs(aRecord) && aKnownAnswer.mTtl >= aRecord.mTtl / 2;
+    });
+}
+
+PublisherBuiltin::RecordGroup::RecordGroup(PublisherBuiltin &aPublisher)
+    : mPublisher(aPublisher)
+    , mId(aPublisher.mNextGroupId++)
+    , mState(kIdle)
+    , mTxCount(0)
+    , mIsStarted(false)
+{
+    mPublisher.mGroups[mId] = this;
+}
+
+PublisherBuiltin::RecordGroup::~RecordGroup(void)
+{
+    for (OwnedRecord &owned : mRecords)
+    {
+        auto range = mPublisher.mRecordIndex.equal_range(ToLowerName(owned.mRecord.mName));
+
+        for (auto it = range.first; it != range.second;)
+        {
+            it = (it->second == &owned) ? mPublisher.mRecordIndex.erase(it) : std::next(it);
+        }
+
+        if (mPublisher.FindOwnedRecord(owned.mRecord) == nullptr)
+        {
+            for (std::vector<PendingAnswer> &pendingAnswers : mPublisher.mPendingAnswers)
+            {
+                pendingAnswers.erase(std::remove_if(pendingAnswers.begin(), pendingAnswers.end(),
+                                                    [&owned](const PendingAnswer &aPending) {
+                                                        return aPending.mRecord.IsSameAs(owned.mRecord);
+                                                    }),
+                                     pendingAnswers.end());
+            }
+        }
+
+        if (IsEstablished())
+        {
+            mPublisher.mPendingGoodbyes.push_back(owned.mRecord);
+        }
+    }
+
+    mPublisher.mGroups.erase(mId);
+}
+
+void PublisherBuiltin::RecordGroup::AddRecord(ResourceRecord aRecord, bool aUnique)
+{
+    OwnedRecord owned;
+
+    assert(!mIsStarted);
+
+    owned.mRecord             = std::move(aRecord);
+    owned.mRecord.mCacheFlush = aUnique;
+    owned.mUnique             = aUnique;
+    owned.mGroup              = this;
+    std::fill(std::begin(owned.mLastMulticast), std::end(owned.mLastMulticast), Timepoint::min());
+
+    mRecords.push_back(std::move(owned));
+}
+
+void PublisherBuiltin::RecordGroup::Start(ResultHandler aResultHandler)
+{
+    bool shouldProbe = false;
+
+    assert(!mIsStarted);
+
+    mIsStarted     = true;
+    mResultHandler = std::move(aResultHandler);
+
+    for (OwnedRecord &owned : mRecords)
+    {
+        // A unique name which is being withdrawn by this responder has just
+        // been updated, so it's known to be ours and needs no probing.
+        if (owned.mUnique && !mPublisher.HasPendingGoodbye(owned.mRecord.mName))
+        {
+            shouldProbe = true;
+        }
+
+        mPublisher.mRecordIndex.emplace(ToLowerName(owned.mRecord.mName), &owned);
+    }
+
+    if (shouldProbe)
+    {
+        RestartProbing(mPublisher.RandomDelay(0, kProbeIntervalMs));
+    }
+    else
+    {
+        mState   = kAnnouncing;
+        mTxCount = 0;
+        mNextTx  = Clock::now();
+        mPublisher.ScheduleTimer(mNextTx);
+        mPublisher.mGroupResults.emplace_back(mId, OTBR_ERROR_NONE);
+    }
+}
+
+void PublisherBuiltin::RecordGroup::RestartProbing(Milliseconds aDelay)
+{
+    mState   = kProbing;
+    mTxCount = 0;
+    mNextTx  = Clock::now() + aDelay;
+    mPublisher.ScheduleTimer(mNextTx);
+}
+
+void PublisherBuiltin::BuiltinServiceRegistration::Register(void)
+{
+    PublisherBuiltin &publisher    = GetPublisher();
+    std::string       instanceName = publisher.MakeInstanceFullName(mName, mType);
+    std::string       typeName     = MakeFullName(mType);
+    ResourceRecord    srv          = MakeRecord(instanceName, kRrTypeSrv, kHostRecordTtl);
+    ResourceRecord    txt          = MakeRecord(instanceName, kRrTypeTxt, kOtherRecordTtl);
+
+    otbrLogInfo("Registering service %s.%s", mName.c_str(), mType.c_str());
+
+    srv.mPort   = mPort;
+    srv.mTarget = mHostName.empty() ? publisher.GetLocalHostFullName() : MakeFullHostName(mHostName);
+
+    // RFC 6763 section 6.1: an empty TXT record is a single zero byte.
+    txt.mData = mTxtData->empty() ? TxtData{0} : *mTxtData;
+
+    mGroup = MakeUnique<RecordGroup>(publisher);
+    mGroup->AddRecord(std::move(srv), /* aUnique */ true);
+    mGroup->AddRecord(std::move(txt), /* aUnique */ true);
+    mGroup->AddRecord(MakePtrRecord(typeName, instanceName, kOtherRecordTtl), /* aUnique */ false);
+
+    for (const std::string &subType : *mSubTypeList)
+    {
+        mGroup->AddRecord(MakePtrRecord(subType + "._sub." + typeName, instanceName, kOtherRecordTtl),
+                          /* aUnique */ false);
+    }
+
+    mGroup->AddRecord(MakePtrRecord(kServicesName, typeName, kOtherRecordTtl), /* aUnique */ false);
+    mGroup->Start([this](otbrError aError) { HandleResult(aError); });
+}
+
+void PublisherBuiltin::BuiltinServiceRegistration::HandleResult(otbrError aError)
+{
+    const RecordGroup *localHostGroup = GetPublisher().mLocalHostGroup.get();
+
+    // A service published without a host name points at the local host, so
+    // it isn't registered until the local host name is.
+    if (aError == OTBR_ERROR_NONE && mHostName.empty() && localHostGroup != nullptr &&
+        !localHostGroup->IsEstablished())
+    {
+        VerifyOrExit(localHostGroup->mState != RecordGroup::kProbing);
+        aError = OTBR_ERROR_DUPLICATED;
+    }
+
+    if (aError == OTBR_ERROR_NONE)
+    {
+        otbrLogInfo("Successfully registered service %s.%s", mName.c_str(), mType.c_str());
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        otbrLogErr("Failed to register service %s.%s: %s", mName.c_str(), mType.c_str(), otbrErrorString(aError));
+        GetPublisher().RemoveServiceRegistration(mName, mType, aError);
+    }
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::BuiltinHostRegistration::Register(void)
+{
+    std::string fullName = MakeFullHostName(mName);
+
+    otbrLogInfo("Registering new host %s", mName.c_str());
+
+    mGroup = MakeUnique<RecordGroup>(GetPublisher());
+
+    for (const Ip6Address &address : mAddresses)
+    {
+        ResourceRecord record = MakeRecord(fullName, kRrTypeAaaa, kHostRecordTtl);
+
+        record.mData.assign(address.m8, address.m8 + sizeof(address.m8));
+        mGroup->AddRecord(std::move(record), /* aUnique */ true);
+    }
+
+    mGroup->Start([this](otbrError aError) { HandleResult(aError); });
+}
+
+void PublisherBuiltin::BuiltinHostRegistration::HandleResult(otbrError aError)
+{
+    if (aError == OTBR_ERROR_NONE)
+    {
+        otbrLogInfo("Successfully registered host %s", mName.c_str());
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        otbrLogErr("Failed to register host %s: %s", mName.c_str(), otbrErrorString(aError));
+        GetPublisher().RemoveHostRegistration(mName, aError);
+    }
+}
+
+void PublisherBuiltin::BuiltinKeyRegistration::Register(void)
+{
+    ResourceRecord record = MakeRecord(GetPublisher().MakeKeyFullName(mName), kRrTypeKey, kOtherRecordTtl);
+
+    otbrLogInfo("Registering new key %s", mName.c_str());
+
+    record.mData = mKeyData;
+
+    mGroup = MakeUnique<RecordGroup>(GetPublisher());
+    mGroup->AddRecord(std::move(record), /* aUnique */ true);
+    mGroup->Start([this](otbrError aError) { HandleResult(aError); });
+}
+
+void PublisherBuiltin::BuiltinKeyRegistration::HandleResult(otbrError aError)
+{
+    if (aError == OTBR_ERROR_NONE)
+    {
+        otbrLogInfo("Successfully registered key %s", mName.c_str());
+        Complete(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        otbrLogErr("Failed to register key %s: %s", mName.c_str(), otbrErrorString(aError));
+        GetPublisher().RemoveKeyRegistration(mName, aError);
+    }
+}
+
+otbrError PublisherBuiltin::PublishServiceImpl(const std::string &aHostName,
+                                               const std::string &aName,
+                                               const std::string &aType,
+                                               const SubTypeList &aSubTypeList,
+                                               uint16_t           aPort,
+                                               const TxtData     &aTxtData,
+                                               ResultCallback   &&aCallback)
+{
+    otbrError                   error             = OTBR_ERROR_NONE;
+    SubTypeList                 sortedSubTypeList = SortSubTypeList(aSubTypeList);
+    BuiltinServiceRegistration *serviceReg;
+
+    if (mState != State::kReady)
+    {
+        error = OTBR_ERROR_INVALID_STATE;
+        std::move(aCallback)(error);
+        ExitNow();
+    }
+
+    aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, aTxtData,
+                                                   std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    serviceReg = new BuiltinServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, aTxtData,
+                                                std::move(aCallback), this);
+    AddServiceRegistration(std::unique_ptr<BuiltinServiceRegistration>(serviceReg));
+
+    serviceReg->Register();
+
+exit:
+    return error;
+}
+
+void PublisherBuiltin::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+otbrError PublisherBuiltin::PublishHostImpl(const std::string &aName,
+                                            const AddressList &aAddresses,
+                                            ResultCallback   &&aCallback)
+{
+    otbrError                error = OTBR_ERROR_NONE;
+    BuiltinHostRegistration *hostReg;
+
+    if (mState != State::kReady)
+    {
+        error = OTBR_ERROR_INVALID_STATE;
+        std::move(aCallback)(error);
+        ExitNow();
+    }
+
+    aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    hostReg = new BuiltinHostRegistration(aName, aAddresses, std::move(aCallback), this);
+    AddHostRegistration(std::unique_ptr<BuiltinHostRegistration>(hostReg));
+
+    hostReg->Register();
+
+exit:
+    return error;
+}
+
+void PublisherBuiltin::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+otbrError PublisherBuiltin::PublishKeyImpl(const std::string &aName,
+                                           const KeyData     &aKeyData,
+                                           ResultCallback   &&aCallback)
+{
+    otbrError               error = OTBR_ERROR_NONE;
+    BuiltinKeyRegistration *keyReg;
+
+    if (mState != State::kReady)
+    {
+        error = OTBR_ERROR_INVALID_STATE;
+        std::move(aCallback)(error);
+        ExitNow();
+    }
+
+    aCallback = HandleDuplicateKeyRegistration(aName, aKeyData, std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    keyReg = new BuiltinKeyRegistration(aName, aKeyData, std::move(aCallback), this);
+    AddKeyRegistration(std::unique_ptr<BuiltinKeyRegistration>(keyReg));
+
+    keyReg->Register();
+
+exit:
+    return error;
+}
+
+void PublisherBuiltin::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveKeyRegistration(aName, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+void PublisherBuiltin::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    VerifyOrExit(mState == State::kReady);
+    mSubscribedServices.push_back(MakeUnique<ServiceSubscription>(aType, aInstanceName));
+
+    otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.size());
+
+    if (!aInstanceName.empty())
+    {
+        mServiceInstanceResolutionBeginTime[std::make_pair(aInstanceName, aType)] = Clock::now();
+    }
+
+    mSubscriptionsDirty = true;
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    ServiceSubscriptionList::iterator it;
+
+    VerifyOrExit(mState == Publisher::State::kReady);
+    it = std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
+                      [&aType, &aInstanceName](const std::unique_ptr<ServiceSubscription> &aService) {
+                          return aService->mType == aType && aService->mInstanceName == aInstanceName;
+                      });
+    VerifyOrExit(it != mSubscribedServices.end());
+
+    mSubscribedServices.erase(it);
+    mSubscriptionsDirty = true;
+
+    otbrLogInfo("Unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.size());
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::SubscribeHost(const std::string &aHostName)
+{
+    VerifyOrExit(mState == State::kReady);
+    mSubscribedHosts.push_back(MakeUnique<HostSubscription>(aHostName));
+
+    otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
+
+    mHostResolutionBeginTime[aHostName] = Clock::now();
+    mSubscriptionsDirty                 = true;
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::UnsubscribeHost(const std::string &aHostName)
+{
+    HostSubscriptionList::iterator it;
+
+    VerifyOrExit(mState == Publisher::State::kReady);
+    it = std::find_if(
+        mSubscribedHosts.begin(), mSubscribedHosts.end(),
+        [&aHostName](const std::unique_ptr<HostSubscription> &aHost) { return aHost->mHostName == aHostName; });
+    VerifyOrExit(it != mSubscribedHosts.end());
+
+    mSubscribedHosts.erase(it);
+    mSubscriptionsDirty = true;
+
+    otbrLogInfo("Unsubscribe host %s (remaining %zu)", aHostName.c_str(), mSubscribedHosts.size());
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::OnServiceResolveFailedImpl(const std::string &aType,
+                                                  const std::string &aInstanceName,
+                                                  int32_t            aErrorCode)
+{
+    otbrLogWarning("Resolve service %s.%s failed: code=%" PRId32, aInstanceName.c_str(), aType.c_str(), aErrorCode);
+}
+
+void PublisherBuiltin::OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode)
+{
+    otbrLogWarning("Resolve host %s failed: code=%" PRId32, aHostName.c_str(), aErrorCode);
+}
+
+otbrError PublisherBuiltin::DnsErrorToOtbrError(int32_t aErrorCode)
+{
+    // The built-in responder reports errors as `otbrError` values.
+    return static_cast<otbrError>(aErrorCode);
+}
+
+void PublisherBuiltin::EvaluateSubscriptions(void)
+{
+    Timepoint                 now = Clock::now();
+    std::vector<QueryKey>     neededQueries;
+    std::vector<Notification> notifications;
+
+    mSubscriptionsDirty = false;
+
+    for (std::unique_ptr<ServiceSubscription> &subscription : mSubscribedServices)
+    {
+        EvaluateServiceSubscription(*subscription, neededQueries, notifications);
+    }
+
+    for (std::unique_ptr<HostSubscription> &subscription : mSubscribedHosts)
+    {
+        EvaluateHostSubscription(*subscription, neededQueries, notifications);
+    }
+
+    std::sort(neededQueries.begin(), neededQueries.end());
+    neededQueries.erase(std::unique(neededQueries.begin(), neededQueries.end()), neededQueries.end());
+
+    for (auto it = mQueries.begin(); it != mQueries.end();)
+    {
+        it = std::binary_search(neededQueries.begin(), neededQueries.end(), it->first) ? std::next(it)
+                                                                                       : mQueries.erase(it);
+    }
+
+    for (const QueryKey &key : neededQueries)
+    {
+        if (mQueries.find(key) == mQueries.end())
+        {
+            ActiveQuery query;
+
+            // RFC 6762 section 5.2: the first query is delayed by 20-120 ms
+            // and the interval between queries at least doubles afterwards.
+            query.mQuestion.mName  = key.first;
+            query.mQuestion.mType  = key.second;
+            query.mQuestion.mClass = kRrClassIn;
+            query.mNextTx          = now + RandomDelay(20, 120);
+            query.mInterval        = Milliseconds(kFirstQueryIntervalMs);
+
+            ScheduleTimer(query.mNextTx);
+            mQueries.emplace(key, std::move(query));
+        }
+    }
+
+    // The notifications are delivered last since the callbacks may
+    // change the subscriptions.
+    for (Notification &notification : notifications)
+    {
+        notification();
+    }
+}
+
+void PublisherBuiltin::EvaluateServiceSubscription(ServiceSubscription       &aSubscription,
+                                                   std::vector<QueryKey>     &aQueries,
+                                                   std::vector<Notification> &aNotifications)
+{
+    const std::string       &type     = aSubscription.mType;
+    bool                     browsing = aSubscription.mInstanceName.empty();
+    std::vector<std::string> instanceNames;
+    std::vector<std::string> presentKeys;
+
+    if (browsing)
+    {
+        std::string              typeName = MakeFullName(type);
+        std::vector<FoundRecord> ptrs;
+
+        aQueries.emplace_back(ToLowerName(typeName), kRrTypePtr);
+        FindRecords(typeName, kRrTypePtr, ptrs);
+
+        for (const FoundRecord &ptr : ptrs)
+        {
+            instanceNames.push_back(ptr.mRecord->mTarget);
+        }
+    }
+    else
+    {
+        instanceNames.push_back(MakeInstanceFullName(aSubscription.mInstanceName, type));
+    }
+
+    for (const std::string &instanceName : instanceNames)
+    {
+        std::string            key = ToLowerName(instanceName);
+        DiscoveredInstanceInfo instanceInfo;
+        bool                   resolved = ResolveInstance(instanceName, aQueries, instanceInfo);
+        auto                   reported = aSubscription.mReportedInstances.find(key);
+
+        if (browsing || resolved)
+        {
+            presentKeys.push_back(key);
+        }
+
+        if (!resolved)
+        {
+            if (reported == aSubscription.mReportedInstances.end())
+            {
+                mServiceInstanceResolutionBeginTime.emplace(std::make_pair(instanceInfo.mName, type), Clock::now());
+            }
+
+            continue;
+        }
+
+        if (reported == aSubscription.mReportedInstances.end() || !IsSameInstanceInfo(reported->second, instanceInfo))
+        {
+            aSubscription.mReportedInstances[key] = instanceInfo;
+            aNotifications.push_back([this, type, instanceInfo]() { OnServiceResolved(type, instanceInfo); });
+        }
+    }
+
+    for (auto it = aSubscription.mReportedInstances.begin(); it != aSubscription.mReportedInstances.end();)
+    {
+        if (std::find(presentKeys.begin(), presentKeys.end(), it->first) != presentKeys.end())
+        {
+            ++it;
+            continue;
+        }
+
+        uint32_t    netifIndex   = it->second.mNetifIndex;
+        std::string instanceName = it->second.mName;
+
+        aNotifications.push_back(
+            [this, netifIndex, type, instanceName]() { OnServiceRemoved(netifIndex, type, instanceName); });
+        it = aSubscription.mReportedInstances.erase(it);
+    }
+}
+
+bool PublisherBuiltin::ResolveInstance(const std::string      &aInstanceFullName,
+                                       std::vector<QueryKey>  &aQueries,
+                                       DiscoveredInstanceInfo &aInstanceInfo) const
+{
+    std::string              key = ToLowerName(aInstanceFullName);
+    std::string              rest;
+    std::vector<FoundRecord> srvs;
+    std::vector<FoundRecord> txts;
+    const ResourceRecord    *srv;
+    uint32_t                 addressTtl;
+    bool                     resolved = false;
+
+    aInstanceInfo.mName = SplitFirstLabel(aInstanceFullName, rest);
+
+    aQueries.emplace_back(key, kRrTypeSrv);
+    aQueries.emplace_back(key, kRrTypeTxt);
+    FindRecords(aInstanceFullName, kRrTypeSrv, srvs);
+    FindRecords(aInstanceFullName, kRrTypeTxt, txts);
+    VerifyOrExit(!srvs.empty() && !txts.empty());
+
+    srv = srvs.front().mRecord;
+
+    aInstanceInfo.mNetifIndex = srvs.front().mNetifIndex;
+    aInstanceInfo.mHostName   = srv->mTarget + ".";
+    aInstanceInfo.mPort       = srv->mPort;
+    aInstanceInfo.mPriority   = srv->mPriority;
+    aInstanceInfo.mWeight     = srv->mWeight;
+    aInstanceInfo.mTxtData    = txts.front().mRecord->mData;
+
+    aQueries.emplace_back(ToLowerName(srv->mTarget), kRrTypeAaaa);
+    FindAddresses(srv->mTarget, aInstanceInfo.mAddresses, addressTtl);
+
+    // Same as the other backends, only routable addresses are reported for services.
+    aInstanceInfo.mAddresses.erase(std::remove_if(aInstanceInfo.mAddresses.begin(), aInstanceInfo.mAddresses.end(),
+                                                  [](const Ip6Address &aAddress) {
+                                                      return aAddress.IsUnspecified() || aAddress.IsLinkLocal() ||
+                                                             aAddress.IsMulticast() || aAddress.IsLoopback();
+                                                  }),
+                                   aInstanceInfo.mAddresses.end());
+    VerifyOrExit(!aInstanceInfo.mAddresses.empty());
+
+    aInstanceInfo.mTtl = std::min(srv->mTtl, addressTtl);
+    resolved           = true;
+
+exit:
+    return resolved;
+}
+
+void PublisherBuiltin::EvaluateHostSubscription(HostSubscription          &aSubscription,
+                                                std::vector<QueryKey>     &aQueries,
+                                                std::vector<Notification> &aNotifications)
+{
+    std::string        fullName = MakeFullHostName(aSubscription.mHostName);
+    std::string        hostName = aSubscription.mHostName;
+    DiscoveredHostInfo hostInfo;
+
+    aQueries.emplace_back(ToLowerName(fullName), kRrTypeAaaa);
+    FindAddresses(fullName, hostInfo.mAddresses, hostInfo.mTtl);
+
+    hostInfo.mAddresses.erase(std::remove_if(hostInfo.mAddresses.begin(), hostInfo.mAddresses.end(),
+                                             [](const Ip6Address &aAddress) { return aAddress.IsLinkLocal(); }),
+                              hostInfo.mAddresses.end());
+
+    VerifyOrExit(hostInfo.mAddresses != aSubscription.mReportedInfo.mAddresses);
+
+    hostInfo.mHostName   = fullName + ".";
+    hostInfo.mNetifIndex = mInfraIfIndex;
+
+    aSubscription.mReportedInfo = hostInfo;
+    aNotifications.push_back([this, hostName, hostInfo]() { OnHostResolved(hostName, hostInfo); });
+
+exit:
+    return;
+}
+
+void PublisherBuiltin::FindRecords(const std::string &aName, uint16_t aType, std::vector<FoundRecord> &aRecords) const
+{
+    std::string key        = ToLowerName(aName);
+    auto        cacheRange = mCache.equal_range(key);
+    auto        ownedRange = mRecordIndex.equal_range(key);
+
+    for (auto it = cacheRange.first; it != cacheRange.second; ++it)
+    {
+        const CacheEntry &entry = it->second;
+
+        if (!entry.mFlushed && entry.mRecord.mType == aType)
+        {
+            aRecords.push_back({&entry.mRecord, mInfraIfIndex});
+        }
+    }
+
+    // Records published by this responder are discovered as well, the
+    // same as with the other backends.
+    for (auto it = ownedRange.first; it != ownedRange.second; ++it)
+    {
+        const OwnedRecord &owned = *it->second;
+
+        if (owned.mGroup->IsEstablished() && owned.mRecord.mType == aType &&
+            std::none_of(aRecords.begin(), aRecords.end(),
+                         [&owned](const FoundRecord &aFound) { return aFound.mRecord->IsSameAs(owned.mRecord); }))
+        {
+            aRecords.push_back({&owned.mRecord, mInfraIfIndex});
+        }
+    }
+}
+
+void PublisherBuiltin::FindAddresses(const std::string &aHostName, AddressList &aAddresses, uint32_t &aTtl) const
+{
+    std::vector<FoundRecord> records;
+
+    aTtl = 0;
+    FindRecords(aHostName, kRrTypeAaaa, records);
+
+    for (const FoundRecord &found : records)
+    {
+        Ip6Address address;
+
+        if (found.mRecord->mData.size() != sizeof(address.m8))
+        {
+            continue;
+        }
+
+        memcpy(address.m8, found.mRecord->mData.data(), sizeof(address.m8));
+        AddAddress(aAddresses, address);
+        aTtl = (aTtl == 0) ? found.mRecord->mTtl : std::min(aTtl, found.mRecord->mTtl);
+    }
+
+    aAddresses = SortAddressList(std::move(aAddresses));
+}
+
+bool PublisherBuiltin::IsSameInstanceInfo(const DiscoveredInstanceInfo &aInfo, const DiscoveredInstanceInfo &aOther)
+{
+    return aInfo.mNetifIndex == aOther.mNetifIndex && aInfo.mName == aOther.mName &&
+           aInfo.mHostName == aOther.mHostName && aInfo.mAddresses == aOther.mAddresses &&
+           aInfo.mPort == aOther.mPort && aInfo.mPriority == aOther.mPriority && aInfo.mWeight == aOther.mWeight &&
+           aInfo.mTxtData == aOther.mTxtData;
+}
+
+Publisher *Publisher::Create(StateCallback aCallback)
+{
+    return new PublisherBuiltin(aCallback);
+}
+
+void Publisher::Destroy(Publisher *aPublisher)
+{
+    delete static_cast<PublisherBuiltin *>(aPublisher);
+}
+
+} // namespace Mdns
+
+} // namespace otbr
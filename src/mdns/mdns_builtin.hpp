@@ -0,0 +1,392 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the built-in mDNS publisher.
+ */
+
+#ifndef OTBR_AGENT_MDNS_BUILTIN_HPP_
+#define OTBR_AGENT_MDNS_BUILTIN_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "mdns/dns_message.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * @addtogroup border-router-mdns
+ *
+ * @brief
+ *   This module includes definition for the built-in mDNS publisher.
+ *
+ * @{
+ */
+
+/**
+ * This class implements an mDNS publisher which runs an mDNS responder and querier (RFC 6762)
+ * inside the agent, directly over the multicast UDP sockets on the infrastructure interface.
+ *
+ */
+class PublisherBuiltin : public MainloopProcessor, public Publisher
+{
+public:
+    explicit PublisherBuiltin(StateCallback aCallback);
+
+    ~PublisherBuiltin(void) override;
+
+    // Implementation of Mdns::Publisher.
+
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
+
+    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
+    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      SubscribeHost(const std::string &aHostName) override;
+    void      UnsubscribeHost(const std::string &aHostName) override;
+    void      SetInfraIf(const std::string &aInfraIfName) override;
+    otbrError Start(void) override;
+    bool      IsStarted(void) const override;
+    void      Stop(void) override;
+
+    // Implementation of MainloopProcessor.
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
+protected:
+    otbrError PublishServiceImpl(const std::string &aHostName,
+                                 const std::string &aName,
+                                 const std::string &aType,
+                                 const SubTypeList &aSubTypeList,
+                                 uint16_t           aPort,
+                                 const TxtData     &aTxtData,
+                                 ResultCallback   &&aCallback) override;
+    otbrError PublishHostImpl(const std::string &aName,
+                              const AddressList &aAddresses,
+                              ResultCallback   &&aCallback) override;
+    otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      OnServiceResolveFailedImpl(const std::string &aType,
+                                         const std::string &aInstanceName,
+                                         int32_t            aErrorCode) override;
+    void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
+    otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+
+private:
+    static constexpr uint16_t kMdnsPort         = 5353;
+    static constexpr uint32_t kHostRecordTtl    = 120;  // TTL of SRV, A and AAAA records (RFC 6762 section 10).
+    static constexpr uint32_t kOtherRecordTtl   = 4500; // TTL of all other records.
+    static constexpr uint32_t kLegacyUnicastTtl = 10;   // RFC 6762 section 6.7.
+    static constexpr size_t   kMaxMessageSize   = 1440; // Fits in the minimum IPv6 MTU with headers.
+    static constexpr size_t   kMaxCacheEntries  = 4096;
+    static constexpr uint8_t  kNumProbes        = 3;
+    static constexpr uint8_t  kNumAnnouncements = 2;
+    static constexpr uint8_t  kNumRefreshes     = 4; // Cache refreshes at 80%, 85%, 90% and 95% of the TTL.
+
+    enum Family : uint8_t
+    {
+        kIp6,
+        kIp4,
+        kNumFamilies,
+    };
+
+    class RecordGroup;
+
+    struct OwnedRecord
+    {
+        ResourceRecord mRecord;
+        bool           mUnique;
+        RecordGroup   *mGroup;
+        Timepoint      mLastMulticast[kNumFamilies];
+    };
+
+    // A set of records which are probed, announced and withdrawn together.
+    class RecordGroup : private ::NonCopyable
+    {
+    public:
+        using ResultHandler = std::function<void(otbrError aError)>;
+
+        enum State : uint8_t
+        {
+            kIdle,
+            kProbing,
+            kAnnouncing,
+            kAnnounced,
+        };
+
+        explicit RecordGroup(PublisherBuiltin &aPublisher);
+        ~RecordGroup(void);
+
+        void AddRecord(ResourceRecord aRecord, bool aUnique);
+        void Start(ResultHandler aResultHandler);
+        void RestartProbing(Milliseconds aDelay);
+        bool IsEstablished(void) const { return mState == kAnnouncing || mState == kAnnounced; }
+
+        PublisherBuiltin        &mPublisher;
+        uint64_t                 mId;
+        std::vector<OwnedRecord> mRecords;
+        State                    mState;
+        uint8_t                  mTxCount;
+        Timepoint                mNextTx;
+        ResultHandler            mResultHandler;
+        bool                     mIsStarted;
+    };
+
+    class BuiltinServiceRegistration : public ServiceRegistration
+    {
+    public:
+        using ServiceRegistration::ServiceRegistration; // Inherit base constructor
+
+        void Register(void);
+        void HandleResult(otbrError aError);
+        bool IsEstablished(void) const { return mGroup != nullptr && mGroup->IsEstablished(); }
+
+    private:
+        PublisherBuiltin &GetPublisher(void) { return *static_cast<PublisherBuiltin *>(mPublisher); }
+
+        std::unique_ptr<RecordGroup> mGroup;
+    };
+
+    class BuiltinHostRegistration : public HostRegistration
+    {
+    public:
+        using HostRegistration::HostRegistration; // Inherit base constructor
+
+        void Register(void);
+
+    private:
+        PublisherBuiltin &GetPublisher(void) { return *static_cast<PublisherBuiltin *>(mPublisher); }
+        void              HandleResult(otbrError aError);
+
+        std::unique_ptr<RecordGroup> mGroup;
+    };
+
+    class BuiltinKeyRegistration : public KeyRegistration
+    {
+    public:
+        using KeyRegistration::KeyRegistration; // Inherit base constructor
+
+        void Register(void);
+
+    private:
+        PublisherBuiltin &GetPublisher(void) { return *static_cast<PublisherBuiltin *>(mPublisher); }
+        void              HandleResult(otbrError aError);
+
+        std::unique_ptr<RecordGroup> mGroup;
+    };
+
+    struct ServiceSubscription
+    {
+        ServiceSubscription(std::string aType, std::string aInstanceName)
+            : mType(std::move(aType))
+            , mInstanceName(std::move(aInstanceName))
+        {
+        }
+
+        std::string mType;
+        std::string mInstanceName; // Empty to browse all instances of `mType`.
+
+        // Lowercase instance name -> the instance info last reported.
+        std::map<std::string, DiscoveredInstanceInfo> mReportedInstances;
+    };
+
+    struct HostSubscription
+    {
+        explicit HostSubscription(std::string aHostName)
+            : mHostName(std::move(aHostName))
+        {
+        }
+
+        std::string        mHostName;
+        DiscoveredHostInfo mReportedInfo;
+    };
+
+    // A question which is asked with continuous querying (RFC 6762 section 5.2).
+    struct ActiveQuery
+    {
+        Question     mQuestion;
+        Timepoint    mNextTx;
+        Milliseconds mInterval;
+    };
+
+    struct CacheEntry
+    {
+        ResourceRecord mRecord;
+        uint32_t       mNetifIndex;
+        Timepoint      mReceiveTime;
+        Timepoint      mExpireTime;
+        uint8_t        mRefreshCount;
+        bool           mFlushed; // Whether the entry expires in one second after a goodbye or a cache flush.
+    };
+
+    struct PendingAnswer
+    {
+        ResourceRecord mRecord;
+        Timepoint      mDeadline;
+    };
+
+    // A record found in the cache or among the records published by this responder.
+    struct FoundRecord
+    {
+        const ResourceRecord *mRecord;
+        uint32_t              mNetifIndex;
+    };
+
+    using ServiceSubscriptionList = std::vector<std::unique_ptr<ServiceSubscription>>;
+    using HostSubscriptionList    = std::vector<std::unique_ptr<HostSubscription>>;
+    using QueryKey                = std::pair<std::string, uint16_t>; // Lowercase name and record type.
+    using Notification            = std::function<void(void)>;
+
+    otbrError SelectInfraIf(void);
+    otbrError OpenSocket(Family aFamily);
+    void      CloseSockets(void);
+    void      ReceiveMessages(Family aFamily);
+    void      SendMessage(Family aFamily, const std::vector<uint8_t> &aMessage, const sockaddr &aDest);
+    void      HandleQuery(Family aFamily, const Message &aQuery, const sockaddr_storage &aSource);
+    void      HandleProbeTiebreak(const Message &aQuery);
+    void      HandleResponse(Family aFamily, const Message &aResponse);
+    void      CheckConflict(const ResourceRecord &aRecord);
+    void      SendResponse(Family                      aFamily,
+                           std::vector<ResourceRecord> aAnswers,
+                           const sockaddr             &aDest,
+                           const Message              *aLegacyQuery);
+    void      SendRecords(Family                             aFamily,
+                          const std::vector<ResourceRecord> &aAnswers,
+                          const std::vector<ResourceRecord> &aAdditionals,
+                          const sockaddr                    &aDest,
+                          const Message                     *aLegacyQuery);
+    void      QueueAnswer(Family aFamily, const ResourceRecord &aRecord, Timepoint aDeadline);
+    void      AddOwnedRecords(const std::string                 &aName,
+                              uint16_t                           aType,
+                              const std::vector<ResourceRecord> &aExcluded,
+                              std::vector<ResourceRecord>       &aRecords) const;
+    OwnedRecord *FindOwnedRecord(const ResourceRecord &aRecord);
+    bool         IsRecordReowned(const ResourceRecord &aRecord) const;
+    bool         HasPendingGoodbye(const std::string &aName) const;
+
+    void HandleTimers(void);
+    void ScheduleTimer(Timepoint aTime);
+    void ProcessGroups(Timepoint aNow);
+    void SendProbe(const RecordGroup &aGroup);
+    void SendAnnouncement(RecordGroup &aGroup, Timepoint aNow);
+    void ProcessPendingAnswers(Timepoint aNow);
+    void ProcessQueries(Timepoint aNow);
+    void CollectKnownAnswers(const Question              &aQuestion,
+                             Timepoint                    aNow,
+                             std::vector<ResourceRecord> &aKnownAnswers) const;
+    void ProcessCache(Timepoint aNow);
+    void AddToCache(const ResourceRecord &aRecord, Timepoint aNow);
+    void FlushGoodbyes(void);
+    void DeliverGroupResults(void);
+    void PublishLocalHost(void);
+    void HandleLocalHostResult(otbrError aError);
+    void CheckLocalHostAddresses(void);
+    void CollectLocalAddresses(std::vector<ResourceRecord> &aRecords) const;
+
+    void EvaluateSubscriptions(void);
+    void EvaluateServiceSubscription(ServiceSubscription       &aSubscription,
+                                     std::vector<QueryKey>     &aQueries,
+                                     std::vector<Notification> &aNotifications);
+    void EvaluateHostSubscription(HostSubscription          &aSubscription,
+                                  std::vector<QueryKey>     &aQueries,
+                                  std::vector<Notification> &aNotifications);
+    bool ResolveInstance(const std::string      &aInstanceFullName,
+                         std::vector<QueryKey>  &aQueries,
+                         DiscoveredInstanceInfo &aInstanceInfo) const;
+    void FindRecords(const std::string &aName, uint16_t aType, std::vector<FoundRecord> &aRecords) const;
+    void FindAddresses(const std::string &aHostName, AddressList &aAddresses, uint32_t &aTtl) const;
+
+    std::string  GetLocalHostFullName(void) const { return MakeFullHostName(mLocalHostName); }
+    std::string  MakeInstanceFullName(const std::string &aName, const std::string &aType) const;
+    std::string  MakeKeyFullName(const std::string &aName) const;
+    Milliseconds RandomDelay(uint32_t aMinMs, uint32_t aMaxMs);
+
+    static void      GetMulticastAddress(Family aFamily, sockaddr_storage &aAddress);
+    static bool      WasMulticastWithin(const OwnedRecord &aOwned,
+                                        Family             aFamily,
+                                        Timepoint          aNow,
+                                        uint32_t           aIntervalMs);
+    static Timepoint GetRefreshTime(const CacheEntry &aEntry);
+    static bool      IsKnownAnswer(const ResourceRecord &aRecord, const std::vector<ResourceRecord> &aKnownAnswers);
+    static bool      IsSameInstanceInfo(const DiscoveredInstanceInfo &aInfo, const DiscoveredInstanceInfo &aOther);
+
+    State         mState;
+    StateCallback mStateCallback;
+    std::string   mInfraIfName;
+    uint32_t      mInfraIfIndex;
+    int           mSockets[kNumFamilies];
+    std::string   mLocalHostName;
+
+    std::unique_ptr<RecordGroup> mLocalHostGroup;
+    Timepoint                    mNextAddressCheck;
+
+    uint64_t                                            mNextGroupId;
+    std::map<uint64_t, RecordGroup *>                   mGroups;
+    std::unordered_multimap<std::string, OwnedRecord *> mRecordIndex; // Lowercase name -> record.
+    std::vector<std::pair<uint64_t, otbrError>>         mGroupResults;
+    std::vector<ResourceRecord>                         mPendingGoodbyes;
+    std::vector<PendingAnswer>                          mPendingAnswers[kNumFamilies];
+    std::unordered_multimap<std::string, CacheEntry>    mCache; // Lowercase name -> entry.
+    std::map<QueryKey, ActiveQuery>                     mQueries;
+    ServiceSubscriptionList                             mSubscribedServices;
+    HostSubscriptionList                                mSubscribedHosts;
+    bool                                                mSubscriptionsDirty;
+    Timepoint                                           mNextFireTime;
+    std::default_random_engine                          mRandom;
+};
+
+/**
+ * @}
+ */
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_BUILTIN_HPP_
@@ -214,7 +214,7 @@ static const char *DNSErrorToString(DNSServiceErrorType aError)
 }
 
 PublisherMDnsSd::PublisherMDnsSd(StateCallback aCallback)
-    : mHostsRef(nullptr)
+    : mSharedRef(nullptr)
     , mState(State::kIdle)
     , mStateCallback(std::move(aCallback))
 {
@@ -243,9 +243,12 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
 
     // If we get a `kDNSServiceErr_ServiceNotRunning` and need to
     // restart the `Publisher`, we should immediately de-allocate
-    // all `ServiceRef`. Otherwise, we first clear the `Registrations`
-    // list so that `DnssdHostRegisteration` destructor gets the chance
-    // to update registered records if needed.
+    // the shared connection. This also frees every `DNSServiceRef`
+    // and `DNSRecordRef` on it, so the registrations and subscriptions
+    // below only drop their (now dangling) references. Otherwise, we
+    // first clear the `Registrations` list and subscriptions so that
+    // they get the chance to unregister records and cancel operations
+    // before the shared connection goes away.
 
     switch (aStopMode)
     {
@@ -253,171 +256,86 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
         break;
 
     case kStopOnServiceNotRunningError:
-        DeallocateHostsRef();
+        DeallocateSharedRef();
         break;
     }
 
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
     mKeyRegistrations.clear();
-    DeallocateHostsRef();
 
+    for (std::unique_ptr<ServiceSubscription> &service : mSubscribedServices)
+    {
+        ReleaseAfterDispatch(std::move(service));
+    }
     mSubscribedServices.clear();
+
+    for (std::unique_ptr<HostSubscription> &host : mSubscribedHosts)
+    {
+        ReleaseAfterDispatch(std::move(host));
+    }
     mSubscribedHosts.clear();
 
+    DeallocateSharedRef();
+
     mState = State::kIdle;
 
 exit:
     return;
 }
 
-DNSServiceErrorType PublisherMDnsSd::CreateSharedHostsRef(void)
+DNSServiceErrorType PublisherMDnsSd::CreateSharedRef(void)
 {
     DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
 
-    VerifyOrExit(mHostsRef == nullptr);
+    VerifyOrExit(mSharedRef == nullptr);
 
-    dnsError = DNSServiceCreateConnection(&mHostsRef);
-    otbrLogDebug("Created new shared DNSServiceRef: %p", mHostsRef);
+    dnsError = DNSServiceCreateConnection(&mSharedRef);
+    otbrLogDebug("Created new shared DNSServiceRef: %p", mSharedRef);
 
 exit:
     return dnsError;
 }
 
-void PublisherMDnsSd::DeallocateHostsRef(void)
+void PublisherMDnsSd::DeallocateSharedRef(void)
 {
-    VerifyOrExit(mHostsRef != nullptr);
+    VerifyOrExit(mSharedRef != nullptr);
 
-    HandleServiceRefDeallocating(mHostsRef);
-    DNSServiceRefDeallocate(mHostsRef);
-    otbrLogDebug("Deallocated DNSServiceRef for hosts: %p", mHostsRef);
-    mHostsRef = nullptr;
+    // This also frees all `DNSServiceRef`s and `DNSRecordRef`s which
+    // were created on the shared connection.
+    DNSServiceRefDeallocate(mSharedRef);
+    otbrLogDebug("Deallocated shared DNSServiceRef: %p", mSharedRef);
+    mSharedRef = nullptr;
 
 exit:
     return;
 }
 
-void PublisherMDnsSd::Update(MainloopContext &aMainloop)
+void PublisherMDnsSd::DeallocateServiceRef(DNSServiceRef &aServiceRef, const PublisherMDnsSd &aPublisher)
 {
-    for (auto &kv : mServiceRegistrations)
-    {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        serviceReg.Update(aMainloop);
-    }
+    VerifyOrExit(aServiceRef != nullptr);
 
-    if (mHostsRef != nullptr)
+    // A `DNSServiceRef` on the shared connection is already freed
+    // if the shared connection is gone.
+    if (aPublisher.mSharedRef != nullptr)
     {
-        int fd = DNSServiceRefSockFD(mHostsRef);
-
-        assert(fd != -1);
-
-        FD_SET(fd, &aMainloop.mReadFdSet);
-
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+        DNSServiceRefDeallocate(aServiceRef);
     }
 
-    for (const auto &service : mSubscribedServices)
-    {
-        service->UpdateAll(aMainloop);
-    }
-
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Update(aMainloop);
-    }
-}
+    aServiceRef = nullptr;
 
-void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
-{
-    mServiceRefsToProcess.clear();
-
-    for (auto &kv : mServiceRegistrations)
-    {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        serviceReg.Process(aMainloop, mServiceRefsToProcess);
-    }
-
-    if (mHostsRef != nullptr)
-    {
-        int fd = DNSServiceRefSockFD(mHostsRef);
-
-        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
-        {
-            mServiceRefsToProcess.push_back(mHostsRef);
-        }
-    }
-
-    for (const auto &service : mSubscribedServices)
-    {
-        service->ProcessAll(aMainloop, mServiceRefsToProcess);
-    }
-
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Process(aMainloop, mServiceRefsToProcess);
-    }
-
-    for (DNSServiceRef serviceRef : mServiceRefsToProcess)
-    {
-        DNSServiceErrorType error;
-
-        // As we go through the list of `mServiceRefsToProcess` the call
-        // to `DNSServiceProcessResult()` can itself invoke callbacks
-        // into `PublisherMDnsSd` and OT, which in turn, may change the
-        // state of `Publisher` and potentially trigger a previously
-        // valid `ServiceRef` in the list to be deallocated. We use
-        // `HandleServiceRefDeallocating()` which is called whenever a
-        // `ServiceRef` is being deallocated and from this we update
-        // the entry in `mServiceRefsToProcess` list to `nullptr` so to
-        // avoid calling `DNSServiceProcessResult()` on an already
-        // freed `ServiceRef`.
-
-        if (serviceRef == nullptr)
-        {
-            continue;
-        }
-
-        error = DNSServiceProcessResult(serviceRef);
-
-        if (error != kDNSServiceErr_NoError)
-        {
-            otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
-            otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
-                    DNSErrorToString(error), serviceRef);
-        }
-        if (error == kDNSServiceErr_ServiceNotRunning)
-        {
-            otbrLogWarning("Need to reconnect to mdnsd");
-            Stop(kStopOnServiceNotRunningError);
-            Start();
-            ExitNow();
-        }
-    }
 exit:
     return;
 }
 
-void PublisherMDnsSd::HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef)
-{
-    for (DNSServiceRef &entry : mServiceRefsToProcess)
-    {
-        if (entry == aServiceRef)
-        {
-            entry = nullptr;
-        }
-    }
-}
-
-void PublisherMDnsSd::DnssdServiceRegistration::Update(MainloopContext &aMainloop) const
+void PublisherMDnsSd::Update(MainloopContext &aMainloop)
 {
     int fd;
 
-    VerifyOrExit(mServiceRef != nullptr);
+    VerifyOrExit(mSharedRef != nullptr);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
+    fd = DNSServiceRefSockFD(mSharedRef);
+    assert(fd != -1);
 
     FD_SET(fd, &aMainloop.mReadFdSet);
     aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
@@ -426,18 +344,33 @@ exit:
     return;
 }
 
-void PublisherMDnsSd::DnssdServiceRegistration::Process(const MainloopContext      &aMainloop,
-                                                        std::vector<DNSServiceRef> &aReadyServices) const
+void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
 {
-    int fd;
+    DNSServiceErrorType error;
 
-    VerifyOrExit(mServiceRef != nullptr);
+    VerifyOrExit(mSharedRef != nullptr);
+    VerifyOrExit(FD_ISSET(DNSServiceRefSockFD(mSharedRef), &aMainloop.mReadFdSet));
+
+    // Replies of all operations arrive on the shared connection and
+    // `DNSServiceProcessResult()` dispatches each of them to the callback
+    // of its own `DNSServiceRef`, draining all replies already received.
+    // The callbacks may deallocate any `DNSServiceRef` on the connection
+    // (including the shared one on `Stop()`), which mDNSResponder's client
+    // library handles while dispatching.
+    error = DNSServiceProcessResult(mSharedRef);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
+        otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s", DNSErrorToString(error));
+    }
 
-    VerifyOrExit(FD_ISSET(fd, &aMainloop.mReadFdSet));
-    aReadyServices.push_back(mServiceRef);
+    if (error == kDNSServiceErr_ServiceNotRunning)
+    {
+        otbrLogWarning("Need to reconnect to mdnsd");
+        Stop(kStopOnServiceNotRunningError);
+        Start();
+    }
 
 exit:
     return;
@@ -445,11 +378,13 @@ exit:
 
 otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
 {
+    PublisherMDnsSd      &publisher = GetPublisher();
     std::string           fullHostName;
-    std::string           regType            = MakeRegType(mType, mSubTypeList);
+    std::string           regType            = MakeRegType(mType, *mSubTypeList);
     const char           *hostNameCString    = nullptr;
     const char           *serviceNameCString = nullptr;
     DnssdKeyRegistration *keyReg;
+    DNSServiceRef         serviceRef;
     DNSServiceErrorType   dnsError;
 
     if (!mHostName.empty())
@@ -472,11 +407,19 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
 
     otbrLogInfo("Registering service %s.%s", mName.c_str(), regType.c_str());
 
-    dnsError = DNSServiceRegister(&mServiceRef, kDNSServiceFlagsNoAutoRename, kDNSServiceInterfaceIndexAny,
-                                  serviceNameCString, regType.c_str(),
-                                  /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(), mTxtData.data(),
-                                  HandleRegisterResult, this);
+    dnsError = GetPublisher().CreateSharedRef();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    serviceRef = GetPublisher().mSharedRef;
+    dnsError   = DNSServiceRegister(&serviceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsNoAutoRename,
+                                    kDNSServiceInterfaceIndexAny, serviceNameCString, regType.c_str(),
+                                    /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData->size(),
+                                    mTxtData->data(), HandleRegisterResult, this);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
+    mServiceRef = serviceRef;
+
+exit:
     if (dnsError != kDNSServiceErr_NoError)
     {
         HandleRegisterResult(/* aFlags */ 0, dnsError);
@@ -487,7 +430,8 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
         keyReg->Register();
     }
 
-    return GetPublisher().DnsErrorToOtbrError(dnsError);
+    // This registration is freed if it failed, so it must not be accessed here.
+    return publisher.DnsErrorToOtbrError(dnsError);
 }
 
 void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
@@ -509,11 +453,9 @@ void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
         keyReg->Unregister();
     }
 
-    GetPublisher().HandleServiceRefDeallocating(mServiceRef);
-    DNSServiceRefDeallocate(mServiceRef);
-    mServiceRef = nullptr;
+    DeallocateServiceRef(mServiceRef, GetPublisher());
 
-    if (keyReg != nullptr)
+    if (keyReg != nullptr && GetPublisher().mSharedRef != nullptr)
     {
         keyReg->Register();
     }
@@ -559,7 +501,8 @@ void PublisherMDnsSd::DnssdServiceRegistration::HandleRegisterResult(DNSServiceF
 
 otbrError PublisherMDnsSd::DnssdHostRegistration::Register(void)
 {
-    DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
+    PublisherMDnsSd    &publisher = GetPublisher();
+    DNSServiceErrorType dnsError  = kDNSServiceErr_NoError;
 
     otbrLogInfo("Registering new host %s", mName.c_str());
 
@@ -567,10 +510,10 @@ otbrError PublisherMDnsSd::DnssdHostRegistration::Register(void)
     {
         DNSRecordRef recordRef = nullptr;
 
-        dnsError = GetPublisher().CreateSharedHostsRef();
+        dnsError = GetPublisher().CreateSharedRef();
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
-        dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &recordRef, kDNSServiceFlagsShared,
+        dnsError = DNSServiceRegisterRecord(GetPublisher().mSharedRef, &recordRef, kDNSServiceFlagsShared,
                                             kDNSServiceInterfaceIndexAny, MakeFullHostName(mName).c_str(),
                                             kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(address.m8), address.m8,
                                             /* ttl */ 0, HandleRegisterResult, this);
@@ -586,14 +529,16 @@ exit:
         HandleRegisterResult(/* aRecordRef */ nullptr, dnsError);
     }
 
-    return GetPublisher().DnsErrorToOtbrError(dnsError);
+    // This registration is freed if it failed, so it must not be accessed here.
+    return publisher.DnsErrorToOtbrError(dnsError);
 }
 
 void PublisherMDnsSd::DnssdHostRegistration::Unregister(void)
 {
     DNSServiceErrorType dnsError;
 
-    VerifyOrExit(GetPublisher().mHostsRef != nullptr);
+    // The records are already freed along with the shared connection.
+    VerifyOrExit(GetPublisher().mSharedRef != nullptr);
 
     for (size_t index = 0; index < mAddrRecordRefs.size(); index++)
     {
@@ -607,13 +552,13 @@ void PublisherMDnsSd::DnssdHostRegistration::Unregister(void)
             // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
             // sending a goodbye message.
             // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
-            dnsError = DNSServiceUpdateRecord(GetPublisher().mHostsRef, mAddrRecordRefs[index], kDNSServiceFlagsUnique,
-                                              sizeof(address.m8), address.m8, /* ttl */ 1);
+            dnsError = DNSServiceUpdateRecord(GetPublisher().mSharedRef, mAddrRecordRefs[index],
+                                              kDNSServiceFlagsUnique, sizeof(address.m8), address.m8, /* ttl */ 1);
             otbrLogResult(DNSErrorToOtbrError(dnsError), "Send goodbye message for host %s address %s: %s",
                           MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
         }
 
-        dnsError = DNSServiceRemoveRecord(GetPublisher().mHostsRef, mAddrRecordRefs[index], /* flags */ 0);
+        dnsError = DNSServiceRemoveRecord(GetPublisher().mSharedRef, mAddrRecordRefs[index], /* flags */ 0);
 
         otbrLogResult(DNSErrorToOtbrError(dnsError), "Remove record for host %s address %s: %s",
                       MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
@@ -672,7 +617,8 @@ void PublisherMDnsSd::DnssdHostRegistration::HandleRegisterResult(DNSRecordRef a
 
 otbrError PublisherMDnsSd::DnssdKeyRegistration::Register(void)
 {
-    DNSServiceErrorType       dnsError = kDNSServiceErr_NoError;
+    PublisherMDnsSd          &publisher = GetPublisher();
+    DNSServiceErrorType       dnsError  = kDNSServiceErr_NoError;
     DnssdServiceRegistration *serviceReg;
 
     otbrLogInfo("Registering new key %s", mName.c_str());
@@ -704,10 +650,10 @@ otbrError PublisherMDnsSd::DnssdKeyRegistration::Register(void)
     {
         otbrLogInfo("Key %s is being registered individually", mName.c_str());
 
-        dnsError = GetPublisher().CreateSharedHostsRef();
+        dnsError = GetPublisher().CreateSharedRef();
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
-        dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &mRecordRef, kDNSServiceFlagsUnique,
+        dnsError = DNSServiceRegisterRecord(GetPublisher().mSharedRef, &mRecordRef, kDNSServiceFlagsUnique,
                                             kDNSServiceInterfaceIndexAny, MakeFullKeyName(mName).c_str(),
                                             kDNSServiceType_KEY, kDNSServiceClass_IN, mKeyData.size(), mKeyData.data(),
                                             /* ttl */ 0, HandleRegisterResult, this);
@@ -720,7 +666,8 @@ exit:
         HandleRegisterResult(dnsError);
     }
 
-    return GetPublisher().DnsErrorToOtbrError(dnsError);
+    // This registration is freed if it failed, so it must not be accessed here.
+    return publisher.DnsErrorToOtbrError(dnsError);
 }
 
 void PublisherMDnsSd::DnssdKeyRegistration::Unregister(void)
@@ -741,19 +688,20 @@ void PublisherMDnsSd::DnssdKeyRegistration::Unregister(void)
     }
     else
     {
-        serviceRef = GetPublisher().mHostsRef;
+        serviceRef = GetPublisher().mSharedRef;
 
         otbrLogInfo("Unregistering key %s (was registered individually)", mName.c_str());
     }
 
-    VerifyOrExit(serviceRef != nullptr);
+    // The record is already freed along with the shared connection.
+    VerifyOrExit(serviceRef != nullptr && GetPublisher().mSharedRef != nullptr);
 
     dnsError = DNSServiceRemoveRecord(serviceRef, mRecordRef, /* flags */ 0);
 
     otbrLogInfo("Unregistered key %s: error:%s", mName.c_str(), DNSErrorToString(dnsError));
 
 exit:
-    return;
+    mRecordRef = nullptr;
 }
 
 void PublisherMDnsSd::DnssdKeyRegistration::HandleRegisterResult(DNSServiceRef       aServiceRef,
@@ -950,6 +898,7 @@ void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::st
                       });
     VerifyOrExit(it != mSubscribedServices.end());
 
+    ReleaseAfterDispatch(std::move(*it));
     mSubscribedServices.erase(it);
 
     otbrLogInfo("Unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
@@ -1000,6 +949,7 @@ void PublisherMDnsSd::UnsubscribeHost(const std::string &aHostName)
 
     VerifyOrExit(it != mSubscribedHosts.end());
 
+    ReleaseAfterDispatch(std::move(*it));
     mSubscribedHosts.erase(it);
 
     otbrLogInfo("Unsubscribe host %s (remaining %d)", aHostName.c_str(), mSubscribedHosts.size());
@@ -1025,52 +975,33 @@ void PublisherMDnsSd::ServiceRef::Release(void)
 
 void PublisherMDnsSd::ServiceRef::DeallocateServiceRef(void)
 {
-    if (mServiceRef != nullptr)
-    {
-        mPublisher.HandleServiceRefDeallocating(mServiceRef);
-        DNSServiceRefDeallocate(mServiceRef);
-        mServiceRef = nullptr;
-    }
+    PublisherMDnsSd::DeallocateServiceRef(mServiceRef, mPublisher);
 }
 
-void PublisherMDnsSd::ServiceRef::Update(MainloopContext &aMainloop) const
+void PublisherMDnsSd::ServiceSubscription::Browse(void)
 {
-    int fd;
+    DNSServiceRef       serviceRef;
+    DNSServiceErrorType dnsError;
 
-    VerifyOrExit(mServiceRef != nullptr);
+    assert(mServiceRef == nullptr);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    FD_SET(fd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
-exit:
-    return;
-}
+    otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
 
-void PublisherMDnsSd::ServiceRef::Process(const MainloopContext      &aMainloop,
-                                          std::vector<DNSServiceRef> &aReadyServices) const
-{
-    int fd;
+    dnsError = mPublisher.CreateSharedRef();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
-    VerifyOrExit(mServiceRef != nullptr);
+    serviceRef = mPublisher.mSharedRef;
+    dnsError   = DNSServiceBrowse(&serviceRef, kDNSServiceFlagsShareConnection, kDNSServiceInterfaceIndexAny,
+                                  mType.c_str(), /* domain */ nullptr, HandleBrowseResult, this);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+    mServiceRef = serviceRef;
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
     {
-        aReadyServices.push_back(mServiceRef);
+        otbrLogWarning("DNSServiceBrowse failed: %s", DNSErrorToString(dnsError));
     }
-exit:
-    return;
-}
-
-void PublisherMDnsSd::ServiceSubscription::Browse(void)
-{
-    assert(mServiceRef == nullptr);
-
-    otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
-    DNSServiceBrowse(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, mType.c_str(),
-                     /* domain */ nullptr, HandleBrowseResult, this);
 }
 
 void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef       aServiceRef,
@@ -1109,6 +1040,7 @@ void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef
     }
     else
     {
+        // NOTE: This `ServiceSubscription` object may be released in `OnServiceRemoved`.
         mPublisher.OnServiceRemoved(aInterfaceIndex, mType, aInstanceName);
     }
 
@@ -1130,36 +1062,32 @@ void PublisherMDnsSd::ServiceSubscription::Resolve(uint32_t           aInterface
     mResolvingInstances.back()->Resolve();
 }
 
-void PublisherMDnsSd::ServiceSubscription::UpdateAll(MainloopContext &aMainloop) const
-{
-    Update(aMainloop);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Update(aMainloop);
-    }
-}
-
-void PublisherMDnsSd::ServiceSubscription::ProcessAll(const MainloopContext      &aMainloop,
-                                                      std::vector<DNSServiceRef> &aReadyServices) const
-{
-    Process(aMainloop, aReadyServices);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Process(aMainloop, aReadyServices);
-    }
-}
-
 void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
 {
+    DNSServiceRef       serviceRef;
+    DNSServiceErrorType dnsError;
+
     assert(mServiceRef == nullptr);
 
     mSubscription->mPublisher.mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mType)] = Clock::now();
 
     otbrLogInfo("DNSServiceResolve %s %s inf %u", mInstanceName.c_str(), mType.c_str(), mNetifIndex);
-    DNSServiceResolve(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mNetifIndex, mInstanceName.c_str(),
-                      mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+
+    dnsError = mPublisher.CreateSharedRef();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    serviceRef = mPublisher.mSharedRef;
+    dnsError   = DNSServiceResolve(&serviceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsTimeout, mNetifIndex,
+                                   mInstanceName.c_str(), mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    mServiceRef = serviceRef;
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("DNSServiceResolve failed: %s", DNSErrorToString(dnsError));
+    }
 }
 
 void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceRef        aServiceRef,
@@ -1189,18 +1117,21 @@ void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceR
 {
     OTBR_UNUSED_VARIABLE(aServiceRef);
 
-    std::string instanceName, type, domain;
-    otbrError   error = OTBR_ERROR_NONE;
+    otbrError error = OTBR_ERROR_NONE;
 
     otbrLogInfo("DNSServiceResolve reply: %s host %s:%d, TXT=%dB inf %u, flags=%u", aFullName, aHostTarget, aPort,
                 aTxtLen, aInterfaceIndex, aFlags);
 
     VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
 
-    SuccessOrExit(error = SplitFullServiceInstanceName(aFullName, instanceName, type, domain));
+    {
+        DnsName name(aFullName, strlen(aFullName));
+
+        VerifyOrExit(name.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+        mInstanceInfo.mName.assign(name.GetInstanceName().GetData(), name.GetInstanceName().GetLength());
+    }
 
     mInstanceInfo.mNetifIndex = aInterfaceIndex;
-    mInstanceInfo.mName       = instanceName;
     mInstanceInfo.mHostName   = aHostTarget;
     mInstanceInfo.mPort       = ntohs(aPort);
     mInstanceInfo.mTxtData.assign(aTxtRecord, aTxtRecord + aTxtLen);
@@ -1226,16 +1157,25 @@ exit:
 
 otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInterfaceIndex)
 {
+    DNSServiceRef       serviceRef;
     DNSServiceErrorType dnsError;
 
     assert(mServiceRef == nullptr);
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
 
-    dnsError = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
-                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
-                                     mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
+    dnsError = mPublisher.CreateSharedRef();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    serviceRef = mPublisher.mSharedRef;
+    dnsError   = DNSServiceGetAddrInfo(&serviceRef, kDNSServiceFlagsShareConnection, aInterfaceIndex,
+                                       kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
+                                       mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
+    mServiceRef = serviceRef;
+
+exit:
     if (dnsError != kDNSServiceErr_NoError)
     {
         otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
@@ -1304,17 +1244,15 @@ exit:
 
 void PublisherMDnsSd::ServiceInstanceResolution::FinishResolution(void)
 {
-    ServiceSubscription   *subscription = mSubscription;
-    std::string            serviceName  = mSubscription->mType;
-    DiscoveredInstanceInfo instanceInfo = mInstanceInfo;
-
-    // NOTE: The `ServiceSubscription` object may be freed in `OnServiceResolved`.
-    subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo);
+    // NOTE: The `ServiceSubscription` object may be released in `OnServiceResolved`.
+    mSubscription->mPublisher.OnServiceResolved(mSubscription->mType, mInstanceInfo);
 }
 
 void PublisherMDnsSd::HostSubscription::Resolve(void)
 {
-    std::string fullHostName = MakeFullHostName(mHostName);
+    std::string         fullHostName = MakeFullHostName(mHostName);
+    DNSServiceRef       serviceRef;
+    DNSServiceErrorType dnsError;
 
     assert(mServiceRef == nullptr);
 
@@ -1322,9 +1260,22 @@ void PublisherMDnsSd::HostSubscription::Resolve(void)
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", fullHostName.c_str(), kDNSServiceInterfaceIndexAny);
 
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
-                          HandleResolveResult, this);
+    dnsError = mPublisher.CreateSharedRef();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    serviceRef = mPublisher.mSharedRef;
+    dnsError   = DNSServiceGetAddrInfo(&serviceRef, kDNSServiceFlagsShareConnection, kDNSServiceInterfaceIndexAny,
+                                       kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
+                                       HandleResolveResult, this);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    mServiceRef = serviceRef;
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
+    }
 }
 
 void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef          aServiceRef,
@@ -1379,7 +1330,7 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
     mHostInfo.mNetifIndex = aInterfaceIndex;
     mHostInfo.mTtl        = aTtl;
 
-    // NOTE: This `HostSubscription` object may be freed in `OnHostResolved`.
+    // NOTE: This `HostSubscription` object may be released in `OnHostResolved`.
     mPublisher.OnHostResolved(mHostName, mHostInfo);
 
 exit:
@@ -122,8 +122,6 @@ private:
 
         ~DnssdServiceRegistration(void) override { Unregister(); }
 
-        void      Update(MainloopContext &aMainloop) const;
-        void      Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         otbrError Register(void);
 
     private:
@@ -203,8 +201,6 @@ private:
 
         ~ServiceRef() { Release(); }
 
-        void Update(MainloopContext &aMainloop) const;
-        void Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         void Release(void);
         void DeallocateServiceRef(void);
     };
@@ -288,8 +284,6 @@ private:
                      const std::string &aInstanceName,
                      const std::string &aType,
                      const std::string &aDomain);
-        void UpdateAll(MainloopContext &aMainloop) const;
-        void ProcessAll(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
 
         static void HandleBrowseResult(DNSServiceRef       aServiceRef,
                                        DNSServiceFlags     aFlags,
@@ -348,18 +342,19 @@ private:
     static std::string MakeRegType(const std::string &aType, SubTypeList aSubTypeList);
 
     void                Stop(StopMode aStopMode);
-    DNSServiceErrorType CreateSharedHostsRef(void);
-    void                DeallocateHostsRef(void);
-    void                HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef);
-
-    DNSServiceRef mHostsRef;
+    DNSServiceErrorType CreateSharedRef(void);
+    void                DeallocateSharedRef(void);
+    static void         DeallocateServiceRef(DNSServiceRef &aServiceRef, const PublisherMDnsSd &aPublisher);
+
+    // The connection to mdnsd that all registrations, browses and resolutions
+    // share with `kDNSServiceFlagsShareConnection`, and that records of hosts
+    // and individually registered keys are added to.
+    DNSServiceRef mSharedRef;
     State         mState;
     StateCallback mStateCallback;
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
-
-    std::vector<DNSServiceRef> mServiceRefsToProcess;
 };
 
 /**
@@ -89,6 +89,10 @@ void NcpHost::Init(void)
     mNcpSpinel.Ip6SetAddressMulticastCallback(
         [this](const std::vector<Ip6Address> &aAddrs) { mNetif.UpdateIp6MulticastAddresses(aAddrs); });
     mNcpSpinel.NetifSetStateChangedCallback([this](bool aState) { mNetif.SetNetifState(aState); });
+    mNcpSpinel.Ip6SetReceiveCallback(
+        [this](const uint8_t *aData, uint16_t aLength) { mNetif.Ip6Receive(aData, aLength); });
+    mNetif.SetIp6SendFunc(
+        [this](const uint8_t *aData, uint16_t aLength) { return mNcpSpinel.Ip6Send(aData, aLength); });
 }
 
 void NcpHost::Deinit(void)
@@ -146,11 +150,13 @@ exit:
 void NcpHost::Process(const MainloopContext &aMainloop)
 {
     mSpinelDriver.Process(&aMainloop);
+    mNetif.Process(aMainloop);
 }
 
 void NcpHost::Update(MainloopContext &aMainloop)
 {
     mSpinelDriver.GetSpinelInterface()->UpdateFdSet(&aMainloop);
+    mNetif.Update(aMainloop);
 
     if (mSpinelDriver.HasPendingFrame())
     {
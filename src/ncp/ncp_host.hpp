@@ -97,6 +97,14 @@ public:
     void            Init(void) override;
     void            Deinit(void) override;
 
+    /**
+     * This method returns the counters of the TUN packet path between the host and the NCP.
+     *
+     * @returns The TUN counters.
+     *
+     */
+    const TunCounters &GetTunCounters(void) const { return mNetif.GetCounters(); }
+
     // MainloopProcessor methods
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
@@ -75,6 +75,7 @@ void NcpSpinel::Deinit(void)
     mSpinelDriver              = nullptr;
     mIp6AddressTableCallback   = nullptr;
     mNetifStateChangedCallback = nullptr;
+    mIp6ReceiveCallback        = nullptr;
 }
 
 otbrError NcpSpinel::SpinelDataUnpack(const uint8_t *aDataIn, spinel_size_t aDataLen, const char *aPackFormat, ...)
@@ -151,6 +152,24 @@ exit:
     return;
 }
 
+otbrError NcpSpinel::Ip6Send(const uint8_t *aData, uint16_t aLength)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    uint8_t   header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid);
+
+    VerifyOrExit(mSpinelDriver != nullptr, error = OTBR_ERROR_INVALID_STATE);
+
+    // The transaction id is left zero, so the NCP handles the packet without responding to it.
+    VerifyOrExit(mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_OPENTHREAD);
+    VerifyOrExit(mEncoder.WriteDataWithLen(aData, aLength) == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
+    VerifyOrExit(mEncoder.EndFrame() == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
+    VerifyOrExit(SendEncodedFrame() == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
+
+exit:
+    return error;
+}
+
 void NcpSpinel::ThreadSetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
 {
     otError      error        = OT_ERROR_NONE;
@@ -262,7 +281,11 @@ void NcpSpinel::HandleNotification(const uint8_t *aFrame, uint16_t aLength)
     HandleValueIs(key, data, static_cast<uint16_t>(len));
 
 exit:
-    otbrLogResult(error, "HandleNotification: %s", __FUNCTION__);
+    // Notifications carry every packet from the NCP, so only failures are logged.
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to handle notification: %s", otbrErrorString(error));
+    }
 }
 
 void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_t aLength)
@@ -384,14 +407,27 @@ void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, ui
         break;
     }
 
+    case SPINEL_PROP_STREAM_NET:
+    {
+        const uint8_t *data;
+        spinel_size_t  dataLen;
+
+        // The packet is passed on in place, the trailing metadata is not used.
+        SuccessOrExit(error = SpinelDataUnpack(aBuffer, aLength, SPINEL_DATATYPE_DATA_WLEN_S, &data, &dataLen));
+        SafeInvoke(mIp6ReceiveCallback, data, static_cast<uint16_t>(dataLen));
+        break;
+    }
+
     default:
         otbrLogWarning("Received uncognized key: %u", aKey);
         break;
     }
 
 exit:
-    otbrLogResult(error, "NcpSpinel: %s", __FUNCTION__);
-    return;
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to handle value of key %u: %s", aKey, otbrErrorString(error));
+    }
 }
 
 otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
@@ -515,7 +551,15 @@ otError NcpSpinel::SendEncodedFrame(void)
     SuccessOrExit(error = mSpinelDriver->GetSpinelInterface()->SendFrame(frame, frameLength));
 
 exit:
-    error = mNcpBuffer.OutFrameRemove();
+    // The frame is removed whether or not it was sent, a failure to send must not be masked by the removal.
+    if (error == OT_ERROR_NONE)
+    {
+        error = mNcpBuffer.OutFrameRemove();
+    }
+    else
+    {
+        (void)mNcpBuffer.OutFrameRemove();
+    }
     return error;
 }
 
@@ -86,6 +86,7 @@ public:
     using Ip6AddressTableCallback          = std::function<void(const std::vector<Ip6AddressInfo> &)>;
     using Ip6MulticastAddressTableCallback = std::function<void(const std::vector<Ip6Address> &)>;
     using NetifStateChangedCallback        = std::function<void(bool)>;
+    using Ip6ReceiveCallback               = std::function<void(const uint8_t *, uint16_t)>;
 
     /**
      * Constructor.
@@ -178,6 +179,33 @@ public:
         mIp6MulticastAddressTableCallback = aCallback;
     }
 
+    /**
+     * This method sends an IPv6 packet to the NCP.
+     *
+     * The packet is encoded straight from @p aData and no response is requested from the NCP, so that packets can be
+     * sent back to back without holding a transaction id each.
+     *
+     * @param[in] aData    A pointer to the IPv6 packet.
+     * @param[in] aLength  The length of the IPv6 packet.
+     *
+     * @retval OTBR_ERROR_NONE           Successfully sent the packet to the NCP.
+     * @retval OTBR_ERROR_INVALID_STATE  The NCP is not initialized.
+     * @retval OTBR_ERROR_OPENTHREAD     Failed to encode or send the packet.
+     *
+     */
+    otbrError Ip6Send(const uint8_t *aData, uint16_t aLength);
+
+    /**
+     * This method sets the callback to receive IPv6 packets from the NCP.
+     *
+     * The packet passed to the callback points into the received Spinel frame, the callback MUST copy it if it's not
+     * used immediately (within the callback).
+     *
+     * @param[in] aCallback  The callback to handle IPv6 packets.
+     *
+     */
+    void Ip6SetReceiveCallback(const Ip6ReceiveCallback &aCallback) { mIp6ReceiveCallback = aCallback; }
+
     /**
      * This method enableds/disables the Thread network on the NCP.
      *
@@ -303,6 +331,7 @@ private:
     Ip6AddressTableCallback          mIp6AddressTableCallback;
     Ip6MulticastAddressTableCallback mIp6MulticastAddressTableCallback;
     NetifStateChangedCallback        mNetifStateChangedCallback;
+    Ip6ReceiveCallback               mIp6ReceiveCallback;
 };
 
 } // namespace Ncp
@@ -42,6 +42,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <unordered_set>
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
@@ -50,6 +51,8 @@
 
 namespace otbr {
 
+constexpr uint16_t Netif::kMaxPacketsPerProcess;
+
 Netif::Netif(void)
     : mTunFd(-1)
     , mIpFd(-1)
@@ -57,6 +60,7 @@ Netif::Netif(void)
     , mNetlinkSequence(0)
     , mNetifIndex(0)
 {
+    memset(&mCounters, 0, sizeof(mCounters));
 }
 
 otbrError Netif::Init(const std::string &aInterfaceName)
@@ -89,41 +93,50 @@ void Netif::Deinit(void)
 
 void Netif::UpdateIp6UnicastAddresses(const std::vector<Ip6AddressInfo> &aAddrInfos)
 {
-    // Remove stale addresses
+    std::unordered_set<Ip6AddressInfo> oldAddrInfos(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end());
+    std::unordered_set<Ip6AddressInfo> newAddrInfos(aAddrInfos.begin(), aAddrInfos.end());
+    size_t                             numRemoved = 0;
+    size_t                             numAdded   = 0;
+
+    // Stale addresses are removed first, so that an address whose attributes changed is re-added.
     for (const Ip6AddressInfo &addrInfo : mIp6UnicastAddresses)
     {
-        if (std::find(aAddrInfos.begin(), aAddrInfos.end(), addrInfo) == aAddrInfos.end())
+        if (newAddrInfos.count(addrInfo) == 0)
         {
-            otbrLogInfo("Remove address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, false);
+            ProcessUnicastAddressChange(addrInfo, /* aIsAdded */ false);
+            numRemoved++;
         }
     }
 
-    // Add new addresses
     for (const Ip6AddressInfo &addrInfo : aAddrInfos)
     {
-        if (std::find(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(), addrInfo) == mIp6UnicastAddresses.end())
+        if (oldAddrInfos.count(addrInfo) == 0)
         {
-            otbrLogInfo("Add address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, true);
+            ProcessUnicastAddressChange(addrInfo, /* aIsAdded */ true);
+            numAdded++;
         }
     }
 
+    if (numRemoved + numAdded > 0)
+    {
+        otbrLogResult(CommitUnicastAddressChanges(), "Update unicast addresses: %zu removed, %zu added", numRemoved,
+                      numAdded);
+    }
+
     mIp6UnicastAddresses.assign(aAddrInfos.begin(), aAddrInfos.end());
 }
 
 otbrError Netif::UpdateIp6MulticastAddresses(const std::vector<Ip6Address> &aAddrs)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError                      error = OTBR_ERROR_NONE;
+    std::unordered_set<Ip6Address> oldAddrs(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end());
+    std::unordered_set<Ip6Address> newAddrs(aAddrs.begin(), aAddrs.end());
 
     // Remove stale addresses
     for (const Ip6Address &address : mIp6MulticastAddresses)
     {
-        if (std::find(aAddrs.begin(), aAddrs.end(), address) == aAddrs.end())
+        if (newAddrs.count(address) == 0)
         {
-            otbrLogInfo("Remove address: %s", Ip6Address(address).ToString().c_str());
             SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ false));
         }
     }
@@ -131,10 +144,8 @@ otbrError Netif::UpdateIp6MulticastAddresses(const std::vector<Ip6Address> &aAdd
     // Add new addresses
     for (const Ip6Address &address : aAddrs)
     {
-        if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), address) ==
-            mIp6MulticastAddresses.end())
+        if (oldAddrs.count(address) == 0)
         {
-            otbrLogInfo("Add address: %s", Ip6Address(address).ToString().c_str());
             SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ true));
         }
     }
@@ -167,7 +178,10 @@ otbrError Netif::ProcessMulticastAddressChange(const Ip6Address &aAddress, bool
         ExitNow(error = OTBR_ERROR_ERRNO);
     }
 
-    otbrLogInfo("%s multicast address %s", aIsAdded ? "Added" : "Removed", Ip6Address(aAddress).ToString().c_str());
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        otbrLogDebug("%s multicast address %s", aIsAdded ? "Added" : "Removed", aAddress.ToString().c_str());
+    }
 
 exit:
     return error;
@@ -202,6 +216,77 @@ exit:
     }
 }
 
+void Netif::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(mTunFd >= 0);
+
+    FD_SET(mTunFd, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mTunFd);
+
+exit:
+    return;
+}
+
+void Netif::Process(const MainloopContext &aMainloop)
+{
+    VerifyOrExit(mTunFd >= 0 && FD_ISSET(mTunFd, &aMainloop.mReadFdSet));
+
+    ProcessTunPackets();
+
+exit:
+    return;
+}
+
+void Netif::ProcessTunPackets(void)
+{
+    // All packets pending on the device are drained at once instead of one per mainloop iteration.
+    for (uint16_t i = 0; i < kMaxPacketsPerProcess; i++)
+    {
+        ssize_t length = read(mTunFd, mPacketBuffer, sizeof(mPacketBuffer));
+
+        if (length <= 0)
+        {
+            if (length < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("Failed to read packet from TUN: %s", strerror(errno));
+            }
+            break;
+        }
+
+        // The packet is handed over in place and must be consumed before the next read.
+        if (mIp6SendFunc && mIp6SendFunc(mPacketBuffer, static_cast<uint16_t>(length)) == OTBR_ERROR_NONE)
+        {
+            mCounters.mTxPackets++;
+            mCounters.mTxBytes += static_cast<uint64_t>(length);
+        }
+        else
+        {
+            mCounters.mTxDrops++;
+        }
+    }
+}
+
+void Netif::Ip6Receive(const uint8_t *aData, uint16_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mTunFd >= 0, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(aLength <= kIp6Mtu, error = OTBR_ERROR_INVALID_ARGS);
+
+    // The TUN device is non-blocking, a packet is dropped rather than stalling the mainloop.
+    VerifyOrExit(write(mTunFd, aData, aLength) == static_cast<ssize_t>(aLength), error = OTBR_ERROR_ERRNO);
+
+    mCounters.mRxPackets++;
+    mCounters.mRxBytes += aLength;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        mCounters.mRxDrops++;
+        otbrLogDebug("Dropped packet from the NCP: %s", otbrErrorString(error));
+    }
+}
+
 void Netif::Clear(void)
 {
     if (mTunFd != -1)
@@ -222,6 +307,10 @@ void Netif::Clear(void)
         mNetlinkFd = -1;
     }
 
+#if __linux__
+    mRtNetlink.Close();
+#endif
+
     mNetifIndex = 0;
     mIp6UnicastAddresses.clear();
     mIp6MulticastAddresses.clear();
@@ -36,17 +36,22 @@
 
 #include <net/if.h>
 
+#include <functional>
 #include <vector>
 
 #include <openthread/ip6.h>
 
+#include "common/mainloop.hpp"
 #include "common/types.hpp"
+#include "utils/rt_netlink.hpp"
 
 namespace otbr {
 
 class Netif
 {
 public:
+    using Ip6SendFunc = std::function<otbrError(const uint8_t *, uint16_t)>;
+
     Netif(void);
 
     otbrError Init(const std::string &aInterfaceName);
@@ -56,11 +61,58 @@ public:
     otbrError UpdateIp6MulticastAddresses(const std::vector<Ip6Address> &aAddrs);
     void      SetNetifState(bool aState);
 
+    /**
+     * This method sets the function to send IPv6 packets read from the TUN device to the coprocessor.
+     *
+     * The packet passed to the function is only valid within the call.
+     *
+     * @param[in] aIp6SendFunc  The function to send IPv6 packets.
+     *
+     */
+    void SetIp6SendFunc(const Ip6SendFunc &aIp6SendFunc) { mIp6SendFunc = aIp6SendFunc; }
+
+    /**
+     * This method writes an IPv6 packet received from the coprocessor to the TUN device.
+     *
+     * @param[in] aData    A pointer to the IPv6 packet.
+     * @param[in] aLength  The length of the IPv6 packet.
+     *
+     */
+    void Ip6Receive(const uint8_t *aData, uint16_t aLength);
+
+    /**
+     * This method updates the mainloop context with the TUN device.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop to be updated.
+     *
+     */
+    void Update(MainloopContext &aMainloop);
+
+    /**
+     * This method forwards the packets pending on the TUN device.
+     *
+     * @param[in] aMainloop  A reference to the mainloop context.
+     *
+     */
+    void Process(const MainloopContext &aMainloop);
+
+    /**
+     * This method returns the counters of the TUN packet path.
+     *
+     * @returns The TUN counters.
+     *
+     */
+    const TunCounters &GetCounters(void) const { return mCounters; }
+
 private:
     // TODO: Retrieve the Maximum Ip6 size from the coprocessor.
     static constexpr size_t kIp6Mtu = 1280;
 
+    // The packets read from the TUN device per mainloop iteration, so that a busy host doesn't starve other processors.
+    static constexpr uint16_t kMaxPacketsPerProcess = 64;
+
     void Clear(void);
+    void ProcessTunPackets(void);
 
     otbrError CreateTunDevice(const std::string &aInterfaceName);
     otbrError InitNetlink(void);
@@ -68,18 +120,26 @@ private:
     void      PlatformSpecificInit(void);
     void      SetAddrGenModeToNone(void);
     void      ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded);
+    otbrError CommitUnicastAddressChanges(void);
     otbrError ProcessMulticastAddressChange(const Ip6Address &aAddress, bool aIsAdded);
 
     int      mTunFd;           ///< Used to exchange IPv6 packets.
     int      mIpFd;            ///< Used to manage IPv6 stack on the network interface.
-    int      mNetlinkFd;       ///< Used to receive netlink events.
+    int      mNetlinkFd;       ///< Used to send netlink requests.
     uint32_t mNetlinkSequence; ///< Netlink message sequence.
+#if __linux__
+    Utils::RtNetlink mRtNetlink; ///< Used to update IPv6 addresses in batches.
+#endif
 
     unsigned int mNetifIndex;
     std::string  mNetifName;
 
     std::vector<Ip6AddressInfo> mIp6UnicastAddresses;
     std::vector<Ip6Address>     mIp6MulticastAddresses;
+
+    Ip6SendFunc mIp6SendFunc;
+    TunCounters mCounters;
+    uint8_t     mPacketBuffer[kIp6Mtu]; ///< Reused for every packet read from the TUN device.
 };
 
 } // namespace otbr
@@ -113,6 +113,8 @@ otbrError Netif::InitNetlink(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
+    SuccessOrExit(error = mRtNetlink.Open());
+
     mNetlinkFd = SocketWithCloseExec(AF_NETLINK, SOCK_DGRAM, NETLINK_ROUTE, kSocketNonBlock);
     VerifyOrExit(mNetlinkFd >= 0, error = OTBR_ERROR_ERRNO);
 
@@ -135,14 +137,8 @@ otbrError Netif::InitNetlink(void)
     }
 #endif
 
-    {
-        sockaddr_nl sa;
-
-        memset(&sa, 0, sizeof(sa));
-        sa.nl_family = AF_NETLINK;
-        sa.nl_groups = RTMGRP_LINK | RTMGRP_IPV6_IFADDR;
-        VerifyOrExit(bind(mNetlinkFd, reinterpret_cast<sockaddr *>(&sa), sizeof(sa)) == 0, error = OTBR_ERROR_ERRNO);
-    }
+    // Link and address events are never read from this socket, modules which need them subscribe to the
+    // `NetlinkMonitor`.
 
 exit:
     return error;
@@ -197,52 +193,36 @@ void Netif::SetAddrGenModeToNone(void)
 
 void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
 {
-    struct
-    {
-        nlmsghdr  nh;
-        ifaddrmsg ifa;
-        char      buf[512];
-    } req;
-
-    assert(mIpFd >= 0);
-    memset(&req, 0, sizeof(req));
+    Utils::RtNetlink::Address address;
 
-    req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
-    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
-    req.nh.nlmsg_type  = aIsAdded ? RTM_NEWADDR : RTM_DELADDR;
-    req.nh.nlmsg_pid   = 0;
-    req.nh.nlmsg_seq   = ++mNetlinkSequence;
+    address.mAddress      = Ip6Address(aAddressInfo.mAddress);
+    address.mPrefixLength = aAddressInfo.mPrefixLength;
+    address.mScope        = aAddressInfo.mScope;
+    address.mIfIndex      = mNetifIndex;
+    address.mDeprecated   = !aAddressInfo.mPreferred || aAddressInfo.mMeshLocal;
 
-    req.ifa.ifa_family    = AF_INET6;
-    req.ifa.ifa_prefixlen = aAddressInfo.mPrefixLength;
-    req.ifa.ifa_flags     = IFA_F_NODAD;
-    req.ifa.ifa_scope     = aAddressInfo.mScope;
-    req.ifa.ifa_index     = mNetifIndex;
-
-    AddRtAttr(&req.nh, sizeof(req), IFA_LOCAL, &aAddressInfo.mAddress, sizeof(aAddressInfo.mAddress));
-
-    if (!aAddressInfo.mPreferred || aAddressInfo.mMeshLocal)
+    if (aIsAdded)
     {
-        ifa_cacheinfo cacheinfo;
-
-        memset(&cacheinfo, 0, sizeof(cacheinfo));
-        cacheinfo.ifa_valid = UINT32_MAX;
-
-        AddRtAttr(&req.nh, sizeof(req), IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
+        mRtNetlink.AddAddress(address);
     }
-
-    if (send(mNetlinkFd, &req, req.nh.nlmsg_len, 0) != -1)
+    else
     {
-        otbrLogInfo("Sent request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                    Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        mRtNetlink.DeleteAddress(address);
     }
-    else
+
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
     {
-        otbrLogWarning("Failed to send request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                       Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        otbrLogDebug("Queued request to %s %s/%u", (aIsAdded ? "add" : "remove"), address.mAddress.ToString().c_str(),
+                     address.mPrefixLength);
     }
 }
 
+otbrError Netif::CommitUnicastAddressChanges(void)
+{
+    // All changes of an update are sent in as few netlink messages as possible and each of them is acknowledged.
+    return mRtNetlink.Commit();
+}
+
 } // namespace otbr
 
 #endif // __linux__
@@ -64,6 +64,11 @@ void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool
     OTBR_UNUSED_VARIABLE(aIsAdded);
 }
 
+otbrError Netif::CommitUnicastAddressChanges(void)
+{
+    return OTBR_ERROR_NONE;
+}
+
 } // namespace otbr
 
 #endif // __APPLE__ || __NetBSD__ || __OpenBSD__
@@ -286,6 +286,44 @@ static cJSON *MacCounters2Json(const otNetworkDiagMacCounters &aMacCounters)
     return macCounters;
 }
 
+static cJSON *LatencyPercentiles2Json(const LatencyPercentiles &aPercentiles)
+{
+    cJSON *percentiles = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(percentiles, "Count", cJSON_CreateNumber(aPercentiles.mCount));
+    cJSON_AddItemToObject(percentiles, "P50", cJSON_CreateNumber(aPercentiles.mP50));
+    cJSON_AddItemToObject(percentiles, "P90", cJSON_CreateNumber(aPercentiles.mP90));
+    cJSON_AddItemToObject(percentiles, "P99", cJSON_CreateNumber(aPercentiles.mP99));
+    cJSON_AddItemToObject(percentiles, "Max", cJSON_CreateNumber(aPercentiles.mMax));
+
+    return percentiles;
+}
+
+static cJSON *NdProxyCounters2Json(const NdProxyCounters &aCounters)
+{
+    cJSON *counters = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(counters, "MulticastNsReceived", cJSON_CreateNumber(aCounters.mMulticastNsReceived));
+    cJSON_AddItemToObject(counters, "UnicastNsReceived", cJSON_CreateNumber(aCounters.mUnicastNsReceived));
+    cJSON_AddItemToObject(counters, "NaSent", cJSON_CreateNumber(aCounters.mNaSent));
+    cJSON_AddItemToObject(counters, "NaFailures", cJSON_CreateNumber(aCounters.mNaFailures));
+    cJSON_AddItemToObject(counters, "ParseErrors", cJSON_CreateNumber(aCounters.mParseErrors));
+    cJSON_AddItemToObject(counters, "TargetMisses", cJSON_CreateNumber(aCounters.mTargetMisses));
+    cJSON_AddItemToObject(counters, "ProxiedDuas", cJSON_CreateNumber(aCounters.mProxiedDuas));
+    cJSON_AddItemToObject(counters, "DuaAdded", cJSON_CreateNumber(aCounters.mDuaAdded));
+    cJSON_AddItemToObject(counters, "DuaRenewed", cJSON_CreateNumber(aCounters.mDuaRenewed));
+    cJSON_AddItemToObject(counters, "DuaRemoved", cJSON_CreateNumber(aCounters.mDuaRemoved));
+    cJSON_AddItemToObject(counters, "DuaCleared", cJSON_CreateNumber(aCounters.mDuaCleared));
+    cJSON_AddItemToObject(counters, "NsToNaLatencyUs", LatencyPercentiles2Json(aCounters.mNsToNaLatency));
+    cJSON_AddItemToObject(counters, "NfQueueLength", cJSON_CreateNumber(aCounters.mNfQueueLength));
+    cJSON_AddItemToObject(counters, "NfQueueDropped", cJSON_CreateNumber(aCounters.mNfQueueDropped));
+    cJSON_AddItemToObject(counters, "NfQueueUserDropped", cJSON_CreateNumber(aCounters.mNfQueueUserDropped));
+    cJSON_AddItemToObject(counters, "NfQueueVerdicts", cJSON_CreateNumber(aCounters.mNfQueueVerdicts));
+    cJSON_AddItemToObject(counters, "NfQueueFailedVerdicts", cJSON_CreateNumber(aCounters.mNfQueueFailedVerdicts));
+
+    return counters;
+}
+
 static cJSON *Connectivity2Json(const otNetworkDiagConnectivity &aConnectivity)
 {
     cJSON *connectivity = cJSON_CreateObject();
@@ -590,6 +628,16 @@ std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
     return ret;
 }
 
+std::string NdProxyCounters2JsonString(const NdProxyCounters &aCounters)
+{
+    cJSON      *counters = NdProxyCounters2Json(aCounters);
+    std::string ret      = Json2String(counters);
+
+    cJSON_Delete(counters);
+
+    return ret;
+}
+
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry)
 {
     cJSON      *childEntry = ChildTableEntry2Json(aChildEntry);
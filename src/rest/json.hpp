@@ -40,6 +40,7 @@
 #include "openthread/link.h"
 #include "openthread/thread_ftd.h"
 
+#include "common/types.hpp"
 #include "rest/types.hpp"
 #include "utils/hex.hpp"
 
@@ -205,6 +206,16 @@ std::string LeaderData2JsonString(const otLeaderData &aLeaderData);
  */
 std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters);
 
+/**
+ * This method formats a NdProxyCounters object to a Json object and serialize it to a string.
+ *
+ * @param[in] aCounters  A NdProxyCounters object.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string NdProxyCounters2JsonString(const NdProxyCounters &aCounters);
+
 /**
  * This method formats a ChildEntry object to a Json object and serialize it to a string.
  *
@@ -30,6 +30,8 @@
 
 #include "rest/resource.hpp"
 
+#include "backbone_router/backbone_agent.hpp"
+
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
@@ -46,6 +48,7 @@
 #define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
 #define OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE "/node/dataset/active"
 #define OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING "/node/dataset/pending"
+#define OT_REST_RESOURCE_PATH_NODE_NDPROXY_COUNTERS "/node/nd-proxy/counters"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
@@ -121,9 +124,10 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     return httpStatus;
 }
 
-Resource::Resource(RcpHost *aHost)
+Resource::Resource(RcpHost *aHost, BackboneRouter::BackboneAgent *aBackboneAgent)
     : mInstance(nullptr)
     , mHost(aHost)
+    , mBackboneAgent(aBackboneAgent)
 {
     // Resource Handler
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::Diagnostic);
@@ -139,6 +143,12 @@ Resource::Resource(RcpHost *aHost)
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE, &Resource::DatasetActive);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING, &Resource::DatasetPending);
+#if OTBR_ENABLE_DUA_ROUTING
+    if (mBackboneAgent != nullptr)
+    {
+        mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NDPROXY_COUNTERS, &Resource::NdProxy);
+    }
+#endif
 
     // Resource callback handler
     mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::HandleDiagnosticCallback);
@@ -598,6 +608,38 @@ void Resource::ExtendedPanId(const Request &aRequest, Response &aResponse) const
     }
 }
 
+void Resource::GetDataNdProxyCounters(Response &aResponse) const
+{
+#if OTBR_ENABLE_DUA_ROUTING
+    otbr::NdProxyCounters counters;
+    std::string           body;
+    std::string           errorCode;
+
+    mBackboneAgent->GetNdProxyCounters(counters);
+    body = Json::NdProxyCounters2JsonString(counters);
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+#else
+    OTBR_UNUSED_VARIABLE(mBackboneAgent);
+
+    ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound);
+#endif
+}
+
+void Resource::NdProxy(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataNdProxyCounters(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
 void Resource::GetDataRloc(Response &aResponse) const
 {
     otIp6Address rlocAddress = *otThreadGetRloc(mInstance);
@@ -54,6 +54,11 @@ using otbr::Ncp::RcpHost;
 using std::chrono::steady_clock;
 
 namespace otbr {
+
+namespace BackboneRouter {
+class BackboneAgent;
+}
+
 namespace rest {
 
 /**
@@ -66,10 +71,11 @@ public:
     /**
      * The constructor initializes the resource handler instance.
      *
-     * @param[in] aHost  A pointer to the Thread controller.
+     * @param[in] aHost           A pointer to the Thread controller.
+     * @param[in] aBackboneAgent  A pointer to the Backbone agent, or nullptr if it's not enabled.
      *
      */
-    Resource(RcpHost *aHost);
+    Resource(RcpHost *aHost, BackboneRouter::BackboneAgent *aBackboneAgent);
 
     /**
      * This method initialize the Resource handler.
@@ -134,6 +140,7 @@ private:
     void DatasetActive(const Request &aRequest, Response &aResponse) const;
     void DatasetPending(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
+    void NdProxy(const Request &aRequest, Response &aResponse) const;
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
 
     void GetNodeInfo(Response &aResponse) const;
@@ -148,6 +155,7 @@ private:
     void GetDataRloc16(Response &aResponse) const;
     void GetDataExtendedPanId(Response &aResponse) const;
     void GetDataRloc(Response &aResponse) const;
+    void GetDataNdProxyCounters(Response &aResponse) const;
     void GetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const;
     void SetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const;
 
@@ -160,8 +168,9 @@ private:
                                           void                *aContext);
     void        DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
-    otInstance *mInstance;
-    RcpHost    *mHost;
+    otInstance                    *mInstance;
+    RcpHost                       *mHost;
+    BackboneRouter::BackboneAgent *mBackboneAgent;
 
     std::unordered_map<std::string, ResourceHandler>         mResourceMap;
     std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
@@ -47,8 +47,11 @@ namespace rest {
 // Maximum number of connection a server support at the same time.
 static const uint32_t kMaxServeNum = 500;
 
-RestWebServer::RestWebServer(RcpHost &aHost, const std::string &aRestListenAddress, int aRestListenPort)
-    : mResource(Resource(&aHost))
+RestWebServer::RestWebServer(RcpHost                       &aHost,
+                             const std::string             &aRestListenAddress,
+                             int                            aRestListenPort,
+                             BackboneRouter::BackboneAgent *aBackboneAgent)
+    : mResource(Resource(&aHost, aBackboneAgent))
     , mListenFd(-1)
 {
     mAddress.sin6_family = AF_INET6;
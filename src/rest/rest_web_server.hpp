@@ -59,10 +59,14 @@ public:
     /**
      * The constructor to initialize a REST server.
      *
-     * @param[in] aHost  A reference to the Thread controller.
+     * @param[in] aHost           A reference to the Thread controller.
+     * @param[in] aBackboneAgent  A pointer to the Backbone agent, or nullptr if it's not enabled.
      *
      */
-    RestWebServer(RcpHost &aHost, const std::string &aRestListenAddress, int aRestListenPort);
+    RestWebServer(RcpHost                       &aHost,
+                  const std::string             &aRestListenAddress,
+                  int                            aRestListenPort,
+                  BackboneRouter::BackboneAgent *aBackboneAgent);
 
     /**
      * The destructor destroys the server instance.
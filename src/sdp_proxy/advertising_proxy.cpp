@@ -37,10 +37,11 @@
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
-#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO
-#error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
+#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO && !OTBR_ENABLE_MDNS_BUILTIN
+#error "The Advertising Proxy requires an mDNS implementation (OTBR_ENABLE_MDNS_AVAHI, _MDNSSD, _MOJO or _BUILTIN)"
 #endif
 
+#include <algorithm>
 #include <string>
 
 #include <assert.h>
@@ -51,10 +52,13 @@
 
 namespace otbr {
 
+constexpr Milliseconds AdvertisingProxy::kUpdateTimeoutGuard;
+
 AdvertisingProxy::AdvertisingProxy(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
     : mHost(aHost)
     , mPublisher(aPublisher)
     , mIsEnabled(false)
+    , mCounters()
 {
     mHost.RegisterResetHandler(
         [this]() { otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this); });
@@ -86,8 +90,19 @@ void AdvertisingProxy::Start(void)
 
 void AdvertisingProxy::Stop(void)
 {
-    // Outstanding updates will fail on the SRP server because of timeout.
-    // TODO: handle this case gracefully.
+    // Outstanding and queued updates will fail on the SRP server because of timeout,
+    // late publishing results of them are ignored.
+    mOutstandingUpdates.clear();
+    mQueuedUpdates.clear();
+    mInFlightPublishes.clear();
+    mTaskRunner.Cancel(mExpiryTaskId);
+    mExpiryTaskId = 0;
+    UpdateGauges();
+
+    mRepublishQueue.clear();
+    mRepublishPending.clear();
+    mRepublishHosts.clear();
+    mPublishedHosts.clear();
 
     // Stop receiving SRP server events.
     if (GetInstance() != nullptr)
@@ -110,53 +125,199 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                           const otSrpServerHost     *aHost,
                                           uint32_t                   aTimeout)
 {
-    OTBR_UNUSED_VARIABLE(aTimeout);
+    QueuedUpdate update;
+    Milliseconds timeout(aTimeout);
 
-    OutstandingUpdate *update = nullptr;
-    otbrError          error  = OTBR_ERROR_NONE;
+    // Leave a margin so that a queued update is never admitted after the SRP server timed it out.
+    timeout = (timeout > kUpdateTimeoutGuard) ? timeout - kUpdateTimeoutGuard : timeout;
 
-    VerifyOrExit(IsEnabled());
+    // The SRP server may add or free hosts after this update, so the republish index is rebuilt.
+    mRepublishHosts.clear();
 
-    mOutstandingUpdates.emplace_back();
-    update      = &mOutstandingUpdates.back();
-    update->mId = aId;
+    VerifyOrExit(IsEnabled());
 
-    error = PublishHostAndItsServices(aHost, update);
+    update.mId          = aId;
+    update.mHost        = CopySrpHost(aHost);
+    update.mReceiveTime = Clock::now();
+    update.mDeadline    = update.mReceiveTime + timeout;
 
-    if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
+    // Keep the arrival order: a new update may only bypass the queue when nothing is waiting.
+    if (mQueuedUpdates.empty() && mOutstandingUpdates.size() < kMaxInFlightUpdates)
     {
-        mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        StartUpdate(update);
+    }
+    else
+    {
+        mQueuedUpdates.push_back(std::move(update));
+        UpdateGauges();
+        otbrLogInfo("Queued SRP service update (id = %u), %zu updates are waiting", aId, mQueuedUpdates.size());
     }
 
 exit:
     return;
 }
 
-void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
+void AdvertisingProxy::StartUpdate(const QueuedUpdate &aUpdate)
+{
+    OutstandingUpdate             &update = mOutstandingUpdates[aUpdate.mId];
+    otbrError                      error;
+    OutstandingUpdateMap::iterator iter;
+
+    update.mId          = aUpdate.mId;
+    update.mReceiveTime = aUpdate.mReceiveTime;
+    update.mDeadline    = aUpdate.mDeadline;
+    UpdateGauges();
+
+    ScheduleExpiry();
+
+    error = PublishHostAndItsServices(aUpdate.mHost, &update);
+
+    // The update has published the host, so a pending republish of it is superseded.
+    if (error == OTBR_ERROR_NONE)
+    {
+        mRepublishPending.erase(aUpdate.mHost.mFullName);
+    }
+
+    // The update may have been completed and removed by a publishing callback invoked synchronously.
+    iter = mOutstandingUpdates.find(aUpdate.mId);
+    if (iter != mOutstandingUpdates.end() && (error != OTBR_ERROR_NONE || iter->second.mCallbackCount == 0))
+    {
+        CompleteUpdate(iter, error);
+    }
+}
+
+void AdvertisingProxy::CompleteUpdate(OutstandingUpdateMap::iterator aUpdate, otbrError aError)
+{
+    otSrpServerServiceUpdateId id      = aUpdate->first;
+    auto                       latency = Clock::now() - aUpdate->second.mReceiveTime;
+
+    mUpdateLatency.Record(static_cast<uint32_t>(std::chrono::duration_cast<Milliseconds>(latency).count()));
+    mUpdateLatency.GetPercentiles(mCounters.mUpdateLatency);
+    ++(aError == OTBR_ERROR_NONE ? mCounters.mCompletedUpdates : mCounters.mFailedUpdates);
+
+    // Erase before notifying OpenThread, because there are chances that new updates
+    // may be added in `otSrpServerHandleServiceUpdateResult`. Such new updates are
+    // queued behind the waiting ones, which are admitted from a posted task.
+    mOutstandingUpdates.erase(aUpdate);
+    PostAdmission();
+    UpdateGauges();
+
+    otSrpServerHandleServiceUpdateResult(GetInstance(), id, OtbrErrorToOtError(aError));
+}
+
+void AdvertisingProxy::AdmitQueuedUpdates(void)
 {
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
+    while (!mQueuedUpdates.empty() && mOutstandingUpdates.size() < kMaxInFlightUpdates)
     {
-        if (update->mId != aUpdateId)
+        QueuedUpdate update = std::move(mQueuedUpdates.front());
+
+        mQueuedUpdates.pop_front();
+
+        if (Clock::now() >= update.mDeadline)
         {
+            // The SRP server has given up this update and would ignore its result.
+            ++mCounters.mExpiredUpdates;
+            otbrLogWarning("SRP service update (id = %u) expired while queued", update.mId);
             continue;
         }
 
-        if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
+        StartUpdate(update);
+    }
+
+    UpdateGauges();
+}
+
+void AdvertisingProxy::PostAdmission(void)
+{
+    VerifyOrExit(!mQueuedUpdates.empty() && !mIsAdmissionPosted);
+
+    mIsAdmissionPosted = true;
+    mTaskRunner.Post([this]() {
+        mIsAdmissionPosted = false;
+        AdmitQueuedUpdates();
+    });
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::ExpireOutstandingUpdates(void)
+{
+    Timepoint now     = Clock::now();
+    bool      expired = false;
+
+    // Updates whose publishing callbacks never arrived would otherwise hold their in-flight slots forever.
+    for (auto iter = mOutstandingUpdates.begin(); iter != mOutstandingUpdates.end();)
+    {
+        if (now >= iter->second.mDeadline)
         {
-            // Erase before notifying OpenThread, because there are chances that new
-            // elements may be added to `otSrpServerHandleServiceUpdateResult` and
-            // the iterator will be invalidated.
-            mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
+            ++mCounters.mExpiredUpdates;
+            otbrLogWarning("SRP service update (id = %u) expired while advertising", iter->first);
+            iter    = mOutstandingUpdates.erase(iter);
+            expired = true;
         }
         else
         {
-            --update->mCallbackCount;
-            otbrLogInfo("Waiting for more publishing callbacks %d", update->mCallbackCount);
+            ++iter;
         }
-        break;
     }
+
+    if (expired)
+    {
+        PostAdmission();
+    }
+    ScheduleExpiry();
+    UpdateGauges();
+}
+
+void AdvertisingProxy::ScheduleExpiry(void)
+{
+    Timepoint deadline = Timepoint::max();
+
+    mTaskRunner.Cancel(mExpiryTaskId);
+    mExpiryTaskId = 0;
+
+    for (const auto &entry : mOutstandingUpdates)
+    {
+        deadline = std::min(deadline, entry.second.mDeadline);
+    }
+    VerifyOrExit(deadline != Timepoint::max());
+
+    // Rounded up so that the task never runs before the deadline.
+    mExpiryTaskId = mTaskRunner.Post(
+        std::chrono::duration_cast<Milliseconds>(deadline - Clock::now()) + Milliseconds(1), [this]() {
+            mExpiryTaskId = 0;
+            ExpireOutstandingUpdates();
+        });
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::UpdateGauges(void)
+{
+    mCounters.mQueuedUpdates   = static_cast<uint32_t>(mQueuedUpdates.size());
+    mCounters.mInFlightUpdates = static_cast<uint32_t>(mOutstandingUpdates.size());
+}
+
+void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
+{
+    auto update = mOutstandingUpdates.find(aUpdateId);
+
+    VerifyOrExit(update != mOutstandingUpdates.end());
+
+    if (aError != OTBR_ERROR_NONE || update->second.mCallbackCount == 1)
+    {
+        CompleteUpdate(update, aError);
+    }
+    else
+    {
+        --update->second.mCallbackCount;
+        otbrLogInfo("Waiting for more publishing callbacks %d", update->second.mCallbackCount);
+    }
+
+exit:
+    return;
 }
 
 std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
@@ -184,6 +345,45 @@ std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Addres
     return addresses;
 }
 
+AdvertisingProxy::SrpHost AdvertisingProxy::CopySrpHost(const otSrpServerHost *aHost)
+{
+    SrpHost                   host;
+    const otIp6Address       *hostAddresses;
+    uint8_t                   hostAddressNum;
+    const otSrpServerService *service = nullptr;
+
+    host.mFullName  = otSrpServerHostGetFullName(aHost);
+    host.mIsDeleted = otSrpServerHostIsDeleted(aHost);
+
+    if (!host.mIsDeleted)
+    {
+        // TODO: select a preferred address or advertise all addresses from SRP client.
+        hostAddresses   = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
+        host.mAddresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
+    }
+
+    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+    {
+        ServiceChange  change;
+        const uint8_t *txtData;
+        uint16_t       txtLength = 0;
+
+        change.mFullName  = otSrpServerServiceGetInstanceName(service);
+        change.mIsDeleted = host.mIsDeleted || otSrpServerServiceIsDeleted(service);
+        if (!change.mIsDeleted)
+        {
+            txtData                    = otSrpServerServiceGetTxtData(service, &txtLength);
+            change.mState.mPort        = otSrpServerServiceGetPort(service);
+            change.mState.mSubTypeList = MakeSubTypeList(service);
+            change.mState.mTxtHash     = HashTxtData(txtData, txtLength);
+            change.mState.mTxtData.assign(txtData, txtData + txtLength);
+        }
+        host.mServices.push_back(std::move(change));
+    }
+
+    return host;
+}
+
 void AdvertisingProxy::HandleMdnsState(Mdns::Publisher::State aState)
 {
     VerifyOrExit(IsEnabled());
@@ -197,73 +397,186 @@ exit:
 
 void AdvertisingProxy::PublishAllHostsAndServices(void)
 {
-    const otSrpServerHost *host = nullptr;
+    const otSrpServerHost                       *host = nullptr;
+    std::vector<std::pair<uint32_t, std::string>> hosts;
 
     VerifyOrExit(IsEnabled());
     VerifyOrExit(mPublisher.IsStarted());
 
-    otbrLogInfo("Publish all hosts and services");
     while ((host = otSrpServerGetNextHost(GetInstance(), host)))
     {
-        PublishHostAndItsServices(host, nullptr);
+        otSrpServerLeaseInfo leaseInfo;
+
+        // The time elapsed since the host was last registered or refreshed.
+        otSrpServerHostGetLeaseInfo(host, &leaseInfo);
+        hosts.emplace_back(leaseInfo.mLease - leaseInfo.mRemainingLease, otSrpServerHostGetFullName(host));
     }
 
+    std::stable_sort(hosts.begin(), hosts.end(),
+                     [](const std::pair<uint32_t, std::string> &aLhs, const std::pair<uint32_t, std::string> &aRhs) {
+                         return aLhs.first < aRhs.first;
+                     });
+
+    // The mDNS daemon may have lost everything, so nothing is considered published.
+    mPublishedHosts.clear();
+
+    mRepublishQueue.clear();
+    mRepublishPending.clear();
+    mRepublishHosts.clear();
+    for (auto &entry : hosts)
+    {
+        mRepublishPending.insert(entry.second);
+        mRepublishQueue.push_back(std::move(entry.second));
+    }
+
+    mRepublishStartTime          = Clock::now();
+    mCounters.mRepublishDuration = 0;
+    mCounters.mRepublishMaxStall = 0;
+
+    otbrLogInfo("Publish all hosts and services: %zu hosts", mRepublishQueue.size());
+
 exit:
     return;
 }
 
-otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate)
+void AdvertisingProxy::Update(MainloopContext &aMainloop)
+{
+    if (CanRepublish())
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+}
+
+void AdvertisingProxy::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    // Queued SRP updates take precedence over republishing.
+    if (CanRepublish())
+    {
+        RepublishNextHosts();
+    }
+}
+
+void AdvertisingProxy::RepublishNextHosts(void)
+{
+    Timepoint              start     = Clock::now();
+    const otSrpServerHost *host      = nullptr;
+    uint32_t               published = 0;
+    uint32_t               stall;
+
+    VerifyOrExit(IsEnabled() && mPublisher.IsStarted(), mRepublishQueue.clear());
+
+    // The index is built once per pass and only rebuilt after an SRP update, which may have
+    // removed hosts since the republish started.
+    if (mRepublishHosts.empty())
+    {
+        while ((host = otSrpServerGetNextHost(GetInstance(), host)))
+        {
+            mRepublishHosts.emplace(otSrpServerHostGetFullName(host), host);
+        }
+    }
+
+    while (!mRepublishQueue.empty() && published < kRepublishHostsPerIteration)
+    {
+        std::string hostName = std::move(mRepublishQueue.front());
+        auto        iter     = mRepublishHosts.find(hostName);
+
+        mRepublishQueue.pop_front();
+
+        if (mRepublishPending.erase(hostName) == 0 || iter == mRepublishHosts.end())
+        {
+            continue;
+        }
+
+        PublishHostAndItsServices(CopySrpHost(iter->second), nullptr);
+        ++published;
+    }
+
+    stall = static_cast<uint32_t>(std::chrono::duration_cast<Microseconds>(Clock::now() - start).count());
+    mCounters.mRepublishMaxStall = std::max(mCounters.mRepublishMaxStall, stall);
+
+    if (mRepublishQueue.empty())
+    {
+        mCounters.mRepublishDuration =
+            static_cast<uint32_t>(std::chrono::duration_cast<Milliseconds>(Clock::now() - mRepublishStartTime).count());
+        otbrLogInfo("Published all hosts and services in %u ms, max stall %u us", mCounters.mRepublishDuration,
+                    mCounters.mRepublishMaxStall);
+    }
+
+exit:
+    if (mRepublishQueue.empty())
+    {
+        mRepublishPending.clear();
+        mRepublishHosts.clear();
+    }
+}
+
+otbrError AdvertisingProxy::PublishHostAndItsServices(const SrpHost &aHost, OutstandingUpdate *aUpdate)
 {
-    otbrError                  error = OTBR_ERROR_NONE;
-    std::string                hostName;
-    std::string                hostDomain;
-    const otIp6Address        *hostAddresses;
-    uint8_t                    hostAddressNum;
-    bool                       hostDeleted;
-    const otSrpServerService  *service;
-    otSrpServerServiceUpdateId updateId     = 0;
-    bool                       hasUpdate    = false;
-    std::string                fullHostName = otSrpServerHostGetFullName(aHost);
+    otbrError                      error = OTBR_ERROR_NONE;
+    std::string                    hostName;
+    std::string                    hostDomain;
+    bool                           hostDeleted = aHost.mIsDeleted;
+    bool                           hostChanged;
+    const std::vector<Ip6Address> &addresses = aHost.mAddresses;
+    std::vector<ServiceChange>     changes;
+    otSrpServerServiceUpdateId     updateId     = 0;
+    bool                           hasUpdate    = false;
+    const std::string             &fullHostName = aHost.mFullName;
+    bool                           isInFlight;
 
     otbrLogInfo("Advertise SRP service updates: host=%s", fullHostName.c_str());
 
     SuccessOrExit(error = SplitFullHostName(fullHostName, hostName, hostDomain));
-    hostAddresses = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
-    hostDeleted   = otSrpServerHostIsDeleted(aHost);
+
+    // The outcome of the operations in flight is unknown, so nothing of the host can be skipped.
+    isInFlight = (mInFlightPublishes.find(hostName) != mInFlightPublishes.end());
+
+    for (const ServiceChange &service : aHost.mServices)
+    {
+        ServiceChange change;
+        std::string   domain;
+
+        if (!isInFlight && !IsServiceChanged(hostName, service))
+        {
+            ++mCounters.mSkippedPublishes;
+            continue;
+        }
+
+        change = service;
+        SuccessOrExit(error = SplitFullServiceInstanceName(change.mFullName, change.mName, change.mType, domain));
+        changes.push_back(std::move(change));
+    }
+
+    hostChanged = isInFlight || IsHostChanged(hostName, hostDeleted, addresses);
+    mCounters.mSkippedPublishes += hostChanged ? 0 : 1;
+    mCounters.mIssuedPublishes += static_cast<uint32_t>(changes.size()) + (hostChanged ? 1 : 0);
 
     if (aUpdate)
     {
         hasUpdate = true;
         updateId  = aUpdate->mId;
-        aUpdate->mCallbackCount++;
+        aUpdate->mCallbackCount += static_cast<uint32_t>(changes.size()) + (hostChanged ? 1 : 0);
         aUpdate->mHostName = hostName;
-        service            = nullptr;
-        while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
-        {
-            aUpdate->mCallbackCount++;
-        }
     }
 
-    service = nullptr;
-    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+    if (!changes.empty() || hostChanged)
     {
-        std::string fullServiceName = otSrpServerServiceGetInstanceName(service);
-        std::string serviceName;
-        std::string serviceType;
-        std::string serviceDomain;
-
-        SuccessOrExit(error = SplitFullServiceInstanceName(fullServiceName, serviceName, serviceType, serviceDomain));
+        mInFlightPublishes[hostName] += static_cast<uint32_t>(changes.size()) + (hostChanged ? 1 : 0);
+    }
 
-        if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
+    for (ServiceChange &change : changes)
+    {
+        if (!change.mIsDeleted)
         {
-            Mdns::Publisher::TxtData     txtData     = MakeTxtData(service);
-            Mdns::Publisher::SubTypeList subTypeList = MakeSubTypeList(service);
-
-            otbrLogDebug("Publish SRP service '%s'", fullServiceName.c_str());
+            otbrLogDebug("Publish SRP service '%s'", change.mFullName.c_str());
             mPublisher.PublishService(
-                hostName, serviceName, serviceType, subTypeList, otSrpServerServiceGetPort(service), txtData,
-                [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
-                    otbrLogResult(aError, "Handle publish SRP service '%s'", fullServiceName.c_str());
+                hostName, change.mName, change.mType, change.mState.mSubTypeList, change.mState.mPort,
+                change.mState.mTxtData,
+                [this, hasUpdate, updateId, hostName, change](otbrError aError) {
+                    otbrLogResult(aError, "Handle publish SRP service '%s'", change.mFullName.c_str());
+                    HandleServicePublished(hostName, change, aError);
                     if (hasUpdate)
                     {
                         OnMdnsPublishResult(updateId, aError);
@@ -272,12 +585,13 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
         }
         else
         {
-            otbrLogDebug("Unpublish SRP service '%s'", fullServiceName.c_str());
+            otbrLogDebug("Unpublish SRP service '%s'", change.mFullName.c_str());
             mPublisher.UnpublishService(
-                serviceName, serviceType, [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
+                change.mName, change.mType, [this, hasUpdate, updateId, hostName, change](otbrError aError) {
                     // Treat `NOT_FOUND` as success when unpublishing service
                     aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
-                    otbrLogResult(aError, "Handle unpublish SRP service '%s'", fullServiceName.c_str());
+                    otbrLogResult(aError, "Handle unpublish SRP service '%s'", change.mFullName.c_str());
+                    HandleServicePublished(hostName, change, aError);
                     if (hasUpdate)
                     {
                         OnMdnsPublishResult(updateId, aError);
@@ -286,18 +600,19 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
         }
     }
 
-    if (!hostDeleted)
+    if (!hostChanged)
+    {
+        otbrLogDebug("SRP host '%s' is unchanged", fullHostName.c_str());
+    }
+    else if (!hostDeleted)
     {
-        std::vector<Ip6Address> addresses;
-
-        // TODO: select a preferred address or advertise all addresses from SRP client.
         otbrLogDebug("Publish SRP host '%s'", fullHostName.c_str());
-
-        addresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
         mPublisher.PublishHost(
             hostName, addresses,
-            Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, fullHostName](otbrError aError) {
+            Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, hostName, addresses,
+                                             fullHostName](otbrError aError) {
                 otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
+                HandleHostPublished(hostName, addresses, aError);
                 if (hasUpdate)
                 {
                     OnMdnsPublishResult(updateId, aError);
@@ -307,10 +622,11 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
     else
     {
         otbrLogDebug("Unpublish SRP host '%s'", fullHostName.c_str());
-        mPublisher.UnpublishHost(hostName, [this, hasUpdate, updateId, fullHostName](otbrError aError) {
+        mPublisher.UnpublishHost(hostName, [this, hasUpdate, updateId, hostName, fullHostName](otbrError aError) {
             // Treat `NOT_FOUND` as success when unpublishing host.
             aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
             otbrLogResult(aError, "Handle unpublish SRP host '%s'", fullHostName.c_str());
+            HandleHostUnpublished(hostName, aError);
             if (hasUpdate)
             {
                 OnMdnsPublishResult(updateId, aError);
@@ -321,22 +637,145 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
 exit:
     if (error != OTBR_ERROR_NONE)
     {
-        if (hasUpdate)
+        if (aUpdate)
         {
-            otbrLogInfo("Failed to advertise SRP service updates (id = %u)", updateId);
+            otbrLogInfo("Failed to advertise SRP service updates (id = %u)", aUpdate->mId);
         }
     }
     return error;
 }
 
-Mdns::Publisher::TxtData AdvertisingProxy::MakeTxtData(const otSrpServerService *aSrpService)
+bool AdvertisingProxy::IsServiceChanged(const std::string &aHostName, const ServiceChange &aChange) const
 {
-    const uint8_t *data;
-    uint16_t       length = 0;
+    const PublishedService *published = nullptr;
+    auto                    host      = mPublishedHosts.find(aHostName);
+    bool                    changed;
+
+    if (host != mPublishedHosts.end())
+    {
+        auto service = host->second.mServices.find(aChange.mFullName);
+
+        if (service != host->second.mServices.end())
+        {
+            published = &service->second;
+        }
+    }
+
+    VerifyOrExit(!aChange.mIsDeleted, changed = (published != nullptr));
+    VerifyOrExit(published != nullptr, changed = true);
+
+    // The hash only rules out a match, equal hashes still need the TXT data to be compared.
+    changed = published->mPort != aChange.mState.mPort || published->mTxtHash != aChange.mState.mTxtHash ||
+              published->mTxtData != aChange.mState.mTxtData || published->mSubTypeList != aChange.mState.mSubTypeList;
 
-    data = otSrpServerServiceGetTxtData(aSrpService, &length);
+exit:
+    return changed;
+}
+
+bool AdvertisingProxy::IsHostChanged(const std::string             &aHostName,
+                                     bool                           aIsDeleted,
+                                     const std::vector<Ip6Address> &aAddresses) const
+{
+    auto host      = mPublishedHosts.find(aHostName);
+    bool published = (host != mPublishedHosts.end() && host->second.mIsPublished);
+
+    return aIsDeleted ? published : (!published || host->second.mAddresses != aAddresses);
+}
+
+void AdvertisingProxy::HandleServicePublished(const std::string   &aHostName,
+                                              const ServiceChange &aChange,
+                                              otbrError            aError)
+{
+    auto host = mPublishedHosts.find(aHostName);
+
+    ReleaseInFlightPublish(aHostName);
+
+    if (!aChange.mIsDeleted && aError == OTBR_ERROR_NONE)
+    {
+        mPublishedHosts[aHostName].mServices[aChange.mFullName] = aChange.mState;
+        ExitNow();
+    }
+
+    // A service which failed to be published is in an unknown state, so it's forgotten and
+    // published again with the next update. A service which failed to be unpublished is kept
+    // so that unpublishing is retried with the next update.
+    VerifyOrExit(host != mPublishedHosts.end());
+    VerifyOrExit(!aChange.mIsDeleted || aError == OTBR_ERROR_NONE);
+
+    host->second.mServices.erase(aChange.mFullName);
+    if (!host->second.mIsPublished && host->second.mServices.empty())
+    {
+        mPublishedHosts.erase(host);
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::HandleHostPublished(const std::string             &aHostName,
+                                           const std::vector<Ip6Address> &aAddresses,
+                                           otbrError                      aError)
+{
+    PublishedHost &host = mPublishedHosts[aHostName];
+
+    ReleaseInFlightPublish(aHostName);
+
+    host.mIsPublished = (aError == OTBR_ERROR_NONE);
+    host.mAddresses   = host.mIsPublished ? aAddresses : std::vector<Ip6Address>();
+
+    if (!host.mIsPublished && host.mServices.empty())
+    {
+        mPublishedHosts.erase(aHostName);
+    }
+}
+
+void AdvertisingProxy::HandleHostUnpublished(const std::string &aHostName, otbrError aError)
+{
+    auto host = mPublishedHosts.find(aHostName);
+
+    ReleaseInFlightPublish(aHostName);
+
+    // A failed unpublish keeps the host so that it's retried with the next update.
+    VerifyOrExit(aError == OTBR_ERROR_NONE && host != mPublishedHosts.end());
+
+    host->second.mIsPublished = false;
+    host->second.mAddresses.clear();
+    if (host->second.mServices.empty())
+    {
+        mPublishedHosts.erase(host);
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::ReleaseInFlightPublish(const std::string &aHostName)
+{
+    auto host = mInFlightPublishes.find(aHostName);
+
+    VerifyOrExit(host != mInFlightPublishes.end());
+
+    if (--host->second == 0)
+    {
+        mInFlightPublishes.erase(host);
+    }
+
+exit:
+    return;
+}
+
+uint32_t AdvertisingProxy::HashTxtData(const uint8_t *aTxtData, uint16_t aTxtLength)
+{
+    uint32_t hash = 2166136261u;
+
+    // FNV-1a.
+    for (uint16_t i = 0; i < aTxtLength; i++)
+    {
+        hash ^= aTxtData[i];
+        hash *= 16777619u;
+    }
 
-    return Mdns::Publisher::TxtData(data, data + length);
+    return hash;
 }
 
 Mdns::Publisher::SubTypeList AdvertisingProxy::MakeSubTypeList(const otSrpServerService *aSrpService)
@@ -38,22 +38,35 @@
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <stdint.h>
 
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
 #include "common/code_utils.hpp"
+#include "common/latency_histogram.hpp"
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
 
+#ifndef OTBR_CONFIG_SRP_ADVERTISING_PROXY_MAX_IN_FLIGHT_UPDATES
+#define OTBR_CONFIG_SRP_ADVERTISING_PROXY_MAX_IN_FLIGHT_UPDATES 16
+#endif
+
 namespace otbr {
 
 /**
  * This class implements the Advertising Proxy.
  *
  */
-class AdvertisingProxy : private NonCopyable
+class AdvertisingProxy : public MainloopProcessor, private NonCopyable
 {
 public:
     /**
@@ -76,6 +89,9 @@ public:
     /**
      * This method publishes all registered hosts and services.
      *
+     * The hosts are republished incrementally, a few per mainloop iteration, starting from the most recently updated
+     * ones. A host is skipped if an SRP update for it is advertised before it is republished.
+     *
      */
     void PublishAllHostsAndServices(void);
 
@@ -87,12 +103,84 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
+    /**
+     * This method returns the counters of the Advertising Proxy.
+     *
+     * @returns A reference to the Advertising Proxy counters.
+     *
+     */
+    const AdvertisingProxyCounters &GetCounters(void) const { return mCounters; }
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
 private:
+    // The maximum number of hosts republished in one mainloop iteration.
+    static constexpr uint32_t kRepublishHostsPerIteration = 8;
+
+    // The maximum number of SRP updates which are advertised concurrently. Updates received while
+    // the window is full are queued and admitted in arrival order as in-flight updates complete.
+    static constexpr uint32_t kMaxInFlightUpdates = OTBR_CONFIG_SRP_ADVERTISING_PROXY_MAX_IN_FLIGHT_UPDATES;
+
+    static_assert(kMaxInFlightUpdates > 0, "OTBR_CONFIG_SRP_ADVERTISING_PROXY_MAX_IN_FLIGHT_UPDATES must be positive");
+
+    // The margin taken off the SRP update timeout.
+    static constexpr Milliseconds kUpdateTimeoutGuard = Milliseconds(500);
+
     struct OutstandingUpdate
     {
         otSrpServerServiceUpdateId mId;                // The ID of the SRP service update transaction.
         std::string                mHostName;          // The host name.
         uint32_t                   mCallbackCount = 0; // The number of callbacks which we are waiting for.
+        Timepoint                  mReceiveTime;       // The time when the update was received.
+        Timepoint                  mDeadline;          // The time after which the SRP server gives up the update.
+    };
+
+    using OutstandingUpdateMap = std::unordered_map<otSrpServerServiceUpdateId, OutstandingUpdate>;
+
+    struct PublishedService
+    {
+        uint16_t                     mPort;        // The port.
+        Mdns::Publisher::SubTypeList mSubTypeList; // The sub-types.
+        uint32_t                     mTxtHash;     // The hash of the TXT data, compared before the TXT data.
+        Mdns::Publisher::TxtData     mTxtData;     // The TXT data.
+    };
+
+    struct PublishedHost
+    {
+        bool                    mIsPublished = false; // Whether the host itself is published.
+        std::vector<Ip6Address> mAddresses;           // The published addresses.
+
+        // The published services indexed by their full instance names.
+        std::unordered_map<std::string, PublishedService> mServices;
+    };
+
+    // A service of an SRP update which differs from what has been published.
+    struct ServiceChange
+    {
+        std::string      mFullName;  // The full service instance name.
+        std::string      mName;      // The service instance name.
+        std::string      mType;      // The service type.
+        bool             mIsDeleted; // Whether the service is to be unpublished.
+        PublishedService mState;     // The state to publish, only meaningful when not deleted.
+    };
+
+    // An SRP host copied out of the SRP server, which may free the host as soon as the update
+    // handler returns (e.g. when the lease of the host expires).
+    struct SrpHost
+    {
+        std::string                mFullName;  // The full host name.
+        bool                       mIsDeleted; // Whether the host is to be unpublished.
+        std::vector<Ip6Address>    mAddresses; // The addresses eligible to be published.
+        std::vector<ServiceChange> mServices;  // The services, their names are not split yet.
+    };
+
+    struct QueuedUpdate
+    {
+        otSrpServerServiceUpdateId mId;          // The ID of the SRP service update transaction.
+        SrpHost                    mHost;        // The host of the update.
+        Timepoint                  mReceiveTime; // The time when the update was received.
+        Timepoint                  mDeadline;    // The time after which the SRP server gives up the update.
     };
 
     static void AdvertisingHandler(otSrpServerServiceUpdateId aId,
@@ -101,11 +189,30 @@ private:
                                    void                      *aContext);
     void        AdvertisingHandler(otSrpServerServiceUpdateId aId, const otSrpServerHost *aHost, uint32_t aTimeout);
 
-    static Mdns::Publisher::TxtData     MakeTxtData(const otSrpServerService *aSrpService);
     static Mdns::Publisher::SubTypeList MakeSubTypeList(const otSrpServerService *aSrpService);
+    static uint32_t                     HashTxtData(const uint8_t *aTxtData, uint16_t aTxtLength);
     void                                OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError);
 
+    void StartUpdate(const QueuedUpdate &aUpdate);
+    void CompleteUpdate(OutstandingUpdateMap::iterator aUpdate, otbrError aError);
+    void AdmitQueuedUpdates(void);
+    void PostAdmission(void);
+    void ExpireOutstandingUpdates(void);
+    void ScheduleExpiry(void);
+    void UpdateGauges(void);
+
+    bool IsServiceChanged(const std::string &aHostName, const ServiceChange &aChange) const;
+    bool IsHostChanged(const std::string &aHostName, bool aIsDeleted, const std::vector<Ip6Address> &aAddresses) const;
+    void HandleServicePublished(const std::string &aHostName, const ServiceChange &aChange, otbrError aError);
+    void HandleHostPublished(const std::string &aHostName, const std::vector<Ip6Address> &aAddresses, otbrError aError);
+    void HandleHostUnpublished(const std::string &aHostName, otbrError aError);
+    void ReleaseInFlightPublish(const std::string &aHostName);
+
+    bool CanRepublish(void) const { return !mRepublishQueue.empty() && mQueuedUpdates.empty(); }
+    void RepublishNextHosts(void);
+
     std::vector<Ip6Address> GetEligibleAddresses(const otIp6Address *aHostAddresses, uint8_t aHostAddressNum);
+    SrpHost                 CopySrpHost(const otSrpServerHost *aHost);
 
     void Start(void);
     void Stop(void);
@@ -114,9 +221,11 @@ private:
     /**
      * This method publishes a specified host and its services.
      *
-     * It also makes a OutstandingUpdate object when needed.
+     * Only the host and services which differ from the last successfully published state are published or unpublished,
+     * unless publishing operations of the host are still in flight. It also makes a OutstandingUpdate object when
+     * needed.
      *
-     * @param[in]  aHost         A pointer to the host.
+     * @param[in]  aHost         A reference to the host copied out of the SRP server.
      * @param[in]  aUpdate       A pointer to the output OutstandingUpdate object. When it's not null, the method will
      *                           fill its fields, otherwise it's ignored.
      *
@@ -124,7 +233,7 @@ private:
      * @retval  ...              Failed to publish the host and/or its services.
      *
      */
-    otbrError PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate);
+    otbrError PublishHostAndItsServices(const SrpHost &aHost, OutstandingUpdate *aUpdate);
 
     otInstance *GetInstance(void) { return mHost.GetInstance(); }
 
@@ -136,8 +245,37 @@ private:
 
     bool mIsEnabled;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // The in-flight updates indexed by their IDs.
+    OutstandingUpdateMap mOutstandingUpdates;
+
+    // The updates waiting for an in-flight slot, in arrival order.
+    std::deque<QueuedUpdate> mQueuedUpdates;
+
+    // What has been successfully published, indexed by the host names. An SRP update only
+    // issues the publishing operations that differ from it.
+    std::unordered_map<std::string, PublishedHost> mPublishedHosts;
+
+    // The number of publishing operations issued but not completed yet, indexed by the host
+    // names. `mPublishedHosts` lags behind such a host, so everything of it is published again.
+    std::unordered_map<std::string, uint32_t> mInFlightPublishes;
+
+    // The full names of the hosts to republish, most recently updated first. A host is only
+    // republished if it's still in `mRepublishPending` when it reaches the front. The hosts of
+    // the SRP server are indexed by `mRepublishHosts`, which is emptied by any SRP update.
+    std::deque<std::string>                                  mRepublishQueue;
+    std::unordered_set<std::string>                          mRepublishPending;
+    std::unordered_map<std::string, const otSrpServerHost *> mRepublishHosts;
+    Timepoint                                                mRepublishStartTime;
+
+    AdvertisingProxyCounters mCounters;
+    LatencyHistogram         mUpdateLatency;
+
+    // Queued updates are admitted from a posted task, so that completing an update never
+    // starts another one in the same call stack. In-flight updates are expired by a delayed
+    // task at the earliest deadline.
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mExpiryTaskId      = 0;
+    bool               mIsAdmissionPosted = false;
 };
 
 } // namespace otbr
@@ -0,0 +1,293 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the answer cache of the DNS-SD Discovery Proxy.
+ */
+
+#include "sdp_proxy/discovery_answer_cache.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+#include "utils/dns_utils.hpp"
+#include "utils/string_utils.hpp"
+
+namespace otbr {
+namespace Dnssd {
+
+void DiscoveryAnswerCache::AddService(const std::string            &aType,
+                                      const DiscoveredInstanceInfo &aInstanceInfo,
+                                      Seconds                       aTtl,
+                                      Timepoint                     aNow)
+{
+    PutService(MakeServiceKey(aType, DnsUtils::UnescapeInstanceName(aInstanceInfo.mName)), aInstanceInfo,
+               /* aIsNegative */ false, aNow + aTtl);
+}
+
+void DiscoveryAnswerCache::AddNegativeService(const std::string &aType,
+                                              const std::string &aInstanceName,
+                                              Seconds            aTtl,
+                                              Timepoint          aNow)
+{
+    PutService(MakeServiceKey(aType, aInstanceName), DiscoveredInstanceInfo(), /* aIsNegative */ true, aNow + aTtl);
+}
+
+void DiscoveryAnswerCache::AddHost(const std::string        &aHostName,
+                                   const DiscoveredHostInfo &aHostInfo,
+                                   Seconds                   aTtl,
+                                   Timepoint                 aNow)
+{
+    PutHost(StringUtils::ToLowercase(aHostName), aHostInfo, /* aIsNegative */ false, aNow + aTtl);
+}
+
+void DiscoveryAnswerCache::AddNegativeHost(const std::string &aHostName, Seconds aTtl, Timepoint aNow)
+{
+    PutHost(StringUtils::ToLowercase(aHostName), DiscoveredHostInfo(), /* aIsNegative */ true, aNow + aTtl);
+}
+
+void DiscoveryAnswerCache::FindServices(const std::string                   &aType,
+                                        const std::string                   &aInstanceName,
+                                        Timepoint                            aNow,
+                                        std::vector<DiscoveredInstanceInfo> &aInstances)
+{
+    ServiceKey key  = MakeServiceKey(aType, aInstanceName);
+    auto       iter = aInstanceName.empty() ? mServiceEntries.lower_bound(key) : mServiceEntries.find(key);
+
+    while (iter != mServiceEntries.end() && iter->first.first == key.first)
+    {
+        ServiceEntry &entry = iter->second;
+
+        if (aNow >= entry.mExpireTime)
+        {
+            EraseService(iter++);
+        }
+        else
+        {
+            if (!entry.mIsNegative)
+            {
+                Touch(entry);
+                aInstances.push_back(entry.mInstanceInfo);
+                aInstances.back().mTtl = GetRemainingTtl(entry, aNow);
+            }
+
+            ++iter;
+        }
+
+        // A resolve query is answered by a single instance.
+        VerifyOrExit(aInstanceName.empty());
+    }
+
+exit:
+    return;
+}
+
+bool DiscoveryAnswerCache::FindHost(const std::string &aHostName, Timepoint aNow, DiscoveredHostInfo &aHostInfo)
+{
+    auto iter  = mHostEntries.find(StringUtils::ToLowercase(aHostName));
+    bool found = false;
+
+    VerifyOrExit(iter != mHostEntries.end());
+
+    if (aNow >= iter->second.mExpireTime)
+    {
+        EraseHost(iter);
+        ExitNow();
+    }
+
+    VerifyOrExit(!iter->second.mIsNegative);
+
+    Touch(iter->second);
+    aHostInfo      = iter->second.mHostInfo;
+    aHostInfo.mTtl = GetRemainingTtl(iter->second, aNow);
+    found          = true;
+
+exit:
+    return found;
+}
+
+bool DiscoveryAnswerCache::IsServiceNegative(const std::string &aType,
+                                             const std::string &aInstanceName,
+                                             Timepoint          aNow) const
+{
+    auto iter = mServiceEntries.find(MakeServiceKey(aType, aInstanceName));
+
+    return iter != mServiceEntries.end() && IsNegative(iter->second, aNow);
+}
+
+bool DiscoveryAnswerCache::IsHostNegative(const std::string &aHostName, Timepoint aNow) const
+{
+    auto iter = mHostEntries.find(StringUtils::ToLowercase(aHostName));
+
+    return iter != mHostEntries.end() && IsNegative(iter->second, aNow);
+}
+
+void DiscoveryAnswerCache::Clear(void)
+{
+    mServiceEntries.clear();
+    mHostEntries.clear();
+    mLruList.clear();
+    mSize = 0;
+}
+
+DiscoveryAnswerCache::ServiceKey DiscoveryAnswerCache::MakeServiceKey(const std::string &aType,
+                                                                      const std::string &aInstanceName)
+{
+    return ServiceKey(StringUtils::ToLowercase(aType), StringUtils::ToLowercase(aInstanceName));
+}
+
+bool DiscoveryAnswerCache::IsNegative(const EntryState &aState, Timepoint aNow)
+{
+    return aState.mIsNegative && aNow < aState.mExpireTime;
+}
+
+uint32_t DiscoveryAnswerCache::GetRemainingTtl(const EntryState &aState, Timepoint aNow)
+{
+    auto remaining = std::chrono::duration_cast<Seconds>(aState.mExpireTime - aNow).count();
+
+    return static_cast<uint32_t>(std::max<decltype(remaining)>(remaining, 1));
+}
+
+void DiscoveryAnswerCache::PutService(const ServiceKey             &aKey,
+                                      const DiscoveredInstanceInfo &aInfo,
+                                      bool                          aIsNegative,
+                                      Timepoint                     aExpire)
+{
+    auto   iter = mServiceEntries.find(aKey);
+    size_t size = sizeof(ServiceEntry) + sizeof(LruItem) + 2 * (aKey.first.size() + aKey.second.size()) +
+                  aInfo.mName.size() + aInfo.mHostName.size() + aInfo.mAddresses.size() * sizeof(Ip6Address) +
+                  aInfo.mTxtData.size();
+
+    if (iter != mServiceEntries.end())
+    {
+        EraseService(iter);
+    }
+
+    VerifyOrExit(Reserve(size));
+
+    {
+        ServiceEntry &entry = mServiceEntries[aKey];
+
+        mLruList.push_front({/* aIsHost */ false, aKey});
+        entry.mExpireTime   = aExpire;
+        entry.mSize         = size;
+        entry.mIsNegative   = aIsNegative;
+        entry.mLruItem      = mLruList.begin();
+        entry.mInstanceInfo = aInfo;
+        mSize += size;
+    }
+
+exit:
+    return;
+}
+
+void DiscoveryAnswerCache::PutHost(const std::string        &aKey,
+                                   const DiscoveredHostInfo &aInfo,
+                                   bool                      aIsNegative,
+                                   Timepoint                 aExpire)
+{
+    auto   iter = mHostEntries.find(aKey);
+    size_t size = sizeof(HostEntry) + sizeof(LruItem) + 2 * aKey.size() + aInfo.mHostName.size() +
+                  aInfo.mAddresses.size() * sizeof(Ip6Address);
+
+    if (iter != mHostEntries.end())
+    {
+        EraseHost(iter);
+    }
+
+    VerifyOrExit(Reserve(size));
+
+    {
+        HostEntry &entry = mHostEntries[aKey];
+
+        mLruList.push_front({/* aIsHost */ true, ServiceKey(aKey, "")});
+        entry.mExpireTime = aExpire;
+        entry.mSize       = size;
+        entry.mIsNegative = aIsNegative;
+        entry.mLruItem    = mLruList.begin();
+        entry.mHostInfo   = aInfo;
+        mSize += size;
+    }
+
+exit:
+    return;
+}
+
+bool DiscoveryAnswerCache::Reserve(size_t aSize)
+{
+    bool reserved = false;
+
+    VerifyOrExit(aSize <= mMaxSize);
+
+    while (mSize + aSize > mMaxSize)
+    {
+        EraseLeastRecentlyUsed();
+    }
+
+    reserved = true;
+
+exit:
+    return reserved;
+}
+
+void DiscoveryAnswerCache::Touch(EntryState &aState)
+{
+    mLruList.splice(mLruList.begin(), mLruList, aState.mLruItem);
+}
+
+void DiscoveryAnswerCache::EraseService(ServiceEntryMap::iterator aIter)
+{
+    mSize -= aIter->second.mSize;
+    mLruList.erase(aIter->second.mLruItem);
+    mServiceEntries.erase(aIter);
+}
+
+void DiscoveryAnswerCache::EraseHost(HostEntryMap::iterator aIter)
+{
+    mSize -= aIter->second.mSize;
+    mLruList.erase(aIter->second.mLruItem);
+    mHostEntries.erase(aIter);
+}
+
+void DiscoveryAnswerCache::EraseLeastRecentlyUsed(void)
+{
+    const LruItem &item = mLruList.back();
+
+    if (item.mIsHost)
+    {
+        EraseHost(mHostEntries.find(item.mKey.first));
+    }
+    else
+    {
+        EraseService(mServiceEntries.find(item.mKey));
+    }
+}
+
+} // namespace Dnssd
+} // namespace otbr
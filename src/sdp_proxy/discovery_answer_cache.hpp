@@ -0,0 +1,258 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the answer cache of the DNS-SD Discovery Proxy.
+ */
+
+#ifndef OTBR_SDP_PROXY_DISCOVERY_ANSWER_CACHE_HPP_
+#define OTBR_SDP_PROXY_DISCOVERY_ANSWER_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <stddef.h>
+
+#include "common/time.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+namespace Dnssd {
+
+/**
+ * This class caches the mDNS results answered by the Discovery Proxy.
+ *
+ * Service instances are cached by service type and instance name, hosts by host name. An entry lives for the
+ * TTL given when it is added, which the Discovery Proxy caps. Names known not to exist are cached as negative
+ * entries. The cache never grows beyond its size limit, the least recently used entries are evicted first.
+ *
+ */
+class DiscoveryAnswerCache
+{
+public:
+    using DiscoveredInstanceInfo = Mdns::Publisher::DiscoveredInstanceInfo;
+    using DiscoveredHostInfo     = Mdns::Publisher::DiscoveredHostInfo;
+
+    /**
+     * This constructor initializes the cache.
+     *
+     * @param[in] aMaxSize  The maximum estimated memory used by the cache entries, in bytes.
+     *
+     */
+    explicit DiscoveryAnswerCache(size_t aMaxSize)
+        : mMaxSize(aMaxSize)
+    {
+    }
+
+    /**
+     * This method caches a discovered service instance.
+     *
+     * A cached service instance replaces the negative entries of the instance and of its service type.
+     *
+     * @param[in] aType          The service type, e.g. "_meshcop._udp".
+     * @param[in] aInstanceInfo  The discovered service instance.
+     * @param[in] aTtl           The time to keep the entry.
+     * @param[in] aNow           The current time.
+     *
+     */
+    void AddService(const std::string            &aType,
+                    const DiscoveredInstanceInfo &aInstanceInfo,
+                    Seconds                       aTtl,
+                    Timepoint                     aNow);
+
+    /**
+     * This method caches that a service instance does not exist.
+     *
+     * @param[in] aType          The service type, e.g. "_meshcop._udp".
+     * @param[in] aInstanceName  The unescaped service instance name.
+     * @param[in] aTtl           The time to keep the entry.
+     * @param[in] aNow           The current time.
+     *
+     */
+    void AddNegativeService(const std::string &aType, const std::string &aInstanceName, Seconds aTtl, Timepoint aNow);
+
+    /**
+     * This method caches a discovered host.
+     *
+     * @param[in] aHostName  The host name without domain.
+     * @param[in] aHostInfo  The discovered host.
+     * @param[in] aTtl       The time to keep the entry.
+     * @param[in] aNow       The current time.
+     *
+     */
+    void AddHost(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo, Seconds aTtl, Timepoint aNow);
+
+    /**
+     * This method caches that a host does not exist.
+     *
+     * @param[in] aHostName  The host name without domain.
+     * @param[in] aTtl       The time to keep the entry.
+     * @param[in] aNow       The current time.
+     *
+     */
+    void AddNegativeHost(const std::string &aHostName, Seconds aTtl, Timepoint aNow);
+
+    /**
+     * This method finds the cached service instances answering a browse or resolve query.
+     *
+     * The TTL of each returned instance is set to the time the entry has left to live.
+     *
+     * @param[in]  aType          The service type, e.g. "_meshcop._udp".
+     * @param[in]  aInstanceName  The unescaped service instance name, or empty to find all instances of the type.
+     * @param[in]  aNow           The current time.
+     * @param[out] aInstances     The cached service instances.
+     *
+     */
+    void FindServices(const std::string                   &aType,
+                      const std::string                   &aInstanceName,
+                      Timepoint                            aNow,
+                      std::vector<DiscoveredInstanceInfo> &aInstances);
+
+    /**
+     * This method finds a cached host.
+     *
+     * The TTL of the returned host is set to the time the entry has left to live.
+     *
+     * @param[in]  aHostName  The host name without domain.
+     * @param[in]  aNow       The current time.
+     * @param[out] aHostInfo  The cached host.
+     *
+     * @retval TRUE   The host is cached.
+     * @retval FALSE  The host is not cached or is cached as not existing.
+     *
+     */
+    bool FindHost(const std::string &aHostName, Timepoint aNow, DiscoveredHostInfo &aHostInfo);
+
+    /**
+     * This method indicates whether a service instance is cached as not existing.
+     *
+     * @param[in] aType          The service type, e.g. "_meshcop._udp".
+     * @param[in] aInstanceName  The unescaped service instance name.
+     * @param[in] aNow           The current time.
+     *
+     * @returns Whether the name is cached as not existing.
+     *
+     */
+    bool IsServiceNegative(const std::string &aType, const std::string &aInstanceName, Timepoint aNow) const;
+
+    /**
+     * This method indicates whether a host is cached as not existing.
+     *
+     * @param[in] aHostName  The host name without domain.
+     * @param[in] aNow       The current time.
+     *
+     * @returns Whether the host is cached as not existing.
+     *
+     */
+    bool IsHostNegative(const std::string &aHostName, Timepoint aNow) const;
+
+    /**
+     * This method removes all entries.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of entries, including expired ones which are not evicted yet.
+     *
+     * @returns The number of entries.
+     *
+     */
+    size_t GetNumEntries(void) const { return mLruList.size(); }
+
+    /**
+     * This method returns the estimated memory used by the entries, in bytes.
+     *
+     * @returns The estimated memory used by the entries.
+     *
+     */
+    size_t GetSize(void) const { return mSize; }
+
+private:
+    using ServiceKey = std::pair<std::string, std::string>; // Lowercase service type and unescaped instance name.
+
+    struct LruItem
+    {
+        bool       mIsHost;
+        ServiceKey mKey; // The lowercase host name is kept in the first string for a host.
+    };
+
+    using LruList = std::list<LruItem>;
+
+    struct EntryState
+    {
+        Timepoint         mExpireTime;
+        size_t            mSize;
+        bool              mIsNegative;
+        LruList::iterator mLruItem;
+    };
+
+    struct ServiceEntry : public EntryState
+    {
+        DiscoveredInstanceInfo mInstanceInfo;
+    };
+
+    struct HostEntry : public EntryState
+    {
+        DiscoveredHostInfo mHostInfo;
+    };
+
+    // Ordered so that the instances of a service type are adjacent, starting with the negative entry of the type.
+    using ServiceEntryMap = std::map<ServiceKey, ServiceEntry>;
+    using HostEntryMap    = std::unordered_map<std::string, HostEntry>;
+
+    static ServiceKey MakeServiceKey(const std::string &aType, const std::string &aInstanceName);
+    static bool       IsNegative(const EntryState &aState, Timepoint aNow);
+    static uint32_t   GetRemainingTtl(const EntryState &aState, Timepoint aNow);
+
+    void PutService(const ServiceKey &aKey, const DiscoveredInstanceInfo &aInfo, bool aIsNegative, Timepoint aExpire);
+    void PutHost(const std::string &aKey, const DiscoveredHostInfo &aInfo, bool aIsNegative, Timepoint aExpire);
+    bool Reserve(size_t aSize);
+    void Touch(EntryState &aState);
+    void EraseService(ServiceEntryMap::iterator aIter);
+    void EraseHost(HostEntryMap::iterator aIter);
+    void EraseLeastRecentlyUsed(void);
+
+    size_t          mMaxSize;
+    size_t          mSize = 0;
+    LruList         mLruList; // The most recently used entry first.
+    ServiceEntryMap mServiceEntries;
+    HostEntryMap    mHostEntries;
+};
+
+} // namespace Dnssd
+} // namespace otbr
+
+#endif // OTBR_SDP_PROXY_DISCOVERY_ANSWER_CACHE_HPP_
@@ -53,15 +53,13 @@
 namespace otbr {
 namespace Dnssd {
 
-static inline bool DnsLabelsEqual(const std::string &aLabel1, const std::string &aLabel2)
-{
-    return StringUtils::EqualCaseInsensitive(aLabel1, aLabel2);
-}
+constexpr Milliseconds DiscoveryProxy::kSubscriptionLingerTime;
 
 DiscoveryProxy::DiscoveryProxy(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
     : mHost(aHost)
     , mMdnsPublisher(aPublisher)
     , mIsEnabled(false)
+    , mAnswerCache(OTBR_CONFIG_DNSSD_DISCOVERY_PROXY_CACHE_SIZE)
 {
     mHost.RegisterResetHandler([this]() {
         otDnssdQuerySetCallbacks(mHost.GetInstance(), &DiscoveryProxy::OnDiscoveryProxySubscribe,
@@ -94,10 +92,7 @@ void DiscoveryProxy::Start(void)
 
     mSubscriberId = mMdnsPublisher.AddSubscriptionCallbacks(
         [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
-            if (!aInstanceInfo.mRemoved)
-            {
-                OnServiceDiscovered(aType, aInstanceInfo);
-            }
+            OnServiceDiscovered(aType, aInstanceInfo);
         },
 
         [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo) {
@@ -117,6 +112,18 @@ void DiscoveryProxy::Stop(void)
         mSubscriberId = 0;
     }
 
+    for (const auto &subscription : mMdnsSubscriptions)
+    {
+        if (subscription.second.mIsSubscribed)
+        {
+            UnsubscribeMdns(subscription.second.mNameInfo);
+        }
+    }
+
+    mMdnsSubscriptions.clear();
+    mQueryIndex.Clear();
+    mAnswerCache.Clear();
+
     otbrLogInfo("Stopped");
 }
 
@@ -129,20 +136,40 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
 {
     std::string fullName(aFullName);
     DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    std::string key      = MakeSubscriptionKey(nameInfo);
 
     otbrLogInfo("Subscribe: %s", fullName.c_str());
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    // Cached answers are delivered once OpenThread has finished setting up the query.
+    mHost.PostTimerTask(Milliseconds(0), [this, nameInfo]() { AnswerFromCache(nameInfo); });
+
+    VerifyOrExit(mQueryIndex.Add(nameInfo) == 1);
+
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
+        auto subscription = mMdnsSubscriptions.find(key);
+
+        if (subscription != mMdnsSubscriptions.end())
         {
-            mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
+            // The lingering mDNS subscription refreshes the cache in the background.
+            subscription->second.mLingerId = 0;
+            ExitNow();
         }
     }
+
+    if (IsNegativelyCached(nameInfo))
+    {
+        // Negative entries live for `kServiceTtlCapLimit`, the name is subscribed once the entry has expired.
+        otbrLogInfo("Not subscribing %s yet: known not to exist", key.c_str());
+        mMdnsSubscriptions[key] = {nameInfo, /* mLingerId */ 0, /* mIsSubscribed */ false};
+        mHost.PostTimerTask(Seconds(kServiceTtlCapLimit), [this, key]() { HandleNegativeCacheTimeout(key); });
+        ExitNow();
+    }
+
+    SubscribeMdns(nameInfo);
+    mMdnsSubscriptions[key] = {nameInfo, /* mLingerId */ 0, /* mIsSubscribed */ true};
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName)
@@ -154,34 +181,174 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
 {
     std::string fullName(aFullName);
     DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    std::string key      = MakeSubscriptionKey(nameInfo);
+    uint64_t    lingerId;
 
     otbrLogInfo("Unsubscribe: %s", fullName.c_str());
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    VerifyOrExit(mQueryIndex.Remove(nameInfo) == 0);
+
     {
-        if (nameInfo.mHostName.empty())
+        auto subscription = mMdnsSubscriptions.find(key);
+
+        VerifyOrExit(subscription != mMdnsSubscriptions.end());
+
+        if (!subscription->second.mIsSubscribed)
         {
-            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+            // There is no mDNS subscription to keep alive.
+            mMdnsSubscriptions.erase(subscription);
+            ExitNow();
         }
-        else
+
+        lingerId                       = ++mNextLingerId;
+        subscription->second.mLingerId = lingerId;
+    }
+
+    mHost.PostTimerTask(kSubscriptionLingerTime, [this, key, lingerId]() { HandleLingerTimeout(key, lingerId); });
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::HandleLingerTimeout(const std::string &aKey, uint64_t aLingerId)
+{
+    auto subscription = mMdnsSubscriptions.find(aKey);
+
+    VerifyOrExit(subscription != mMdnsSubscriptions.end() && subscription->second.mLingerId == aLingerId);
+
+    otbrLogInfo("Unsubscribe mDNS: %s", aKey.c_str());
+
+    UnsubscribeMdns(subscription->second.mNameInfo);
+    mMdnsSubscriptions.erase(subscription);
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::HandleNegativeCacheTimeout(const std::string &aKey)
+{
+    auto subscription = mMdnsSubscriptions.find(aKey);
+
+    VerifyOrExit(subscription != mMdnsSubscriptions.end() && !subscription->second.mIsSubscribed);
+
+    if (IsNegativelyCached(subscription->second.mNameInfo))
+    {
+        // The name has been reported as not existing again since.
+        mHost.PostTimerTask(Seconds(kServiceTtlCapLimit), [this, aKey]() { HandleNegativeCacheTimeout(aKey); });
+        ExitNow();
+    }
+
+    otbrLogInfo("Subscribe mDNS: %s", aKey.c_str());
+
+    SubscribeMdns(subscription->second.mNameInfo);
+    subscription->second.mIsSubscribed = true;
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::SubscribeMdns(const DnsNameInfo &aNameInfo)
+{
+    if (aNameInfo.mHostName.empty())
+    {
+        mMdnsPublisher.SubscribeService(aNameInfo.mServiceName, aNameInfo.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.SubscribeHost(aNameInfo.mHostName);
+    }
+}
+
+void DiscoveryProxy::UnsubscribeMdns(const DnsNameInfo &aNameInfo)
+{
+    if (aNameInfo.mHostName.empty())
+    {
+        mMdnsPublisher.UnsubscribeService(aNameInfo.mServiceName, aNameInfo.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.UnsubscribeHost(aNameInfo.mHostName);
+    }
+}
+
+bool DiscoveryProxy::IsNegativelyCached(const DnsNameInfo &aNameInfo) const
+{
+    bool isNegative;
+
+    if (aNameInfo.IsHost())
+    {
+        isNegative = mAnswerCache.IsHostNegative(aNameInfo.mHostName, Clock::now());
+    }
+    else
+    {
+        isNegative = mAnswerCache.IsServiceNegative(aNameInfo.mServiceName, aNameInfo.mInstanceName, Clock::now());
+    }
+
+    return isNegative;
+}
+
+void DiscoveryProxy::AnswerFromCache(const DnsNameInfo &aNameInfo)
+{
+    VerifyOrExit(IsEnabled());
+
+    if (aNameInfo.IsHost())
+    {
+        Mdns::Publisher::DiscoveredHostInfo hostInfo;
+
+        VerifyOrExit(mAnswerCache.FindHost(aNameInfo.mHostName, Clock::now(), hostInfo));
+        otbrLogInfo("Answer host %s from cache", aNameInfo.mHostName.c_str());
+        AnswerHostQueries(aNameInfo.mHostName, hostInfo);
+    }
+    else
+    {
+        std::vector<Mdns::Publisher::DiscoveredInstanceInfo> instances;
+
+        mAnswerCache.FindServices(aNameInfo.mServiceName, aNameInfo.mInstanceName, Clock::now(), instances);
+
+        for (const Mdns::Publisher::DiscoveredInstanceInfo &instance : instances)
         {
-            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
+            otbrLogInfo("Answer service %s instance %s from cache", aNameInfo.mServiceName.c_str(),
+                        instance.mName.c_str());
+            AnswerServiceQueries(aNameInfo.mServiceName, instance);
         }
     }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::OnServiceDiscovered(const std::string                             &aType,
                                          const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
 {
-    otDnssdServiceInstanceInfo instanceInfo;
-    const otDnssdQuery        *query                 = nullptr;
-    std::string                unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
+    std::string unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
+
+    if (aInstanceInfo.mRemoved)
+    {
+        otbrLogInfo("Service removed: %s, instance %s", aType.c_str(), aInstanceInfo.mName.c_str());
+        mAnswerCache.AddNegativeService(aType, unescapedInstanceName, Seconds(kServiceTtlCapLimit), Clock::now());
+        ExitNow();
+    }
 
     otbrLogInfo("Service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
                 "weight %d",
                 aType.c_str(), aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
                 aInstanceInfo.mAddresses.size(), aInstanceInfo.mPort, aInstanceInfo.mPriority, aInstanceInfo.mWeight);
 
+    mAnswerCache.AddService(aType, aInstanceInfo, Seconds(CapTtl(aInstanceInfo.mTtl)), Clock::now());
+
+    AnswerServiceQueries(aType, aInstanceInfo);
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::AnswerServiceQueries(const std::string                             &aType,
+                                          const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
+{
+    otDnssdServiceInstanceInfo instanceInfo;
+    std::vector<DnsNameInfo>   queries;
+    std::string                unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
+
     instanceInfo.mAddressNum = aInstanceInfo.mAddresses.size();
 
     if (!aInstanceInfo.mAddresses.empty())
@@ -200,59 +367,49 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
     instanceInfo.mTxtData   = aInstanceInfo.mTxtData.data();
     instanceInfo.mTtl       = CapTtl(aInstanceInfo.mTtl);
 
-    while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
-    {
-        std::string      instanceName;
-        std::string      serviceName;
-        std::string      hostName;
-        std::string      domain;
-        char             queryName[OT_DNS_MAX_NAME_SIZE];
-        otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
-
-        switch (type)
-        {
-        case OT_DNSSD_QUERY_TYPE_BROWSE:
-            splitError = SplitFullServiceName(queryName, serviceName, domain);
-            break;
-        case OT_DNSSD_QUERY_TYPE_RESOLVE:
-            splitError = SplitFullServiceInstanceName(queryName, instanceName, serviceName, domain);
-            break;
-        default:
-            splitError = OTBR_ERROR_NOT_FOUND;
-            break;
-        }
-        if (splitError != OTBR_ERROR_NONE)
-        {
-            // Incoming service/instance was not what current query wanted to see, move on.
-            continue;
-        }
+    mQueryIndex.FindServiceQueries(aType, unescapedInstanceName, queries);
 
-        if (DnsLabelsEqual(serviceName, aType) &&
-            (instanceName.empty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
-        {
-            std::string serviceFullName    = aType + "." + domain;
-            std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
-            std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
+    // The queries are copied out because answering one may finish queries and update the index.
+    for (const DnsNameInfo &query : queries)
+    {
+        std::string serviceFullName    = aType + "." + query.mDomain;
+        std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, query.mDomain);
+        std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
 
-            instanceInfo.mFullName = instanceFullName.c_str();
-            instanceInfo.mHostName = translatedHostName.c_str();
+        instanceInfo.mFullName = instanceFullName.c_str();
+        instanceInfo.mHostName = translatedHostName.c_str();
 
-            otDnssdQueryHandleDiscoveredServiceInstance(mHost.GetInstance(), serviceFullName.c_str(), &instanceInfo);
-        }
+        otDnssdQueryHandleDiscoveredServiceInstance(mHost.GetInstance(), serviceFullName.c_str(), &instanceInfo);
     }
 }
 
 void DiscoveryProxy::OnHostDiscovered(const std::string                         &aHostName,
                                       const Mdns::Publisher::DiscoveredHostInfo &aHostInfo)
 {
-    otDnssdHostInfo     hostInfo;
-    const otDnssdQuery *query            = nullptr;
-    std::string         resolvedHostName = aHostInfo.mHostName;
-
     otbrLogInfo("Host discovered: %s hostname %s addresses %zu", aHostName.c_str(), aHostInfo.mHostName.c_str(),
                 aHostInfo.mAddresses.size());
 
+    if (aHostInfo.mAddresses.empty())
+    {
+        mAnswerCache.AddNegativeHost(aHostName, Seconds(kServiceTtlCapLimit), Clock::now());
+        ExitNow();
+    }
+
+    mAnswerCache.AddHost(aHostName, aHostInfo, Seconds(CapTtl(aHostInfo.mTtl)), Clock::now());
+
+    AnswerHostQueries(aHostName, aHostInfo);
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::AnswerHostQueries(const std::string                         &aHostName,
+                                       const Mdns::Publisher::DiscoveredHostInfo &aHostInfo)
+{
+    otDnssdHostInfo          hostInfo;
+    std::vector<DnsNameInfo> queries;
+    std::string              resolvedHostName = aHostInfo.mHostName;
+
     if (resolvedHostName.empty())
     {
         resolvedHostName = aHostName + ".local.";
@@ -270,71 +427,51 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 
     hostInfo.mTtl = CapTtl(aHostInfo.mTtl);
 
-    while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
-    {
-        std::string      hostName, domain;
-        char             queryName[OT_DNS_MAX_NAME_SIZE];
-        otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
-
-        OTBR_UNUSED_VARIABLE(splitError);
-
-        if (type != OT_DNSSD_QUERY_TYPE_RESOLVE_HOST)
-        {
-            continue;
-        }
-
-        splitError = SplitFullHostName(queryName, hostName, domain);
+    mQueryIndex.FindHostQueries(aHostName, queries);
 
-        if (splitError != OTBR_ERROR_NONE)
-        {
-            continue;
-        }
-
-        if (DnsLabelsEqual(hostName, aHostName))
-        {
-            std::string hostFullName = TranslateDomain(resolvedHostName, domain);
+    for (const DnsNameInfo &query : queries)
+    {
+        std::string hostFullName = TranslateDomain(resolvedHostName, query.mDomain);
 
-            otDnssdQueryHandleDiscoveredHost(mHost.GetInstance(), hostFullName.c_str(), &hostInfo);
-        }
+        otDnssdQueryHandleDiscoveredHost(mHost.GetInstance(), hostFullName.c_str(), &hostInfo);
     }
 }
 
 std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
 {
     std::string targetName;
-    std::string hostName;
-    std::string domain;
+    DnsName     name(aName);
 
-    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), targetName = aName);
-    VerifyOrExit(DnsLabelsEqual(domain, "local."), targetName = aName);
+    VerifyOrExit(name.IsHost() && name.GetDomain().EqualsCaseInsensitive("local"), targetName = aName);
 
-    targetName = hostName + "." + aTargetDomain;
+    targetName.reserve(name.GetHostName().GetLength() + 1 + aTargetDomain.size());
+    targetName.assign(name.GetHostName().GetData(), name.GetHostName().GetLength());
+    targetName += '.';
+    targetName += aTargetDomain;
 
 exit:
     otbrLogDebug("Translate domain: %s => %s", aName.c_str(), targetName.c_str());
     return targetName;
 }
 
-int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const
+std::string DiscoveryProxy::MakeSubscriptionKey(const DnsNameInfo &aNameInfo)
 {
-    const otDnssdQuery *query = nullptr;
-    int                 count = 0;
+    std::string key;
 
-    while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
+    if (aNameInfo.IsHost())
     {
-        char        queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsNameInfo queryInfo;
-
-        otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = SplitFullDnsName(queryName);
-
-        count += (DnsLabelsEqual(aNameInfo.mInstanceName, queryInfo.mInstanceName) &&
-                  DnsLabelsEqual(aNameInfo.mServiceName, queryInfo.mServiceName) &&
-                  DnsLabelsEqual(aNameInfo.mHostName, queryInfo.mHostName));
+        key = aNameInfo.mHostName;
+    }
+    else if (aNameInfo.IsService())
+    {
+        key = aNameInfo.mServiceName;
+    }
+    else
+    {
+        key = aNameInfo.mInstanceName + "." + aNameInfo.mServiceName;
     }
 
-    return count;
+    return StringUtils::ToLowercase(key);
 }
 
 uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
@@ -38,7 +38,8 @@
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
-#include <set>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <stdint.h>
@@ -47,8 +48,15 @@
 #include <openthread/instance.h>
 
 #include "common/dns_utils.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
+#include "sdp_proxy/discovery_answer_cache.hpp"
+#include "sdp_proxy/discovery_query_index.hpp"
+
+#ifndef OTBR_CONFIG_DNSSD_DISCOVERY_PROXY_CACHE_SIZE
+#define OTBR_CONFIG_DNSSD_DISCOVERY_PROXY_CACHE_SIZE (32 * 1024)
+#endif
 
 namespace otbr {
 namespace Dnssd {
@@ -86,7 +94,13 @@ public:
     void HandleMdnsState(Mdns::Publisher::State aState)
     {
         VerifyOrExit(IsEnabled());
-        OTBR_UNUSED_VARIABLE(aState);
+
+        // Cached answers may be stale after the mDNS daemon restarts.
+        if (aState != Mdns::Publisher::State::kReady)
+        {
+            mAnswerCache.Clear();
+        }
+
     exit:
         return;
     }
@@ -97,25 +111,47 @@ private:
         kServiceTtlCapLimit = 10, // TTL cap limit for Discovery Proxy (in seconds).
     };
 
+    // Keeps an mDNS subscription alive after its last query so that the cache stays fresh for the next ones.
+    static constexpr Milliseconds kSubscriptionLingerTime = Seconds(kServiceTtlCapLimit);
+
+    struct MdnsSubscription
+    {
+        DnsNameInfo mNameInfo;     // The split name of the first query.
+        uint64_t    mLingerId;     // The pending linger timeout, or 0 when there are queries.
+        bool        mIsSubscribed; // Whether mDNS is subscribed, not while the name is cached as not existing.
+    };
+
     static void        OnDiscoveryProxySubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxySubscribe(const char *aSubscription);
     static void        OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxyUnsubscribe(const char *aSubscription);
-    int                GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const;
     static std::string TranslateDomain(const std::string &aName, const std::string &aTargetDomain);
     void               OnServiceDiscovered(const std::string                             &aSubscription,
                                            const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void OnHostDiscovered(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
-    static uint32_t CapTtl(uint32_t aTtl);
+    void AnswerServiceQueries(const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
+    void AnswerHostQueries(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
+    void AnswerFromCache(const DnsNameInfo &aNameInfo);
+    void SubscribeMdns(const DnsNameInfo &aNameInfo);
+    void UnsubscribeMdns(const DnsNameInfo &aNameInfo);
+    void HandleLingerTimeout(const std::string &aKey, uint64_t aLingerId);
+    void HandleNegativeCacheTimeout(const std::string &aKey);
+    bool IsNegativelyCached(const DnsNameInfo &aNameInfo) const;
+    static std::string MakeSubscriptionKey(const DnsNameInfo &aNameInfo);
+    static uint32_t    CapTtl(uint32_t aTtl);
 
     void Start(void);
     void Stop(void);
     bool IsEnabled(void) const { return mIsEnabled; }
 
-    Ncp::RcpHost    &mHost;
-    Mdns::Publisher &mMdnsPublisher;
-    bool             mIsEnabled;
-    uint64_t         mSubscriberId = 0;
+    Ncp::RcpHost                                      &mHost;
+    Mdns::Publisher                                   &mMdnsPublisher;
+    bool                                               mIsEnabled;
+    uint64_t                                           mSubscriberId = 0;
+    DiscoveryQueryIndex                                mQueryIndex;
+    DiscoveryAnswerCache                               mAnswerCache;
+    std::unordered_map<std::string, MdnsSubscription> mMdnsSubscriptions; // Keyed by MakeSubscriptionKey().
+    uint64_t                                           mNextLingerId = 0;
 };
 
 } // namespace Dnssd
@@ -0,0 +1,183 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the index of DNS-SD Discovery Proxy queries.
+ */
+
+#include "sdp_proxy/discovery_query_index.hpp"
+
+#include "common/code_utils.hpp"
+#include "utils/string_utils.hpp"
+
+namespace otbr {
+namespace Dnssd {
+
+static inline bool DnsLabelsEqual(const std::string &aLabel1, const std::string &aLabel2)
+{
+    return StringUtils::EqualCaseInsensitive(aLabel1, aLabel2);
+}
+
+uint32_t DiscoveryQueryIndex::Add(const DnsNameInfo &aNameInfo)
+{
+    EntryList &entries = GetEntryMap(aNameInfo)[MakeKey(aNameInfo)];
+    Entry     *entry   = nullptr;
+
+    for (Entry &existing : entries)
+    {
+        if (IsSameQuery(existing.mNameInfo, aNameInfo))
+        {
+            entry = &existing;
+            break;
+        }
+    }
+
+    if (entry != nullptr)
+    {
+        ++entry->mCount;
+    }
+    else
+    {
+        entries.push_back({aNameInfo, 1});
+        ++mSize;
+    }
+
+    return CountSubscription(entries, aNameInfo);
+}
+
+uint32_t DiscoveryQueryIndex::Remove(const DnsNameInfo &aNameInfo)
+{
+    EntryMap &entryMap = GetEntryMap(aNameInfo);
+    auto      list     = entryMap.find(MakeKey(aNameInfo));
+    uint32_t  count    = 0;
+
+    VerifyOrExit(list != entryMap.end());
+
+    for (auto entry = list->second.begin(); entry != list->second.end(); ++entry)
+    {
+        if (IsSameQuery(entry->mNameInfo, aNameInfo))
+        {
+            if (--entry->mCount == 0)
+            {
+                list->second.erase(entry);
+                --mSize;
+            }
+            break;
+        }
+    }
+
+    count = CountSubscription(list->second, aNameInfo);
+
+    if (list->second.empty())
+    {
+        entryMap.erase(list);
+    }
+
+exit:
+    return count;
+}
+
+void DiscoveryQueryIndex::Clear(void)
+{
+    mServiceEntries.clear();
+    mHostEntries.clear();
+    mSize = 0;
+}
+
+void DiscoveryQueryIndex::FindServiceQueries(const std::string        &aType,
+                                             const std::string        &aInstanceName,
+                                             std::vector<DnsNameInfo> &aQueries) const
+{
+    auto list = mServiceEntries.find(StringUtils::ToLowercase(aType));
+
+    VerifyOrExit(list != mServiceEntries.end());
+
+    for (const Entry &entry : list->second)
+    {
+        if (entry.mNameInfo.mInstanceName.empty() || DnsLabelsEqual(entry.mNameInfo.mInstanceName, aInstanceName))
+        {
+            aQueries.push_back(entry.mNameInfo);
+        }
+    }
+
+exit:
+    return;
+}
+
+void DiscoveryQueryIndex::FindHostQueries(const std::string &aHostName, std::vector<DnsNameInfo> &aQueries) const
+{
+    auto list = mHostEntries.find(StringUtils::ToLowercase(aHostName));
+
+    VerifyOrExit(list != mHostEntries.end());
+
+    for (const Entry &entry : list->second)
+    {
+        aQueries.push_back(entry.mNameInfo);
+    }
+
+exit:
+    return;
+}
+
+std::string DiscoveryQueryIndex::MakeKey(const DnsNameInfo &aNameInfo)
+{
+    return StringUtils::ToLowercase(aNameInfo.IsHost() ? aNameInfo.mHostName : aNameInfo.mServiceName);
+}
+
+bool DiscoveryQueryIndex::IsSameSubscription(const DnsNameInfo &aLhs, const DnsNameInfo &aRhs)
+{
+    return DnsLabelsEqual(aLhs.mInstanceName, aRhs.mInstanceName) &&
+           DnsLabelsEqual(aLhs.mServiceName, aRhs.mServiceName) && DnsLabelsEqual(aLhs.mHostName, aRhs.mHostName);
+}
+
+bool DiscoveryQueryIndex::IsSameQuery(const DnsNameInfo &aLhs, const DnsNameInfo &aRhs)
+{
+    return IsSameSubscription(aLhs, aRhs) && DnsLabelsEqual(aLhs.mDomain, aRhs.mDomain);
+}
+
+uint32_t DiscoveryQueryIndex::CountSubscription(const EntryList &aEntries, const DnsNameInfo &aNameInfo)
+{
+    uint32_t count = 0;
+
+    // Queries in different domains share the same mDNS subscription.
+    for (const Entry &entry : aEntries)
+    {
+        count += IsSameSubscription(entry.mNameInfo, aNameInfo) ? entry.mCount : 0;
+    }
+
+    return count;
+}
+
+DiscoveryQueryIndex::EntryMap &DiscoveryQueryIndex::GetEntryMap(const DnsNameInfo &aNameInfo)
+{
+    return aNameInfo.IsHost() ? mHostEntries : mServiceEntries;
+}
+
+} // namespace Dnssd
+} // namespace otbr
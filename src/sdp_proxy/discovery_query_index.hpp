@@ -0,0 +1,144 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the index of DNS-SD Discovery Proxy queries.
+ */
+
+#ifndef OTBR_SDP_PROXY_DISCOVERY_QUERY_INDEX_HPP_
+#define OTBR_SDP_PROXY_DISCOVERY_QUERY_INDEX_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/dns_utils.hpp"
+
+namespace otbr {
+namespace Dnssd {
+
+/**
+ * This class indexes the active Discovery Proxy queries by their service type and host name.
+ *
+ * Queries are split into name parts once when added, so that a discovered service instance or
+ * host only visits the queries which may match it.
+ *
+ */
+class DiscoveryQueryIndex
+{
+public:
+    /**
+     * This method adds a query.
+     *
+     * @param[in] aNameInfo  The split name of the query.
+     *
+     * @returns The number of queries for the same instance, service and host in any domain, including this one.
+     *
+     */
+    uint32_t Add(const DnsNameInfo &aNameInfo);
+
+    /**
+     * This method removes a query.
+     *
+     * @param[in] aNameInfo  The split name of the query.
+     *
+     * @returns The number of remaining queries for the same instance, service and host in any domain.
+     *
+     */
+    uint32_t Remove(const DnsNameInfo &aNameInfo);
+
+    /**
+     * This method removes all queries.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method finds the queries answered by a discovered service instance.
+     *
+     * These are the browse queries of the service type and the resolve queries of the instance. Each
+     * distinct query name is returned once no matter how many queries share it.
+     *
+     * @param[in]  aType          The service type, e.g. "_meshcop._udp".
+     * @param[in]  aInstanceName  The unescaped service instance name.
+     * @param[out] aQueries       The matching queries.
+     *
+     */
+    void FindServiceQueries(const std::string        &aType,
+                            const std::string        &aInstanceName,
+                            std::vector<DnsNameInfo> &aQueries) const;
+
+    /**
+     * This method finds the queries answered by a discovered host.
+     *
+     * Each distinct query name is returned once no matter how many queries share it.
+     *
+     * @param[in]  aHostName  The host name without domain.
+     * @param[out] aQueries   The matching queries.
+     *
+     */
+    void FindHostQueries(const std::string &aHostName, std::vector<DnsNameInfo> &aQueries) const;
+
+    /**
+     * This method returns the number of distinct query names.
+     *
+     * @returns The number of distinct query names.
+     *
+     */
+    size_t GetSize(void) const { return mSize; }
+
+private:
+    struct Entry
+    {
+        DnsNameInfo mNameInfo; // The split query name.
+        uint32_t    mCount;    // The number of queries with this name.
+    };
+
+    using EntryList = std::vector<Entry>;
+    using EntryMap  = std::unordered_map<std::string, EntryList>;
+
+    static std::string MakeKey(const DnsNameInfo &aNameInfo);
+    static bool        IsSameSubscription(const DnsNameInfo &aLhs, const DnsNameInfo &aRhs);
+    static bool        IsSameQuery(const DnsNameInfo &aLhs, const DnsNameInfo &aRhs);
+    static uint32_t    CountSubscription(const EntryList &aEntries, const DnsNameInfo &aNameInfo);
+    EntryMap          &GetEntryMap(const DnsNameInfo &aNameInfo);
+
+    EntryMap mServiceEntries; // Browse and resolve queries indexed by the lowercase service type.
+    EntryMap mHostEntries;    // Host queries indexed by the lowercase host name.
+    size_t   mSize = 0;
+};
+
+} // namespace Dnssd
+} // namespace otbr
+
+#endif // OTBR_SDP_PROXY_DISCOVERY_QUERY_INDEX_HPP_
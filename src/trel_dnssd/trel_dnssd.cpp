@@ -84,6 +84,13 @@ namespace TrelDnssd {
 TrelDnssd::TrelDnssd(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
     : mPublisher(aPublisher)
     , mHost(aHost)
+#if OTBR_ENABLE_TREL_PROBING
+    , mProber(
+          [this](const std::string &aInstanceName, const Ip6Address &aAddress) {
+              HandleBestAddressChanged(aInstanceName, aAddress);
+          },
+          [this](const std::string &aInstanceName) { OnTrelServiceInstanceRemoved(aInstanceName); })
+#endif
 {
     sTrelDnssd = this;
 }
@@ -111,6 +118,7 @@ void TrelDnssd::StartBrowse(void)
 
     assert(mSubscriberId == 0);
     mSubscriberId = mPublisher.AddSubscriptionCallbacks(
+        kTrelServiceName,
         [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
             OnTrelServiceInstanceResolved(aType, aInstanceInfo);
         },
@@ -285,9 +293,10 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
     std::string        instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
     Ip6Address         selectedAddress;
     otPlatTrelPeerInfo peerInfo;
-
-    // Remove any existing TREL service instance before adding
-    OnTrelServiceInstanceRemoved(instanceName);
+    PeerMap::iterator  it;
+#if OTBR_ENABLE_TREL_PROBING
+    std::vector<Ip6Address> candidates;
+#endif
 
     otbrLogDebug("Peer discovered: %s hostname %s addresses %zu port %d priority %d "
                  "weight %d",
@@ -304,6 +313,10 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
             continue;
         }
 
+#if OTBR_ENABLE_TREL_PROBING
+        candidates.push_back(addr);
+#endif
+
         // If there are multiple addresses, we prefer the address
         // which is numerically smallest. This prefers GUA over ULA
         // (`fc00::/7`) and then link-local (`fe80::/10`).
@@ -317,6 +330,7 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
     if (aInstanceInfo.mAddresses.empty())
     {
         otbrLogWarning("Peer %s does not have any IPv6 address, ignored", aInstanceInfo.mName.c_str());
+        OnTrelServiceInstanceRemoved(instanceName);
         ExitNow();
     }
 
@@ -326,16 +340,75 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
     peerInfo.mTxtData        = aInstanceInfo.mTxtData.data();
     peerInfo.mTxtLength      = aInstanceInfo.mTxtData.size();
 
+    it = mPeers.find(instanceName);
+
+    if (it == mPeers.end())
     {
         Peer peer(aInstanceInfo.mTxtData, peerInfo.mSockAddr);
 
         VerifyOrExit(peer.mValid, otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str()));
 
+#if OTBR_ENABLE_TREL_PROBING
+        SelectProbedAddress(instanceName, candidates, peerInfo.mSockAddr);
+        peer.mSockAddr = peerInfo.mSockAddr;
+#endif
+
         otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
 
-        mPeers.emplace(instanceName, peer);
+        it                   = mPeers.emplace(instanceName, std::move(peer)).first;
+        it->second.mAgeEntry = mPeerAges.insert(mPeerAges.end(), instanceName);
+        AddPeerKey(it->second);
         CheckPeersNumLimit();
     }
+    else
+    {
+#if OTBR_ENABLE_TREL_PROBING
+        SelectProbedAddress(instanceName, candidates, peerInfo.mSockAddr);
+#endif
+
+        Peer &peer            = it->second;
+        bool  txtChanged      = (peer.mTxtData != aInstanceInfo.mTxtData);
+        bool  sockAddrChanged = !IsSameSockAddr(peer.mSockAddr, peerInfo.mSockAddr);
+
+        mPeerAges.splice(mPeerAges.end(), mPeerAges, peer.mAgeEntry);
+
+        VerifyOrExit(txtChanged || sockAddrChanged, otbrLogDebug("Peer %s is unchanged", instanceName.c_str()));
+
+        {
+            Peer oldPeer = peer;
+
+            peer.mSockAddr = peerInfo.mSockAddr;
+
+            if (txtChanged)
+            {
+                peer.mTxtData = aInstanceInfo.mTxtData;
+                peer.mValid   = false;
+                peer.ReadExtAddrFromTxtData();
+            }
+
+            // OpenThread updates the peer with the same extended address in place, so the old peer needs to be
+            // removed only when its extended address changes.
+            if (RemovePeerKey(oldPeer) == 0 &&
+                (!peer.mValid || memcmp(&oldPeer.mExtAddr, &peer.mExtAddr, sizeof(otExtAddress)) != 0))
+            {
+                NotifyRemovePeer(oldPeer);
+            }
+
+            if (!peer.mValid)
+            {
+                otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str());
+#if OTBR_ENABLE_TREL_PROBING
+                mProber.RemovePeer(instanceName);
+#endif
+                mPeerAges.erase(peer.mAgeEntry);
+                mPeers.erase(it);
+                ExitNow();
+            }
+
+            AddPeerKey(peer);
+            otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+        }
+    }
 
 exit:
     return;
@@ -352,12 +425,16 @@ void TrelDnssd::OnTrelServiceInstanceRemoved(const std::string &aInstanceName)
 
     // Remove the peer only when all instances are removed because one peer can have multiple instances if expired
     // instances were not properly removed by mDNS.
-    if (CountDuplicatePeers(it->second) == 0)
+    if (RemovePeerKey(it->second) == 0)
     {
         NotifyRemovePeer(it->second);
     }
 
+    mPeerAges.erase(it->second.mAgeEntry);
     mPeers.erase(it);
+#if OTBR_ENABLE_TREL_PROBING
+    mProber.RemovePeer(instanceName);
+#endif
 
 exit:
     return;
@@ -365,19 +442,13 @@ exit:
 
 void TrelDnssd::CheckPeersNumLimit(void)
 {
-    const PeerMap::value_type *oldestPeer = nullptr;
-
     VerifyOrExit(mPeers.size() >= kPeerCacheSize);
 
-    for (const auto &entry : mPeers)
     {
-        if (oldestPeer == nullptr || entry.second.mDiscoverTime < oldestPeer->second.mDiscoverTime)
-        {
-            oldestPeer = &entry;
-        }
-    }
+        std::string oldestPeer = mPeerAges.front();
 
-    OnTrelServiceInstanceRemoved(oldestPeer->first);
+        OnTrelServiceInstanceRemoved(oldestPeer);
+    }
 
 exit:
     return;
@@ -399,10 +470,18 @@ void TrelDnssd::RemoveAllPeers(void)
 {
     for (const auto &entry : mPeers)
     {
-        NotifyRemovePeer(entry.second);
+        if (RemovePeerKey(entry.second) == 0)
+        {
+            NotifyRemovePeer(entry.second);
+        }
     }
 
     mPeers.clear();
+    mPeerCounts.clear();
+    mPeerAges.clear();
+#if OTBR_ENABLE_TREL_PROBING
+    mProber.Clear();
+#endif
 }
 
 void TrelDnssd::CheckTrelNetifReady(void)
@@ -416,6 +495,9 @@ void TrelDnssd::CheckTrelNetifReady(void)
         if (mTrelNetifIndex != 0)
         {
             otbrLogDebug("Netif %s is ready: index = %" PRIu32, mTrelNetif.c_str(), mTrelNetifIndex);
+#if OTBR_ENABLE_TREL_PROBING
+            mProber.Start(mTrelNetifIndex);
+#endif
             OnBecomeReady();
         }
         else
@@ -455,27 +537,94 @@ void TrelDnssd::OnBecomeReady(void)
     }
 }
 
-uint16_t TrelDnssd::CountDuplicatePeers(const TrelDnssd::Peer &aPeer)
+void TrelDnssd::AddPeerKey(const Peer &aPeer)
+{
+    ++mPeerCounts[MakePeerKey(aPeer)];
+}
+
+uint16_t TrelDnssd::RemovePeerKey(const Peer &aPeer)
 {
+    auto     it    = mPeerCounts.find(MakePeerKey(aPeer));
     uint16_t count = 0;
 
-    for (const auto &entry : mPeers)
-    {
-        if (&entry.second == &aPeer)
-        {
-            continue;
-        }
+    VerifyOrExit(it != mPeerCounts.end());
 
-        if (!memcmp(&entry.second.mSockAddr, &aPeer.mSockAddr, sizeof(otSockAddr)) &&
-            !memcmp(&entry.second.mExtAddr, &aPeer.mExtAddr, sizeof(otExtAddress)))
-        {
-            count++;
-        }
+    count = --it->second;
+
+    if (count == 0)
+    {
+        mPeerCounts.erase(it);
     }
 
+exit:
     return count;
 }
 
+std::string TrelDnssd::MakePeerKey(const Peer &aPeer)
+{
+    std::string key;
+
+    key.reserve(sizeof(aPeer.mExtAddr.m8) + sizeof(aPeer.mSockAddr.mAddress.mFields.m8) + sizeof(uint16_t));
+    key.append(reinterpret_cast<const char *>(aPeer.mExtAddr.m8), sizeof(aPeer.mExtAddr.m8));
+    key.append(reinterpret_cast<const char *>(aPeer.mSockAddr.mAddress.mFields.m8),
+               sizeof(aPeer.mSockAddr.mAddress.mFields.m8));
+    key.push_back(static_cast<char>(aPeer.mSockAddr.mPort >> 8));
+    key.push_back(static_cast<char>(aPeer.mSockAddr.mPort & 0xff));
+
+    return key;
+}
+
+bool TrelDnssd::IsSameSockAddr(const otSockAddr &aLhs, const otSockAddr &aRhs)
+{
+    return aLhs.mPort == aRhs.mPort && memcmp(&aLhs.mAddress, &aRhs.mAddress, sizeof(aLhs.mAddress)) == 0;
+}
+
+#if OTBR_ENABLE_TREL_PROBING
+void TrelDnssd::SelectProbedAddress(const std::string             &aInstanceName,
+                                    const std::vector<Ip6Address> &aAddresses,
+                                    otSockAddr                    &aSockAddr)
+{
+    if (aAddresses.empty())
+    {
+        mProber.RemovePeer(aInstanceName);
+        ExitNow();
+    }
+
+    // The prober keeps the best measured address of the peer if it's still advertised.
+    memcpy(&aSockAddr.mAddress, &mProber.SetPeer(aInstanceName, aAddresses), sizeof(aSockAddr.mAddress));
+
+exit:
+    return;
+}
+
+void TrelDnssd::HandleBestAddressChanged(const std::string &aInstanceName, const Ip6Address &aAddress)
+{
+    auto               it = mPeers.find(aInstanceName);
+    otPlatTrelPeerInfo peerInfo;
+
+    VerifyOrExit(it != mPeers.end());
+
+    peerInfo.mRemoved  = false;
+    peerInfo.mSockAddr = it->second.mSockAddr;
+    memcpy(&peerInfo.mSockAddr.mAddress, &aAddress, sizeof(peerInfo.mSockAddr.mAddress));
+    VerifyOrExit(!IsSameSockAddr(peerInfo.mSockAddr, it->second.mSockAddr));
+
+    otbrLogInfo("Peer %s is now reached at %s", aInstanceName.c_str(), aAddress.ToString().c_str());
+
+    // The extended address is unchanged, so OpenThread updates the socket address of the peer in place.
+    RemovePeerKey(it->second);
+    it->second.mSockAddr = peerInfo.mSockAddr;
+    AddPeerKey(it->second);
+
+    peerInfo.mTxtData   = it->second.mTxtData.data();
+    peerInfo.mTxtLength = it->second.mTxtData.size();
+    otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+
+exit:
+    return;
+}
+#endif // OTBR_ENABLE_TREL_PROBING
+
 void TrelDnssd::RegisterInfo::Assign(uint16_t aPort, const uint8_t *aTxtData, uint8_t aTxtLength)
 {
     assert(!IsPublished());
@@ -497,28 +646,16 @@ const char TrelDnssd::Peer::kTxtRecordExtAddressKey[] = "xa";
 
 void TrelDnssd::Peer::ReadExtAddrFromTxtData(void)
 {
-    std::vector<Mdns::Publisher::TxtEntry> txtEntries;
+    Mdns::Publisher::TxtView        txtView(mTxtData);
+    Mdns::Publisher::TxtView::Entry txtEntry;
 
     memset(&mExtAddr, 0, sizeof(mExtAddr));
 
-    SuccessOrExit(Mdns::Publisher::DecodeTxtData(txtEntries, mTxtData.data(), mTxtData.size()));
+    SuccessOrExit(txtView.FindEntry(kTxtRecordExtAddressKey, txtEntry));
+    VerifyOrExit(!txtEntry.mIsBooleanAttribute && txtEntry.mValueLength == sizeof(mExtAddr));
 
-    for (const auto &txtEntry : txtEntries)
-    {
-        if (txtEntry.mIsBooleanAttribute)
-        {
-            continue;
-        }
-
-        if (StringUtils::EqualCaseInsensitive(txtEntry.mKey, kTxtRecordExtAddressKey))
-        {
-            VerifyOrExit(txtEntry.mValue.size() == sizeof(mExtAddr));
-
-            memcpy(mExtAddr.m8, txtEntry.mValue.data(), sizeof(mExtAddr));
-            mValid = true;
-            break;
-        }
-    }
+    memcpy(mExtAddr.m8, txtEntry.mValue, sizeof(mExtAddr));
+    mValid = true;
 
 exit:
 
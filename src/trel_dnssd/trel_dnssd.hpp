@@ -39,6 +39,9 @@
 #if OTBR_ENABLE_TREL
 
 #include <assert.h>
+#include <list>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <openthread/instance.h>
@@ -46,6 +49,7 @@
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
+#include "trel_dnssd/trel_peer_prober.hpp"
 
 namespace otbr {
 
@@ -116,6 +120,16 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
+#if OTBR_ENABLE_TREL_PROBING
+    /**
+     * This method returns the probing statistics of all addresses of the discovered TREL peers.
+     *
+     * @param[out] aStats  A reference to the vector to receive the statistics.
+     *
+     */
+    void GetPeerStats(std::vector<TrelPeerProber::PeerStats> &aStats) const { mProber.GetPeerStats(aStats); }
+#endif
+
 private:
     static constexpr size_t   kPeerCacheSize             = 256;
     static constexpr uint16_t kCheckNetifReadyIntervalMs = 5000;
@@ -132,15 +146,14 @@ private:
         void Clear(void);
     };
 
-    using Clock = std::chrono::system_clock;
+    using AgeList = std::list<std::string>; // Peer instance names, the least recently discovered first.
 
     struct Peer
     {
         static const char kTxtRecordExtAddressKey[];
 
         explicit Peer(std::vector<uint8_t> aTxtData, const otSockAddr &aSockAddr)
-            : mDiscoverTime(Clock::now())
-            , mTxtData(std::move(aTxtData))
+            : mTxtData(std::move(aTxtData))
             , mSockAddr(aSockAddr)
         {
             ReadExtAddrFromTxtData();
@@ -148,14 +161,17 @@ private:
 
         void ReadExtAddrFromTxtData(void);
 
-        Clock::time_point    mDiscoverTime;
         std::vector<uint8_t> mTxtData;
         otSockAddr           mSockAddr;
         otExtAddress         mExtAddr;
         bool                 mValid = false;
+        AgeList::iterator    mAgeEntry;
     };
 
-    using PeerMap = std::map<std::string, Peer>;
+    // Peers are keyed by the lowercase instance name. Instances sharing the same extended address and socket
+    // address are the same peer for OpenThread, so they are also counted by `MakePeerKey()`.
+    using PeerMap      = std::unordered_map<std::string, Peer>;
+    using PeerCountMap = std::unordered_map<std::string, uint16_t>;
 
     bool        IsInitialized(void) const { return !mTrelNetif.empty(); }
     bool        IsReady(void) const;
@@ -171,10 +187,20 @@ private:
     void        OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void        OnTrelServiceInstanceRemoved(const std::string &aInstanceName);
 
-    void     NotifyRemovePeer(const Peer &aPeer);
-    void     CheckPeersNumLimit(void);
-    void     RemoveAllPeers(void);
-    uint16_t CountDuplicatePeers(const Peer &aPeer);
+    void               NotifyRemovePeer(const Peer &aPeer);
+    void               CheckPeersNumLimit(void);
+    void               RemoveAllPeers(void);
+    void               AddPeerKey(const Peer &aPeer);
+    uint16_t           RemovePeerKey(const Peer &aPeer);
+    static std::string MakePeerKey(const Peer &aPeer);
+    static bool        IsSameSockAddr(const otSockAddr &aLhs, const otSockAddr &aRhs);
+
+#if OTBR_ENABLE_TREL_PROBING
+    void SelectProbedAddress(const std::string             &aInstanceName,
+                             const std::vector<Ip6Address> &aAddresses,
+                             otSockAddr                    &aSockAddr);
+    void HandleBestAddressChanged(const std::string &aInstanceName, const Ip6Address &aAddress);
+#endif
 
     Mdns::Publisher &mPublisher;
     Ncp::RcpHost    &mHost;
@@ -184,7 +210,12 @@ private:
     uint64_t         mSubscriberId   = 0;
     RegisterInfo     mRegisterInfo;
     PeerMap          mPeers;
+    PeerCountMap     mPeerCounts; // The number of instances of each peer, keyed by `MakePeerKey()`.
+    AgeList          mPeerAges;
     bool             mMdnsPublisherReady = false;
+#if OTBR_ENABLE_TREL_PROBING
+    TrelPeerProber mProber;
+#endif
 };
 
 /**
@@ -0,0 +1,455 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes implementation of probing the liveness and round-trip time of TREL peers.
+ */
+
+#if OTBR_ENABLE_TREL && OTBR_ENABLE_TREL_PROBING
+
+#define OTBR_LOG_TAG "TrelProb"
+
+#include "trel_dnssd/trel_peer_prober.hpp"
+
+#include <algorithm>
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <random>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/logging.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+
+namespace TrelDnssd {
+
+constexpr uint32_t TrelPeerProber::kDefaultProbeIntervalMs;
+constexpr uint32_t TrelPeerProber::kDefaultProbeTimeoutMs;
+constexpr uint16_t TrelPeerProber::kMaxConsecutiveLosses;
+constexpr uint32_t TrelPeerProber::kSwitchThresholdPercent;
+
+TrelPeerProber::TrelPeerProber(BestAddressChangedCallback aBestAddressChangedCallback,
+                               PeerDeadCallback           aPeerDeadCallback)
+    : mBestAddressChangedCallback(std::move(aBestAddressChangedCallback))
+    , mPeerDeadCallback(std::move(aPeerDeadCallback))
+    , mProbeInterval(kDefaultProbeIntervalMs)
+    , mProbeTimeout(kDefaultProbeTimeoutMs)
+{
+}
+
+TrelPeerProber::~TrelPeerProber(void)
+{
+    Stop();
+}
+
+void TrelPeerProber::SetTiming(Milliseconds aInterval, Milliseconds aTimeout)
+{
+    assert(aTimeout < aInterval);
+
+    mProbeInterval = aInterval;
+    mProbeTimeout  = aTimeout;
+}
+
+otbrError TrelPeerProber::Start(uint32_t aNetifIndex)
+{
+    otbrError           error = OTBR_ERROR_NONE;
+    struct icmp6_filter filter;
+    std::random_device  randomDevice;
+
+    VerifyOrExit(!IsRunning());
+
+    mSocket = SocketWithCloseExec(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6, kSocketNonBlock);
+    VerifyOrExit(mSocket >= 0, error = OTBR_ERROR_ERRNO);
+
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    ICMP6_FILTER_SETPASS(ICMP6_ECHO_REPLY, &filter);
+    VerifyOrExit(setsockopt(mSocket, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    if (aNetifIndex != 0)
+    {
+        char netifName[IF_NAMESIZE];
+
+        VerifyOrExit(if_indextoname(aNetifIndex, netifName) != nullptr, error = OTBR_ERROR_ERRNO);
+        VerifyOrExit(setsockopt(mSocket, SOL_SOCKET, SO_BINDTODEVICE, netifName, strlen(netifName)) == 0,
+                     error = OTBR_ERROR_ERRNO);
+    }
+
+    mNetifIndex  = aNetifIndex;
+    mIdentifier  = static_cast<uint16_t>(randomDevice());
+    mRoundTaskId = mTaskRunner.Post(Milliseconds(0), [this]() { StartRound(); });
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to start probing TREL peers: %s", strerror(errno));
+        Stop();
+    }
+    else
+    {
+        otbrLogInfo("Started probing TREL peers: netif=%u, interval=%ums, timeout=%ums", aNetifIndex,
+                    static_cast<uint32_t>(mProbeInterval.count()), static_cast<uint32_t>(mProbeTimeout.count()));
+    }
+
+    return error;
+}
+
+void TrelPeerProber::Stop(void)
+{
+    if (mSocket >= 0)
+    {
+        close(mSocket);
+        mSocket = -1;
+    }
+
+    if (mRoundTaskId != 0)
+    {
+        mTaskRunner.Cancel(mRoundTaskId);
+        mRoundTaskId = 0;
+    }
+
+    mPendingProbes.clear();
+}
+
+const Ip6Address &TrelPeerProber::SetPeer(const std::string &aInstanceName, const std::vector<Ip6Address> &aAddresses)
+{
+    Peer                     &peer = mPeers[aInstanceName];
+    std::vector<AddressStats> addresses;
+    size_t                    bestIndex = 0;
+
+    assert(!aAddresses.empty());
+
+    addresses.reserve(aAddresses.size());
+
+    for (const Ip6Address &address : aAddresses)
+    {
+        AddressStats *stats = FindAddress(peer, address);
+
+        if (stats != nullptr && stats == &peer.mAddresses[peer.mBestIndex])
+        {
+            bestIndex = addresses.size();
+        }
+
+        addresses.push_back(stats != nullptr ? *stats : AddressStats());
+        addresses.back().mAddress = address;
+    }
+
+    peer.mAddresses = std::move(addresses);
+    peer.mBestIndex = bestIndex;
+    peer.mIsDead    = false;
+
+    return peer.mAddresses[bestIndex].mAddress;
+}
+
+void TrelPeerProber::RemovePeer(const std::string &aInstanceName)
+{
+    // Pending probes of the peer are ignored when they are answered or time out.
+    mPeers.erase(aInstanceName);
+}
+
+void TrelPeerProber::Clear(void)
+{
+    mPeers.clear();
+    mPendingProbes.clear();
+}
+
+void TrelPeerProber::GetPeerStats(std::vector<PeerStats> &aStats) const
+{
+    aStats.clear();
+
+    for (const auto &entry : mPeers)
+    {
+        const Peer &peer = entry.second;
+
+        for (size_t i = 0; i < peer.mAddresses.size(); i++)
+        {
+            PeerStats stats;
+
+            static_cast<AddressStats &>(stats) = peer.mAddresses[i];
+            stats.mInstanceName                = entry.first;
+            stats.mIsBest                      = (i == peer.mBestIndex);
+            aStats.push_back(std::move(stats));
+        }
+    }
+}
+
+void TrelPeerProber::Update(MainloopContext &aMainloop)
+{
+    if (mSocket >= 0)
+    {
+        FD_SET(mSocket, &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mSocket);
+    }
+}
+
+void TrelPeerProber::Process(const MainloopContext &aMainloop)
+{
+    if (mSocket >= 0 && FD_ISSET(mSocket, &aMainloop.mReadFdSet))
+    {
+        ReceiveReplies();
+    }
+}
+
+void TrelPeerProber::StartRound(void)
+{
+    for (auto &entry : mPeers)
+    {
+        for (AddressStats &address : entry.second.mAddresses)
+        {
+            SendProbe(entry.first, address);
+        }
+    }
+
+    mRoundTaskId = mTaskRunner.Post(mProbeTimeout, [this]() { HandleRoundTimeout(); });
+}
+
+void TrelPeerProber::HandleRoundTimeout(void)
+{
+    std::vector<std::string> deadPeers;
+    std::vector<std::string> changedPeers;
+
+    // All probes of this round which are still pending are lost.
+    for (const auto &entry : mPendingProbes)
+    {
+        auto          it      = mPeers.find(entry.second.mInstanceName);
+        AddressStats *address = (it != mPeers.end()) ? FindAddress(it->second, entry.second.mAddress) : nullptr;
+
+        if (address != nullptr)
+        {
+            address->mConsecutiveLosses++;
+        }
+    }
+
+    mPendingProbes.clear();
+
+    for (auto &entry : mPeers)
+    {
+        Peer  &peer      = entry.second;
+        size_t bestIndex = peer.mBestIndex;
+
+        if (peer.mIsDead)
+        {
+            continue;
+        }
+
+        if (peer.mHasAnswered && std::none_of(peer.mAddresses.begin(), peer.mAddresses.end(),
+                                              [](const AddressStats &aAddress) { return aAddress.IsAlive(); }))
+        {
+            peer.mIsDead = true;
+            deadPeers.push_back(entry.first);
+            continue;
+        }
+
+        UpdateBestAddress(peer);
+
+        if (peer.mBestIndex != bestIndex)
+        {
+            changedPeers.push_back(entry.first);
+        }
+    }
+
+    mRoundTaskId = mTaskRunner.Post(mProbeInterval - mProbeTimeout, [this]() { StartRound(); });
+
+    // The callbacks may modify the peers, so they are invoked after iterating the peers.
+    for (const std::string &name : changedPeers)
+    {
+        auto it = mPeers.find(name);
+
+        if (it != mPeers.end())
+        {
+            const Ip6Address &address = it->second.mAddresses[it->second.mBestIndex].mAddress;
+
+            otbrLogInfo("Best address of peer %s changed to %s", name.c_str(), address.ToString().c_str());
+
+            if (mBestAddressChangedCallback)
+            {
+                mBestAddressChangedCallback(name, address);
+            }
+        }
+    }
+
+    for (const std::string &name : deadPeers)
+    {
+        if (mPeers.count(name) != 0)
+        {
+            otbrLogInfo("Peer %s does not answer probes", name.c_str());
+
+            if (mPeerDeadCallback)
+            {
+                mPeerDeadCallback(name);
+            }
+        }
+    }
+}
+
+void TrelPeerProber::SendProbe(const std::string &aInstanceName, AddressStats &aAddress)
+{
+    struct icmp6_hdr    echoRequest;
+    struct sockaddr_in6 dest;
+    uint16_t            sequence = mSequence++;
+
+    memset(&echoRequest, 0, sizeof(echoRequest));
+    echoRequest.icmp6_type = ICMP6_ECHO_REQUEST;
+    echoRequest.icmp6_id   = htons(mIdentifier);
+    echoRequest.icmp6_seq  = htons(sequence);
+
+    memset(&dest, 0, sizeof(dest));
+    aAddress.mAddress.CopyTo(dest);
+
+    if (aAddress.mAddress.IsLinkLocal())
+    {
+        dest.sin6_scope_id = mNetifIndex;
+    }
+
+    aAddress.mTxProbes++;
+
+    // The checksum is filled by the kernel for ICMPv6 raw sockets.
+    if (sendto(mSocket, &echoRequest, sizeof(echoRequest), 0, reinterpret_cast<struct sockaddr *>(&dest),
+               sizeof(dest)) < 0)
+    {
+        otbrLogDebug("Failed to probe %s: %s", aAddress.mAddress.ToString().c_str(), strerror(errno));
+    }
+
+    // A probe which failed to be sent is counted as lost.
+    mPendingProbes[sequence] = PendingProbe{aInstanceName, aAddress.mAddress, Clock::now()};
+}
+
+void TrelPeerProber::ReceiveReplies(void)
+{
+    while (true)
+    {
+        uint8_t             buffer[sizeof(struct icmp6_hdr) + 64];
+        struct sockaddr_in6 source;
+        socklen_t           sourceLength = sizeof(source);
+        ssize_t             length;
+        struct icmp6_hdr   *echoReply = reinterpret_cast<struct icmp6_hdr *>(buffer);
+
+        length = recvfrom(mSocket, buffer, sizeof(buffer), 0, reinterpret_cast<struct sockaddr *>(&source),
+                          &sourceLength);
+
+        if (length < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("Failed to receive Echo Reply: %s", strerror(errno));
+            }
+
+            break;
+        }
+
+        if (static_cast<size_t>(length) < sizeof(struct icmp6_hdr) || echoReply->icmp6_type != ICMP6_ECHO_REPLY ||
+            ntohs(echoReply->icmp6_id) != mIdentifier)
+        {
+            continue;
+        }
+
+        HandleReply(Ip6Address(source.sin6_addr.s6_addr), ntohs(echoReply->icmp6_seq));
+    }
+}
+
+void TrelPeerProber::HandleReply(const Ip6Address &aSource, uint16_t aSequence)
+{
+    auto          probeIt = mPendingProbes.find(aSequence);
+    Peer         *peer    = nullptr;
+    AddressStats *address = nullptr;
+    Microseconds  rtt;
+
+    VerifyOrExit(probeIt != mPendingProbes.end() && probeIt->second.mAddress == aSource);
+
+    {
+        auto peerIt = mPeers.find(probeIt->second.mInstanceName);
+
+        peer    = (peerIt != mPeers.end()) ? &peerIt->second : nullptr;
+        address = (peer != nullptr) ? FindAddress(*peer, aSource) : nullptr;
+    }
+
+    rtt = std::max(std::chrono::duration_cast<Microseconds>(Clock::now() - probeIt->second.mSentTime),
+                   Microseconds(1));
+    mPendingProbes.erase(probeIt);
+
+    VerifyOrExit(address != nullptr);
+
+    peer->mHasAnswered = true;
+    address->mRxReplies++;
+    address->mConsecutiveLosses = 0;
+
+    // Smoothed RTT as in RFC 6298: SRTT = 7/8 * SRTT + 1/8 * RTT.
+    address->mSmoothedRtt =
+        (address->mSmoothedRtt == Microseconds::zero()) ? rtt : (address->mSmoothedRtt * 7 + rtt) / 8;
+
+exit:
+    return;
+}
+
+void TrelPeerProber::UpdateBestAddress(Peer &aPeer)
+{
+    const AddressStats *best      = &aPeer.mAddresses[aPeer.mBestIndex];
+    size_t              bestIndex = aPeer.mBestIndex;
+
+    for (size_t i = 0; i < aPeer.mAddresses.size(); i++)
+    {
+        const AddressStats &candidate = aPeer.mAddresses[i];
+
+        if (!candidate.IsAlive() || candidate.mRxReplies == 0 || i == aPeer.mBestIndex)
+        {
+            continue;
+        }
+
+        // Switch away from a working address only when the candidate is notably faster, so that the peer address
+        // does not flap between addresses with similar RTTs.
+        if (!best->IsAlive() || best->mRxReplies == 0 ||
+            candidate.mSmoothedRtt * 100 < best->mSmoothedRtt * kSwitchThresholdPercent)
+        {
+            best      = &candidate;
+            bestIndex = i;
+        }
+    }
+
+    aPeer.mBestIndex = bestIndex;
+}
+
+TrelPeerProber::AddressStats *TrelPeerProber::FindAddress(Peer &aPeer, const Ip6Address &aAddress)
+{
+    auto it = std::find_if(aPeer.mAddresses.begin(), aPeer.mAddresses.end(),
+                           [&aAddress](const AddressStats &aStats) { return aStats.mAddress == aAddress; });
+
+    return (it != aPeer.mAddresses.end()) ? &*it : nullptr;
+}
+
+} // namespace TrelDnssd
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TREL && OTBR_ENABLE_TREL_PROBING
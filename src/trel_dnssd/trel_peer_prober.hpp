@@ -0,0 +1,261 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for probing the liveness and round-trip time of TREL peers.
+ */
+
+#ifndef OTBR_AGENT_TREL_PEER_PROBER_HPP_
+#define OTBR_AGENT_TREL_PEER_PROBER_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_TREL && OTBR_ENABLE_TREL_PROBING
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+namespace TrelDnssd {
+
+/**
+ * @addtogroup border-router-trel-dnssd
+ *
+ * @{
+ */
+
+/**
+ * This class probes the addresses of TREL peers with ICMPv6 Echo Requests on the TREL network interface.
+ *
+ * Each address of a peer is probed periodically. The prober keeps a smoothed round-trip time and a loss count per
+ * address, selects the best address of a multi-homed peer and reports a peer as dead when none of its addresses
+ * answers for `kMaxConsecutiveLosses` consecutive rounds.
+ *
+ */
+class TrelPeerProber : public MainloopProcessor, private NonCopyable
+{
+public:
+    static constexpr uint32_t kDefaultProbeIntervalMs = 5000; ///< The default interval between two probe rounds.
+    static constexpr uint32_t kDefaultProbeTimeoutMs  = 2000; ///< The default time to wait for an Echo Reply.
+    static constexpr uint16_t kMaxConsecutiveLosses   = 3;    ///< The number of losses before an address is dead.
+
+    /**
+     * This structure represents the probing statistics of one address of a peer.
+     *
+     */
+    struct AddressStats
+    {
+        Ip6Address   mAddress;                                  ///< The peer address.
+        uint32_t     mTxProbes          = 0;                    ///< The number of Echo Requests sent to the address.
+        uint32_t     mRxReplies         = 0;                    ///< The number of Echo Replies from the address.
+        uint16_t     mConsecutiveLosses = 0;                    ///< The number of Echo Requests lost in a row.
+        Microseconds mSmoothedRtt       = Microseconds::zero(); ///< The smoothed round-trip time, zero if unknown.
+
+        bool IsAlive(void) const { return mConsecutiveLosses < kMaxConsecutiveLosses; }
+    };
+
+    /**
+     * This structure represents the probing statistics of one address of a peer, as reported by `GetPeerStats()`.
+     *
+     */
+    struct PeerStats : public AddressStats
+    {
+        std::string mInstanceName;   ///< The instance name of the peer.
+        bool        mIsBest = false; ///< Whether the address is the best address of the peer.
+    };
+
+    /**
+     * This function is called when the best address of a peer changes.
+     *
+     * @param[in] aInstanceName  The instance name of the peer.
+     * @param[in] aAddress       The new best address of the peer.
+     *
+     */
+    using BestAddressChangedCallback =
+        std::function<void(const std::string &aInstanceName, const Ip6Address &aAddress)>;
+
+    /**
+     * This function is called when none of the addresses of a peer answers probes anymore.
+     *
+     * A peer which has never answered is not reported, as it may not answer ICMPv6 Echo Requests at all.
+     *
+     * @param[in] aInstanceName  The instance name of the peer.
+     *
+     */
+    using PeerDeadCallback = std::function<void(const std::string &aInstanceName)>;
+
+    /**
+     * This constructor initializes the TrelPeerProber instance.
+     *
+     * @param[in] aBestAddressChangedCallback  The callback for best address changes.
+     * @param[in] aPeerDeadCallback            The callback for dead peers.
+     *
+     */
+    TrelPeerProber(BestAddressChangedCallback aBestAddressChangedCallback, PeerDeadCallback aPeerDeadCallback);
+
+    ~TrelPeerProber(void) override;
+
+    /**
+     * This method sets the probe interval and timeout.
+     *
+     * @param[in] aInterval  The interval between two probe rounds.
+     * @param[in] aTimeout   The time to wait for an Echo Reply, must be shorter than @p aInterval.
+     *
+     */
+    void SetTiming(Milliseconds aInterval, Milliseconds aTimeout);
+
+    /**
+     * This method starts probing.
+     *
+     * @param[in] aNetifIndex  The index of the TREL network interface, or 0 to not bind to any interface.
+     *
+     * @retval OTBR_ERROR_NONE    Successfully started probing.
+     * @retval OTBR_ERROR_ERRNO   Failed to open the ICMPv6 socket.
+     *
+     */
+    otbrError Start(uint32_t aNetifIndex);
+
+    /**
+     * This method stops probing. The peers and their statistics are kept.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method indicates whether probing is running.
+     *
+     * @returns Whether probing is running.
+     *
+     */
+    bool IsRunning(void) const { return mSocket >= 0; }
+
+    /**
+     * This method adds a peer or updates the addresses of a peer.
+     *
+     * The statistics of the addresses which are kept are preserved. The best address is kept if it's still present,
+     * otherwise the first address of @p aAddresses becomes the best address until measurements are available.
+     *
+     * @param[in] aInstanceName  The instance name of the peer.
+     * @param[in] aAddresses     The addresses of the peer, in the order of preference. Must not be empty.
+     *
+     * @returns The best address of the peer.
+     *
+     */
+    const Ip6Address &SetPeer(const std::string &aInstanceName, const std::vector<Ip6Address> &aAddresses);
+
+    /**
+     * This method removes a peer.
+     *
+     * @param[in] aInstanceName  The instance name of the peer.
+     *
+     */
+    void RemovePeer(const std::string &aInstanceName);
+
+    /**
+     * This method removes all peers.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the probing statistics of all addresses of all peers.
+     *
+     * @param[out] aStats  A reference to the vector to receive the statistics.
+     *
+     */
+    void GetPeerStats(std::vector<PeerStats> &aStats) const;
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
+private:
+    // The best address is switched only if the candidate's smoothed RTT is below this percentage of the current one.
+    static constexpr uint32_t kSwitchThresholdPercent = 75;
+
+    struct Peer
+    {
+        std::vector<AddressStats> mAddresses;
+        size_t                    mBestIndex   = 0;
+        bool                      mIsDead      = false;
+        bool                      mHasAnswered = false; // Whether any address of the peer has ever answered.
+    };
+
+    struct PendingProbe
+    {
+        std::string mInstanceName;
+        Ip6Address  mAddress;
+        Timepoint   mSentTime;
+    };
+
+    using PeerMap         = std::unordered_map<std::string, Peer>;
+    using PendingProbeMap = std::unordered_map<uint16_t, PendingProbe>;
+
+    void          StartRound(void);
+    void          HandleRoundTimeout(void);
+    void          SendProbe(const std::string &aInstanceName, AddressStats &aAddress);
+    void          ReceiveReplies(void);
+    void          HandleReply(const Ip6Address &aSource, uint16_t aSequence);
+    void          UpdateBestAddress(Peer &aPeer);
+    AddressStats *FindAddress(Peer &aPeer, const Ip6Address &aAddress);
+
+    BestAddressChangedCallback mBestAddressChangedCallback;
+    PeerDeadCallback           mPeerDeadCallback;
+    Milliseconds               mProbeInterval;
+    Milliseconds               mProbeTimeout;
+    TaskRunner                 mTaskRunner;
+    TaskRunner::TaskId         mRoundTaskId = 0;
+    int                        mSocket      = -1;
+    uint32_t                   mNetifIndex  = 0;
+    uint16_t                   mIdentifier  = 0;
+    uint16_t                   mSequence    = 0;
+    PeerMap                    mPeers;
+    PendingProbeMap            mPendingProbes;
+};
+
+/**
+ * @}
+ */
+
+} // namespace TrelDnssd
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TREL && OTBR_ENABLE_TREL_PROBING
+
+#endif // OTBR_AGENT_TREL_PEER_PROBER_HPP_
@@ -29,6 +29,7 @@
 #include "utils/dns_utils.hpp"
 
 #include <assert.h>
+#include <stddef.h>
 
 #include "common/code_utils.hpp"
 
@@ -36,40 +37,50 @@ namespace otbr {
 
 namespace DnsUtils {
 
-std::string UnescapeInstanceName(const std::string &aName)
+static inline bool IsDigit(char aChar)
 {
-    std::string newName;
-    auto        nameLen = aName.length();
+    return aChar >= '0' && aChar <= '9';
+}
 
-    newName.reserve(nameLen);
+size_t UnescapeInstanceName(const char *aName, size_t aLength, char *aBuffer)
+{
+    size_t length = 0;
 
-    for (unsigned int i = 0; i < nameLen; i++)
+    for (size_t i = 0; i < aLength; i++)
     {
         char c = aName[i];
 
         if (c == '\\')
         {
-            if (i + 3 < nameLen && isdigit(aName[i + 1]) && isdigit(aName[i + 2]) && isdigit(aName[i + 3]))
+            if (i + 3 < aLength && IsDigit(aName[i + 1]) && IsDigit(aName[i + 2]) && IsDigit(aName[i + 3]))
             {
-                uint8_t b = (aName[i + 1] - '0') * 100 + (aName[i + 2] - '0') * 10 + (aName[i + 3] - '0');
-
-                newName.push_back(b);
+                aBuffer[length++] =
+                    static_cast<char>((aName[i + 1] - '0') * 100 + (aName[i + 2] - '0') * 10 + (aName[i + 3] - '0'));
                 i += 3;
                 continue;
             }
 
-            if (i + 1 < nameLen)
+            if (i + 1 < aLength)
             {
-                newName.push_back(aName[i + 1]);
+                aBuffer[length++] = aName[i + 1];
                 i += 1;
                 continue;
             }
         }
 
         // append all not escaped characters
-        newName.push_back(c);
+        aBuffer[length++] = c;
     }
 
+    return length;
+}
+
+std::string UnescapeInstanceName(const std::string &aName)
+{
+    std::string newName(aName);
+
+    newName.resize(UnescapeInstanceName(aName.data(), aName.size(), &newName[0]));
+
     return newName;
 }
 
@@ -38,6 +38,8 @@
 
 #include <string>
 
+#include <stddef.h>
+
 namespace otbr {
 
 namespace DnsUtils {
@@ -55,6 +57,21 @@ namespace DnsUtils {
  */
 std::string UnescapeInstanceName(const std::string &aName);
 
+/**
+ * This function unescapes a DNS Service Instance name into a caller buffer.
+ *
+ * The unescaped name is never longer than the escaped one, so @p aBuffer may point to @p aName to unescape the
+ * name in place.
+ *
+ * @param[in]  aName    A pointer to the characters of the DNS Service Instance name to unescape.
+ * @param[in]  aLength  The number of characters of the name.
+ * @param[out] aBuffer  A buffer of at least @p aLength bytes to receive the unescaped name, not null-terminated.
+ *
+ * @returns  The length of the unescaped DNS Service Instance name.
+ *
+ */
+size_t UnescapeInstanceName(const char *aName, size_t aLength, char *aBuffer);
+
 /**
  * This function checks a given host name for sanity.
  *
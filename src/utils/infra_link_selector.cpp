@@ -37,16 +37,10 @@
 
 #include "utils/infra_link_selector.hpp"
 
-#include <linux/rtnetlink.h>
 #include <net/if.h>
-#include <sys/ioctl.h>
-#include <sys/socket.h>
-#include <unistd.h>
 
 #include <openthread/backbone_router_ftd.h>
 
-#include "utils/socket_utils.hpp"
-
 namespace otbr {
 namespace Utils {
 
@@ -74,8 +68,9 @@ InfraLinkSelector::InfraLinkSelector(std::vector<const char *> aInfraLinkNames)
 {
     if (mInfraLinkNames.size() >= 2)
     {
-        mNetlinkSocket = CreateNetLinkRouteSocket(RTMGRP_LINK);
-        VerifyOrDie(mNetlinkSocket != -1, "Failed to create netlink socket");
+        VerifyOrDie(NetlinkMonitor::GetInstance().Open() == OTBR_ERROR_NONE, "Failed to open netlink monitor");
+        mLinkSubscriberId = NetlinkMonitor::GetInstance().AddLinkSubscriber(
+            [this](NetlinkMonitor::Change, const NetlinkMonitor::Link &) { HandleLinkChange(); });
     }
 
     for (const char *name : mInfraLinkNames)
@@ -86,10 +81,9 @@ InfraLinkSelector::InfraLinkSelector(std::vector<const char *> aInfraLinkNames)
 
 InfraLinkSelector::~InfraLinkSelector(void)
 {
-    if (mNetlinkSocket != -1)
+    if (mLinkSubscriberId != 0)
     {
-        close(mNetlinkSocket);
-        mNetlinkSocket = -1;
+        NetlinkMonitor::GetInstance().RemoveSubscriber(mLinkSubscriberId);
     }
 }
 
@@ -108,9 +102,23 @@ const char *InfraLinkSelector::Select(void)
     sel = SelectGeneric();
 #endif
 
+    mSelectedInfraLink = sel;
+
     return sel;
 }
 
+void InfraLinkSelector::Reselect(void)
+{
+    const char *prevInfraLink = mSelectedInfraLink;
+
+    mRequireReselect = true;
+
+    if (Select() != prevInfraLink && mInfraLinkChangedCallback)
+    {
+        mInfraLinkChangedCallback(mSelectedInfraLink);
+    }
+}
+
 const char *InfraLinkSelector::SelectGeneric(void)
 {
     const char                  *prevInfraLink         = mCurrentInfraLink;
@@ -172,7 +180,11 @@ const char *InfraLinkSelector::SelectGeneric(void)
 
                 otbrLogInfo("Infra link %s was running %lldms ago, wait for %lldms to recheck.", mCurrentInfraLink,
                             timeSinceLastRunning.count(), delay.count());
-                mTaskRunner.Post(delay, [this]() { mRequireReselect = true; });
+                mTaskRunner.Cancel(mReselectTaskId);
+                mReselectTaskId = mTaskRunner.Post(delay, [this]() {
+                    mReselectTaskId = 0;
+                    Reselect();
+                });
                 ExitNow();
             }
         }
@@ -208,121 +220,37 @@ exit:
 
 InfraLinkSelector::LinkState InfraLinkSelector::QueryInfraLinkState(const char *aInfraLinkName)
 {
-    int                          sock = 0;
-    struct ifreq                 ifReq;
+    const NetlinkMonitor::Link  *link  = NetlinkMonitor::GetInstance().FindLink(aInfraLinkName);
     InfraLinkSelector::LinkState state = kInvalid;
 
-    sock = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketBlock);
-    VerifyOrDie(sock != -1, "Failed to create AF_INET6 socket.");
-
-    memset(&ifReq, 0, sizeof(ifReq));
-    strncpy(ifReq.ifr_name, aInfraLinkName, sizeof(ifReq.ifr_name) - 1);
-
-    VerifyOrExit(ioctl(sock, SIOCGIFFLAGS, &ifReq) != -1);
+    VerifyOrExit(link != nullptr);
 
-    state = (ifReq.ifr_flags & IFF_UP) ? ((ifReq.ifr_flags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
+    state = (link->mFlags & IFF_UP) ? ((link->mFlags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
 
 exit:
-    if (sock != 0)
-    {
-        close(sock);
-    }
-
     return state;
 }
 
-void InfraLinkSelector::Update(MainloopContext &aMainloop)
+void InfraLinkSelector::HandleLinkChange(void)
 {
-    if (mNetlinkSocket != -1)
-    {
-        FD_SET(mNetlinkSocket, &aMainloop.mReadFdSet);
-        aMainloop.mMaxFd = std::max(mNetlinkSocket, aMainloop.mMaxFd);
-    }
-}
-
-void InfraLinkSelector::Process(const MainloopContext &aMainloop)
-{
-    OTBR_UNUSED_VARIABLE(aMainloop);
-
-    if (mNetlinkSocket != -1 && FD_ISSET(mNetlinkSocket, &aMainloop.mReadFdSet))
-    {
-        ReceiveNetLinkMessage();
-    }
-}
-
-void InfraLinkSelector::ReceiveNetLinkMessage(void)
-{
-    const size_t kMaxNetLinkBufSize = 8192;
-    ssize_t      len;
-    union
-    {
-        nlmsghdr mHeader;
-        uint8_t  mBuffer[kMaxNetLinkBufSize];
-    } msgBuffer;
-
-    len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), 0);
-    if (len < 0)
-    {
-        otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
-        ExitNow();
-    }
-
-    for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
-         header                  = NLMSG_NEXT(header, len))
-    {
-        struct ifinfomsg *ifinfo;
-
-        switch (header->nlmsg_type)
-        {
-        case RTM_NEWLINK:
-        case RTM_DELLINK:
-            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
-            HandleInfraLinkStateChange(ifinfo->ifi_index);
-            break;
-        case NLMSG_ERROR:
-        {
-            struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
-
-            otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
-            break;
-        }
-        default:
-            break;
-        }
-    }
-
-exit:
-    return;
-}
-
-void InfraLinkSelector::HandleInfraLinkStateChange(uint32_t aInfraLinkIndex)
-{
-    const char *infraLinkName = nullptr;
-
+    // Re-read every candidate since renaming a link changes the state of two names at once.
     for (const char *name : mInfraLinkNames)
     {
-        if (aInfraLinkIndex == if_nametoindex(name))
-        {
-            infraLinkName = name;
-            break;
-        }
-    }
-
-    VerifyOrExit(infraLinkName != nullptr);
-
-    {
-        LinkInfo &linkInfo  = mInfraLinkInfos[infraLinkName];
+        LinkInfo &linkInfo  = mInfraLinkInfos[name];
         LinkState prevState = linkInfo.mState;
 
-        if (linkInfo.Update(QueryInfraLinkState(infraLinkName)))
+        if (linkInfo.Update(QueryInfraLinkState(name)))
         {
-            otbrLogInfo("Infra link name %s index %lu state changed: %s -> %s", infraLinkName, aInfraLinkIndex,
-                        LinkStateToString(prevState), LinkStateToString(linkInfo.mState));
+            otbrLogInfo("Infra link name %s state changed: %s -> %s", name, LinkStateToString(prevState),
+                        LinkStateToString(linkInfo.mState));
             mRequireReselect = true;
         }
     }
-exit:
-    return;
+
+    if (mRequireReselect)
+    {
+        Reselect();
+    }
 }
 
 const char *InfraLinkSelector::LinkStateToString(LinkState aState)
@@ -39,6 +39,7 @@
 #if __linux__
 
 #include <assert.h>
+#include <functional>
 #include <map>
 #include <utility>
 #include <vector>
@@ -46,7 +47,7 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
-#include "common/mainloop.hpp"
+#include "common/netlink_monitor.hpp"
 #include "common/task_runner.hpp"
 #include "common/time.hpp"
 
@@ -57,6 +58,9 @@
  * This function should return the infrastructure link that is selected by platform specific rules.
  * If the function returns nullptr, the generic infrastructure link selections rules will be applied.
  *
+ * This function is evaluated on startup and whenever a candidate link changes state or the reselection timer fires,
+ * not on every mainloop iteration.
+ *
  */
 extern "C" const char *otbrVendorInfraLinkSelect(void);
 #endif
@@ -68,9 +72,17 @@ namespace Utils {
  * This class implements Infrastructure Link Selector.
  *
  */
-class InfraLinkSelector : public MainloopProcessor, private NonCopyable
+class InfraLinkSelector : private NonCopyable
 {
 public:
+    /**
+     * This function pointer is called when the selected infrastructure link changes.
+     *
+     * @param[in]  aInfraLink  The newly selected infrastructure link.
+     *
+     */
+    using InfraLinkChangedCallback = std::function<void(const char *aInfraLink)>;
+
     /**
      * This constructor initializes the InfraLinkSelector instance.
      *
@@ -97,11 +109,23 @@ public:
      *      No other interface is `up and running`
      *      The interface has been `up and running` within last 10 seconds
      *
+     * The link states are taken from the shared `NetlinkMonitor`, so the selection only needs to be re-evaluated when
+     * a candidate link changes state or the reselection delay expires. Both cases are handled internally and reported
+     * through the callback set by `SetInfraLinkChangedCallback()`.
+     *
      * @returns  The selected infrastructure link.
      *
      */
     const char *Select(void);
 
+    /**
+     * This method sets the callback to be notified when the selected infrastructure link changes.
+     *
+     * @param[in]  aCallback  The callback to invoke with the newly selected infrastructure link.
+     *
+     */
+    void SetInfraLinkChangedCallback(InfraLinkChangedCallback aCallback) { mInfraLinkChangedCallback = aCallback; }
+
 private:
     /**
      * This enumeration infrastructure link states.
@@ -129,20 +153,21 @@ private:
     static constexpr auto        kInfraLinkSelectionDelay = Milliseconds(10000);
 
     const char *SelectGeneric(void);
+    void        Reselect(void);
 
     static const char *LinkStateToString(LinkState aState);
     static LinkState   QueryInfraLinkState(const char *aInfraLinkName);
-    void               Update(MainloopContext &aMainloop) override;
-    void               Process(const MainloopContext &aMainloop) override;
-    void               ReceiveNetLinkMessage(void);
-    void               HandleInfraLinkStateChange(uint32_t aInfraLinkIndex);
+    void               HandleLinkChange(void);
 
     std::vector<const char *>        mInfraLinkNames;
     std::map<const char *, LinkInfo> mInfraLinkInfos;
-    int                              mNetlinkSocket    = -1;
-    const char                      *mCurrentInfraLink = nullptr;
+    NetlinkMonitor::SubscriberId     mLinkSubscriberId  = 0;
+    const char                      *mCurrentInfraLink  = nullptr;
+    const char                      *mSelectedInfraLink = nullptr;
     TaskRunner                       mTaskRunner;
+    TaskRunner::TaskId               mReselectTaskId  = 0;
     bool                             mRequireReselect = true;
+    InfraLinkChangedCallback         mInfraLinkChangedCallback;
 };
 
 } // namespace Utils
@@ -33,6 +33,11 @@
 
 #include "utils/pskc.hpp"
 
+#include <algorithm>
+#include <atomic>
+
+#include <mbedtls/sha256.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
@@ -81,17 +86,44 @@ exit:
 
 const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
 {
-    uint32_t blockCounter = 0;
-    uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    static constexpr unsigned int kPrfKeyBits = 128;
+
+    const mbedtls_cipher_info_t *cipherInfo    = mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_AES_128_ECB);
+    const size_t                 passphraseLen = strlen(aPassphrase);
+    int                          ret           = 0;
+    uint32_t                     blockCounter  = 0;
+    uint16_t                     useLen        = 0;
+    uint16_t                     prfBlockLen   = MBEDTLS_CIPHER_BLKSIZE_MAX;
+    uint8_t                      prfKey[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint8_t                      prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t                      prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint8_t                      keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint16_t                     keyLen = OT_PSKC_LENGTH;
+    uint8_t                     *pskc   = mPskc;
+    mbedtls_cipher_context_t     cmac;
+
+    mbedtls_cipher_init(&cmac);
 
     SetSalt(aExtPanId, aNetworkName);
 
+    // AES-CMAC-PRF-128 (RFC 4615) uses the passphrase as the AES key when it is 128 bits long, and otherwise the
+    // AES-CMAC of the passphrase under an all-zero key. The key is the same for every iteration, so derive it and
+    // set up the CMAC context once instead of once per iteration as `mbedtls_aes_cmac_prf_128()` would.
+    if (passphraseLen == sizeof(prfKey))
+    {
+        memcpy(prfKey, aPassphrase, sizeof(prfKey));
+    }
+    else
+    {
+        const uint8_t zeroKey[MBEDTLS_CIPHER_BLKSIZE_MAX] = {0};
+
+        SuccessOrExit(ret = mbedtls_cipher_cmac(cipherInfo, zeroKey, kPrfKeyBits,
+                                                reinterpret_cast<const uint8_t *>(aPassphrase), passphraseLen, prfKey));
+    }
+
+    SuccessOrExit(ret = mbedtls_cipher_setup(&cmac, cipherInfo));
+    SuccessOrExit(ret = mbedtls_cipher_cmac_starts(&cmac, prfKey, kPrfKeyBits));
+
     while (keyLen)
     {
         memcpy(prfInput, mSalt, mSaltLen);
@@ -102,8 +134,8 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
         prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
         // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
+        SuccessOrExit(ret = mbedtls_cipher_cmac_update(&cmac, prfInput, mSaltLen + 4));
+        SuccessOrExit(ret = mbedtls_cipher_cmac_finish(&cmac, prfOutput));
         memcpy(keyBlock, prfOutput, prfBlockLen);
 
         for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
@@ -111,8 +143,9 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
             memcpy(prfInput, prfOutput, prfBlockLen);
 
             // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
+            SuccessOrExit(ret = mbedtls_cipher_cmac_reset(&cmac));
+            SuccessOrExit(ret = mbedtls_cipher_cmac_update(&cmac, prfInput, prfBlockLen));
+            SuccessOrExit(ret = mbedtls_cipher_cmac_finish(&cmac, prfOutput));
 
             // xor
             for (uint32_t j = 0; j < prfBlockLen; j++)
@@ -121,13 +154,246 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
             }
         }
 
+        SuccessOrExit(ret = mbedtls_cipher_cmac_reset(&cmac));
+
         useLen = (keyLen < prfBlockLen) ? keyLen : prfBlockLen;
         memcpy(pskc, keyBlock, useLen);
         pskc += useLen;
         keyLen -= useLen;
     }
+
+exit:
+    if (ret != 0)
+    {
+        otbrLogErr("Failed to compute PSKc: %d", ret);
+        memset(mPskc, 0, sizeof(mPskc));
+    }
+    mbedtls_cipher_free(&cmac);
+    memset(prfKey, 0, sizeof(prfKey));
     return mPskc;
 }
 
+void Pskc::ComputePskcBatch(const std::vector<PskcParams> &aParams,
+                            std::vector<PskcValue>        &aPskcs,
+                            unsigned                       aNumThreads)
+{
+    std::atomic<size_t>      next(0);
+    std::vector<std::thread> threads;
+
+    auto worker = [&aParams, &aPskcs, &next]() {
+        Pskc pskc;
+
+        for (size_t i = next++; i < aParams.size(); i = next++)
+        {
+            const uint8_t *value = pskc.ComputePskc(aParams[i].mExtPanId, aParams[i].mNetworkName.c_str(),
+                                                    aParams[i].mPassphrase.c_str());
+
+            memcpy(aPskcs[i].m8, value, sizeof(aPskcs[i].m8));
+        }
+    };
+
+    aPskcs.resize(aParams.size());
+
+    if (aNumThreads == 0)
+    {
+        aNumThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // The calling thread takes part in the work.
+    for (size_t i = 1; i < std::min<size_t>(aNumThreads, aParams.size()); i++)
+    {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+constexpr size_t PskcCache::kDefaultCapacity;
+
+PskcCache::PskcCache(size_t aCapacity)
+    : mCapacity(aCapacity)
+{
+}
+
+std::string PskcCache::MakeKey(const PskcParams &aParams)
+{
+    static constexpr size_t kSha256Size = 32;
+
+    uint8_t                passphraseHash[kSha256Size];
+    mbedtls_sha256_context sha256;
+    std::string            key;
+
+    mbedtls_sha256_init(&sha256);
+    mbedtls_sha256_starts(&sha256, 0);
+    mbedtls_sha256_update(&sha256, reinterpret_cast<const uint8_t *>(aParams.mPassphrase.data()),
+                          aParams.mPassphrase.size());
+    mbedtls_sha256_finish(&sha256, passphraseHash);
+    mbedtls_sha256_free(&sha256);
+
+    key.reserve(sizeof(aParams.mExtPanId) + sizeof(passphraseHash) + aParams.mNetworkName.size());
+    key.append(reinterpret_cast<const char *>(aParams.mExtPanId), sizeof(aParams.mExtPanId));
+    key.append(reinterpret_cast<const char *>(passphraseHash), sizeof(passphraseHash));
+    key.append(aParams.mNetworkName);
+
+    return key;
+}
+
+bool PskcCache::Find(const PskcParams &aParams, PskcValue &aPskc)
+{
+    bool found = false;
+    auto it    = mIndex.find(MakeKey(aParams));
+
+    VerifyOrExit(it != mIndex.end());
+
+    mEntries.splice(mEntries.begin(), mEntries, it->second);
+    aPskc = it->second->second;
+    found = true;
+
+exit:
+    return found;
+}
+
+void PskcCache::Add(const PskcParams &aParams, const PskcValue &aPskc)
+{
+    std::string key;
+
+    VerifyOrExit(mCapacity > 0);
+
+    key = MakeKey(aParams);
+
+    {
+        auto it = mIndex.find(key);
+
+        if (it != mIndex.end())
+        {
+            it->second->second = aPskc;
+            mEntries.splice(mEntries.begin(), mEntries, it->second);
+            ExitNow();
+        }
+    }
+
+    if (mEntries.size() >= mCapacity)
+    {
+        mIndex.erase(mEntries.back().first);
+        mEntries.pop_back();
+    }
+
+    mEntries.emplace_front(key, aPskc);
+    mIndex.emplace(std::move(key), mEntries.begin());
+
+exit:
+    return;
+}
+
+void PskcCache::Clear(void)
+{
+    mIndex.clear();
+    mEntries.clear();
+}
+
+AsyncPskcComputer::AsyncPskcComputer(TaskRunner &aTaskRunner, size_t aCacheCapacity)
+    : mTaskRunner(aTaskRunner)
+    , mState(std::make_shared<State>(aCacheCapacity))
+    , mStopping(false)
+{
+}
+
+AsyncPskcComputer::~AsyncPskcComputer(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopping = true;
+    }
+
+    mCondVar.notify_one();
+
+    if (mWorker.joinable())
+    {
+        mWorker.join();
+    }
+}
+
+void AsyncPskcComputer::ComputePskc(const PskcParams &aParams, ResultHandler aHandler)
+{
+    PskcValue pskc;
+
+    if (mState->mCache.Find(aParams, pskc))
+    {
+        std::weak_ptr<State> state = mState;
+
+        mTaskRunner.Post([state, pskc, aHandler]() {
+            if (!state.expired())
+            {
+                aHandler(pskc);
+            }
+        });
+        ExitNow();
+    }
+
+    // The worker is started on first use so that processes which never derive a PSKc don't pay for the thread.
+    if (!mWorker.joinable())
+    {
+        mWorker = std::thread(&AsyncPskcComputer::Run, this);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mJobs.push_back(Job{aParams, std::move(aHandler)});
+    }
+
+    mCondVar.notify_one();
+
+exit:
+    return;
+}
+
+void AsyncPskcComputer::Run(void)
+{
+    Pskc pskc;
+
+    while (true)
+    {
+        Job                  job;
+        PskcValue            result;
+        std::weak_ptr<State> state = mState;
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mCondVar.wait(lock, [this]() { return mStopping || !mJobs.empty(); });
+            VerifyOrExit(!mStopping);
+
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+        }
+
+        memcpy(result.m8,
+               pskc.ComputePskc(job.mParams.mExtPanId, job.mParams.mNetworkName.c_str(),
+                                job.mParams.mPassphrase.c_str()),
+               sizeof(result.m8));
+
+        // The cache is only accessed on the mainloop thread, so it is updated by the posted task.
+        mTaskRunner.Post([state, job, result]() {
+            std::shared_ptr<State> lockedState = state.lock();
+
+            if (lockedState != nullptr)
+            {
+                lockedState->mCache.Add(job.mParams, result);
+                job.mHandler(result);
+            }
+        });
+    }
+
+exit:
+    return;
+}
+
 } // namespace Psk
 } // namespace otbr
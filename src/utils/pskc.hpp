@@ -45,8 +45,21 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include <mbedtls/cmac.h>
 
+#include "common/task_runner.hpp"
+
 namespace otbr {
 namespace Psk {
 
@@ -56,6 +69,26 @@ enum
     kPskcStatus_InvalidArgument = 1
 };
 
+/**
+ * This structure represents the inputs of a single PSKc derivation.
+ *
+ */
+struct PskcParams
+{
+    uint8_t     mExtPanId[OT_EXTENDED_PAN_ID_LENGTH];
+    std::string mNetworkName;
+    std::string mPassphrase;
+};
+
+/**
+ * This structure represents a derived PSKc value.
+ *
+ */
+struct PskcValue
+{
+    uint8_t m8[OT_PSKC_LENGTH];
+};
+
 class Pskc
 {
 public:
@@ -71,6 +104,21 @@ public:
      */
     const uint8_t *ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
 
+    /**
+     * This method computes the PSKc of each entry of @p aParams using up to @p aNumThreads threads.
+     *
+     * The derivations are independent, so they are spread over the threads and the results are written in the
+     * order of @p aParams.
+     *
+     * @param[in]  aParams      The list of PSKc inputs.
+     * @param[out] aPskcs       The derived PSKc values.
+     * @param[in]  aNumThreads  The number of threads to use, zero to use one per CPU core.
+     *
+     */
+    static void ComputePskcBatch(const std::vector<PskcParams> &aParams,
+                                 std::vector<PskcValue>        &aPskcs,
+                                 unsigned                       aNumThreads = 0);
+
 private:
     void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
 
@@ -79,6 +127,152 @@ private:
     uint8_t  mPskc[OT_PSKC_LENGTH];
 };
 
+/**
+ * This class implements a least-recently-used cache of derived PSKc values.
+ *
+ * Entries are keyed by the extended PAN ID, the network name and the SHA-256 of the passphrase, so the passphrase
+ * itself is not kept in memory.
+ *
+ */
+class PskcCache
+{
+public:
+    static constexpr size_t kDefaultCapacity = 8; ///< The default number of cached PSKc values.
+
+    /**
+     * The constructor to initialize the cache.
+     *
+     * @param[in] aCapacity  The maximum number of cached values.
+     *
+     */
+    explicit PskcCache(size_t aCapacity = kDefaultCapacity);
+
+    /**
+     * This method looks up a PSKc and marks it as most recently used.
+     *
+     * @param[in]  aParams  The PSKc inputs.
+     * @param[out] aPskc    The cached PSKc value.
+     *
+     * @retval TRUE   The PSKc was found.
+     * @retval FALSE  The PSKc was not found.
+     *
+     */
+    bool Find(const PskcParams &aParams, PskcValue &aPskc);
+
+    /**
+     * This method adds a PSKc, evicting the least recently used entry when the cache is full.
+     *
+     * @param[in] aParams  The PSKc inputs.
+     * @param[in] aPskc    The PSKc value.
+     *
+     */
+    void Add(const PskcParams &aParams, const PskcValue &aPskc);
+
+    /**
+     * This method removes all entries.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of cached entries.
+     *
+     * @returns The number of cached entries.
+     *
+     */
+    size_t GetSize(void) const { return mEntries.size(); }
+
+private:
+    typedef std::pair<std::string, PskcValue> Entry;
+    typedef std::list<Entry>                  EntryList;
+
+    static std::string MakeKey(const PskcParams &aParams);
+
+    size_t                                               mCapacity;
+    EntryList                                            mEntries; // Most recently used first.
+    std::unordered_map<std::string, EntryList::iterator> mIndex;
+};
+
+/**
+ * This class derives PSKc values on a worker thread and delivers the results on the mainloop.
+ *
+ * Requests and results are handled on the mainloop thread; only the derivation itself runs on the worker, so the
+ * 16384 AES-CMAC iterations never block the mainloop. Results are cached, and a cached PSKc is delivered without
+ * running the derivation again.
+ *
+ */
+class AsyncPskcComputer
+{
+public:
+    /**
+     * This function is called on the mainloop with the derived PSKc.
+     *
+     */
+    using ResultHandler = std::function<void(const PskcValue &aPskc)>;
+
+    /**
+     * The constructor to initialize the computer.
+     *
+     * @param[in] aTaskRunner     The task runner of the mainloop the results are posted to.
+     * @param[in] aCacheCapacity  The maximum number of cached PSKc values.
+     *
+     */
+    explicit AsyncPskcComputer(TaskRunner &aTaskRunner, size_t aCacheCapacity = PskcCache::kDefaultCapacity);
+
+    /**
+     * The destructor stops the worker thread. Results of pending requests are dropped.
+     *
+     */
+    ~AsyncPskcComputer(void);
+
+    /**
+     * This method requests the PSKc of @p aParams.
+     *
+     * @p aHandler is always invoked from a task posted to the task runner, never from within this method.
+     *
+     * @param[in] aParams   The PSKc inputs.
+     * @param[in] aHandler  The handler to receive the PSKc.
+     *
+     */
+    void ComputePskc(const PskcParams &aParams, ResultHandler aHandler);
+
+    /**
+     * This method returns the PSKc cache.
+     *
+     * @returns A reference to the PSKc cache.
+     *
+     */
+    PskcCache &GetCache(void) { return mState->mCache; }
+
+private:
+    struct Job
+    {
+        PskcParams    mParams;
+        ResultHandler mHandler;
+    };
+
+    // The state shared with posted tasks, which may outlive this object.
+    struct State
+    {
+        explicit State(size_t aCacheCapacity)
+            : mCache(aCacheCapacity)
+        {
+        }
+
+        PskcCache mCache;
+    };
+
+    void Run(void);
+
+    TaskRunner             &mTaskRunner;
+    std::shared_ptr<State>  mState;
+    std::thread             mWorker;
+    std::mutex              mMutex;
+    std::condition_variable mCondVar;
+    std::deque<Job>         mJobs;
+    bool                    mStopping;
+};
+
 } // namespace Psk
 } // namespace otbr
 
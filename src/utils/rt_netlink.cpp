@@ -0,0 +1,387 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a minimal rtnetlink client to program addresses, routes and policy rules.
+ */
+
+#include "utils/rt_netlink.hpp"
+
+#if __linux__
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <linux/fib_rules.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+
+#include "common/logging.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+namespace Utils {
+
+constexpr uint32_t RtNetlink::kAckTimeoutMs;
+constexpr size_t   RtNetlink::kMaxRequestsPerDatagram;
+
+// The message headers only hold 8-bit table ids, larger ids are given by the table attribute alone.
+static uint8_t ToHeaderTable(uint32_t aTable)
+{
+    return aTable <= UINT8_MAX ? static_cast<uint8_t>(aTable) : static_cast<uint8_t>(RT_TABLE_UNSPEC);
+}
+
+RtNetlink::RtNetlink(void)
+    : mFd(-1)
+    , mSequence(0)
+    , mLastRequestOffset(0)
+{
+}
+
+RtNetlink::~RtNetlink(void)
+{
+    Close();
+}
+
+otbrError RtNetlink::Open(void)
+{
+    otbrError      error   = OTBR_ERROR_NONE;
+    int            enable  = 1;
+    struct timeval timeout = {kAckTimeoutMs / 1000, (kAckTimeoutMs % 1000) * 1000};
+    sockaddr_nl    sa;
+
+    VerifyOrExit(mFd < 0);
+
+    mFd = SocketWithCloseExec(AF_NETLINK, SOCK_DGRAM, NETLINK_ROUTE, kSocketBlock);
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    // Acknowledgements of failed requests don't need to echo the request.
+    if (setsockopt(mFd, SOL_NETLINK, NETLINK_CAP_ACK, &enable, sizeof(enable)) != 0)
+    {
+        otbrLogWarning("Failed to enable NETLINK_CAP_ACK: %s", strerror(errno));
+    }
+
+    VerifyOrExit(setsockopt(mFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&sa, 0, sizeof(sa));
+    sa.nl_family = AF_NETLINK;
+    VerifyOrExit(bind(mFd, reinterpret_cast<sockaddr *>(&sa), sizeof(sa)) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to open rtnetlink socket: %s", strerror(errno));
+        Close();
+    }
+    return error;
+}
+
+void RtNetlink::Close(void)
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+
+    mBuffer.clear();
+    mRequests.clear();
+}
+
+void RtNetlink::AddAddress(const Address &aAddress)
+{
+    AppendAddress(RTM_NEWADDR, NLM_F_CREATE | NLM_F_EXCL, aAddress);
+}
+
+void RtNetlink::DeleteAddress(const Address &aAddress)
+{
+    AppendAddress(RTM_DELADDR, 0, aAddress);
+}
+
+void RtNetlink::AddRoute(const Route &aRoute)
+{
+    AppendRoute(RTM_NEWROUTE, NLM_F_CREATE | NLM_F_REPLACE, aRoute);
+}
+
+void RtNetlink::DeleteRoute(const Route &aRoute)
+{
+    AppendRoute(RTM_DELROUTE, 0, aRoute);
+}
+
+void RtNetlink::AddRule(const Rule &aRule)
+{
+    // Without `NLM_F_EXCL` the kernel adds a duplicate of an existing rule.
+    AppendRule(RTM_NEWRULE, NLM_F_CREATE | NLM_F_EXCL, aRule);
+}
+
+void RtNetlink::DeleteRule(const Rule &aRule)
+{
+    AppendRule(RTM_DELRULE, 0, aRule);
+}
+
+void RtNetlink::AppendRequest(uint16_t aType, uint16_t aFlags, const void *aHeader, size_t aHeaderLength)
+{
+    nlmsghdr header;
+
+    memset(&header, 0, sizeof(header));
+    header.nlmsg_len   = NLMSG_LENGTH(aHeaderLength);
+    header.nlmsg_type  = aType;
+    header.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | aFlags;
+    header.nlmsg_seq   = ++mSequence;
+
+    mLastRequestOffset = mBuffer.size();
+    mBuffer.resize(mLastRequestOffset + NLMSG_SPACE(aHeaderLength), 0);
+    memcpy(&mBuffer[mLastRequestOffset], &header, sizeof(header));
+    memcpy(&mBuffer[mLastRequestOffset + NLMSG_HDRLEN], aHeader, aHeaderLength);
+
+    mRequests.push_back({mLastRequestOffset, header.nlmsg_seq, aType, false});
+}
+
+void RtNetlink::AppendAttribute(uint16_t aType, const void *aData, size_t aLength)
+{
+    rtattr    attribute;
+    size_t    offset = mBuffer.size();
+    nlmsghdr *header;
+
+    attribute.rta_type = aType;
+    attribute.rta_len  = static_cast<unsigned short>(RTA_LENGTH(aLength));
+
+    mBuffer.resize(offset + RTA_SPACE(aLength), 0);
+    memcpy(&mBuffer[offset], &attribute, sizeof(attribute));
+    memcpy(&mBuffer[offset + RTA_LENGTH(0)], aData, aLength);
+
+    // The request is the last one of the buffer, its length covers everything appended after its header.
+    header            = reinterpret_cast<nlmsghdr *>(&mBuffer[mLastRequestOffset]);
+    header->nlmsg_len = static_cast<uint32_t>(mBuffer.size() - mLastRequestOffset);
+}
+
+void RtNetlink::AppendAddress(uint16_t aType, uint16_t aFlags, const Address &aAddress)
+{
+    ifaddrmsg ifa;
+
+    memset(&ifa, 0, sizeof(ifa));
+    ifa.ifa_family    = AF_INET6;
+    ifa.ifa_prefixlen = aAddress.mPrefixLength;
+    ifa.ifa_flags     = IFA_F_NODAD;
+    ifa.ifa_scope     = aAddress.mScope;
+    ifa.ifa_index     = aAddress.mIfIndex;
+
+    AppendRequest(aType, aFlags, &ifa, sizeof(ifa));
+    AppendAttribute(IFA_LOCAL, aAddress.mAddress.m8, sizeof(aAddress.mAddress.m8));
+
+    if (aAddress.mDeprecated)
+    {
+        ifa_cacheinfo cacheinfo;
+
+        memset(&cacheinfo, 0, sizeof(cacheinfo));
+        cacheinfo.ifa_valid = UINT32_MAX;
+
+        AppendAttribute(IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
+    }
+}
+
+void RtNetlink::AppendRoute(uint16_t aType, uint16_t aFlags, const Route &aRoute)
+{
+    rtmsg rtm;
+
+    memset(&rtm, 0, sizeof(rtm));
+    rtm.rtm_family   = AF_INET6;
+    rtm.rtm_dst_len  = aRoute.mPrefix.mLength;
+    rtm.rtm_table    = ToHeaderTable(aRoute.mTable);
+    rtm.rtm_protocol = RTPROT_STATIC;
+    rtm.rtm_scope    = aType == RTM_NEWROUTE ? RT_SCOPE_UNIVERSE : RT_SCOPE_NOWHERE;
+    rtm.rtm_type     = aType == RTM_NEWROUTE ? RTN_UNICAST : RTN_UNSPEC;
+
+    AppendRequest(aType, aFlags, &rtm, sizeof(rtm));
+    AppendAttribute(RTA_DST, aRoute.mPrefix.mPrefix.m8, sizeof(aRoute.mPrefix.mPrefix.m8));
+    AppendAttribute(RTA_OIF, &aRoute.mIfIndex, sizeof(aRoute.mIfIndex));
+    AppendAttribute(RTA_TABLE, &aRoute.mTable, sizeof(aRoute.mTable));
+
+    if (aRoute.mMetric != 0)
+    {
+        AppendAttribute(RTA_PRIORITY, &aRoute.mMetric, sizeof(aRoute.mMetric));
+    }
+}
+
+void RtNetlink::AppendRule(uint16_t aType, uint16_t aFlags, const Rule &aRule)
+{
+    fib_rule_hdr frh;
+
+    memset(&frh, 0, sizeof(frh));
+    frh.family = AF_INET6;
+    frh.table  = ToHeaderTable(aRule.mTable);
+    frh.action = FR_ACT_TO_TBL;
+
+    AppendRequest(aType, aFlags, &frh, sizeof(frh));
+    AppendAttribute(FRA_IIFNAME, aRule.mIifName.c_str(), aRule.mIifName.size() + 1);
+    AppendAttribute(FRA_TABLE, &aRule.mTable, sizeof(aRule.mTable));
+    if (aRule.mPriority != 0)
+    {
+        AppendAttribute(FRA_PRIORITY, &aRule.mPriority, sizeof(aRule.mPriority));
+    }
+}
+
+otbrError RtNetlink::Commit(void)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       firstErrno = 0;
+
+    VerifyOrExit(!mRequests.empty());
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_INVALID_STATE);
+
+    for (size_t begin = 0; begin < mRequests.size(); begin += kMaxRequestsPerDatagram)
+    {
+        size_t end = std::min(begin + kMaxRequestsPerDatagram, mRequests.size());
+
+        // The remaining requests are still sent after a failure, the first failure is reported.
+        if (SendRequests(begin, end) != OTBR_ERROR_NONE && firstErrno == 0)
+        {
+            firstErrno = errno;
+        }
+    }
+
+    if (firstErrno != 0)
+    {
+        errno = firstErrno;
+        error = OTBR_ERROR_ERRNO;
+    }
+
+exit:
+    mBuffer.clear();
+    mRequests.clear();
+    return error;
+}
+
+otbrError RtNetlink::SendRequests(size_t aBegin, size_t aEnd)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    size_t    offset = mRequests[aBegin].mOffset;
+    size_t    length = (aEnd < mRequests.size() ? mRequests[aEnd].mOffset : mBuffer.size()) - offset;
+
+    // The kernel processes every request of the datagram in order and acknowledges each of them.
+    VerifyOrExit(send(mFd, &mBuffer[offset], length, 0) == static_cast<ssize_t>(length), error = OTBR_ERROR_ERRNO);
+
+    error = ReceiveAcks(aBegin, aEnd);
+
+exit:
+    return error;
+}
+
+otbrError RtNetlink::ReceiveAcks(size_t aBegin, size_t aEnd)
+{
+    otbrError error       = OTBR_ERROR_NONE;
+    int       firstErrno  = 0;
+    size_t    numUnacked  = aEnd - aBegin;
+    uint32_t  firstSeqNum = mRequests[aBegin].mSequence;
+    char      buffer[4096];
+
+    while (numUnacked > 0)
+    {
+        ssize_t received = recv(mFd, buffer, sizeof(buffer), 0);
+        int     length;
+
+        VerifyOrExit(received > 0, error = OTBR_ERROR_ERRNO);
+        length = static_cast<int>(received);
+
+        for (nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, length);
+             header = NLMSG_NEXT(header, length))
+        {
+            const nlmsgerr *ack;
+            Request        *request;
+
+            // Acknowledgements of earlier batches which timed out are skipped.
+            if (header->nlmsg_type != NLMSG_ERROR || header->nlmsg_seq - firstSeqNum >= aEnd - aBegin)
+            {
+                continue;
+            }
+
+            ack     = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(header));
+            request = &mRequests[aBegin + (header->nlmsg_seq - firstSeqNum)];
+
+            if (request->mAcked)
+            {
+                continue;
+            }
+
+            request->mAcked = true;
+            numUnacked--;
+
+            if (ack->error != 0 && !IsExpectedError(request->mType, -ack->error))
+            {
+                otbrLogWarning("Netlink request#%u of type %u failed: %s", request->mSequence, request->mType,
+                               strerror(-ack->error));
+                firstErrno = (firstErrno == 0) ? -ack->error : firstErrno;
+            }
+        }
+    }
+
+    if (firstErrno != 0)
+    {
+        errno = firstErrno;
+        error = OTBR_ERROR_ERRNO;
+    }
+
+exit:
+    return error;
+}
+
+bool RtNetlink::IsExpectedError(uint16_t aType, int aErrorNumber)
+{
+    bool expected = false;
+
+    switch (aType)
+    {
+    case RTM_NEWADDR:
+    case RTM_NEWROUTE:
+    case RTM_NEWRULE:
+        expected = (aErrorNumber == EEXIST);
+        break;
+    case RTM_DELADDR:
+        expected = (aErrorNumber == EADDRNOTAVAIL);
+        break;
+    case RTM_DELROUTE:
+    case RTM_DELRULE:
+        expected = (aErrorNumber == ESRCH || aErrorNumber == ENOENT);
+        break;
+    default:
+        break;
+    }
+
+    return expected;
+}
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // __linux__
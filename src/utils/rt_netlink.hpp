@@ -0,0 +1,225 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a minimal rtnetlink client to program addresses, routes and policy rules.
+ */
+
+#ifndef OTBR_UTILS_RT_NETLINK_HPP_
+#define OTBR_UTILS_RT_NETLINK_HPP_
+
+#include "openthread-br/config.h"
+
+#if __linux__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Utils {
+
+/**
+ * This class implements a minimal rtnetlink client to program IPv6 addresses, routes and policy rules.
+ *
+ * Requests are queued and sent to the kernel in batches by `Commit()`, which waits for the acknowledgement of each
+ * request. Adding an entry which already exists or deleting an entry which doesn't exist is not an error, so
+ * requests can be repeated safely. A routing table exists as long as it holds a route, so tables are managed through
+ * the routes and rules which refer to them.
+ *
+ */
+class RtNetlink : private NonCopyable
+{
+public:
+    /**
+     * This structure represents an IPv6 address assigned to a network interface.
+     *
+     */
+    struct Address
+    {
+        Ip6Address mAddress;      ///< The address.
+        uint8_t    mPrefixLength; ///< The prefix length of the on-link prefix.
+        uint8_t    mScope;        ///< The address scope, e.g. `RT_SCOPE_UNIVERSE`.
+        uint32_t   mIfIndex;      ///< The index of the network interface.
+        bool       mDeprecated;   ///< Whether the address is valid forever but never preferred.
+    };
+
+    /**
+     * This structure represents an IPv6 unicast route.
+     *
+     */
+    struct Route
+    {
+        Ip6Prefix mPrefix;  ///< The destination prefix.
+        uint32_t  mIfIndex; ///< The index of the output interface.
+        uint32_t  mTable;   ///< The routing table, e.g. `RT_TABLE_MAIN`.
+        uint32_t  mMetric;  ///< The route metric, zero for the kernel default.
+    };
+
+    /**
+     * This structure represents an IPv6 policy rule looking up a routing table.
+     *
+     */
+    struct Rule
+    {
+        std::string mIifName;  ///< The input interface the rule applies to.
+        uint32_t    mTable;    ///< The routing table to look up.
+        uint32_t    mPriority; ///< The rule priority, must be non-zero for re-adding to be detected as a duplicate.
+    };
+
+    /**
+     * This constructor initializes the client.
+     *
+     */
+    RtNetlink(void);
+
+    /**
+     * This destructor closes the netlink socket.
+     *
+     */
+    ~RtNetlink(void);
+
+    /**
+     * This method opens the netlink socket.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully opened the socket, or it was already open.
+     * @retval OTBR_ERROR_ERRNO  Failed to open the socket.
+     *
+     */
+    otbrError Open(void);
+
+    /**
+     * This method closes the netlink socket and drops queued requests.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method queues a request to add an address without duplicate address detection.
+     *
+     * @param[in] aAddress  The address to add.
+     *
+     */
+    void AddAddress(const Address &aAddress);
+
+    /**
+     * This method queues a request to delete an address.
+     *
+     * @param[in] aAddress  The address to delete.
+     *
+     */
+    void DeleteAddress(const Address &aAddress);
+
+    /**
+     * This method queues a request to add a route, replacing an existing route with the same key.
+     *
+     * @param[in] aRoute  The route to add.
+     *
+     */
+    void AddRoute(const Route &aRoute);
+
+    /**
+     * This method queues a request to delete a route.
+     *
+     * @param[in] aRoute  The route to delete.
+     *
+     */
+    void DeleteRoute(const Route &aRoute);
+
+    /**
+     * This method queues a request to add a policy rule.
+     *
+     * @param[in] aRule  The rule to add.
+     *
+     */
+    void AddRule(const Rule &aRule);
+
+    /**
+     * This method queues a request to delete a policy rule.
+     *
+     * @param[in] aRule  The rule to delete.
+     *
+     */
+    void DeleteRule(const Rule &aRule);
+
+    /**
+     * This method sends the queued requests and waits for their acknowledgements.
+     *
+     * Requests are packed into as few datagrams as the socket buffers allow. All requests are processed by the
+     * kernel, even if some of them fail.
+     *
+     * @retval OTBR_ERROR_NONE           All requests succeeded.
+     * @retval OTBR_ERROR_INVALID_STATE  The socket is not open.
+     * @retval OTBR_ERROR_ERRNO          Failed to send the requests or to receive their acknowledgements, or a
+     *                                   request failed. `errno` is set to the first failure.
+     *
+     */
+    otbrError Commit(void);
+
+private:
+    static constexpr uint32_t kAckTimeoutMs = 1000;
+
+    // Every acknowledgement is queued as its own buffer on the receive side, so a datagram carries a bounded number of
+    // requests to keep the acknowledgements from overflowing the default socket receive buffer.
+    static constexpr size_t kMaxRequestsPerDatagram = 64;
+
+    struct Request
+    {
+        size_t   mOffset;
+        uint32_t mSequence;
+        uint16_t mType;
+        bool     mAcked;
+    };
+
+    void        AppendRequest(uint16_t aType, uint16_t aFlags, const void *aHeader, size_t aHeaderLength);
+    void        AppendAttribute(uint16_t aType, const void *aData, size_t aLength);
+    void        AppendAddress(uint16_t aType, uint16_t aFlags, const Address &aAddress);
+    void        AppendRoute(uint16_t aType, uint16_t aFlags, const Route &aRoute);
+    void        AppendRule(uint16_t aType, uint16_t aFlags, const Rule &aRule);
+    otbrError   SendRequests(size_t aBegin, size_t aEnd);
+    otbrError   ReceiveAcks(size_t aBegin, size_t aEnd);
+    static bool IsExpectedError(uint16_t aType, int aErrorNumber);
+
+    int                  mFd;
+    uint32_t             mSequence;
+    size_t               mLastRequestOffset;
+    std::vector<uint8_t> mBuffer;
+    std::vector<Request> mRequests;
+};
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // __linux__
+#endif // OTBR_UTILS_RT_NETLINK_HPP_
@@ -226,6 +226,15 @@ void CopyMdnsResponseCounters(const MdnsResponseCounters &from, threadnetwork::T
     to->set_invalid_state_count(from.mInvalidState);
 }
 
+void CopyMdnsLatencyPercentiles(const LatencyPercentiles &from, threadnetwork::TelemetryData_MdnsLatencyPercentiles *to)
+{
+    to->set_count(from.mCount);
+    to->set_p50_ms(from.mP50);
+    to->set_p90_ms(from.mP90);
+    to->set_p99_ms(from.mP99);
+    to->set_max_ms(from.mMax);
+}
+
 #if OTBR_ENABLE_BORDER_AGENT
 threadnetwork::TelemetryData_BorderAgentState BorderAgentStateFromOtBorderAgentState(
     otBorderAgentState aBorderAgentState)
@@ -1563,7 +1572,8 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
         if (aPublisher != nullptr)
         {
             auto                     mdns     = wpanBorderRouter->mutable_mdns();
-            const MdnsTelemetryInfo &mdnsInfo = aPublisher->GetMdnsTelemetryInfo();
+            const MdnsTelemetryInfo      &mdnsInfo = aPublisher->GetMdnsTelemetryInfo();
+            const MdnsLatencyPercentiles &latency  = mdnsInfo.mLatencyPercentiles;
 
             CopyMdnsResponseCounters(mdnsInfo.mHostRegistrations, mdns->mutable_host_registration_responses());
             CopyMdnsResponseCounters(mdnsInfo.mServiceRegistrations, mdns->mutable_service_registration_responses());
@@ -1574,6 +1584,12 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
             mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
             mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
             mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
+
+            CopyMdnsLatencyPercentiles(latency.mHostRegistration, mdns->mutable_host_registration_latency());
+            CopyMdnsLatencyPercentiles(latency.mKeyRegistration, mdns->mutable_key_registration_latency());
+            CopyMdnsLatencyPercentiles(latency.mServiceRegistration, mdns->mutable_service_registration_latency());
+            CopyMdnsLatencyPercentiles(latency.mHostResolution, mdns->mutable_host_resolution_latency());
+            CopyMdnsLatencyPercentiles(latency.mServiceResolution, mdns->mutable_service_resolution_latency());
         }
         // End of MdnsInfo section.
 
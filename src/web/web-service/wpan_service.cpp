@@ -37,8 +37,11 @@
 
 #include <sstream>
 
+#include <errno.h>
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/select.h>
 #include <unistd.h>
 
 #include "common/byteswap.hpp"
@@ -187,9 +190,9 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     Json::FastWriter            jsonWriter;
     Json::Reader                reader;
     std::string                 response;
-    otbr::Psk::Pskc             psk;
+    otbr::Psk::PskcParams       pskcParams;
+    otbr::Psk::PskcValue        pskc;
     char                        pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
-    uint8_t                     extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
     std::string                 networkKey;
     std::string                 prefix;
     uint16_t                    channel;
@@ -215,9 +218,11 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
                  ret = kWpanStatus_ParseRequestFailed);
     defaultRoute = root["defaultRoute"].asBool();
 
-    otbr::Utils::Hex2Bytes(root["extPanId"].asString().c_str(), extPanIdBytes, OT_EXTENDED_PANID_LENGTH);
-    otbr::Utils::Bytes2Hex(psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str()), OT_PSKC_MAX_LENGTH,
-                           pskcStr);
+    otbr::Utils::Hex2Bytes(root["extPanId"].asString().c_str(), pskcParams.mExtPanId, sizeof(pskcParams.mExtPanId));
+    pskcParams.mNetworkName = networkName;
+    pskcParams.mPassphrase  = passphrase;
+    computePskc(pskcParams, pskc);
+    otbr::Utils::Bytes2Hex(pskc.m8, sizeof(pskc.m8), pskcStr);
 
     if (prefix.find('/') == std::string::npos)
     {
@@ -592,6 +597,40 @@ exit:
     return response;
 }
 
+void WpanService::computePskc(const otbr::Psk::PskcParams &aParams, otbr::Psk::PskcValue &aPskc)
+{
+    bool done = false;
+
+    mPskcComputer.ComputePskc(aParams, [&done, &aPskc](const otbr::Psk::PskcValue &aResult) {
+        aPskc = aResult;
+        done  = true;
+    });
+
+    // otbr-web has no mainloop, so the task runner is driven here until the
+    // worker thread posts the PSKc back. Cached values are posted at once.
+    while (!done)
+    {
+        MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {1, 0};
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        mTaskRunner.Update(mainloop);
+
+        if (select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                   &mainloop.mTimeout) < 0)
+        {
+            VerifyOrDie(errno == EINTR, strerror(errno));
+            continue;
+        }
+
+        mTaskRunner.Process(mainloop);
+    }
+}
+
 int WpanService::joinActiveDataset(otbr::Web::OpenThreadClient &aClient,
                                    const std::string           &aNetworkKey,
                                    uint16_t                     aChannel,
@@ -46,6 +46,7 @@
 #include <json/writer.h>
 
 #include "common/logging.hpp"
+#include "common/task_runner.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
 #include "web/web-service/ot_client.hpp"
@@ -73,6 +74,15 @@ namespace Web {
 class WpanService
 {
 public:
+    /**
+     * The constructor to initialize the WPAN service.
+     *
+     */
+    WpanService(void)
+        : mPskcComputer(mTaskRunner)
+    {
+    }
+
     /**
      * This method handles http request to get information to generate QR code.
      *
@@ -194,12 +204,15 @@ private:
                                          uint16_t                     aChannel,
                                          uint16_t                     aPanId);
     static std::string escapeOtCliEscapable(const std::string &aArg);
-
-    WpanNetworkInfo mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
-    int             mNetworksCount;
-    char            mIfName[IFNAMSIZ];
-    std::string     mNetworkName;
-    std::string     mExtPanId;
+    void               computePskc(const otbr::Psk::PskcParams &aParams, otbr::Psk::PskcValue &aPskc);
+
+    WpanNetworkInfo              mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
+    int                          mNetworksCount;
+    char                         mIfName[IFNAMSIZ];
+    std::string                  mNetworkName;
+    std::string                  mExtPanId;
+    otbr::TaskRunner             mTaskRunner;
+    otbr::Psk::AsyncPskcComputer mPskcComputer; // Caches the PSKc of recently formed networks.
 
     enum
     {
@@ -198,6 +198,15 @@ void CheckTrelInfo(ThreadApiDBus *aApi)
     TEST_ASSERT(trelInfo.mTrelCounters.mRxPackets == 0);
     TEST_ASSERT(trelInfo.mTrelCounters.mRxBytes == 0);
 #endif
+
+#if OTBR_ENABLE_TREL_PROBING
+    {
+        std::vector<otbr::DBus::TrelPeerStats> trelPeerStats;
+
+        TEST_ASSERT(aApi->GetTrelPeerStats(trelPeerStats) == OTBR_ERROR_NONE);
+        TEST_ASSERT(trelPeerStats.empty());
+    }
+#endif
 }
 
 void CheckDnssdCounters(ThreadApiDBus *aApi)
@@ -219,12 +228,52 @@ void CheckDnssdCounters(ThreadApiDBus *aApi)
 
 void CheckMdnsInfo(ThreadApiDBus *aApi)
 {
-    otbr::MdnsTelemetryInfo mdnsInfo;
+    otbr::MdnsTelemetryInfo      mdnsInfo;
+    otbr::MdnsLatencyPercentiles percentiles;
 
     TEST_ASSERT(aApi->GetMdnsTelemetryInfo(mdnsInfo) == OTBR_ERROR_NONE);
 
     TEST_ASSERT(mdnsInfo.mServiceRegistrations.mSuccess > 0);
     TEST_ASSERT(mdnsInfo.mServiceRegistrationEmaLatency > 0);
+
+    TEST_ASSERT(aApi->GetMdnsLatencyPercentiles(percentiles) == OTBR_ERROR_NONE);
+
+    TEST_ASSERT(percentiles.mServiceRegistration.mCount > 0);
+    TEST_ASSERT(percentiles.mServiceRegistration.mP50 <= percentiles.mServiceRegistration.mP99);
+    TEST_ASSERT(percentiles.mServiceRegistration.mP99 <= percentiles.mServiceRegistration.mMax);
+}
+
+void CheckAdvertisingProxyCounters(ThreadApiDBus *aApi)
+{
+    OTBR_UNUSED_VARIABLE(aApi);
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    otbr::AdvertisingProxyCounters counters;
+
+    TEST_ASSERT(aApi->GetAdvertisingProxyCounters(counters) == OTBR_ERROR_NONE);
+    TEST_ASSERT(counters.mUpdateLatency.mCount == counters.mCompletedUpdates + counters.mFailedUpdates);
+    TEST_ASSERT(counters.mUpdateLatency.mP50 <= counters.mUpdateLatency.mMax);
+#endif
+}
+
+void CheckNdProxyCounters(ThreadApiDBus *aApi)
+{
+    OTBR_UNUSED_VARIABLE(aApi);
+#if OTBR_ENABLE_DUA_ROUTING
+    otbr::NdProxyCounters counters;
+
+    TEST_ASSERT(aApi->GetNdProxyCounters(counters) == OTBR_ERROR_NONE);
+    TEST_ASSERT(counters.mNsToNaLatency.mCount <= counters.mNaSent);
+    TEST_ASSERT(counters.mNsToNaLatency.mP50 <= counters.mNsToNaLatency.mMax);
+    TEST_ASSERT(counters.mNfQueueFailedVerdicts <= counters.mNfQueueVerdicts);
+#endif
+}
+
+void CheckMeshCopUpdateCounters(ThreadApiDBus *aApi)
+{
+    otbr::MeshCopUpdateCounters counters;
+
+    TEST_ASSERT(aApi->GetMeshCopUpdateCounters(counters) == OTBR_ERROR_NONE);
+    TEST_ASSERT(counters.mIssued > 0);
 }
 
 void CheckNat64(ThreadApiDBus *aApi)
@@ -506,6 +555,9 @@ int main()
                             CheckTrelInfo(api.get());
                             CheckMdnsInfo(api.get());
                             CheckDnssdCounters(api.get());
+                            CheckAdvertisingProxyCounters(api.get());
+                            CheckNdProxyCounters(api.get());
+                            CheckMeshCopUpdateCounters(api.get());
                             CheckNat64(api.get());
                             CheckEphemeralKey(api.get());
 #if OTBR_ENABLE_TELEMETRY_DATA_API
@@ -0,0 +1,1292 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements an in-process fake of the avahi daemon and its client library.
+ */
+
+#include "fake_avahi_client.hpp"
+
+#include <utility>
+
+#include <assert.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+
+using otbr::Clock;
+using otbr::Timepoint;
+using otbr::Mdns::FakeAvahi;
+
+struct AvahiClient
+{
+    struct PendingReply
+    {
+        uint64_t              mTargetSerial;
+        std::function<void()> mHandler;
+    };
+
+    uint64_t                               mSerial;
+    const AvahiPoll                       *mPoll;
+    AvahiWatch                            *mWatch   = nullptr;
+    int                                    mTimerFd = -1;
+    AvahiClientCallback                    mCallback;
+    void                                  *mContext;
+    AvahiClientState                       mState;
+    bool                                   mIsFailureReported = false;
+    int                                    mError             = AVAHI_OK;
+    std::multimap<Timepoint, PendingReply> mPendingReplies;
+    std::list<AvahiEntryGroup *>           mGroups;
+    std::list<AvahiServiceBrowser *>       mServiceBrowsers;
+    std::list<AvahiServiceResolver *>      mServiceResolvers;
+    std::list<AvahiRecordBrowser *>        mRecordBrowsers;
+};
+
+struct AvahiEntryGroup
+{
+    uint64_t                        mSerial;
+    AvahiClient                    *mClient;
+    AvahiEntryGroupCallback         mCallback;
+    void                           *mContext;
+    AvahiEntryGroupState            mState        = AVAHI_ENTRY_GROUP_UNCOMMITED;
+    uint64_t                        mCommitSerial = 0;
+    std::vector<FakeAvahi::Service> mServices;
+    std::vector<FakeAvahi::Record>  mRecords;
+};
+
+struct AvahiServiceBrowser
+{
+    uint64_t                    mSerial;
+    AvahiClient                *mClient;
+    std::string                 mType;
+    AvahiServiceBrowserCallback mCallback;
+    void                       *mContext;
+};
+
+struct AvahiServiceResolver
+{
+    uint64_t                     mSerial;
+    AvahiClient                 *mClient;
+    AvahiServiceResolverCallback mCallback;
+    void                        *mContext;
+};
+
+struct AvahiRecordBrowser
+{
+    uint64_t                   mSerial;
+    AvahiClient               *mClient;
+    std::string                mName;
+    uint16_t                   mType;
+    AvahiRecordBrowserCallback mCallback;
+    void                      *mContext;
+};
+
+namespace otbr {
+
+namespace Mdns {
+
+static constexpr char kHostName[] = "otbr-fake";
+static constexpr char kDomain[]   = "local";
+
+constexpr AvahiIfIndex FakeAvahi::kInterfaceIndex;
+
+int FakeAvahi::sDaemonDepth = 0;
+
+/**
+ * This class marks the code which runs on behalf of the fake daemon.
+ *
+ */
+class FakeAvahi::DaemonScope
+{
+public:
+    DaemonScope(void) { sDaemonDepth++; }
+    ~DaemonScope(void) { sDaemonDepth--; }
+};
+
+/**
+ * This class marks the code which runs on behalf of the client, i.e. the callbacks.
+ *
+ */
+class FakeAvahi::ClientScope
+{
+public:
+    ClientScope(void)
+        : mSavedDepth(sDaemonDepth)
+    {
+        sDaemonDepth = 0;
+    }
+    ~ClientScope(void) { sDaemonDepth = mSavedDepth; }
+
+private:
+    int mSavedDepth;
+};
+
+// The daemon accepts names with or without the trailing dot of the root label.
+static std::string MakeRelativeName(const std::string &aName)
+{
+    return (!aName.empty() && aName.back() == '.') ? aName.substr(0, aName.size() - 1) : aName;
+}
+
+static bool NameEquals(const std::string &aLhs, const std::string &aRhs)
+{
+    return strcasecmp(aLhs.c_str(), aRhs.c_str()) == 0;
+}
+
+// The entries of an `AvahiStringList` are linked in reverse order.
+static std::vector<uint8_t> SerializeTxt(AvahiStringList *aTxt)
+{
+    std::vector<AvahiStringList *> entries;
+    std::vector<uint8_t>           txtData;
+
+    for (AvahiStringList *entry = aTxt; entry != nullptr; entry = avahi_string_list_get_next(entry))
+    {
+        entries.push_back(entry);
+    }
+
+    for (auto iter = entries.rbegin(); iter != entries.rend(); ++iter)
+    {
+        const uint8_t *text = avahi_string_list_get_text(*iter);
+
+        txtData.push_back(static_cast<uint8_t>(avahi_string_list_get_size(*iter)));
+        txtData.insert(txtData.end(), text, text + avahi_string_list_get_size(*iter));
+    }
+
+    // Like avahi, publishes an empty TXT record as a single empty string.
+    if (txtData.empty())
+    {
+        txtData.push_back(0);
+    }
+
+    return txtData;
+}
+
+bool FakeAvahi::CaseInsensitiveLess::operator()(const std::string &aLhs, const std::string &aRhs) const
+{
+    return strcasecmp(aLhs.c_str(), aRhs.c_str()) < 0;
+}
+
+FakeAvahi &FakeAvahi::Get(void)
+{
+    static FakeAvahi sFakeAvahi;
+
+    return sFakeAvahi;
+}
+
+void FakeAvahi::Reset(void)
+{
+    DaemonScope daemonScope;
+
+    assert(mClients.empty());
+
+    mRunning      = true;
+    mLatency      = Milliseconds(0);
+    mFailureCount = 0;
+    mFailureError = AVAHI_OK;
+    mConflictingNames.clear();
+    mServices.clear();
+    mRecords.clear();
+    mStats = Stats();
+}
+
+void FakeAvahi::AddConflictingName(const std::string &aFullName)
+{
+    DaemonScope daemonScope;
+
+    mConflictingNames.insert(MakeRelativeName(aFullName));
+}
+
+void FakeAvahi::FailNextRegistrations(uint32_t aCount, int aError)
+{
+    mFailureCount = aCount;
+    mFailureError = aError;
+}
+
+void FakeAvahi::SetRunning(bool aRunning)
+{
+    DaemonScope daemonScope;
+
+    VerifyOrExit(mRunning != aRunning);
+    mRunning = aRunning;
+
+    if (mRunning)
+    {
+        for (AvahiClient *client : mClients)
+        {
+            Schedule(client, client->mSerial, [client]() {
+                ClientScope clientScope;
+
+                client->mState = AVAHI_CLIENT_S_RUNNING;
+                client->mCallback(client, client->mState, client->mContext);
+            });
+        }
+
+        ExitNow();
+    }
+
+    // All clients get disconnected first, so that withdrawing the
+    // entry groups below schedules no results.
+    for (AvahiClient *client : mClients)
+    {
+        client->mPendingReplies.clear();
+
+        if (client->mState == AVAHI_CLIENT_S_RUNNING)
+        {
+            client->mState = AVAHI_CLIENT_FAILURE;
+            client->mError = AVAHI_ERR_DISCONNECTED;
+        }
+    }
+
+    for (AvahiClient *client : mClients)
+    {
+        for (AvahiEntryGroup *group : client->mGroups)
+        {
+            Withdraw(*group);
+        }
+
+        Rearm(*client);
+    }
+
+exit:
+    return;
+}
+
+void FakeAvahi::AddRemoteService(const std::string          &aInstanceName,
+                                 const std::string          &aType,
+                                 const std::string          &aHostName,
+                                 uint16_t                    aPort,
+                                 const std::vector<uint8_t> &aTxtData)
+{
+    DaemonScope daemonScope;
+    Service     service;
+
+    RemoveRemoteService(aInstanceName, aType);
+
+    service.mInstanceName = aInstanceName;
+    service.mType         = MakeRelativeName(aType);
+    service.mHostName     = aHostName + "." + kDomain;
+    service.mPort         = aPort;
+    service.mTxtData      = aTxtData;
+    service.mOwner        = nullptr;
+    AddService(std::move(service));
+}
+
+void FakeAvahi::RemoveRemoteService(const std::string &aInstanceName, const std::string &aType)
+{
+    DaemonScope          daemonScope;
+    ServiceMap::iterator iter = mServices.find(MakeServiceKey(aInstanceName, MakeRelativeName(aType)));
+
+    if (iter != mServices.end() && iter->second.mOwner == nullptr)
+    {
+        RemoveService(iter);
+    }
+}
+
+void FakeAvahi::AddRemoteHostAddress(const std::string &aHostName, const Ip6Address &aAddress)
+{
+    DaemonScope daemonScope;
+    Record      record;
+
+    record.mName = aHostName + "." + kDomain;
+    record.mType = AVAHI_DNS_TYPE_AAAA;
+    record.mData.assign(aAddress.m8, aAddress.m8 + sizeof(aAddress.m8));
+    record.mIsUnique = true;
+    record.mOwner    = nullptr;
+    AddRecord(std::move(record));
+}
+
+bool FakeAvahi::IsServiceRegistered(const std::string &aInstanceName, const std::string &aType) const
+{
+    ServiceMap::const_iterator iter = mServices.find(MakeServiceKey(aInstanceName, MakeRelativeName(aType)));
+
+    return iter != mServices.end() && iter->second.mOwner != nullptr;
+}
+
+size_t FakeAvahi::GetRecordCount(const std::string &aFullName, uint16_t aType) const
+{
+    size_t count = 0;
+
+    for (const Record &record : mRecords)
+    {
+        if (record.mOwner != nullptr && record.mType == aType && NameEquals(record.mName, MakeRelativeName(aFullName)))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+size_t FakeAvahi::GetServiceCount(void) const
+{
+    size_t count = 0;
+
+    for (const auto &entry : mServices)
+    {
+        if (entry.second.mOwner != nullptr)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+std::string FakeAvahi::MakeServiceKey(const std::string &aInstanceName, const std::string &aType)
+{
+    return aInstanceName + "." + aType + "." + kDomain;
+}
+
+uint64_t FakeAvahi::AllocateSerial(void)
+{
+    uint64_t serial = mNextSerial++;
+
+    mLiveSerials.insert(serial);
+
+    return serial;
+}
+
+bool FakeAvahi::ConsumeFailure(int &aError)
+{
+    bool shouldFail = (mFailureCount > 0);
+
+    if (shouldFail)
+    {
+        mFailureCount--;
+        mStats.mFailures++;
+        aError = mFailureError;
+    }
+
+    return shouldFail;
+}
+
+bool FakeAvahi::HasConflict(const AvahiEntryGroup &aGroup) const
+{
+    bool hasConflict = false;
+
+    for (auto service = aGroup.mServices.begin(); !hasConflict && service != aGroup.mServices.end(); ++service)
+    {
+        std::string                key  = MakeServiceKey(service->mInstanceName, service->mType);
+        ServiceMap::const_iterator iter = mServices.find(key);
+
+        hasConflict = (mConflictingNames.count(key) != 0);
+        hasConflict = hasConflict || (iter != mServices.end() && iter->second.mOwner != &aGroup);
+    }
+
+    // Shared records (e.g. PTR records of sub-types) never conflict.
+    for (auto record = aGroup.mRecords.begin(); !hasConflict && record != aGroup.mRecords.end(); ++record)
+    {
+        if (!record->mIsUnique)
+        {
+            continue;
+        }
+
+        hasConflict = (mConflictingNames.count(record->mName) != 0);
+
+        for (auto iter = mRecords.begin(); !hasConflict && iter != mRecords.end(); ++iter)
+        {
+            hasConflict =
+                (iter->mOwner != &aGroup && iter->mType == record->mType && NameEquals(iter->mName, record->mName));
+        }
+    }
+
+    return hasConflict;
+}
+
+void FakeAvahi::Establish(AvahiEntryGroup &aGroup)
+{
+    for (const Service &service : aGroup.mServices)
+    {
+        AddService(Service(service));
+    }
+
+    for (const Record &record : aGroup.mRecords)
+    {
+        AddRecord(Record(record));
+    }
+}
+
+void FakeAvahi::Withdraw(AvahiEntryGroup &aGroup)
+{
+    for (ServiceMap::iterator iter = mServices.begin(); iter != mServices.end();)
+    {
+        ServiceMap::iterator next = std::next(iter);
+
+        if (iter->second.mOwner == &aGroup)
+        {
+            RemoveService(iter);
+        }
+
+        iter = next;
+    }
+
+    for (RecordList::iterator iter = mRecords.begin(); iter != mRecords.end();)
+    {
+        RecordList::iterator next = std::next(iter);
+
+        if (iter->mOwner == &aGroup)
+        {
+            RemoveRecord(iter);
+        }
+
+        iter = next;
+    }
+}
+
+void FakeAvahi::AddService(Service &&aService)
+{
+    auto result = mServices.emplace(MakeServiceKey(aService.mInstanceName, aService.mType), std::move(aService));
+
+    NotifyServiceBrowsers(result.first->second, /* aIsAdd */ true);
+}
+
+void FakeAvahi::RemoveService(ServiceMap::iterator aIter)
+{
+    Service service = std::move(aIter->second);
+
+    mServices.erase(aIter);
+    NotifyServiceBrowsers(service, /* aIsAdd */ false);
+}
+
+void FakeAvahi::AddRecord(Record &&aRecord)
+{
+    RecordList::iterator iter = mRecords.insert(mRecords.end(), std::move(aRecord));
+
+    NotifyRecordBrowsers(*iter, /* aIsAdd */ true);
+}
+
+void FakeAvahi::RemoveRecord(RecordList::iterator aIter)
+{
+    Record record = std::move(*aIter);
+
+    mRecords.erase(aIter);
+    NotifyRecordBrowsers(record, /* aIsAdd */ false);
+}
+
+void FakeAvahi::NotifyServiceBrowsers(const Service &aService, bool aIsAdd)
+{
+    for (AvahiClient *client : mClients)
+    {
+        for (AvahiServiceBrowser *browser : client->mServiceBrowsers)
+        {
+            if (NameEquals(browser->mType, aService.mType))
+            {
+                ScheduleBrowseResult(browser, aService, aIsAdd);
+            }
+        }
+    }
+}
+
+void FakeAvahi::NotifyRecordBrowsers(const Record &aRecord, bool aIsAdd)
+{
+    for (AvahiClient *client : mClients)
+    {
+        for (AvahiRecordBrowser *browser : client->mRecordBrowsers)
+        {
+            if (browser->mType == aRecord.mType && NameEquals(browser->mName, aRecord.mName))
+            {
+                ScheduleRecordResult(browser, aRecord, aIsAdd);
+            }
+        }
+    }
+}
+
+void FakeAvahi::ScheduleBrowseResult(AvahiServiceBrowser *aBrowser, const Service &aService, bool aIsAdd)
+{
+    std::string instanceName = aService.mInstanceName;
+    std::string type         = aService.mType;
+
+    Schedule(aBrowser->mClient, aBrowser->mSerial, [aBrowser, instanceName, type, aIsAdd]() {
+        ClientScope clientScope;
+
+        aBrowser->mCallback(aBrowser, kInterfaceIndex, AVAHI_PROTO_INET6,
+                            aIsAdd ? AVAHI_BROWSER_NEW : AVAHI_BROWSER_REMOVE, instanceName.c_str(), type.c_str(),
+                            kDomain, AvahiLookupResultFlags{}, aBrowser->mContext);
+    });
+}
+
+void FakeAvahi::ScheduleRecordResult(AvahiRecordBrowser *aBrowser, const Record &aRecord, bool aIsAdd)
+{
+    std::string          name = aRecord.mName;
+    uint16_t             type = aRecord.mType;
+    std::vector<uint8_t> data = aRecord.mData;
+
+    Schedule(aBrowser->mClient, aBrowser->mSerial, [aBrowser, name, type, data, aIsAdd]() {
+        ClientScope clientScope;
+
+        aBrowser->mCallback(aBrowser, kInterfaceIndex, AVAHI_PROTO_INET6,
+                            aIsAdd ? AVAHI_BROWSER_NEW : AVAHI_BROWSER_REMOVE, name.c_str(), AVAHI_DNS_CLASS_IN, type,
+                            data.data(), data.size(), AvahiLookupResultFlags{}, aBrowser->mContext);
+    });
+}
+
+void FakeAvahi::Schedule(AvahiClient *aClient, uint64_t aTargetSerial, std::function<void()> &&aHandler)
+{
+    VerifyOrExit(aClient->mState != AVAHI_CLIENT_FAILURE);
+
+    aClient->mPendingReplies.emplace(Clock::now() + mLatency,
+                                     AvahiClient::PendingReply{aTargetSerial, std::move(aHandler)});
+    Rearm(*aClient);
+
+exit:
+    return;
+}
+
+void FakeAvahi::Rearm(AvahiClient &aClient)
+{
+    struct itimerspec spec;
+
+    memset(&spec, 0, sizeof(spec));
+
+    // A zero `it_value` disarms the timer, so an already due result
+    // arms it with the shortest delay instead.
+    if (aClient.mState == AVAHI_CLIENT_FAILURE)
+    {
+        spec.it_value.tv_nsec = aClient.mIsFailureReported ? 0 : 1;
+    }
+    else if (!aClient.mPendingReplies.empty())
+    {
+        auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(aClient.mPendingReplies.begin()->first -
+                                                                          Clock::now());
+
+        if (delay.count() <= 0)
+        {
+            spec.it_value.tv_nsec = 1;
+        }
+        else
+        {
+            spec.it_value.tv_sec  = static_cast<time_t>(delay.count() / 1000000000);
+            spec.it_value.tv_nsec = static_cast<long>(delay.count() % 1000000000);
+        }
+    }
+
+    timerfd_settime(aClient.mTimerFd, 0, &spec, nullptr);
+}
+
+void FakeAvahi::Process(AvahiClient &aClient)
+{
+    DaemonScope                            daemonScope;
+    std::vector<AvahiClient::PendingReply> dueReplies;
+    uint64_t                               clientSerial = aClient.mSerial;
+    uint64_t                               expirations;
+    Timepoint                              now;
+
+    // Drains the expirations of the non-blocking timer; nothing to do if it hasn't fired.
+    VerifyOrExit(read(aClient.mTimerFd, &expirations, sizeof(expirations)) > 0);
+
+    if (aClient.mState == AVAHI_CLIENT_FAILURE)
+    {
+        ClientScope clientScope;
+
+        VerifyOrExit(!aClient.mIsFailureReported);
+        aClient.mIsFailureReported = true;
+        mStats.mReplies++;
+
+        // The client may be freed by the callback.
+        aClient.mCallback(&aClient, AVAHI_CLIENT_FAILURE, aClient.mContext);
+        ExitNow();
+    }
+
+    now = Clock::now();
+    while (!aClient.mPendingReplies.empty() && aClient.mPendingReplies.begin()->first <= now)
+    {
+        dueReplies.push_back(std::move(aClient.mPendingReplies.begin()->second));
+        aClient.mPendingReplies.erase(aClient.mPendingReplies.begin());
+    }
+    Rearm(aClient);
+
+    // A callback may free any object of the client, including the
+    // client itself, so liveness is checked by serial.
+    for (AvahiClient::PendingReply &reply : dueReplies)
+    {
+        VerifyOrExit(IsAlive(clientSerial));
+
+        if (IsAlive(reply.mTargetSerial))
+        {
+            mStats.mReplies++;
+            reply.mHandler();
+        }
+    }
+
+exit:
+    return;
+}
+
+/**
+ * This class implements the `libavahi-client` API on top of `FakeAvahi`.
+ *
+ */
+class FakeAvahiApi
+{
+public:
+    typedef FakeAvahi::DaemonScope DaemonScope;
+    typedef FakeAvahi::ClientScope ClientScope;
+
+    static AvahiClient *ClientNew(const AvahiPoll    *aPoll,
+                                  AvahiClientFlags    aFlags,
+                                  AvahiClientCallback aCallback,
+                                  void               *aContext,
+                                  int                *aError)
+    {
+        DaemonScope  daemonScope;
+        FakeAvahi   &daemon = FakeAvahi::Get();
+        AvahiClient *client = nullptr;
+        int          error  = AVAHI_OK;
+
+        VerifyOrExit(daemon.mRunning || (aFlags & AVAHI_CLIENT_NO_FAIL), error = AVAHI_ERR_NO_DAEMON);
+
+        client            = new AvahiClient();
+        client->mSerial   = daemon.AllocateSerial();
+        client->mPoll     = aPoll;
+        client->mCallback = aCallback;
+        client->mContext  = aContext;
+        client->mState    = daemon.mRunning ? AVAHI_CLIENT_S_RUNNING : AVAHI_CLIENT_CONNECTING;
+        client->mTimerFd  = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        assert(client->mTimerFd >= 0);
+        client->mWatch = aPoll->watch_new(aPoll, client->mTimerFd, AVAHI_WATCH_IN, HandleWatch, client);
+
+        daemon.mClients.push_back(client);
+
+        // Like libavahi-client, reports the initial state before returning.
+        {
+            ClientScope clientScope;
+
+            client->mCallback(client, client->mState, client->mContext);
+        }
+
+    exit:
+        if (aError != nullptr)
+        {
+            *aError = error;
+        }
+
+        return client;
+    }
+
+    // Like libavahi-client, also frees all the objects of the client.
+    static void ClientFree(AvahiClient *aClient)
+    {
+        DaemonScope daemonScope;
+        FakeAvahi  &daemon = FakeAvahi::Get();
+
+        VerifyOrExit(aClient != nullptr);
+
+        daemon.mClients.remove(aClient);
+
+        while (!aClient->mGroups.empty())
+        {
+            EntryGroupFree(aClient->mGroups.front());
+        }
+
+        while (!aClient->mServiceBrowsers.empty())
+        {
+            ServiceBrowserFree(aClient->mServiceBrowsers.front());
+        }
+
+        while (!aClient->mServiceResolvers.empty())
+        {
+            ServiceResolverFree(aClient->mServiceResolvers.front());
+        }
+
+        while (!aClient->mRecordBrowsers.empty())
+        {
+            RecordBrowserFree(aClient->mRecordBrowsers.front());
+        }
+
+        aClient->mPoll->watch_free(aClient->mWatch);
+        close(aClient->mTimerFd);
+
+        daemon.mLiveSerials.erase(aClient->mSerial);
+        delete aClient;
+
+    exit:
+        return;
+    }
+
+    static const char *ClientGetHostName(AvahiClient *aClient)
+    {
+        OTBR_UNUSED_VARIABLE(aClient);
+
+        return kHostName;
+    }
+
+    static int ClientErrno(AvahiClient *aClient) { return aClient->mError; }
+
+    static AvahiEntryGroup *EntryGroupNew(AvahiClient *aClient, AvahiEntryGroupCallback aCallback, void *aContext)
+    {
+        DaemonScope      daemonScope;
+        AvahiEntryGroup *group = nullptr;
+
+        VerifyOrExit(CheckRunning(aClient) == AVAHI_OK);
+
+        group            = new AvahiEntryGroup();
+        group->mSerial   = FakeAvahi::Get().AllocateSerial();
+        group->mClient   = aClient;
+        group->mCallback = aCallback;
+        group->mContext  = aContext;
+        aClient->mGroups.push_back(group);
+
+    exit:
+        return group;
+    }
+
+    static int EntryGroupFree(AvahiEntryGroup *aGroup)
+    {
+        DaemonScope daemonScope;
+
+        EntryGroupReset(aGroup);
+        aGroup->mClient->mGroups.remove(aGroup);
+        FakeAvahi::Get().mLiveSerials.erase(aGroup->mSerial);
+        delete aGroup;
+
+        return AVAHI_OK;
+    }
+
+    static int EntryGroupReset(AvahiEntryGroup *aGroup)
+    {
+        DaemonScope daemonScope;
+        FakeAvahi  &daemon = FakeAvahi::Get();
+
+        daemon.Withdraw(*aGroup);
+        daemon.mLiveSerials.erase(aGroup->mCommitSerial);
+        aGroup->mCommitSerial = 0;
+        aGroup->mState        = AVAHI_ENTRY_GROUP_UNCOMMITED;
+        aGroup->mServices.clear();
+        aGroup->mRecords.clear();
+
+        return AVAHI_OK;
+    }
+
+    static int EntryGroupCommit(AvahiEntryGroup *aGroup)
+    {
+        DaemonScope daemonScope;
+        FakeAvahi  &daemon  = FakeAvahi::Get();
+        int         failure = AVAHI_OK;
+        bool        shouldFail;
+        int         error;
+
+        SuccessOrExit(error = CheckUncommitted(aGroup));
+        VerifyOrExit(!aGroup->mServices.empty() || !aGroup->mRecords.empty(), error = AVAHI_ERR_IS_EMPTY);
+
+        daemon.mStats.mServiceRegistrations += aGroup->mServices.size();
+        daemon.mStats.mRecordRegistrations += aGroup->mRecords.size();
+        shouldFail = daemon.ConsumeFailure(failure);
+
+        aGroup->mState        = AVAHI_ENTRY_GROUP_REGISTERING;
+        aGroup->mCommitSerial = daemon.AllocateSerial();
+
+        // The names are claimed when the result is due, like after probing.
+        daemon.Schedule(aGroup->mClient, aGroup->mCommitSerial, [aGroup, shouldFail, failure]() {
+            FakeAvahi &fakeAvahi = FakeAvahi::Get();
+
+            if (shouldFail)
+            {
+                aGroup->mClient->mError = failure;
+                aGroup->mState          = AVAHI_ENTRY_GROUP_FAILURE;
+            }
+            else if (fakeAvahi.HasConflict(*aGroup))
+            {
+                fakeAvahi.mStats.mConflicts++;
+                aGroup->mState = AVAHI_ENTRY_GROUP_COLLISION;
+            }
+            else
+            {
+                fakeAvahi.Establish(*aGroup);
+                aGroup->mState = AVAHI_ENTRY_GROUP_ESTABLISHED;
+            }
+
+            {
+                ClientScope clientScope;
+
+                aGroup->mCallback(aGroup, aGroup->mState, aGroup->mContext);
+            }
+        });
+
+    exit:
+        return error;
+    }
+
+    static int EntryGroupAddService(AvahiEntryGroup *aGroup,
+                                    const char      *aName,
+                                    const char      *aType,
+                                    const char      *aHost,
+                                    uint16_t         aPort,
+                                    AvahiStringList *aTxt)
+    {
+        DaemonScope        daemonScope;
+        FakeAvahi::Service service;
+        int                error;
+
+        SuccessOrExit(error = CheckUncommitted(aGroup));
+
+        // An empty host name stands for the host of the daemon.
+        service.mInstanceName = aName;
+        service.mType         = MakeRelativeName(aType);
+        service.mHostName =
+            (aHost != nullptr && aHost[0] != '\0') ? MakeRelativeName(aHost) : std::string(kHostName) + "." + kDomain;
+        service.mPort    = aPort;
+        service.mTxtData = SerializeTxt(aTxt);
+        service.mOwner   = aGroup;
+        aGroup->mServices.push_back(std::move(service));
+
+    exit:
+        return error;
+    }
+
+    static int EntryGroupAddRecord(AvahiEntryGroup   *aGroup,
+                                   AvahiPublishFlags  aFlags,
+                                   const char        *aName,
+                                   uint16_t           aType,
+                                   const void        *aData,
+                                   size_t             aDataLength)
+    {
+        DaemonScope       daemonScope;
+        FakeAvahi::Record record;
+        int               error;
+
+        SuccessOrExit(error = CheckUncommitted(aGroup));
+
+        record.mName = MakeRelativeName(aName);
+        record.mType = aType;
+        record.mData.assign(static_cast<const uint8_t *>(aData), static_cast<const uint8_t *>(aData) + aDataLength);
+        record.mIsUnique = (aFlags & AVAHI_PUBLISH_UNIQUE) != 0;
+        record.mOwner    = aGroup;
+        aGroup->mRecords.push_back(std::move(record));
+
+    exit:
+        return error;
+    }
+
+    static AvahiServiceBrowser *ServiceBrowserNew(AvahiClient                *aClient,
+                                                  const char                 *aType,
+                                                  AvahiServiceBrowserCallback aCallback,
+                                                  void                       *aContext)
+    {
+        DaemonScope          daemonScope;
+        FakeAvahi           &daemon  = FakeAvahi::Get();
+        AvahiServiceBrowser *browser = nullptr;
+
+        VerifyOrExit(CheckRunning(aClient) == AVAHI_OK);
+
+        browser            = new AvahiServiceBrowser();
+        browser->mSerial   = daemon.AllocateSerial();
+        browser->mClient   = aClient;
+        browser->mType     = MakeRelativeName(aType);
+        browser->mCallback = aCallback;
+        browser->mContext  = aContext;
+        aClient->mServiceBrowsers.push_back(browser);
+
+        for (const auto &entry : daemon.mServices)
+        {
+            if (NameEquals(entry.second.mType, browser->mType))
+            {
+                daemon.ScheduleBrowseResult(browser, entry.second, /* aIsAdd */ true);
+            }
+        }
+
+    exit:
+        return browser;
+    }
+
+    static int ServiceBrowserFree(AvahiServiceBrowser *aBrowser)
+    {
+        DaemonScope daemonScope;
+
+        aBrowser->mClient->mServiceBrowsers.remove(aBrowser);
+        FakeAvahi::Get().mLiveSerials.erase(aBrowser->mSerial);
+        delete aBrowser;
+
+        return AVAHI_OK;
+    }
+
+    static AvahiServiceResolver *ServiceResolverNew(AvahiClient                 *aClient,
+                                                    const char                  *aName,
+                                                    const char                  *aType,
+                                                    AvahiLookupFlags             aFlags,
+                                                    AvahiServiceResolverCallback aCallback,
+                                                    void                        *aContext)
+    {
+        DaemonScope           daemonScope;
+        FakeAvahi            &daemon   = FakeAvahi::Get();
+        AvahiServiceResolver *resolver = nullptr;
+        std::string           name(aName);
+        std::string           type = MakeRelativeName(aType);
+
+        VerifyOrExit(CheckRunning(aClient) == AVAHI_OK);
+
+        // Only resolutions without the address are supported, which is
+        // how `PublisherAvahi` resolves services.
+        VerifyOrExit(aFlags & AVAHI_LOOKUP_NO_ADDRESS, aClient->mError = AVAHI_ERR_NOT_SUPPORTED);
+
+        resolver            = new AvahiServiceResolver();
+        resolver->mSerial   = daemon.AllocateSerial();
+        resolver->mClient   = aClient;
+        resolver->mCallback = aCallback;
+        resolver->mContext  = aContext;
+        aClient->mServiceResolvers.push_back(resolver);
+
+        {
+            auto iter = daemon.mServices.find(FakeAvahi::MakeServiceKey(name, type));
+
+            if (iter == daemon.mServices.end())
+            {
+                // Avahi gives up on unknown instances after a timeout.
+                daemon.Schedule(aClient, resolver->mSerial, [resolver, name, type]() {
+                    ClientScope clientScope;
+
+                    resolver->mClient->mError = AVAHI_ERR_TIMEOUT;
+                    resolver->mCallback(resolver, FakeAvahi::kInterfaceIndex, AVAHI_PROTO_INET6,
+                                        AVAHI_RESOLVER_FAILURE, name.c_str(), type.c_str(), kDomain, nullptr, nullptr,
+                                        0, nullptr, AvahiLookupResultFlags{}, resolver->mContext);
+                });
+                ExitNow();
+            }
+
+            std::string          host    = iter->second.mHostName;
+            uint16_t             port    = iter->second.mPort;
+            std::vector<uint8_t> txtData = iter->second.mTxtData;
+
+            daemon.Schedule(aClient, resolver->mSerial, [resolver, name, type, host, port, txtData]() {
+                AvahiStringList *txt = nullptr;
+
+                avahi_string_list_parse(txtData.data(), txtData.size(), &txt);
+
+                {
+                    ClientScope clientScope;
+
+                    resolver->mCallback(resolver, FakeAvahi::kInterfaceIndex, AVAHI_PROTO_INET6,
+                                        AVAHI_RESOLVER_FOUND, name.c_str(), type.c_str(), kDomain, host.c_str(),
+                                        nullptr, port, txt, AvahiLookupResultFlags{}, resolver->mContext);
+                }
+
+                avahi_string_list_free(txt);
+            });
+        }
+
+    exit:
+        return resolver;
+    }
+
+    static int ServiceResolverFree(AvahiServiceResolver *aResolver)
+    {
+        DaemonScope daemonScope;
+
+        aResolver->mClient->mServiceResolvers.remove(aResolver);
+        FakeAvahi::Get().mLiveSerials.erase(aResolver->mSerial);
+        delete aResolver;
+
+        return AVAHI_OK;
+    }
+
+    static AvahiRecordBrowser *RecordBrowserNew(AvahiClient               *aClient,
+                                                const char                *aName,
+                                                uint16_t                   aType,
+                                                AvahiRecordBrowserCallback aCallback,
+                                                void                      *aContext)
+    {
+        DaemonScope         daemonScope;
+        FakeAvahi          &daemon  = FakeAvahi::Get();
+        AvahiRecordBrowser *browser = nullptr;
+
+        VerifyOrExit(CheckRunning(aClient) == AVAHI_OK);
+
+        browser            = new AvahiRecordBrowser();
+        browser->mSerial   = daemon.AllocateSerial();
+        browser->mClient   = aClient;
+        browser->mName     = MakeRelativeName(aName);
+        browser->mType     = aType;
+        browser->mCallback = aCallback;
+        browser->mContext  = aContext;
+        aClient->mRecordBrowsers.push_back(browser);
+
+        for (const FakeAvahi::Record &record : daemon.mRecords)
+        {
+            if (record.mType == aType && NameEquals(record.mName, browser->mName))
+            {
+                daemon.ScheduleRecordResult(browser, record, /* aIsAdd */ true);
+            }
+        }
+
+    exit:
+        return browser;
+    }
+
+    static int RecordBrowserFree(AvahiRecordBrowser *aBrowser)
+    {
+        DaemonScope daemonScope;
+
+        aBrowser->mClient->mRecordBrowsers.remove(aBrowser);
+        FakeAvahi::Get().mLiveSerials.erase(aBrowser->mSerial);
+        delete aBrowser;
+
+        return AVAHI_OK;
+    }
+
+private:
+    static void HandleWatch(AvahiWatch *aWatch, int aFd, AvahiWatchEvent aEvent, void *aContext)
+    {
+        OTBR_UNUSED_VARIABLE(aWatch);
+        OTBR_UNUSED_VARIABLE(aFd);
+        OTBR_UNUSED_VARIABLE(aEvent);
+
+        FakeAvahi::Get().Process(*static_cast<AvahiClient *>(aContext));
+    }
+
+    // Like libavahi-client, records the error of a failed call in the client.
+    static int CheckRunning(AvahiClient *aClient)
+    {
+        int error = AVAHI_OK;
+
+        VerifyOrExit(aClient->mState == AVAHI_CLIENT_S_RUNNING,
+                     error = (aClient->mState == AVAHI_CLIENT_FAILURE) ? AVAHI_ERR_DISCONNECTED : AVAHI_ERR_BAD_STATE);
+
+    exit:
+        if (error != AVAHI_OK)
+        {
+            aClient->mError = error;
+        }
+
+        return error;
+    }
+
+    static int CheckUncommitted(AvahiEntryGroup *aGroup)
+    {
+        int error;
+
+        SuccessOrExit(error = CheckRunning(aGroup->mClient));
+        VerifyOrExit(aGroup->mState == AVAHI_ENTRY_GROUP_UNCOMMITED, error = AVAHI_ERR_BAD_STATE);
+
+    exit:
+        return error;
+    }
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+using otbr::Mdns::FakeAvahiApi;
+
+AvahiClient *avahi_client_new(const AvahiPoll    *aPoll,
+                              AvahiClientFlags    aFlags,
+                              AvahiClientCallback aCallback,
+                              void               *aContext,
+                              int                *aError)
+{
+    return FakeAvahiApi::ClientNew(aPoll, aFlags, aCallback, aContext, aError);
+}
+
+void avahi_client_free(AvahiClient *aClient)
+{
+    FakeAvahiApi::ClientFree(aClient);
+}
+
+const char *avahi_client_get_host_name(AvahiClient *aClient)
+{
+    return FakeAvahiApi::ClientGetHostName(aClient);
+}
+
+int avahi_client_errno(AvahiClient *aClient)
+{
+    return FakeAvahiApi::ClientErrno(aClient);
+}
+
+AvahiEntryGroup *avahi_entry_group_new(AvahiClient *aClient, AvahiEntryGroupCallback aCallback, void *aContext)
+{
+    return FakeAvahiApi::EntryGroupNew(aClient, aCallback, aContext);
+}
+
+int avahi_entry_group_free(AvahiEntryGroup *aGroup)
+{
+    return FakeAvahiApi::EntryGroupFree(aGroup);
+}
+
+int avahi_entry_group_commit(AvahiEntryGroup *aGroup)
+{
+    return FakeAvahiApi::EntryGroupCommit(aGroup);
+}
+
+int avahi_entry_group_reset(AvahiEntryGroup *aGroup)
+{
+    return FakeAvahiApi::EntryGroupReset(aGroup);
+}
+
+AvahiClient *avahi_entry_group_get_client(AvahiEntryGroup *aGroup)
+{
+    return aGroup->mClient;
+}
+
+int avahi_entry_group_add_service_strlst(AvahiEntryGroup  *aGroup,
+                                         AvahiIfIndex      aInterface,
+                                         AvahiProtocol     aProtocol,
+                                         AvahiPublishFlags aFlags,
+                                         const char       *aName,
+                                         const char       *aType,
+                                         const char       *aDomain,
+                                         const char       *aHost,
+                                         uint16_t          aPort,
+                                         AvahiStringList  *aTxt)
+{
+    OTBR_UNUSED_VARIABLE(aInterface);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aDomain);
+
+    return FakeAvahiApi::EntryGroupAddService(aGroup, aName, aType, aHost, aPort, aTxt);
+}
+
+// Sub-types are accepted, but not browsable.
+int avahi_entry_group_add_service_subtype(AvahiEntryGroup  *aGroup,
+                                          AvahiIfIndex      aInterface,
+                                          AvahiProtocol     aProtocol,
+                                          AvahiPublishFlags aFlags,
+                                          const char       *aName,
+                                          const char       *aType,
+                                          const char       *aDomain,
+                                          const char       *aSubType)
+{
+    OTBR_UNUSED_VARIABLE(aInterface);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aSubType);
+
+    return (aGroup->mState == AVAHI_ENTRY_GROUP_UNCOMMITED) ? AVAHI_OK : AVAHI_ERR_BAD_STATE;
+}
+
+// Like avahi, publishes the addresses of a host as unique records.
+int avahi_entry_group_add_address(AvahiEntryGroup    *aGroup,
+                                  AvahiIfIndex        aInterface,
+                                  AvahiProtocol       aProtocol,
+                                  AvahiPublishFlags   aFlags,
+                                  const char         *aName,
+                                  const AvahiAddress *aAddress)
+{
+    bool isIp6 = (aAddress->proto == AVAHI_PROTO_INET6);
+
+    OTBR_UNUSED_VARIABLE(aInterface);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+
+    return FakeAvahiApi::EntryGroupAddRecord(
+        aGroup, static_cast<AvahiPublishFlags>(aFlags | AVAHI_PUBLISH_UNIQUE), aName,
+        isIp6 ? AVAHI_DNS_TYPE_AAAA : AVAHI_DNS_TYPE_A, aAddress->data.data,
+        isIp6 ? sizeof(aAddress->data.ipv6.address) : sizeof(aAddress->data.ipv4.address));
+}
+
+int avahi_entry_group_add_record(AvahiEntryGroup  *aGroup,
+                                 AvahiIfIndex      aInterface,
+                                 AvahiProtocol     aProtocol,
+                                 AvahiPublishFlags aFlags,
+                                 const char       *aName,
+                                 uint16_t          aClass,
+                                 uint16_t          aType,
+                                 uint32_t          aTtl,
+                                 const void       *aData,
+                                 size_t            aDataLength)
+{
+    OTBR_UNUSED_VARIABLE(aInterface);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aClass);
+    OTBR_UNUSED_VARIABLE(aTtl);
+
+    return FakeAvahiApi::EntryGroupAddRecord(aGroup, aFlags, aName, aType, aData, aDataLength);
+}
+
+AvahiServiceBrowser *avahi_service_browser_new(AvahiClient                *aClient,
+                                               AvahiIfIndex                aInterface,
+                                               AvahiProtocol               aProtocol,
+                                               const char                 *aType,
+                                               const char                 *aDomain,
+                                               AvahiLookupFlags            aFlags,
+                                               AvahiServiceBrowserCallback aCallback,
+                                               void                       *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterface);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    return FakeAvahiApi::ServiceBrowserNew(aClient, aType, aCallback, aContext);
+}
+
+int avahi_service_browser_free(AvahiServiceBrowser *aBrowser)
+{
+    return FakeAvahiApi::ServiceBrowserFree(aBrowser);
+}
+
+AvahiServiceResolver *avahi_service_resolver_new(AvahiClient                 *aClient,
+                                                 AvahiIfIndex                 aInterface,
+                                                 AvahiProtocol                aProtocol,
+                                                 const char                  *aName,
+                                                 const char                  *aType,
+                                                 const char                  *aDomain,
+                                                 AvahiProtocol                aAddressProtocol,
+                                                 AvahiLookupFlags             aFlags,
+                                                 AvahiServiceResolverCallback aCallback,
+                                                 void                        *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterface);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aAddressProtocol);
+
+    return FakeAvahiApi::ServiceResolverNew(aClient, aName, aType, aFlags, aCallback, aContext);
+}
+
+int avahi_service_resolver_free(AvahiServiceResolver *aResolver)
+{
+    return FakeAvahiApi::ServiceResolverFree(aResolver);
+}
+
+AvahiRecordBrowser *avahi_record_browser_new(AvahiClient               *aClient,
+                                             AvahiIfIndex               aInterface,
+                                             AvahiProtocol              aProtocol,
+                                             const char                *aName,
+                                             uint16_t                   aClass,
+                                             uint16_t                   aType,
+                                             AvahiLookupFlags           aFlags,
+                                             AvahiRecordBrowserCallback aCallback,
+                                             void                      *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterface);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aClass);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    return FakeAvahiApi::RecordBrowserNew(aClient, aName, aType, aCallback, aContext);
+}
+
+int avahi_record_browser_free(AvahiRecordBrowser *aBrowser)
+{
+    return FakeAvahiApi::RecordBrowserFree(aBrowser);
+}
@@ -0,0 +1,1171 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements an in-process fake of the mDNSResponder daemon and its client library.
+ */
+
+#include "fake_dns_sd.hpp"
+
+#include <utility>
+
+#include <arpa/inet.h>
+#include <assert.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+
+using otbr::Clock;
+using otbr::Timepoint;
+using otbr::Mdns::FakeDnssd;
+
+struct _DNSRecordRef_t
+{
+    uint64_t                        mSerial;
+    DNSServiceRef                   mOwner; // The connection, or the service registration for `DNSServiceAddRecord()`.
+    DNSServiceRegisterRecordReply   mCallback     = nullptr;
+    void                           *mContext      = nullptr;
+    bool                            mIsRegistered = false;
+    FakeDnssd::RecordList::iterator mEntry;
+};
+
+struct _DNSServiceRef_t
+{
+    enum Kind : uint8_t
+    {
+        kConnection,
+        kRegister,
+        kBrowse,
+        kResolve,
+        kGetAddrInfo,
+    };
+
+    struct PendingReply
+    {
+        uint64_t              mTargetSerial;
+        std::function<void()> mHandler;
+    };
+
+    Kind                       mKind;
+    uint64_t                   mSerial;
+    DNSServiceRef              mConnection; // The shared connection, `this` for connections.
+    void                      *mContext             = nullptr;
+    DNSServiceRegisterReply    mRegisterCallback    = nullptr;
+    DNSServiceBrowseReply      mBrowseCallback      = nullptr;
+    DNSServiceResolveReply     mResolveCallback     = nullptr;
+    DNSServiceGetAddrInfoReply mGetAddrInfoCallback = nullptr;
+    std::string                mName;
+    std::string                mType;
+    std::string                mHostTarget;
+    uint16_t                   mPort         = 0;
+    bool                       mIsRegistered = false;
+    std::vector<uint8_t>       mTxtData;
+    std::list<DNSRecordRef>    mRecords;
+
+    // Members of connections.
+    int                                    mTimerFd        = -1;
+    bool                                   mIsDisconnected = false;
+    std::multimap<Timepoint, PendingReply> mPendingReplies;
+    std::list<DNSServiceRef>               mChildren;
+};
+
+namespace otbr {
+
+namespace Mdns {
+
+static constexpr char     kDefaultInstanceName[] = "otbr-fake";
+static constexpr char     kDefaultHostTarget[]   = "otbr-fake.local.";
+static constexpr char     kDomain[]              = "local.";
+static constexpr uint32_t kDefaultTtl            = 120;
+
+constexpr uint32_t FakeDnssd::kInterfaceIndex;
+
+int FakeDnssd::sDaemonDepth = 0;
+
+/**
+ * This class marks the code which runs on behalf of the fake daemon.
+ *
+ */
+class FakeDnssd::DaemonScope
+{
+public:
+    DaemonScope(void) { sDaemonDepth++; }
+    ~DaemonScope(void) { sDaemonDepth--; }
+};
+
+/**
+ * This class marks the code which runs on behalf of the client, i.e. the reply callbacks.
+ *
+ */
+class FakeDnssd::ClientScope
+{
+public:
+    ClientScope(void)
+        : mSavedDepth(sDaemonDepth)
+    {
+        sDaemonDepth = 0;
+    }
+    ~ClientScope(void) { sDaemonDepth = mSavedDepth; }
+
+private:
+    int mSavedDepth;
+};
+
+static std::string NormalizeType(const char *aType)
+{
+    std::string type(aType);
+
+    if (!type.empty() && type.back() == '.')
+    {
+        type.pop_back();
+    }
+
+    return type;
+}
+
+// The daemon accepts names with or without the trailing dot of the root label.
+static std::string MakeAbsoluteName(const std::string &aName)
+{
+    return (!aName.empty() && aName.back() == '.') ? aName : aName + ".";
+}
+
+static bool NameEquals(const std::string &aLhs, const std::string &aRhs)
+{
+    return strcasecmp(aLhs.c_str(), aRhs.c_str()) == 0;
+}
+
+bool FakeDnssd::CaseInsensitiveLess::operator()(const std::string &aLhs, const std::string &aRhs) const
+{
+    return strcasecmp(aLhs.c_str(), aRhs.c_str()) < 0;
+}
+
+FakeDnssd &FakeDnssd::Get(void)
+{
+    static FakeDnssd sFakeDnssd;
+
+    return sFakeDnssd;
+}
+
+void FakeDnssd::Reset(void)
+{
+    DaemonScope daemonScope;
+
+    assert(mConnections.empty());
+
+    mRunning      = true;
+    mLatency      = Milliseconds(0);
+    mFailureCount = 0;
+    mFailureError = kDNSServiceErr_NoError;
+    mConflictingNames.clear();
+    mServices.clear();
+    mRecords.clear();
+    mStats = Stats();
+}
+
+void FakeDnssd::AddConflictingName(const std::string &aFullName)
+{
+    DaemonScope daemonScope;
+
+    mConflictingNames.insert(MakeAbsoluteName(aFullName));
+}
+
+void FakeDnssd::FailNextRegistrations(uint32_t aCount, DNSServiceErrorType aError)
+{
+    mFailureCount = aCount;
+    mFailureError = aError;
+}
+
+void FakeDnssd::SetRunning(bool aRunning)
+{
+    DaemonScope daemonScope;
+
+    VerifyOrExit(mRunning != aRunning);
+    mRunning = aRunning;
+    VerifyOrExit(!mRunning);
+
+    // All clients get disconnected first, so that dropping the
+    // registrations below schedules no replies.
+    for (DNSServiceRef connection : mConnections)
+    {
+        connection->mIsDisconnected = true;
+        connection->mPendingReplies.clear();
+    }
+
+    for (DNSServiceRef connection : mConnections)
+    {
+        Unregister(connection);
+
+        for (DNSServiceRef child : connection->mChildren)
+        {
+            Unregister(child);
+        }
+
+        Rearm(connection);
+    }
+
+exit:
+    return;
+}
+
+void FakeDnssd::AddRemoteService(const std::string          &aInstanceName,
+                                 const std::string          &aType,
+                                 const std::string          &aHostName,
+                                 uint16_t                    aPort,
+                                 const std::vector<uint8_t> &aTxtData)
+{
+    DaemonScope daemonScope;
+    Service     service;
+
+    RemoveRemoteService(aInstanceName, aType);
+
+    service.mInstanceName = aInstanceName;
+    service.mType         = NormalizeType(aType.c_str());
+    service.mHostTarget   = aHostName + "." + kDomain;
+    service.mPort         = aPort;
+    service.mTxtData      = aTxtData;
+    service.mOwner        = nullptr;
+    AddService(std::move(service));
+}
+
+void FakeDnssd::RemoveRemoteService(const std::string &aInstanceName, const std::string &aType)
+{
+    DaemonScope          daemonScope;
+    ServiceMap::iterator iter = mServices.find(MakeServiceKey(aInstanceName, NormalizeType(aType.c_str())));
+
+    if (iter != mServices.end() && iter->second.mOwner == nullptr)
+    {
+        RemoveService(iter);
+    }
+}
+
+void FakeDnssd::AddRemoteHostAddress(const std::string &aHostName, const Ip6Address &aAddress)
+{
+    DaemonScope daemonScope;
+    Record      record;
+
+    record.mName = aHostName + "." + kDomain;
+    record.mType = kDNSServiceType_AAAA;
+    record.mData.assign(aAddress.m8, aAddress.m8 + sizeof(aAddress.m8));
+    record.mTtl      = kDefaultTtl;
+    record.mIsShared = true;
+    record.mOwner    = nullptr;
+    AddRecord(std::move(record));
+}
+
+bool FakeDnssd::IsServiceRegistered(const std::string &aInstanceName, const std::string &aType) const
+{
+    ServiceMap::const_iterator iter = mServices.find(MakeServiceKey(aInstanceName, NormalizeType(aType.c_str())));
+
+    return iter != mServices.end() && iter->second.mOwner != nullptr;
+}
+
+size_t FakeDnssd::GetRecordCount(const std::string &aFullName, uint16_t aType) const
+{
+    size_t count = 0;
+
+    for (const Record &record : mRecords)
+    {
+        if (record.mOwner != nullptr && record.mType == aType && NameEquals(record.mName, MakeAbsoluteName(aFullName)))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+size_t FakeDnssd::GetServiceCount(void) const
+{
+    size_t count = 0;
+
+    for (const auto &entry : mServices)
+    {
+        if (entry.second.mOwner != nullptr)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+std::string FakeDnssd::MakeServiceKey(const std::string &aInstanceName, const std::string &aType)
+{
+    return aInstanceName + "." + aType + "." + kDomain;
+}
+
+uint64_t FakeDnssd::AllocateSerial(void)
+{
+    uint64_t serial = mNextSerial++;
+
+    mLiveSerials.insert(serial);
+
+    return serial;
+}
+
+bool FakeDnssd::ConsumeFailure(DNSServiceErrorType &aError)
+{
+    bool shouldFail = (mFailureCount > 0);
+
+    if (shouldFail)
+    {
+        mFailureCount--;
+        mStats.mFailures++;
+        aError = mFailureError;
+    }
+
+    return shouldFail;
+}
+
+bool FakeDnssd::HasConflict(const Record &aRecord) const
+{
+    bool hasConflict = (mConflictingNames.count(aRecord.mName) != 0);
+
+    for (auto iter = mRecords.begin(); !hasConflict && iter != mRecords.end(); ++iter)
+    {
+        hasConflict = (iter->mOwner != aRecord.mOwner && iter->mType == aRecord.mType &&
+                       NameEquals(iter->mName, aRecord.mName));
+    }
+
+    return hasConflict;
+}
+
+void FakeDnssd::AddService(Service &&aService)
+{
+    auto result = mServices.emplace(MakeServiceKey(aService.mInstanceName, aService.mType), std::move(aService));
+
+    NotifyBrowsers(result.first->second, /* aIsAdd */ true);
+}
+
+void FakeDnssd::RemoveService(ServiceMap::iterator aIter)
+{
+    Service service = std::move(aIter->second);
+
+    mServices.erase(aIter);
+    NotifyBrowsers(service, /* aIsAdd */ false);
+}
+
+FakeDnssd::RecordList::iterator FakeDnssd::AddRecord(Record &&aRecord)
+{
+    RecordList::iterator iter = mRecords.insert(mRecords.end(), std::move(aRecord));
+
+    NotifyAddressQueries(*iter, /* aIsAdd */ true);
+
+    return iter;
+}
+
+void FakeDnssd::RemoveRecord(RecordList::iterator aIter)
+{
+    Record record = std::move(*aIter);
+
+    mRecords.erase(aIter);
+    NotifyAddressQueries(record, /* aIsAdd */ false);
+}
+
+void FakeDnssd::Unregister(DNSServiceRef aServiceRef)
+{
+    if (aServiceRef->mIsRegistered)
+    {
+        aServiceRef->mIsRegistered = false;
+        RemoveService(mServices.find(MakeServiceKey(aServiceRef->mName, aServiceRef->mType)));
+    }
+
+    for (DNSRecordRef recordRef : aServiceRef->mRecords)
+    {
+        if (recordRef->mIsRegistered)
+        {
+            recordRef->mIsRegistered = false;
+            RemoveRecord(recordRef->mEntry);
+        }
+    }
+}
+
+void FakeDnssd::NotifyBrowsers(const Service &aService, bool aIsAdd)
+{
+    for (DNSServiceRef connection : mConnections)
+    {
+        for (DNSServiceRef child : connection->mChildren)
+        {
+            if (child->mKind == _DNSServiceRef_t::kBrowse && NameEquals(child->mType, aService.mType))
+            {
+                ScheduleBrowseReply(child, aService, aIsAdd);
+            }
+        }
+    }
+}
+
+void FakeDnssd::NotifyAddressQueries(const Record &aRecord, bool aIsAdd)
+{
+    VerifyOrExit(aRecord.mType == kDNSServiceType_AAAA);
+
+    for (DNSServiceRef connection : mConnections)
+    {
+        for (DNSServiceRef child : connection->mChildren)
+        {
+            if (child->mKind == _DNSServiceRef_t::kGetAddrInfo && NameEquals(child->mName, aRecord.mName))
+            {
+                ScheduleAddressReply(child, aRecord, aIsAdd);
+            }
+        }
+    }
+
+exit:
+    return;
+}
+
+void FakeDnssd::ScheduleBrowseReply(DNSServiceRef aServiceRef, const Service &aService, bool aIsAdd)
+{
+    std::string instanceName = aService.mInstanceName;
+    std::string type         = aService.mType + ".";
+
+    Schedule(aServiceRef, aServiceRef->mSerial, [aServiceRef, instanceName, type, aIsAdd]() {
+        ClientScope clientScope;
+
+        aServiceRef->mBrowseCallback(aServiceRef, aIsAdd ? kDNSServiceFlagsAdd : 0, kInterfaceIndex,
+                                     kDNSServiceErr_NoError, instanceName.c_str(), type.c_str(), kDomain,
+                                     aServiceRef->mContext);
+    });
+}
+
+void FakeDnssd::ScheduleAddressReply(DNSServiceRef aServiceRef, const Record &aRecord, bool aIsAdd)
+{
+    std::string         hostName = aRecord.mName;
+    uint32_t            ttl      = aRecord.mTtl != 0 ? aRecord.mTtl : kDefaultTtl;
+    struct sockaddr_in6 address;
+
+    memset(&address, 0, sizeof(address));
+    address.sin6_family = AF_INET6;
+    memcpy(&address.sin6_addr, aRecord.mData.data(), std::min(aRecord.mData.size(), sizeof(address.sin6_addr)));
+
+    Schedule(aServiceRef, aServiceRef->mSerial, [aServiceRef, hostName, ttl, address, aIsAdd]() {
+        ClientScope clientScope;
+
+        aServiceRef->mGetAddrInfoCallback(aServiceRef, aIsAdd ? kDNSServiceFlagsAdd : 0, kInterfaceIndex,
+                                          kDNSServiceErr_NoError, hostName.c_str(),
+                                          reinterpret_cast<const struct sockaddr *>(&address), ttl,
+                                          aServiceRef->mContext);
+    });
+}
+
+void FakeDnssd::Schedule(DNSServiceRef aServiceRef, uint64_t aTargetSerial, std::function<void()> &&aHandler)
+{
+    DNSServiceRef connection = aServiceRef->mConnection;
+
+    VerifyOrExit(!connection->mIsDisconnected);
+
+    connection->mPendingReplies.emplace(Clock::now() + mLatency,
+                                        _DNSServiceRef_t::PendingReply{aTargetSerial, std::move(aHandler)});
+    Rearm(connection);
+
+exit:
+    return;
+}
+
+void FakeDnssd::Rearm(DNSServiceRef aConnection)
+{
+    struct itimerspec spec;
+
+    memset(&spec, 0, sizeof(spec));
+
+    // A zero `it_value` disarms the timer, so an already due reply
+    // arms it with the shortest delay instead.
+    if (aConnection->mIsDisconnected)
+    {
+        spec.it_value.tv_nsec = 1;
+    }
+    else if (!aConnection->mPendingReplies.empty())
+    {
+        auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            aConnection->mPendingReplies.begin()->first - Clock::now());
+
+        if (delay.count() <= 0)
+        {
+            spec.it_value.tv_nsec = 1;
+        }
+        else
+        {
+            spec.it_value.tv_sec  = static_cast<time_t>(delay.count() / 1000000000);
+            spec.it_value.tv_nsec = static_cast<long>(delay.count() % 1000000000);
+        }
+    }
+
+    timerfd_settime(aConnection->mTimerFd, 0, &spec, nullptr);
+}
+
+/**
+ * This class implements the `dns_sd.h` client API on top of `FakeDnssd`.
+ *
+ */
+class FakeDnssdApi
+{
+public:
+    typedef FakeDnssd::DaemonScope DaemonScope;
+    typedef FakeDnssd::ClientScope ClientScope;
+
+    static DNSServiceErrorType CreateConnection(DNSServiceRef *aServiceRef)
+    {
+        DaemonScope         daemonScope;
+        FakeDnssd          &daemon = FakeDnssd::Get();
+        DNSServiceRef       connection;
+        DNSServiceErrorType error = kDNSServiceErr_NoError;
+
+        VerifyOrExit(aServiceRef != nullptr, error = kDNSServiceErr_BadParam);
+        VerifyOrExit(daemon.mRunning, error = kDNSServiceErr_ServiceNotRunning);
+
+        connection              = new _DNSServiceRef_t();
+        connection->mKind       = _DNSServiceRef_t::kConnection;
+        connection->mSerial     = daemon.AllocateSerial();
+        connection->mConnection = connection;
+        connection->mTimerFd    = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        assert(connection->mTimerFd >= 0);
+
+        daemon.mConnections.push_back(connection);
+        *aServiceRef = connection;
+
+    exit:
+        return error;
+    }
+
+    static int GetSockFd(DNSServiceRef aServiceRef)
+    {
+        return IsAliveRef(aServiceRef) ? aServiceRef->mConnection->mTimerFd : -1;
+    }
+
+    static DNSServiceErrorType ProcessResult(DNSServiceRef aConnection)
+    {
+        DaemonScope                                daemonScope;
+        FakeDnssd                                 &daemon = FakeDnssd::Get();
+        std::vector<_DNSServiceRef_t::PendingReply> dueReplies;
+        uint64_t                                   connectionSerial;
+        uint64_t                                   expirations;
+        Timepoint                                  now;
+        DNSServiceErrorType                        error = kDNSServiceErr_NoError;
+
+        VerifyOrExit(IsAliveRef(aConnection) && aConnection->mKind == _DNSServiceRef_t::kConnection,
+                     error = kDNSServiceErr_BadReference);
+
+        // Drains the expirations of the non-blocking timer; nothing to do if it hasn't fired.
+        if (read(aConnection->mTimerFd, &expirations, sizeof(expirations)) < 0)
+        {
+            ExitNow();
+        }
+
+        VerifyOrExit(!aConnection->mIsDisconnected, error = kDNSServiceErr_ServiceNotRunning);
+
+        now = Clock::now();
+        while (!aConnection->mPendingReplies.empty() && aConnection->mPendingReplies.begin()->first <= now)
+        {
+            dueReplies.push_back(std::move(aConnection->mPendingReplies.begin()->second));
+            aConnection->mPendingReplies.erase(aConnection->mPendingReplies.begin());
+        }
+        daemon.Rearm(aConnection);
+
+        // A callback may deallocate any `DNSServiceRef` or `DNSRecordRef`,
+        // including the connection itself, so liveness is checked by serial.
+        connectionSerial = aConnection->mSerial;
+        for (_DNSServiceRef_t::PendingReply &reply : dueReplies)
+        {
+            VerifyOrExit(daemon.IsAlive(connectionSerial));
+
+            if (daemon.IsAlive(reply.mTargetSerial))
+            {
+                daemon.mStats.mReplies++;
+                reply.mHandler();
+            }
+        }
+
+    exit:
+        return error;
+    }
+
+    static void Deallocate(DNSServiceRef aServiceRef)
+    {
+        DaemonScope daemonScope;
+        FakeDnssd  &daemon = FakeDnssd::Get();
+
+        VerifyOrExit(IsAliveRef(aServiceRef));
+
+        if (aServiceRef->mKind == _DNSServiceRef_t::kConnection)
+        {
+            while (!aServiceRef->mChildren.empty())
+            {
+                Deallocate(aServiceRef->mChildren.front());
+            }
+
+            close(aServiceRef->mTimerFd);
+            daemon.mConnections.remove(aServiceRef);
+        }
+        else
+        {
+            aServiceRef->mConnection->mChildren.remove(aServiceRef);
+        }
+
+        if (!aServiceRef->mConnection->mIsDisconnected)
+        {
+            daemon.Unregister(aServiceRef);
+        }
+
+        for (DNSRecordRef recordRef : aServiceRef->mRecords)
+        {
+            daemon.mLiveSerials.erase(recordRef->mSerial);
+            delete recordRef;
+        }
+
+        daemon.mLiveSerials.erase(aServiceRef->mSerial);
+        delete aServiceRef;
+
+    exit:
+        return;
+    }
+
+    static DNSServiceErrorType Register(DNSServiceRef          *aServiceRef,
+                                        DNSServiceFlags         aFlags,
+                                        const char             *aName,
+                                        const char             *aRegType,
+                                        const char             *aHost,
+                                        uint16_t                aPort,
+                                        uint16_t                aTxtLen,
+                                        const void             *aTxtRecord,
+                                        DNSServiceRegisterReply aCallback,
+                                        void                   *aContext)
+    {
+        DaemonScope         daemonScope;
+        FakeDnssd          &daemon = FakeDnssd::Get();
+        std::string         regType(aRegType);
+        DNSServiceRef       serviceRef;
+        DNSServiceErrorType failure = kDNSServiceErr_NoError;
+        bool                shouldFail;
+        DNSServiceErrorType error;
+
+        SuccessOrExit(error = NewOperation(aServiceRef, aFlags, _DNSServiceRef_t::kRegister, serviceRef));
+
+        // Sub-types follow the service type in `aRegType`, separated by commas.
+        serviceRef->mName       = (aName != nullptr) ? aName : kDefaultInstanceName;
+        serviceRef->mType       = NormalizeType(regType.substr(0, regType.find(',')).c_str());
+        serviceRef->mHostTarget = (aHost != nullptr) ? MakeAbsoluteName(aHost) : kDefaultHostTarget;
+        serviceRef->mPort       = ntohs(aPort);
+        serviceRef->mTxtData.assign(static_cast<const uint8_t *>(aTxtRecord),
+                                    static_cast<const uint8_t *>(aTxtRecord) + aTxtLen);
+        serviceRef->mRegisterCallback = aCallback;
+        serviceRef->mContext          = aContext;
+
+        daemon.mStats.mServiceRegistrations++;
+        shouldFail = daemon.ConsumeFailure(failure);
+
+        // The name is claimed when the reply is due, like after probing.
+        daemon.Schedule(serviceRef, serviceRef->mSerial, [serviceRef, shouldFail, failure]() {
+            FakeDnssd          &fakeDnssd  = FakeDnssd::Get();
+            std::string         name       = serviceRef->mName;
+            std::string         type       = serviceRef->mType + ".";
+            DNSServiceFlags     flags      = 0;
+            DNSServiceErrorType replyError = failure;
+
+            if (!shouldFail)
+            {
+                std::string key = FakeDnssd::MakeServiceKey(name, serviceRef->mType);
+
+                if (fakeDnssd.mConflictingNames.count(key) != 0 || fakeDnssd.mServices.count(key) != 0)
+                {
+                    fakeDnssd.mStats.mConflicts++;
+                    replyError = kDNSServiceErr_NameConflict;
+                }
+                else
+                {
+                    FakeDnssd::Service service;
+
+                    service.mInstanceName = serviceRef->mName;
+                    service.mType         = serviceRef->mType;
+                    service.mHostTarget   = serviceRef->mHostTarget;
+                    service.mPort         = serviceRef->mPort;
+                    service.mTxtData      = serviceRef->mTxtData;
+                    service.mOwner        = serviceRef;
+
+                    serviceRef->mIsRegistered = true;
+                    fakeDnssd.AddService(std::move(service));
+                    flags      = kDNSServiceFlagsAdd;
+                    replyError = kDNSServiceErr_NoError;
+                }
+            }
+
+            {
+                ClientScope clientScope;
+
+                serviceRef->mRegisterCallback(serviceRef, flags, replyError, name.c_str(), type.c_str(), kDomain,
+                                              serviceRef->mContext);
+            }
+        });
+
+    exit:
+        return error;
+    }
+
+    static DNSServiceErrorType AddRecord(DNSServiceRef   aServiceRef,
+                                         DNSRecordRef   *aRecordRef,
+                                         DNSServiceFlags aFlags,
+                                         uint16_t        aRrType,
+                                         uint16_t        aRdLen,
+                                         const void     *aRdata,
+                                         uint32_t        aTtl)
+    {
+        DaemonScope         daemonScope;
+        FakeDnssd          &daemon = FakeDnssd::Get();
+        FakeDnssd::Record   record;
+        DNSRecordRef        recordRef;
+        DNSServiceErrorType error = kDNSServiceErr_NoError;
+
+        VerifyOrExit(IsAliveRef(aServiceRef) && aServiceRef->mKind == _DNSServiceRef_t::kRegister,
+                     error = kDNSServiceErr_BadReference);
+        VerifyOrExit(!aServiceRef->mConnection->mIsDisconnected, error = kDNSServiceErr_ServiceNotRunning);
+
+        recordRef        = NewRecordRef(aServiceRef);
+        record.mName     = FakeDnssd::MakeServiceKey(aServiceRef->mName, aServiceRef->mType);
+        record.mType     = aRrType;
+        record.mTtl      = aTtl;
+        record.mIsShared = (aFlags & kDNSServiceFlagsShared) != 0;
+        record.mOwner    = recordRef;
+        record.mData.assign(static_cast<const uint8_t *>(aRdata), static_cast<const uint8_t *>(aRdata) + aRdLen);
+
+        // The record belongs to the service registration, so it is added without probing.
+        recordRef->mIsRegistered = true;
+        recordRef->mEntry        = daemon.AddRecord(std::move(record));
+        *aRecordRef              = recordRef;
+
+    exit:
+        return error;
+    }
+
+    static DNSServiceErrorType UpdateRecord(DNSServiceRef aServiceRef,
+                                            DNSRecordRef  aRecordRef,
+                                            uint16_t      aRdLen,
+                                            const void   *aRdata,
+                                            uint32_t      aTtl)
+    {
+        DaemonScope         daemonScope;
+        DNSServiceErrorType error = kDNSServiceErr_NoError;
+
+        VerifyOrExit(IsAliveRecord(aServiceRef, aRecordRef), error = kDNSServiceErr_BadReference);
+        VerifyOrExit(!aServiceRef->mConnection->mIsDisconnected, error = kDNSServiceErr_ServiceNotRunning);
+
+        if (aRecordRef->mIsRegistered)
+        {
+            aRecordRef->mEntry->mData.assign(static_cast<const uint8_t *>(aRdata),
+                                             static_cast<const uint8_t *>(aRdata) + aRdLen);
+            aRecordRef->mEntry->mTtl = aTtl;
+        }
+
+    exit:
+        return error;
+    }
+
+    static DNSServiceErrorType RemoveRecord(DNSServiceRef aServiceRef, DNSRecordRef aRecordRef)
+    {
+        DaemonScope         daemonScope;
+        FakeDnssd          &daemon = FakeDnssd::Get();
+        DNSServiceErrorType error  = kDNSServiceErr_NoError;
+
+        VerifyOrExit(IsAliveRecord(aServiceRef, aRecordRef), error = kDNSServiceErr_BadReference);
+        VerifyOrExit(!aServiceRef->mConnection->mIsDisconnected, error = kDNSServiceErr_ServiceNotRunning);
+
+        if (aRecordRef->mIsRegistered)
+        {
+            daemon.RemoveRecord(aRecordRef->mEntry);
+        }
+
+        aServiceRef->mRecords.remove(aRecordRef);
+        daemon.mLiveSerials.erase(aRecordRef->mSerial);
+        delete aRecordRef;
+
+    exit:
+        return error;
+    }
+
+    static DNSServiceErrorType RegisterRecord(DNSServiceRef                 aConnection,
+                                              DNSRecordRef                 *aRecordRef,
+                                              DNSServiceFlags               aFlags,
+                                              const char                   *aFullName,
+                                              uint16_t                      aRrType,
+                                              uint16_t                      aRdLen,
+                                              const void                   *aRdata,
+                                              uint32_t                      aTtl,
+                                              DNSServiceRegisterRecordReply aCallback,
+                                              void                         *aContext)
+    {
+        DaemonScope         daemonScope;
+        FakeDnssd          &daemon = FakeDnssd::Get();
+        FakeDnssd::Record   record;
+        DNSRecordRef        recordRef;
+        DNSServiceErrorType failure = kDNSServiceErr_NoError;
+        bool                shouldFail;
+        DNSServiceErrorType error = kDNSServiceErr_NoError;
+
+        VerifyOrExit(IsAliveRef(aConnection) && aConnection->mKind == _DNSServiceRef_t::kConnection,
+                     error = kDNSServiceErr_BadReference);
+        VerifyOrExit(!aConnection->mIsDisconnected, error = kDNSServiceErr_ServiceNotRunning);
+
+        recordRef            = NewRecordRef(aConnection);
+        recordRef->mCallback = aCallback;
+        recordRef->mContext  = aContext;
+        record.mName         = MakeAbsoluteName(aFullName);
+        record.mType         = aRrType;
+        record.mTtl          = aTtl;
+        record.mIsShared     = (aFlags & kDNSServiceFlagsShared) != 0;
+        record.mOwner        = recordRef;
+        record.mData.assign(static_cast<const uint8_t *>(aRdata), static_cast<const uint8_t *>(aRdata) + aRdLen);
+
+        daemon.mStats.mRecordRegistrations++;
+        shouldFail = daemon.ConsumeFailure(failure);
+
+        daemon.Schedule(aConnection, recordRef->mSerial, [aConnection, recordRef, record, shouldFail, failure]() {
+            FakeDnssd          &fakeDnssd  = FakeDnssd::Get();
+            DNSServiceErrorType replyError = failure;
+
+            if (!shouldFail)
+            {
+                // Shared records (e.g. the addresses of a host) never conflict.
+                if (!record.mIsShared && fakeDnssd.HasConflict(record))
+                {
+                    fakeDnssd.mStats.mConflicts++;
+                    replyError = kDNSServiceErr_NameConflict;
+                }
+                else
+                {
+                    recordRef->mIsRegistered = true;
+                    recordRef->mEntry        = fakeDnssd.AddRecord(FakeDnssd::Record(record));
+                    replyError               = kDNSServiceErr_NoError;
+                }
+            }
+
+            {
+                ClientScope clientScope;
+
+                recordRef->mCallback(aConnection, recordRef, 0, replyError, recordRef->mContext);
+            }
+        });
+
+        *aRecordRef = recordRef;
+
+    exit:
+        return error;
+    }
+
+    static DNSServiceErrorType Browse(DNSServiceRef        *aServiceRef,
+                                      DNSServiceFlags       aFlags,
+                                      const char           *aRegType,
+                                      DNSServiceBrowseReply aCallback,
+                                      void                 *aContext)
+    {
+        DaemonScope         daemonScope;
+        FakeDnssd          &daemon = FakeDnssd::Get();
+        DNSServiceRef       serviceRef;
+        DNSServiceErrorType error;
+
+        SuccessOrExit(error = NewOperation(aServiceRef, aFlags, _DNSServiceRef_t::kBrowse, serviceRef));
+
+        serviceRef->mType           = NormalizeType(aRegType);
+        serviceRef->mBrowseCallback = aCallback;
+        serviceRef->mContext        = aContext;
+
+        for (const auto &entry : daemon.mServices)
+        {
+            if (NameEquals(entry.second.mType, serviceRef->mType))
+            {
+                daemon.ScheduleBrowseReply(serviceRef, entry.second, /* aIsAdd */ true);
+            }
+        }
+
+    exit:
+        return error;
+    }
+
+    static DNSServiceErrorType Resolve(DNSServiceRef         *aServiceRef,
+                                       DNSServiceFlags        aFlags,
+                                       const char            *aName,
+                                       const char            *aRegType,
+                                       DNSServiceResolveReply aCallback,
+                                       void                  *aContext)
+    {
+        DaemonScope         daemonScope;
+        FakeDnssd          &daemon = FakeDnssd::Get();
+        DNSServiceRef       serviceRef;
+        DNSServiceErrorType error;
+
+        SuccessOrExit(error = NewOperation(aServiceRef, aFlags, _DNSServiceRef_t::kResolve, serviceRef));
+
+        serviceRef->mName            = aName;
+        serviceRef->mType            = NormalizeType(aRegType);
+        serviceRef->mResolveCallback = aCallback;
+        serviceRef->mContext         = aContext;
+
+        {
+            auto iter = daemon.mServices.find(FakeDnssd::MakeServiceKey(serviceRef->mName, serviceRef->mType));
+
+            // Unknown instances are never answered, as the reply of a timed-out resolve is not supported.
+            VerifyOrExit(iter != daemon.mServices.end());
+
+            const FakeDnssd::Service &service  = iter->second;
+            std::string               fullName = FakeDnssd::MakeServiceKey(service.mInstanceName, service.mType);
+            std::string               host     = service.mHostTarget;
+            uint16_t                  port     = htons(service.mPort);
+            std::vector<uint8_t>      txtData  = service.mTxtData;
+
+            daemon.Schedule(serviceRef, serviceRef->mSerial, [serviceRef, fullName, host, port, txtData]() {
+                ClientScope clientScope;
+
+                serviceRef->mResolveCallback(serviceRef, 0, FakeDnssd::kInterfaceIndex, kDNSServiceErr_NoError,
+                                             fullName.c_str(), host.c_str(), port,
+                                             static_cast<uint16_t>(txtData.size()), txtData.data(),
+                                             serviceRef->mContext);
+            });
+        }
+
+    exit:
+        return error;
+    }
+
+    static DNSServiceErrorType GetAddrInfo(DNSServiceRef             *aServiceRef,
+                                           DNSServiceFlags            aFlags,
+                                           const char                *aHostName,
+                                           DNSServiceGetAddrInfoReply aCallback,
+                                           void                      *aContext)
+    {
+        DaemonScope         daemonScope;
+        FakeDnssd          &daemon = FakeDnssd::Get();
+        DNSServiceRef       serviceRef;
+        DNSServiceErrorType error;
+
+        SuccessOrExit(error = NewOperation(aServiceRef, aFlags, _DNSServiceRef_t::kGetAddrInfo, serviceRef));
+
+        serviceRef->mName                = MakeAbsoluteName(aHostName);
+        serviceRef->mGetAddrInfoCallback = aCallback;
+        serviceRef->mContext             = aContext;
+
+        for (const FakeDnssd::Record &record : daemon.mRecords)
+        {
+            if (record.mType == kDNSServiceType_AAAA && NameEquals(record.mName, serviceRef->mName))
+            {
+                daemon.ScheduleAddressReply(serviceRef, record, /* aIsAdd */ true);
+            }
+        }
+
+    exit:
+        return error;
+    }
+
+private:
+    static bool IsAliveRef(DNSServiceRef aServiceRef)
+    {
+        return aServiceRef != nullptr && FakeDnssd::Get().IsAlive(aServiceRef->mSerial);
+    }
+
+    static bool IsAliveRecord(DNSServiceRef aServiceRef, DNSRecordRef aRecordRef)
+    {
+        return IsAliveRef(aServiceRef) && aRecordRef != nullptr && FakeDnssd::Get().IsAlive(aRecordRef->mSerial) &&
+               aRecordRef->mOwner == aServiceRef;
+    }
+
+    // Only operations on a shared connection are supported, which is how
+    // `PublisherMDnsSd` issues all of its requests.
+    static DNSServiceErrorType NewOperation(DNSServiceRef         *aServiceRef,
+                                            DNSServiceFlags        aFlags,
+                                            _DNSServiceRef_t::Kind aKind,
+                                            DNSServiceRef         &aOperation)
+    {
+        DNSServiceRef       connection = (aServiceRef != nullptr) ? *aServiceRef : nullptr;
+        DNSServiceErrorType error      = kDNSServiceErr_NoError;
+
+        VerifyOrExit(aFlags & kDNSServiceFlagsShareConnection, error = kDNSServiceErr_Unsupported);
+        VerifyOrExit(IsAliveRef(connection) && connection->mKind == _DNSServiceRef_t::kConnection,
+                     error = kDNSServiceErr_BadReference);
+        VerifyOrExit(!connection->mIsDisconnected, error = kDNSServiceErr_ServiceNotRunning);
+
+        aOperation              = new _DNSServiceRef_t();
+        aOperation->mKind       = aKind;
+        aOperation->mSerial     = FakeDnssd::Get().AllocateSerial();
+        aOperation->mConnection = connection;
+        connection->mChildren.push_back(aOperation);
+        *aServiceRef = aOperation;
+
+    exit:
+        return error;
+    }
+
+    static DNSRecordRef NewRecordRef(DNSServiceRef aOwner)
+    {
+        DNSRecordRef recordRef = new _DNSRecordRef_t();
+
+        recordRef->mSerial = FakeDnssd::Get().AllocateSerial();
+        recordRef->mOwner  = aOwner;
+        aOwner->mRecords.push_back(recordRef);
+
+        return recordRef;
+    }
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+using otbr::Mdns::FakeDnssdApi;
+
+DNSServiceErrorType DNSServiceCreateConnection(DNSServiceRef *aServiceRef)
+{
+    return FakeDnssdApi::CreateConnection(aServiceRef);
+}
+
+int DNSServiceRefSockFD(DNSServiceRef aServiceRef)
+{
+    return FakeDnssdApi::GetSockFd(aServiceRef);
+}
+
+DNSServiceErrorType DNSServiceProcessResult(DNSServiceRef aServiceRef)
+{
+    return FakeDnssdApi::ProcessResult(aServiceRef);
+}
+
+void DNSServiceRefDeallocate(DNSServiceRef aServiceRef)
+{
+    FakeDnssdApi::Deallocate(aServiceRef);
+}
+
+DNSServiceErrorType DNSServiceRegister(DNSServiceRef          *aServiceRef,
+                                       DNSServiceFlags         aFlags,
+                                       uint32_t                aInterfaceIndex,
+                                       const char             *aName,
+                                       const char             *aRegType,
+                                       const char             *aDomain,
+                                       const char             *aHost,
+                                       uint16_t                aPort,
+                                       uint16_t                aTxtLen,
+                                       const void             *aTxtRecord,
+                                       DNSServiceRegisterReply aCallback,
+                                       void                   *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aDomain);
+
+    return FakeDnssdApi::Register(aServiceRef, aFlags, aName, aRegType, aHost, aPort, aTxtLen, aTxtRecord, aCallback,
+                                  aContext);
+}
+
+DNSServiceErrorType DNSServiceAddRecord(DNSServiceRef   aServiceRef,
+                                        DNSRecordRef   *aRecordRef,
+                                        DNSServiceFlags aFlags,
+                                        uint16_t        aRrType,
+                                        uint16_t        aRdLen,
+                                        const void     *aRdata,
+                                        uint32_t        aTtl)
+{
+    return FakeDnssdApi::AddRecord(aServiceRef, aRecordRef, aFlags, aRrType, aRdLen, aRdata, aTtl);
+}
+
+DNSServiceErrorType DNSServiceUpdateRecord(DNSServiceRef   aServiceRef,
+                                           DNSRecordRef    aRecordRef,
+                                           DNSServiceFlags aFlags,
+                                           uint16_t        aRdLen,
+                                           const void     *aRdata,
+                                           uint32_t        aTtl)
+{
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    return FakeDnssdApi::UpdateRecord(aServiceRef, aRecordRef, aRdLen, aRdata, aTtl);
+}
+
+DNSServiceErrorType DNSServiceRemoveRecord(DNSServiceRef aServiceRef, DNSRecordRef aRecordRef, DNSServiceFlags aFlags)
+{
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    return FakeDnssdApi::RemoveRecord(aServiceRef, aRecordRef);
+}
+
+DNSServiceErrorType DNSServiceRegisterRecord(DNSServiceRef                 aServiceRef,
+                                             DNSRecordRef                 *aRecordRef,
+                                             DNSServiceFlags               aFlags,
+                                             uint32_t                      aInterfaceIndex,
+                                             const char                   *aFullName,
+                                             uint16_t                      aRrType,
+                                             uint16_t                      aRrClass,
+                                             uint16_t                      aRdLen,
+                                             const void                   *aRdata,
+                                             uint32_t                      aTtl,
+                                             DNSServiceRegisterRecordReply aCallback,
+                                             void                         *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aRrClass);
+
+    return FakeDnssdApi::RegisterRecord(aServiceRef, aRecordRef, aFlags, aFullName, aRrType, aRdLen, aRdata, aTtl,
+                                        aCallback, aContext);
+}
+
+DNSServiceErrorType DNSServiceBrowse(DNSServiceRef        *aServiceRef,
+                                     DNSServiceFlags       aFlags,
+                                     uint32_t              aInterfaceIndex,
+                                     const char           *aRegType,
+                                     const char           *aDomain,
+                                     DNSServiceBrowseReply aCallback,
+                                     void                 *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aDomain);
+
+    return FakeDnssdApi::Browse(aServiceRef, aFlags, aRegType, aCallback, aContext);
+}
+
+DNSServiceErrorType DNSServiceResolve(DNSServiceRef         *aServiceRef,
+                                      DNSServiceFlags        aFlags,
+                                      uint32_t               aInterfaceIndex,
+                                      const char            *aName,
+                                      const char            *aRegType,
+                                      const char            *aDomain,
+                                      DNSServiceResolveReply aCallback,
+                                      void                  *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aDomain);
+
+    return FakeDnssdApi::Resolve(aServiceRef, aFlags, aName, aRegType, aCallback, aContext);
+}
+
+DNSServiceErrorType DNSServiceGetAddrInfo(DNSServiceRef             *aServiceRef,
+                                          DNSServiceFlags            aFlags,
+                                          uint32_t                   aInterfaceIndex,
+                                          DNSServiceProtocol         aProtocol,
+                                          const char                *aHostName,
+                                          DNSServiceGetAddrInfoReply aCallback,
+                                          void                      *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+
+    return FakeDnssdApi::GetAddrInfo(aServiceRef, aFlags, aHostName, aCallback, aContext);
+}
@@ -0,0 +1,284 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of an in-process fake of the mDNSResponder daemon.
+ *
+ *   The fake implements the `dns_sd.h` client API used by `PublisherMDnsSd`, so that
+ *   the publisher can be tested and measured without a running mdnsd.
+ */
+
+#ifndef OTBR_TESTS_GTEST_FAKE_DNS_SD_HPP_
+#define OTBR_TESTS_GTEST_FAKE_DNS_SD_HPP_
+
+#include <functional>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <dns_sd.h>
+#include <stdint.h>
+
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements the state of a fake mDNSResponder daemon.
+ *
+ * Replies to client requests are delivered on the shared connection after a
+ * configurable latency, and the daemon can be told to report name conflicts,
+ * fail registrations or stop running.
+ *
+ */
+class FakeDnssd
+{
+public:
+    static constexpr uint32_t kInterfaceIndex = 1; ///< The interface index reported in all replies.
+
+    /**
+     * This structure represents the counters of the fake daemon.
+     *
+     */
+    struct Stats
+    {
+        uint32_t mServiceRegistrations = 0; ///< Number of `DNSServiceRegister()` requests.
+        uint32_t mRecordRegistrations  = 0; ///< Number of `DNSServiceRegisterRecord()` requests.
+        uint32_t mConflicts            = 0; ///< Number of registrations rejected with a name conflict.
+        uint32_t mFailures             = 0; ///< Number of registrations rejected by injected failures.
+        uint32_t mReplies              = 0; ///< Number of replies delivered to clients.
+    };
+
+    /**
+     * This method returns the singleton instance of the fake daemon.
+     *
+     */
+    static FakeDnssd &Get(void);
+
+    /**
+     * This method restores the initial state: running, no latency, no conflicts,
+     * failures or remote records, and cleared counters.
+     *
+     * @note All connections must have been deallocated.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method sets the delay of the replies to subsequent requests.
+     *
+     * @param[in] aLatency  The reply latency.
+     *
+     */
+    void SetLatency(Milliseconds aLatency) { mLatency = aLatency; }
+
+    /**
+     * This method makes the registrations of a unique name fail with a name conflict,
+     * as if another host on the link already owned it.
+     *
+     * @param[in] aFullName  The full name, e.g. "instance._type._udp.local." or "host.local.".
+     *
+     */
+    void AddConflictingName(const std::string &aFullName);
+
+    /**
+     * This method makes the next service and record registrations fail.
+     *
+     * @param[in] aCount  The number of registrations to fail.
+     * @param[in] aError  The error to reply with.
+     *
+     */
+    void FailNextRegistrations(uint32_t aCount, DNSServiceErrorType aError);
+
+    /**
+     * This method starts or stops the daemon.
+     *
+     * Stopping the daemon drops all registrations of local clients, and all existing
+     * connections report `kDNSServiceErr_ServiceNotRunning` when they are processed.
+     * New connections fail until the daemon runs again.
+     *
+     * @param[in] aRunning  Whether the daemon is running.
+     *
+     */
+    void SetRunning(bool aRunning);
+
+    /**
+     * This method adds a service instance advertised by another host on the link.
+     *
+     * @param[in] aInstanceName  The service instance name.
+     * @param[in] aType          The service type, e.g. "_test._udp".
+     * @param[in] aHostName      The host name without domain.
+     * @param[in] aPort          The port number.
+     * @param[in] aTxtData       The TXT data.
+     *
+     */
+    void AddRemoteService(const std::string          &aInstanceName,
+                          const std::string          &aType,
+                          const std::string          &aHostName,
+                          uint16_t                    aPort,
+                          const std::vector<uint8_t> &aTxtData);
+
+    /**
+     * This method removes a service instance added with `AddRemoteService()`.
+     *
+     * @param[in] aInstanceName  The service instance name.
+     * @param[in] aType          The service type.
+     *
+     */
+    void RemoveRemoteService(const std::string &aInstanceName, const std::string &aType);
+
+    /**
+     * This method adds an address of a host on the link.
+     *
+     * @param[in] aHostName  The host name without domain.
+     * @param[in] aAddress   The IPv6 address.
+     *
+     */
+    void AddRemoteHostAddress(const std::string &aHostName, const Ip6Address &aAddress);
+
+    /**
+     * This method indicates whether a service instance is registered by a local client.
+     *
+     * @param[in] aInstanceName  The service instance name.
+     * @param[in] aType          The service type.
+     *
+     */
+    bool IsServiceRegistered(const std::string &aInstanceName, const std::string &aType) const;
+
+    /**
+     * This method returns the number of records registered by local clients with a given name and type.
+     *
+     * @param[in] aFullName  The full record name.
+     * @param[in] aType      The record type.
+     *
+     */
+    size_t GetRecordCount(const std::string &aFullName, uint16_t aType) const;
+
+    /**
+     * This method returns the number of service instances registered by local clients.
+     *
+     */
+    size_t GetServiceCount(void) const;
+
+    /**
+     * This method returns the counters of the fake daemon.
+     *
+     */
+    const Stats &GetStats(void) const { return mStats; }
+
+    /**
+     * This method indicates whether the calling code runs inside the fake daemon.
+     *
+     * Benchmarks use this to keep the allocations of the fake out of the measured
+     * footprint of the publisher.
+     *
+     */
+    static bool IsInDaemon(void) { return sDaemonDepth > 0; }
+
+private:
+    friend struct ::_DNSRecordRef_t;
+    friend class FakeDnssdApi;
+
+    class DaemonScope;
+    class ClientScope;
+
+    struct CaseInsensitiveLess
+    {
+        bool operator()(const std::string &aLhs, const std::string &aRhs) const;
+    };
+
+    struct Service
+    {
+        std::string          mInstanceName;
+        std::string          mType;
+        std::string          mHostTarget;
+        uint16_t             mPort;
+        std::vector<uint8_t> mTxtData;
+        DNSServiceRef        mOwner; // `nullptr` for remote services.
+    };
+
+    struct Record
+    {
+        std::string          mName;
+        uint16_t             mType;
+        std::vector<uint8_t> mData;
+        uint32_t             mTtl;
+        bool                 mIsShared;
+        DNSRecordRef         mOwner; // `nullptr` for remote records.
+    };
+
+    typedef std::map<std::string, Service, CaseInsensitiveLess> ServiceMap;
+    typedef std::list<Record>                                   RecordList;
+
+    FakeDnssd(void) = default;
+
+    uint64_t             AllocateSerial(void);
+    bool                 IsAlive(uint64_t aSerial) const { return mLiveSerials.count(aSerial) != 0; }
+    bool                 ConsumeFailure(DNSServiceErrorType &aError);
+    bool                 HasConflict(const Record &aRecord) const;
+    void                 AddService(Service &&aService);
+    void                 RemoveService(ServiceMap::iterator aIter);
+    RecordList::iterator AddRecord(Record &&aRecord);
+    void                 RemoveRecord(RecordList::iterator aIter);
+    void                 Unregister(DNSServiceRef aServiceRef);
+    void                 NotifyBrowsers(const Service &aService, bool aIsAdd);
+    void                 NotifyAddressQueries(const Record &aRecord, bool aIsAdd);
+    void                 ScheduleBrowseReply(DNSServiceRef aServiceRef, const Service &aService, bool aIsAdd);
+    void                 ScheduleAddressReply(DNSServiceRef aServiceRef, const Record &aRecord, bool aIsAdd);
+    void                 Schedule(DNSServiceRef aServiceRef, uint64_t aTargetSerial, std::function<void()> &&aHandler);
+    void                 Rearm(DNSServiceRef aConnection);
+
+    static std::string MakeServiceKey(const std::string &aInstanceName, const std::string &aType);
+
+    static int sDaemonDepth;
+
+    bool                                       mRunning      = true;
+    Milliseconds                               mLatency      = Milliseconds(0);
+    uint32_t                                   mFailureCount = 0;
+    DNSServiceErrorType                        mFailureError = kDNSServiceErr_NoError;
+    uint64_t                                   mNextSerial   = 1;
+    std::unordered_set<uint64_t>               mLiveSerials;
+    std::set<std::string, CaseInsensitiveLess> mConflictingNames;
+    std::list<DNSServiceRef>                   mConnections;
+    ServiceMap                                 mServices;
+    RecordList                                 mRecords;
+    Stats                                      mStats;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_TESTS_GTEST_FAKE_DNS_SD_HPP_
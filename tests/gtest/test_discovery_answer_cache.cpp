@@ -0,0 +1,157 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sdp_proxy/discovery_answer_cache.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using otbr::Clock;
+using otbr::Seconds;
+using otbr::Timepoint;
+using otbr::Dnssd::DiscoveryAnswerCache;
+
+static DiscoveryAnswerCache::DiscoveredInstanceInfo MakeInstance(const std::string &aName, uint16_t aPort)
+{
+    DiscoveryAnswerCache::DiscoveredInstanceInfo instance;
+
+    instance.mName     = aName;
+    instance.mHostName = aName + ".local.";
+    instance.mPort     = aPort;
+    instance.mTxtData  = {1, 2, 3};
+
+    return instance;
+}
+
+TEST(DiscoveryAnswerCache, TestServices)
+{
+    DiscoveryAnswerCache                                      cache(4096);
+    Timepoint                                                 now = Clock::now();
+    std::vector<DiscoveryAnswerCache::DiscoveredInstanceInfo> instances;
+
+    cache.AddService("_meshcop._udp", MakeInstance("BR1", 1000), Seconds(10), now);
+    cache.AddService("_meshcop._udp", MakeInstance("br2", 2000), Seconds(5), now);
+    cache.AddService("_trel._udp", MakeInstance("br1", 3000), Seconds(10), now);
+
+    cache.FindServices("_MeshCoP._udp", "", now + Seconds(2), instances);
+    ASSERT_EQ(instances.size(), 2u);
+    EXPECT_EQ(instances[0].mPort, 1000);
+    EXPECT_EQ(instances[0].mTtl, 8u);
+    EXPECT_EQ(instances[1].mPort, 2000);
+    EXPECT_EQ(instances[1].mTtl, 3u);
+
+    instances.clear();
+    cache.FindServices("_meshcop._udp", "br1", now, instances);
+    ASSERT_EQ(instances.size(), 1u);
+    EXPECT_EQ(instances[0].mName, "BR1");
+
+    // Expired entries are not returned and are evicted.
+    instances.clear();
+    cache.FindServices("_meshcop._udp", "", now + Seconds(6), instances);
+    ASSERT_EQ(instances.size(), 1u);
+    EXPECT_EQ(instances[0].mPort, 1000);
+    EXPECT_EQ(cache.GetNumEntries(), 2u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetNumEntries(), 0u);
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
+
+TEST(DiscoveryAnswerCache, TestNegativeEntries)
+{
+    DiscoveryAnswerCache                                      cache(4096);
+    Timepoint                                                 now = Clock::now();
+    std::vector<DiscoveryAnswerCache::DiscoveredInstanceInfo> instances;
+    DiscoveryAnswerCache::DiscoveredHostInfo                  hostInfo;
+
+    cache.AddNegativeService("_meshcop._udp", "br1", Seconds(10), now);
+    EXPECT_TRUE(cache.IsServiceNegative("_meshcop._udp", "br1", now));
+    EXPECT_FALSE(cache.IsServiceNegative("_meshcop._udp", "br2", now));
+    EXPECT_FALSE(cache.IsServiceNegative("_meshcop._udp", "", now));
+    EXPECT_FALSE(cache.IsServiceNegative("_meshcop._udp", "br1", now + Seconds(10)));
+
+    // A discovered instance replaces its negative entry.
+    cache.AddService("_meshcop._udp", MakeInstance("br1", 1000), Seconds(10), now);
+    EXPECT_FALSE(cache.IsServiceNegative("_meshcop._udp", "br1", now));
+
+    cache.AddNegativeService("_meshcop._udp", "BR1", Seconds(10), now);
+    EXPECT_TRUE(cache.IsServiceNegative("_meshcop._udp", "br1", now));
+    cache.FindServices("_meshcop._udp", "", now, instances);
+    EXPECT_TRUE(instances.empty());
+
+    DiscoveryAnswerCache::DiscoveredHostInfo host;
+
+    host.mHostName = "host1.local.";
+    host.mAddresses.resize(2);
+    cache.AddHost("Host1", host, Seconds(10), now);
+    EXPECT_TRUE(cache.FindHost("host1", now + Seconds(1), hostInfo));
+    EXPECT_EQ(hostInfo.mAddresses.size(), 2u);
+    EXPECT_EQ(hostInfo.mTtl, 9u);
+
+    cache.AddNegativeHost("host1", Seconds(10), now);
+    EXPECT_TRUE(cache.IsHostNegative("HOST1", now));
+    EXPECT_FALSE(cache.FindHost("host1", now, hostInfo));
+    EXPECT_FALSE(cache.IsHostNegative("host1", now + Seconds(10)));
+}
+
+TEST(DiscoveryAnswerCache, TestSizeLimit)
+{
+    DiscoveryAnswerCache                                      cache(4096);
+    Timepoint                                                 now = Clock::now();
+    std::vector<DiscoveryAnswerCache::DiscoveredInstanceInfo> instances;
+
+    for (uint16_t i = 0; i < 100; i++)
+    {
+        cache.AddService("_meshcop._udp", MakeInstance("br" + std::to_string(i), i), Seconds(10), now);
+
+        // Keep the first instance in use.
+        instances.clear();
+        cache.FindServices("_meshcop._udp", "br0", now, instances);
+        ASSERT_EQ(instances.size(), 1u);
+        EXPECT_LE(cache.GetSize(), 4096u);
+    }
+
+    EXPECT_LT(cache.GetNumEntries(), 100u);
+
+    // The least recently used instances are evicted first.
+    instances.clear();
+    cache.FindServices("_meshcop._udp", "br1", now, instances);
+    EXPECT_TRUE(instances.empty());
+    cache.FindServices("_meshcop._udp", "br99", now, instances);
+    EXPECT_EQ(instances.size(), 1u);
+
+    // An entry larger than the cache is not cached.
+    DiscoveryAnswerCache::DiscoveredInstanceInfo large = MakeInstance("large", 1);
+
+    large.mTxtData.resize(8192);
+    cache.AddService("_meshcop._udp", large, Seconds(10), now);
+    instances.clear();
+    cache.FindServices("_meshcop._udp", "large", now, instances);
+    EXPECT_TRUE(instances.empty());
+}
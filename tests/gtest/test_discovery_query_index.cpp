@@ -0,0 +1,191 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sdp_proxy/discovery_query_index.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/dns_utils.hpp"
+#include "utils/string_utils.hpp"
+
+using otbr::Dnssd::DiscoveryQueryIndex;
+
+TEST(DiscoveryQueryIndex, TestSubscriptionCounting)
+{
+    DiscoveryQueryIndex index;
+
+    EXPECT_EQ(index.Add(SplitFullDnsName("_meshcop._udp.default.service.arpa.")), 1u);
+    EXPECT_EQ(index.Add(SplitFullDnsName("_MeshCoP._udp.default.service.arpa.")), 2u);
+    // The same service in another domain shares the mDNS subscription.
+    EXPECT_EQ(index.Add(SplitFullDnsName("_meshcop._udp.other.arpa.")), 3u);
+    EXPECT_EQ(index.Add(SplitFullDnsName("br1._meshcop._udp.default.service.arpa.")), 1u);
+    EXPECT_EQ(index.GetSize(), 3u);
+
+    EXPECT_EQ(index.Remove(SplitFullDnsName("_meshcop._udp.default.service.arpa.")), 2u);
+    EXPECT_EQ(index.Remove(SplitFullDnsName("_meshcop._udp.other.arpa.")), 1u);
+    EXPECT_EQ(index.Remove(SplitFullDnsName("_meshcop._udp.default.service.arpa.")), 0u);
+    EXPECT_EQ(index.Remove(SplitFullDnsName("_meshcop._udp.default.service.arpa.")), 0u);
+    EXPECT_EQ(index.GetSize(), 1u);
+
+    EXPECT_EQ(index.Remove(SplitFullDnsName("br1._meshcop._udp.default.service.arpa.")), 0u);
+    EXPECT_EQ(index.GetSize(), 0u);
+}
+
+TEST(DiscoveryQueryIndex, TestFindServiceQueries)
+{
+    DiscoveryQueryIndex      index;
+    std::vector<DnsNameInfo> queries;
+
+    index.Add(SplitFullDnsName("_meshcop._udp.default.service.arpa."));
+    index.Add(SplitFullDnsName("_meshcop._udp.default.service.arpa."));
+    index.Add(SplitFullDnsName("br1._meshcop._udp.default.service.arpa."));
+    index.Add(SplitFullDnsName("br2._meshcop._udp.default.service.arpa."));
+    index.Add(SplitFullDnsName("_trel._udp.default.service.arpa."));
+    index.Add(SplitFullDnsName("br1.default.service.arpa."));
+
+    index.FindServiceQueries("_MESHCOP._udp", "BR1", queries);
+    ASSERT_EQ(queries.size(), 2u);
+    EXPECT_TRUE(queries[0].IsService());
+    EXPECT_EQ(queries[0].mDomain, "default.service.arpa.");
+    EXPECT_EQ(queries[1].mInstanceName, "br1");
+
+    queries.clear();
+    index.FindServiceQueries("_srpl-tls._tcp", "br1", queries);
+    EXPECT_TRUE(queries.empty());
+}
+
+TEST(DiscoveryQueryIndex, TestFindHostQueries)
+{
+    DiscoveryQueryIndex      index;
+    std::vector<DnsNameInfo> queries;
+
+    index.Add(SplitFullDnsName("host1.default.service.arpa."));
+    index.Add(SplitFullDnsName("host1.other.arpa."));
+    index.Add(SplitFullDnsName("host2.default.service.arpa."));
+
+    index.FindHostQueries("HOST1", queries);
+    ASSERT_EQ(queries.size(), 2u);
+    EXPECT_EQ(queries[0].mDomain, "default.service.arpa.");
+    EXPECT_EQ(queries[1].mDomain, "other.arpa.");
+
+    index.Clear();
+    queries.clear();
+    index.FindHostQueries("host1", queries);
+    EXPECT_TRUE(queries.empty());
+    EXPECT_EQ(index.GetSize(), 0u);
+}
+
+#if OTBR_GTEST_BENCHMARK
+static constexpr uint32_t kNumServiceTypes = 50;
+static constexpr uint32_t kNumQueries      = 500;
+static constexpr uint32_t kNumResults      = 5000;
+
+static std::string MakeServiceType(uint32_t aIndex)
+{
+    return "_svc" + std::to_string(aIndex) + "._udp";
+}
+
+// Returns a browse, resolve or host query name, in roughly equal shares.
+static std::string MakeQueryName(uint32_t aIndex)
+{
+    std::string type = MakeServiceType(aIndex % kNumServiceTypes);
+
+    switch (aIndex % 3)
+    {
+    case 0:
+        return type + ".default.service.arpa.";
+    case 1:
+        return "instance" + std::to_string(aIndex) + "." + type + ".default.service.arpa.";
+    default:
+        return "host" + std::to_string(aIndex) + ".default.service.arpa.";
+    }
+}
+
+TEST(DiscoveryQueryIndex, BenchmarkFanOutWith500Queries)
+{
+    using Clock = std::chrono::steady_clock;
+
+    DiscoveryQueryIndex      index;
+    std::vector<std::string> queryNames;
+    std::vector<DnsNameInfo> queries;
+    size_t                   indexedMatches = 0;
+    size_t                   linearMatches  = 0;
+    Clock::time_point        begin;
+    uint64_t                 indexedUs;
+    uint64_t                 linearUs;
+
+    for (uint32_t i = 0; i < kNumQueries; i++)
+    {
+        std::string queryName = MakeQueryName(i);
+
+        // Concurrent queries for the same name are answered once, so the baseline only keeps distinct names.
+        if (index.Add(SplitFullDnsName(queryName)) == 1)
+        {
+            queryNames.push_back(queryName);
+        }
+    }
+
+    begin = Clock::now();
+    for (uint32_t i = 0; i < kNumResults; i++)
+    {
+        queries.clear();
+        index.FindServiceQueries(MakeServiceType(i % kNumServiceTypes), "instance" + std::to_string(i % kNumQueries),
+                                 queries);
+        indexedMatches += queries.size();
+    }
+    indexedUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count();
+
+    // The previous approach: split the name of every active query for each result.
+    begin = Clock::now();
+    for (uint32_t i = 0; i < kNumResults; i++)
+    {
+        std::string type     = MakeServiceType(i % kNumServiceTypes);
+        std::string instance = "instance" + std::to_string(i % kNumQueries);
+
+        for (const std::string &queryName : queryNames)
+        {
+            DnsNameInfo query = SplitFullDnsName(queryName);
+
+            linearMatches += (!query.IsHost() && otbr::StringUtils::EqualCaseInsensitive(query.mServiceName, type) &&
+                              (query.mInstanceName.empty() ||
+                               otbr::StringUtils::EqualCaseInsensitive(query.mInstanceName, instance)));
+        }
+    }
+    linearUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count();
+
+    EXPECT_EQ(indexedMatches, linearMatches);
+
+    std::cout << "queries: " << kNumQueries << ", results: " << kNumResults << std::endl;
+    std::cout << "indexed: " << indexedUs << " us, linear: " << linearUs << " us" << std::endl;
+}
+#endif // OTBR_GTEST_BENCHMARK
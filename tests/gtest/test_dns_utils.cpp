@@ -31,6 +31,8 @@
 #include <assert.h>
 #include <gtest/gtest.h>
 
+#include "utils/dns_utils.hpp"
+
 static void CheckSplitFullDnsName(const std::string &aFullName,
                                   bool               aIsServiceInstance,
                                   bool               aIsService,
@@ -92,3 +94,49 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestDnsName)
+{
+    std::string fullName     = "Instance.Name._ipps._tcp.default.service.arpa.";
+    std::string upperService = "_IPPS._tcp.local";
+    std::string otherService = "_ipp._tcp.local";
+    DnsName     name(fullName);
+
+    EXPECT_TRUE(name.IsServiceInstance());
+    EXPECT_EQ(name.GetFullName().ToString(), "Instance.Name._ipps._tcp.default.service.arpa");
+    EXPECT_EQ(name.GetInstanceName().ToString(), "Instance.Name");
+    EXPECT_EQ(name.GetServiceName().ToString(), "_ipps._tcp");
+    EXPECT_EQ(name.GetDomain().ToString(), "default.service.arpa");
+    EXPECT_EQ(name.GetInstanceName().GetData(), fullName.data());
+
+    EXPECT_TRUE(name.GetServiceName().EqualsCaseInsensitive("_IPPS._TCP"));
+    EXPECT_FALSE(name.GetServiceName().EqualsCaseInsensitive("_ipps._tc"));
+    EXPECT_EQ(name.GetServiceName().HashCaseInsensitive(),
+              DnsName(upperService).GetServiceName().HashCaseInsensitive());
+    EXPECT_NE(name.GetServiceName().HashCaseInsensitive(),
+              DnsName(otherService).GetServiceName().HashCaseInsensitive());
+
+    fullName = "host1.local";
+    name     = DnsName(fullName);
+    EXPECT_TRUE(name.IsHost());
+    EXPECT_EQ(name.GetHostName().ToString(), "host1");
+    EXPECT_TRUE(name.GetDomain().EqualsCaseInsensitive("LOCAL"));
+
+    fullName = "com.";
+    name     = DnsName(fullName);
+    EXPECT_EQ(name.GetHostName().ToString(), "com");
+    EXPECT_TRUE(name.GetDomain().IsEmpty());
+    EXPECT_EQ(name.ToNameInfo().mDomain, ".");
+}
+
+TEST(DnsUtils, TestUnescapeInstanceName)
+{
+    std::string name = "Living\\032Room\\.1\\\\";
+    size_t      length;
+
+    EXPECT_EQ(otbr::DnsUtils::UnescapeInstanceName(name), "Living Room.1\\");
+
+    // Unescape in place.
+    length = otbr::DnsUtils::UnescapeInstanceName(name.data(), name.size(), &name[0]);
+    EXPECT_EQ(name.substr(0, length), "Living Room.1\\");
+}
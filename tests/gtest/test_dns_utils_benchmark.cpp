@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/dns_utils.hpp"
+#include "utils/dns_utils.hpp"
+#include "utils/string_utils.hpp"
+
+static constexpr uint32_t kNumIterations = 20000;
+
+static const std::vector<std::string> &GetNames(void)
+{
+    static const std::vector<std::string> sNames = {
+        "Living\\032Room\\032Speaker._airplay._tcp.default.service.arpa.",
+        "OpenThread BR 1234._meshcop._udp.default.service.arpa.",
+        "_meshcop._udp.default.service.arpa.",
+        "otbr-host-1234.default.service.arpa.",
+        "device-0123456789abcdef.local.",
+    };
+
+    return sNames;
+}
+
+template <typename Function> static uint64_t Measure(Function aFunction)
+{
+    auto begin = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < kNumIterations; i++)
+    {
+        for (const std::string &name : GetNames())
+        {
+            aFunction(name);
+        }
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+TEST(DnsUtilsBenchmark, BenchmarkSplitAndCompare)
+{
+    size_t   matches = 0;
+    uint64_t splitUs;
+    uint64_t viewUs;
+
+    // Splitting into strings, as done before the DnsName view existed.
+    splitUs = Measure([&matches](const std::string &aName) {
+        DnsNameInfo nameInfo = SplitFullDnsName(aName);
+
+        matches += otbr::StringUtils::EqualCaseInsensitive(nameInfo.mDomain, "local.");
+    });
+
+    viewUs = Measure([&matches](const std::string &aName) {
+        DnsName name(aName);
+
+        matches -= name.GetDomain().EqualsCaseInsensitive("local");
+    });
+
+    EXPECT_EQ(matches, 0u);
+
+    std::cout << "split: " << splitUs << " us, view: " << viewUs << " us for " << kNumIterations * GetNames().size()
+              << " names" << std::endl;
+}
+
+TEST(DnsUtilsBenchmark, BenchmarkUnescape)
+{
+    size_t   length = 0;
+    uint64_t stringUs;
+    uint64_t bufferUs;
+
+    stringUs = Measure([&length](const std::string &aName) {
+        length += otbr::DnsUtils::UnescapeInstanceName(aName).size();
+    });
+
+    bufferUs = Measure([&length](const std::string &aName) {
+        char buffer[256];
+
+        ASSERT_LE(aName.size(), sizeof(buffer));
+        length -= otbr::DnsUtils::UnescapeInstanceName(aName.data(), aName.size(), buffer);
+    });
+
+    EXPECT_EQ(length, 0u);
+
+    std::cout << "string: " << stringUs << " us, buffer: " << bufferUs << " us for "
+              << kNumIterations * GetNames().size() << " names" << std::endl;
+}
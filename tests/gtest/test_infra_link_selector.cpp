@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <gtest/gtest.h>
+
+#include <errno.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/select.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "common/mainloop_manager.hpp"
+#include "common/netlink_monitor.hpp"
+#include "utils/infra_link_selector.hpp"
+#include "utils/system_utils.hpp"
+
+using namespace otbr;
+using otbr::Utils::InfraLinkSelector;
+
+// These tests need CAP_SYS_ADMIN and CAP_NET_ADMIN. Each test process moves itself to a new network namespace where
+// the infrastructure link candidates are veth pairs, so link state can be toggled without touching the host.
+static constexpr char kInfraLink0[] = "otbr-ils0";
+static constexpr char kInfraLink1[] = "otbr-ils1";
+
+static void EnterNetworkNamespace(void)
+{
+    ASSERT_EQ(unshare(CLONE_NEWNET), 0) << strerror(errno);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link add %s type veth peer name %s-peer", kInfraLink0, kInfraLink0), 0);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link add %s type veth peer name %s-peer", kInfraLink1, kInfraLink1), 0);
+}
+
+static void SetLinkUpAndRunning(const char *aInfraLink, bool aUp)
+{
+    const char *state = aUp ? "up" : "down";
+
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link set %s-peer %s", aInfraLink, state), 0);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link set %s %s", aInfraLink, state), 0);
+}
+
+class InfraLinkSelectorTest : public testing::Test
+{
+protected:
+    void SetUp(void) override { EnterNetworkNamespace(); }
+
+    // The shared monitor is bound to the namespace it was opened in.
+    void TearDown(void) override { NetlinkMonitor::GetInstance().Close(); }
+
+    // Runs the mainloop until the selected infra link changed or `aTimeout` elapsed.
+    void RunMainloopUntilChanged(Milliseconds aTimeout)
+    {
+        auto deadline = Clock::now() + aTimeout;
+
+        while (mChangedInfraLinks.empty() && Clock::now() < deadline)
+        {
+            MainloopContext mainloop;
+
+            mainloop.mMaxFd   = -1;
+            mainloop.mTimeout = {0, 100000};
+            FD_ZERO(&mainloop.mReadFdSet);
+            FD_ZERO(&mainloop.mWriteFdSet);
+            FD_ZERO(&mainloop.mErrorFdSet);
+
+            MainloopManager::GetInstance().Update(mainloop);
+            ASSERT_GE(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet,
+                             &mainloop.mErrorFdSet, &mainloop.mTimeout),
+                      0);
+            MainloopManager::GetInstance().Process(mainloop);
+        }
+    }
+
+    void Watch(InfraLinkSelector &aSelector)
+    {
+        aSelector.SetInfraLinkChangedCallback(
+            [this](const char *aInfraLink) { mChangedInfraLinks.emplace_back(aInfraLink); });
+    }
+
+    std::vector<std::string> mChangedInfraLinks;
+};
+
+TEST_F(InfraLinkSelectorTest, SelectsLinkAsSoonAsItIsRunning)
+{
+    InfraLinkSelector selector({kInfraLink0, kInfraLink1});
+
+    Watch(selector);
+    EXPECT_STREQ(selector.Select(), kInfraLink0);
+
+    SetLinkUpAndRunning(kInfraLink1, true);
+    RunMainloopUntilChanged(Milliseconds(2000));
+
+    ASSERT_EQ(mChangedInfraLinks.size(), 1u);
+    EXPECT_EQ(mChangedInfraLinks.front(), kInfraLink1);
+}
+
+TEST_F(InfraLinkSelectorTest, IgnoresEventsThatDoNotChangeSelection)
+{
+    InfraLinkSelector selector({kInfraLink0, kInfraLink1});
+
+    SetLinkUpAndRunning(kInfraLink0, true);
+    Watch(selector);
+    EXPECT_STREQ(selector.Select(), kInfraLink0);
+
+    // Unrelated links and attribute changes on the candidates must not switch the selection.
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link add otbr-other type veth peer name otbr-other-peer"), 0);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link set otbr-other up"), 0);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link set %s mtu 1400", kInfraLink0), 0);
+    SetLinkUpAndRunning(kInfraLink1, true);
+    RunMainloopUntilChanged(Milliseconds(500));
+
+    EXPECT_TRUE(mChangedInfraLinks.empty());
+}
+
+TEST_F(InfraLinkSelectorTest, SwitchesLinkAfterSelectionDelay)
+{
+    InfraLinkSelector selector({kInfraLink0, kInfraLink1});
+    Timepoint         start;
+    Milliseconds      elapsed;
+
+    SetLinkUpAndRunning(kInfraLink0, true);
+    SetLinkUpAndRunning(kInfraLink1, true);
+    Watch(selector);
+    EXPECT_STREQ(selector.Select(), kInfraLink0);
+
+    start = Clock::now();
+    SetLinkUpAndRunning(kInfraLink0, false);
+    RunMainloopUntilChanged(Milliseconds(15000));
+    elapsed = std::chrono::duration_cast<Milliseconds>(Clock::now() - start);
+
+    ASSERT_EQ(mChangedInfraLinks.size(), 1u);
+    EXPECT_EQ(mChangedInfraLinks.front(), kInfraLink1);
+    EXPECT_GE(elapsed.count(), 9000);
+}
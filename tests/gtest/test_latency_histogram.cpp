@@ -0,0 +1,120 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/latency_histogram.hpp"
+
+#include <gtest/gtest.h>
+
+using otbr::LatencyHistogram;
+using otbr::LatencyPercentiles;
+
+TEST(LatencyHistogram, TestEmpty)
+{
+    LatencyHistogram   histogram;
+    LatencyPercentiles percentiles;
+
+    histogram.GetPercentiles(percentiles);
+
+    EXPECT_EQ(percentiles.mCount, 0u);
+    EXPECT_EQ(percentiles.mP50, 0u);
+    EXPECT_EQ(percentiles.mP90, 0u);
+    EXPECT_EQ(percentiles.mP99, 0u);
+    EXPECT_EQ(percentiles.mMax, 0u);
+}
+
+TEST(LatencyHistogram, TestSmallValuesAreExact)
+{
+    LatencyHistogram histogram;
+
+    for (uint32_t i = 1; i <= 10; i++)
+    {
+        histogram.Record(i);
+    }
+
+    EXPECT_EQ(histogram.GetCount(), 10u);
+    EXPECT_EQ(histogram.GetPercentile(50), 5u);
+    EXPECT_EQ(histogram.GetPercentile(90), 9u);
+    EXPECT_EQ(histogram.GetPercentile(100), 10u);
+    EXPECT_EQ(histogram.GetMax(), 10u);
+}
+
+TEST(LatencyHistogram, TestTailIsNotSmoothed)
+{
+    LatencyHistogram   histogram;
+    LatencyPercentiles percentiles;
+
+    // 98 fast registrations and 2 multi-second probes.
+    for (uint32_t i = 0; i < 98; i++)
+    {
+        histogram.Record(20);
+    }
+    histogram.Record(3000);
+    histogram.Record(4500);
+
+    histogram.GetPercentiles(percentiles);
+
+    EXPECT_EQ(percentiles.mCount, 100u);
+    EXPECT_GE(percentiles.mP50, 20u);
+    EXPECT_LE(percentiles.mP50, 23u);
+    EXPECT_GE(percentiles.mP90, 20u);
+    EXPECT_LE(percentiles.mP90, 23u);
+    EXPECT_GE(percentiles.mP99, 3000u);
+    EXPECT_LE(percentiles.mP99, 3000u + 3000u / 8);
+    EXPECT_EQ(percentiles.mMax, 4500u);
+}
+
+TEST(LatencyHistogram, TestRelativeErrorIsBounded)
+{
+    for (uint32_t value = 16; value < (1u << 20); value = value * 3 / 2 + 1)
+    {
+        LatencyHistogram histogram;
+
+        histogram.Record(0);
+        histogram.Record(value);
+
+        // The reported percentile is the bucket upper bound capped by the max.
+        EXPECT_EQ(histogram.GetPercentile(100), value);
+        EXPECT_EQ(histogram.GetPercentile(50), 0u);
+    }
+}
+
+TEST(LatencyHistogram, TestOverflowIsClamped)
+{
+    LatencyHistogram histogram;
+
+    histogram.Record(UINT32_MAX);
+    histogram.Record(1u << 25);
+
+    EXPECT_EQ(histogram.GetCount(), 2u);
+    EXPECT_EQ(histogram.GetMax(), UINT32_MAX);
+    EXPECT_EQ(histogram.GetPercentile(50), UINT32_MAX);
+
+    histogram.Clear();
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetMax(), 0u);
+}
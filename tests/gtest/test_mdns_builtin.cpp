@@ -0,0 +1,429 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <limits.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "mdns/dns_message.hpp"
+#include "mdns/mdns.hpp"
+
+using namespace otbr;
+using namespace otbr::Mdns;
+
+// The publisher runs on one end of a veth pair and the test talks to it as a
+// peer on the other end, so each side receives what the other multicasts.
+static constexpr char     kPublisherIf[] = "otbr-mdns0";
+static constexpr char     kPeerIf[]      = "otbr-mdns1";
+static constexpr char     kMdnsGroup[]   = "ff02::fb";
+static constexpr uint16_t kMdnsPort      = 5353;
+
+struct Result
+{
+    bool      mDone  = false;
+    otbrError mError = OTBR_ERROR_NONE;
+};
+
+static Publisher::ResultCallback StoreResult(Result &aResult)
+{
+    return [&aResult](otbrError aError) {
+        aResult.mDone  = true;
+        aResult.mError = aError;
+    };
+}
+
+static std::string GetLocalHostFullName(void)
+{
+    char hostName[HOST_NAME_MAX + 1];
+
+    VerifyOrDie(gethostname(hostName, sizeof(hostName)) == 0, strerror(errno));
+    hostName[sizeof(hostName) - 1] = '\0';
+
+    return std::string(hostName, strcspn(hostName, ".")) + ".local";
+}
+
+static ResourceRecord MakeAaaaRecord(const std::string &aName, const char *aAddress)
+{
+    ResourceRecord record;
+    in6_addr       address;
+
+    inet_pton(AF_INET6, aAddress, &address);
+
+    record.mName       = aName;
+    record.mType       = kRrTypeAaaa;
+    record.mClass      = kRrClassIn;
+    record.mCacheFlush = true;
+    record.mTtl        = 120;
+    record.mData.assign(address.s6_addr, address.s6_addr + sizeof(address.s6_addr));
+
+    return record;
+}
+
+static bool IsProbeFor(const Message &aMessage, const std::string &aName)
+{
+    return !aMessage.IsResponse() && !aMessage.mQuestions.empty() && NameEquals(aMessage.mQuestions[0].mName, aName) &&
+           aMessage.mQuestions[0].mType == kRrTypeAny && !aMessage.mAuthorities.empty();
+}
+
+static bool IsAnnouncementOf(const Message &aMessage, const std::string &aName)
+{
+    return aMessage.IsResponse() && !aMessage.mAnswers.empty() && aMessage.mAnswers[0].HasName(aName);
+}
+
+/**
+ * This class is an mDNS peer on the other end of the veth pair.
+ *
+ */
+class MdnsPeer
+{
+public:
+    ~MdnsPeer(void)
+    {
+        if (mFd >= 0)
+        {
+            close(mFd);
+        }
+    }
+
+    void Open(void)
+    {
+        sockaddr_in6 sockAddr;
+        ipv6_mreq    mreq;
+        int          one  = 1;
+        int          hops = 255;
+        int          loop = 0;
+
+        mIfIndex = if_nametoindex(kPeerIf);
+        mFd      = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+        ASSERT_GE(mFd, 0);
+        ASSERT_EQ(setsockopt(mFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)), 0);
+        ASSERT_EQ(setsockopt(mFd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)), 0);
+        ASSERT_EQ(setsockopt(mFd, IPPROTO_IPV6, IPV6_V6ONLY, &one, sizeof(one)), 0);
+        ASSERT_EQ(setsockopt(mFd, IPPROTO_IPV6, IPV6_RECVPKTINFO, &one, sizeof(one)), 0);
+        ASSERT_EQ(setsockopt(mFd, IPPROTO_IPV6, IPV6_MULTICAST_IF, &mIfIndex, sizeof(mIfIndex)), 0);
+        ASSERT_EQ(setsockopt(mFd, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops)), 0);
+        ASSERT_EQ(setsockopt(mFd, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &loop, sizeof(loop)), 0);
+
+        memset(&sockAddr, 0, sizeof(sockAddr));
+        sockAddr.sin6_family = AF_INET6;
+        sockAddr.sin6_port   = htons(kMdnsPort);
+        ASSERT_EQ(bind(mFd, reinterpret_cast<sockaddr *>(&sockAddr), sizeof(sockAddr)), 0);
+
+        memset(&mreq, 0, sizeof(mreq));
+        inet_pton(AF_INET6, kMdnsGroup, &mreq.ipv6mr_multiaddr);
+        mreq.ipv6mr_interface = mIfIndex;
+        ASSERT_EQ(setsockopt(mFd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)), 0);
+    }
+
+    // Receives the messages multicast by the publisher.
+    void Receive(void)
+    {
+        uint8_t buffer[9000];
+        uint8_t control[CMSG_SPACE(sizeof(in6_pktinfo))];
+        iovec   iov;
+        msghdr  msg;
+        ssize_t length;
+
+        iov.iov_base = buffer;
+        iov.iov_len  = sizeof(buffer);
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+
+        while ((length = recvmsg(mFd, &msg, 0)) > 0)
+        {
+            cmsghdr    *cmsg = CMSG_FIRSTHDR(&msg);
+            in6_pktinfo pktInfo;
+            Message     message;
+
+            // Group members get the messages sent to the group on any interface,
+            // so the messages of this peer received by the publisher are skipped.
+            memset(&pktInfo, 0, sizeof(pktInfo));
+            if (cmsg != nullptr && cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO)
+            {
+                memcpy(&pktInfo, CMSG_DATA(cmsg), sizeof(pktInfo));
+            }
+
+            if (pktInfo.ipi6_ifindex == mIfIndex &&
+                message.Parse(buffer, static_cast<size_t>(length)) == OTBR_ERROR_NONE)
+            {
+                mMessages.push_back(message);
+            }
+
+            msg.msg_controllen = sizeof(control);
+        }
+    }
+
+    void SendResponse(const ResourceRecord &aRecord)
+    {
+        MessageWriter writer(0, Message::kFlagResponse | Message::kFlagAuthoritative, 1440);
+        sockaddr_in6  dest;
+
+        ASSERT_TRUE(writer.AppendRecord(MessageWriter::kAnswer, aRecord));
+
+        memset(&dest, 0, sizeof(dest));
+        dest.sin6_family   = AF_INET6;
+        dest.sin6_port     = htons(kMdnsPort);
+        dest.sin6_scope_id = mIfIndex;
+        inet_pton(AF_INET6, kMdnsGroup, &dest.sin6_addr);
+
+        ASSERT_EQ(sendto(mFd, writer.GetBuffer().data(), writer.GetBuffer().size(), 0,
+                         reinterpret_cast<sockaddr *>(&dest), sizeof(dest)),
+                  static_cast<ssize_t>(writer.GetBuffer().size()));
+    }
+
+    size_t CountProbesFor(const std::string &aName) const
+    {
+        return std::count_if(mMessages.begin(), mMessages.end(),
+                             [&aName](const Message &aMessage) { return IsProbeFor(aMessage, aName); });
+    }
+
+    size_t CountAnnouncementsOf(const std::string &aName) const
+    {
+        return std::count_if(mMessages.begin(), mMessages.end(),
+                             [&aName](const Message &aMessage) { return IsAnnouncementOf(aMessage, aName); });
+    }
+
+    std::vector<Message> mMessages;
+
+private:
+    int          mFd      = -1;
+    unsigned int mIfIndex = 0;
+};
+
+/**
+ * This class runs the built-in publisher on a veth pair. It needs CAP_NET_ADMIN.
+ *
+ */
+class MdnsBuiltin : public ::testing::Test
+{
+protected:
+    void SetUp(void) override
+    {
+        // Fixed link-local addresses without DAD make the interfaces usable right away.
+        if (system("ip link add otbr-mdns0 type veth peer name otbr-mdns1 2>/dev/null") != 0)
+        {
+            GTEST_SKIP() << "Creating a veth pair needs CAP_NET_ADMIN";
+        }
+
+        ASSERT_EQ(system("ip link set dev otbr-mdns0 addrgenmode none && "
+                         "ip link set dev otbr-mdns1 addrgenmode none && "
+                         "ip -6 addr add fe80::1/64 dev otbr-mdns0 nodad && "
+                         "ip -6 addr add fe80::2/64 dev otbr-mdns1 nodad && "
+                         "ip link set dev otbr-mdns0 up && ip link set dev otbr-mdns1 up"),
+                  0);
+
+        mPeer.Open();
+
+        mPublisher = Publisher::Create([](Publisher::State) {});
+        mPublisher->SetInfraIf(kPublisherIf);
+        ASSERT_EQ(mPublisher->Start(), OTBR_ERROR_NONE);
+    }
+
+    void TearDown(void) override
+    {
+        int rval;
+
+        if (mPublisher != nullptr)
+        {
+            Publisher::Destroy(mPublisher);
+        }
+
+        rval = system("ip link del otbr-mdns0 2>/dev/null");
+        OTBR_UNUSED_VARIABLE(rval);
+    }
+
+    void RunMainloopOnce(void)
+    {
+        MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {0, 10000};
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        MainloopManager::GetInstance().Update(mainloop);
+
+        if (select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                   &mainloop.mTimeout) >= 0)
+        {
+            MainloopManager::GetInstance().Process(mainloop);
+        }
+
+        mPeer.Receive();
+    }
+
+    bool RunMainloopUntil(const std::function<bool(void)> &aCondition, Milliseconds aTimeout = Milliseconds(5000))
+    {
+        Timepoint deadline = Clock::now() + aTimeout;
+
+        while (!aCondition() && Clock::now() < deadline)
+        {
+            RunMainloopOnce();
+        }
+
+        return aCondition();
+    }
+
+    // Answers the first probe for a name with a conflicting record.
+    bool ConflictWithProbe(const std::string &aName, const ResourceRecord &aConflictingRecord)
+    {
+        bool probed = RunMainloopUntil([&]() { return mPeer.CountProbesFor(aName) > 0; });
+
+        if (probed)
+        {
+            mPeer.SendResponse(aConflictingRecord);
+        }
+
+        return probed;
+    }
+
+    MdnsPeer   mPeer;
+    Publisher *mPublisher = nullptr;
+};
+
+TEST_F(MdnsBuiltin, TestHostIsProbedThenAnnounced)
+{
+    Result               result;
+    size_t               probesBeforeResult;
+    std::vector<Message> probes;
+
+    mPublisher->PublishHost("host1", {Ip6Address("fd00::1")}, StoreResult(result));
+
+    ASSERT_TRUE(RunMainloopUntil([&]() { return result.mDone; }));
+    EXPECT_EQ(result.mError, OTBR_ERROR_NONE);
+    probesBeforeResult = mPeer.CountProbesFor("host1.local");
+    EXPECT_EQ(probesBeforeResult, 3u);
+    EXPECT_LE(mPeer.CountAnnouncementsOf("host1.local"), 1u);
+
+    // RFC 6762 section 8.3: at least two announcements, one second apart.
+    ASSERT_TRUE(RunMainloopUntil([&]() { return mPeer.CountAnnouncementsOf("host1.local") == 2; }));
+    EXPECT_EQ(mPeer.CountProbesFor("host1.local"), probesBeforeResult);
+
+    for (const Message &message : mPeer.mMessages)
+    {
+        if (IsProbeFor(message, "host1.local"))
+        {
+            probes.push_back(message);
+        }
+        else if (IsAnnouncementOf(message, "host1.local"))
+        {
+            EXPECT_TRUE(message.mAnswers[0].IsSameAs(MakeAaaaRecord("host1.local", "fd00::1")));
+            EXPECT_TRUE(message.mAnswers[0].mCacheFlush);
+        }
+    }
+
+    // RFC 6762 section 8.1: only the first probe asks for a unicast response
+    // and the probes propose the records without the cache-flush bit.
+    ASSERT_EQ(probes.size(), 3u);
+    EXPECT_TRUE(probes[0].mQuestions[0].mUnicastResponse);
+    EXPECT_FALSE(probes[1].mQuestions[0].mUnicastResponse);
+    EXPECT_TRUE(probes[2].mAuthorities[0].IsSameAs(MakeAaaaRecord("host1.local", "fd00::1")));
+    EXPECT_FALSE(probes[2].mAuthorities[0].mCacheFlush);
+}
+
+TEST_F(MdnsBuiltin, TestHostNameConflictIsReported)
+{
+    Result result;
+
+    mPublisher->PublishHost("host1", {Ip6Address("fd00::1")}, StoreResult(result));
+
+    ASSERT_TRUE(ConflictWithProbe("host1.local", MakeAaaaRecord("host1.local", "fd00::99")));
+    ASSERT_TRUE(RunMainloopUntil([&]() { return result.mDone; }));
+    EXPECT_EQ(result.mError, OTBR_ERROR_DUPLICATED);
+
+    // The conflicting records are never announced.
+    RunMainloopUntil([]() { return false; }, Milliseconds(1500));
+    EXPECT_EQ(mPeer.CountAnnouncementsOf("host1.local"), 0u);
+}
+
+TEST_F(MdnsBuiltin, TestServiceNameConflictIsReported)
+{
+    Result         result;
+    ResourceRecord srv;
+
+    srv.mName       = "svc1._test._udp.local";
+    srv.mType       = kRrTypeSrv;
+    srv.mClass      = kRrClassIn;
+    srv.mCacheFlush = true;
+    srv.mTtl        = 120;
+    srv.mTarget     = "other.local";
+    srv.mPort       = 4321;
+
+    mPublisher->PublishService("", "svc1", "_test._udp", {}, 1234, {}, StoreResult(result));
+
+    ASSERT_TRUE(ConflictWithProbe("svc1._test._udp.local", srv));
+    ASSERT_TRUE(RunMainloopUntil([&]() { return result.mDone; }));
+    EXPECT_EQ(result.mError, OTBR_ERROR_DUPLICATED);
+}
+
+TEST_F(MdnsBuiltin, TestServiceOnLocalHostIsRegistered)
+{
+    Result      result;
+    std::string localHostName = GetLocalHostFullName();
+
+    mPublisher->PublishService("", "svc1", "_test._udp", {}, 1234, {}, StoreResult(result));
+
+    ASSERT_TRUE(RunMainloopUntil([&]() { return result.mDone; }));
+    EXPECT_EQ(result.mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(mPeer.CountProbesFor(localHostName), 3u);
+}
+
+TEST_F(MdnsBuiltin, TestLocalHostNameConflictIsReported)
+{
+    Result      result;
+    std::string localHostName = GetLocalHostFullName();
+
+    mPublisher->PublishService("", "svc1", "_test._udp", {}, 1234, {}, StoreResult(result));
+
+    // The service's SRV record points at the local host, so it fails with the local host name.
+    ASSERT_TRUE(ConflictWithProbe(localHostName, MakeAaaaRecord(localHostName, "fe80::99")));
+    ASSERT_TRUE(RunMainloopUntil([&]() { return result.mDone; }));
+    EXPECT_EQ(result.mError, OTBR_ERROR_DUPLICATED);
+}
@@ -0,0 +1,690 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/select.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "mdns/mdns.hpp"
+
+#if OTBR_ENABLE_MDNS_AVAHI
+#include "fake_avahi_client.hpp"
+#else
+#include "fake_dns_sd.hpp"
+#endif
+
+using namespace otbr;
+using namespace otbr::Mdns;
+
+#if OTBR_ENABLE_MDNS_AVAHI
+typedef FakeAvahi FakeDaemon;
+
+static constexpr int kInjectedError = AVAHI_ERR_FAILURE;
+#else
+typedef FakeDnssd FakeDaemon;
+
+static constexpr int kInjectedError = kDNSServiceErr_Refused;
+#endif
+
+#if OTBR_GTEST_BENCHMARK
+// Tracks the heap usage of the publisher, leaving out the allocations of
+// the fake daemon, so that benchmarks report the footprint of the publisher.
+static std::atomic<size_t> sLiveHeapBytes(0);
+
+static constexpr size_t kAllocHeaderSize = alignof(std::max_align_t);
+static constexpr size_t kUntrackedFlag   = ~(SIZE_MAX >> 1);
+
+void *operator new(size_t aSize)
+{
+    uint8_t *block = static_cast<uint8_t *>(malloc(aSize + kAllocHeaderSize));
+
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    if (FakeDaemon::IsInDaemon())
+    {
+        *reinterpret_cast<size_t *>(block) = aSize | kUntrackedFlag;
+    }
+    else
+    {
+        *reinterpret_cast<size_t *>(block) = aSize;
+        sLiveHeapBytes += aSize;
+    }
+
+    return block + kAllocHeaderSize;
+}
+
+void operator delete(void *aPointer) noexcept
+{
+    uint8_t *block;
+    size_t   size;
+
+    VerifyOrExit(aPointer != nullptr);
+
+    block = static_cast<uint8_t *>(aPointer) - kAllocHeaderSize;
+    size  = *reinterpret_cast<size_t *>(block);
+
+    if ((size & kUntrackedFlag) == 0)
+    {
+        sLiveHeapBytes -= size;
+    }
+
+    free(block);
+
+exit:
+    return;
+}
+
+void operator delete(void *aPointer, size_t aSize) noexcept
+{
+    OTBR_UNUSED_VARIABLE(aSize);
+    operator delete(aPointer);
+}
+#endif // OTBR_GTEST_BENCHMARK
+
+static constexpr char     kServiceType[]  = "_test._udp";
+static constexpr uint16_t kAaaaRecordType = 28;
+static constexpr uint16_t kKeyRecordType  = 25;
+
+struct Result
+{
+    bool      mDone  = false;
+    otbrError mError = OTBR_ERROR_NONE;
+};
+
+static Publisher::ResultCallback StoreResult(Result &aResult)
+{
+    return [&aResult](otbrError aError) {
+        aResult.mDone  = true;
+        aResult.mError = aError;
+    };
+}
+
+static uint64_t ElapsedMicroseconds(Timepoint aBegin)
+{
+    return std::chrono::duration_cast<Microseconds>(Clock::now() - aBegin).count();
+}
+
+static void RunMainloopOnce(void)
+{
+    MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 10000};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    MainloopManager::GetInstance().Update(mainloop);
+
+    if (select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+               &mainloop.mTimeout) >= 0)
+    {
+        MainloopManager::GetInstance().Process(mainloop);
+    }
+}
+
+static bool RunMainloopUntil(const std::function<bool(void)> &aCondition, Milliseconds aTimeout = Milliseconds(5000))
+{
+    Timepoint deadline = Clock::now() + aTimeout;
+
+    while (!aCondition() && Clock::now() < deadline)
+    {
+        RunMainloopOnce();
+    }
+
+    return aCondition();
+}
+
+/**
+ * This class runs a `Publisher` backed by the fake daemon of the mDNS backend it is built with.
+ *
+ */
+class MdnsConformance : public ::testing::Test
+{
+protected:
+    void SetUp(void) override
+    {
+        FakeDaemon::Get().Reset();
+
+        mPublisher = Publisher::Create([this](Publisher::State aState) {
+            mStateChangeCount++;
+            mState = aState;
+
+            if (aState == Publisher::State::kReady)
+            {
+                mReadyCount++;
+            }
+        });
+        ASSERT_EQ(mPublisher->Start(), OTBR_ERROR_NONE);
+        ASSERT_TRUE(mPublisher->IsStarted());
+    }
+
+    void TearDown(void) override { Publisher::Destroy(mPublisher); }
+
+    otbrError PublishServiceAndWait(const std::string &aName, uint16_t aPort = 1234)
+    {
+        Result result;
+
+        mPublisher->PublishService("", aName, kServiceType, {"_sub1"}, aPort, {0}, StoreResult(result));
+        EXPECT_TRUE(RunMainloopUntil([&result]() { return result.mDone; }));
+
+        return result.mError;
+    }
+
+    Publisher       *mPublisher        = nullptr;
+    Publisher::State mState            = Publisher::State::kIdle;
+    uint32_t         mReadyCount       = 0;
+    uint32_t         mStateChangeCount = 0;
+};
+
+TEST_F(MdnsConformance, TestPublishAndUnpublishService)
+{
+    Result result;
+
+    EXPECT_EQ(PublishServiceAndWait("svc1"), OTBR_ERROR_NONE);
+    EXPECT_TRUE(FakeDaemon::Get().IsServiceRegistered("svc1", kServiceType));
+
+    mPublisher->UnpublishService("svc1", kServiceType, StoreResult(result));
+    EXPECT_TRUE(RunMainloopUntil([&result]() { return result.mDone; }));
+    EXPECT_EQ(result.mError, OTBR_ERROR_NONE);
+    EXPECT_FALSE(FakeDaemon::Get().IsServiceRegistered("svc1", kServiceType));
+    EXPECT_EQ(FakeDaemon::Get().GetStats().mServiceRegistrations, 1u);
+}
+
+TEST_F(MdnsConformance, TestPublishHostAndKey)
+{
+    Result hostResult;
+    Result keyResult;
+    Result unpublishResult;
+
+    mPublisher->PublishHost("host1", {Ip6Address("fd00::1"), Ip6Address("fd00::2")}, StoreResult(hostResult));
+    mPublisher->PublishKey("host1", {1, 2, 3}, StoreResult(keyResult));
+    EXPECT_TRUE(RunMainloopUntil([&]() { return hostResult.mDone && keyResult.mDone; }));
+    EXPECT_EQ(hostResult.mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(keyResult.mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(FakeDaemon::Get().GetRecordCount("host1.local.", kAaaaRecordType), 2u);
+    EXPECT_EQ(FakeDaemon::Get().GetRecordCount("host1.local.", kKeyRecordType), 1u);
+
+    mPublisher->UnpublishHost("host1", StoreResult(unpublishResult));
+    EXPECT_TRUE(RunMainloopUntil([&]() { return unpublishResult.mDone; }));
+    EXPECT_EQ(FakeDaemon::Get().GetRecordCount("host1.local.", kAaaaRecordType), 0u);
+}
+
+TEST_F(MdnsConformance, TestServiceKeyIsAddedToServiceRegistration)
+{
+    Result keyResult;
+
+    EXPECT_EQ(PublishServiceAndWait("svc1"), OTBR_ERROR_NONE);
+
+    // The key of a service instance is named after the instance and the service type.
+    mPublisher->PublishKey("svc1._test._udp", {1, 2, 3}, StoreResult(keyResult));
+    EXPECT_TRUE(RunMainloopUntil([&]() { return keyResult.mDone; }));
+    EXPECT_EQ(keyResult.mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(FakeDaemon::Get().GetRecordCount("svc1._test._udp.local.", kKeyRecordType), 1u);
+}
+
+TEST_F(MdnsConformance, TestNameConflictIsReportedAsDuplicated)
+{
+    Result hostResult;
+    Result keyResult;
+
+    FakeDaemon::Get().AddConflictingName("svc1._test._udp.local.");
+    FakeDaemon::Get().AddConflictingName("host1.local.");
+
+    EXPECT_EQ(PublishServiceAndWait("svc1"), OTBR_ERROR_DUPLICATED);
+    EXPECT_EQ(PublishServiceAndWait("svc2"), OTBR_ERROR_NONE);
+
+    mPublisher->PublishHost("host1", {Ip6Address("fd00::1")}, StoreResult(hostResult));
+    mPublisher->PublishKey("host1", {1, 2, 3}, StoreResult(keyResult));
+    EXPECT_TRUE(RunMainloopUntil([&]() { return hostResult.mDone && keyResult.mDone; }));
+    EXPECT_EQ(keyResult.mError, OTBR_ERROR_DUPLICATED);
+
+#if OTBR_ENABLE_MDNS_AVAHI
+    // Avahi publishes host addresses as unique records.
+    EXPECT_EQ(hostResult.mError, OTBR_ERROR_DUPLICATED);
+    EXPECT_EQ(FakeDaemon::Get().GetStats().mConflicts, 3u);
+#else
+    // Host addresses are shared records, so only the unique KEY record conflicts.
+    EXPECT_EQ(hostResult.mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(FakeDaemon::Get().GetStats().mConflicts, 2u);
+#endif
+}
+
+TEST_F(MdnsConformance, TestInjectedFailureIsReported)
+{
+    FakeDaemon::Get().FailNextRegistrations(1, kInjectedError);
+
+    EXPECT_NE(PublishServiceAndWait("svc1"), OTBR_ERROR_NONE);
+    EXPECT_FALSE(FakeDaemon::Get().IsServiceRegistered("svc1", kServiceType));
+
+    EXPECT_EQ(PublishServiceAndWait("svc1"), OTBR_ERROR_NONE);
+    EXPECT_EQ(FakeDaemon::Get().GetStats().mFailures, 1u);
+}
+
+TEST_F(MdnsConformance, TestRepliesHonorLatency)
+{
+    Timepoint begin;
+
+    FakeDaemon::Get().SetLatency(Milliseconds(50));
+
+    begin = Clock::now();
+    EXPECT_EQ(PublishServiceAndWait("svc1"), OTBR_ERROR_NONE);
+    EXPECT_GE(ElapsedMicroseconds(begin), 50000u);
+}
+
+TEST_F(MdnsConformance, TestSubscribeServiceResolvesRemoteInstance)
+{
+    std::vector<Publisher::DiscoveredInstanceInfo> instances;
+
+    FakeDaemon::Get().AddRemoteService("remote1", kServiceType, "rhost", 5683, {3, 'a', '=', '1'});
+    FakeDaemon::Get().AddRemoteHostAddress("rhost", Ip6Address("fd00::abcd"));
+
+    mPublisher->AddSubscriptionCallbacks(
+        kServiceType,
+        [&instances](const std::string &, const Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
+            instances.push_back(aInstanceInfo);
+        },
+        nullptr);
+    mPublisher->SubscribeService(kServiceType, "");
+
+    ASSERT_TRUE(RunMainloopUntil([&]() { return !instances.empty(); }));
+    EXPECT_EQ(instances[0].mName, "remote1");
+    EXPECT_EQ(instances[0].mHostName, "rhost.local.");
+    EXPECT_EQ(instances[0].mPort, 5683);
+    EXPECT_EQ(instances[0].mTxtData, std::vector<uint8_t>({3, 'a', '=', '1'}));
+    ASSERT_EQ(instances[0].mAddresses.size(), 1u);
+    EXPECT_EQ(instances[0].mAddresses[0], Ip6Address("fd00::abcd"));
+
+    FakeDaemon::Get().RemoveRemoteService("remote1", kServiceType);
+    ASSERT_TRUE(RunMainloopUntil([&]() { return instances.size() == 2; }));
+    EXPECT_EQ(instances[1].mName, "remote1");
+    EXPECT_TRUE(instances[1].mRemoved);
+
+    mPublisher->UnsubscribeService(kServiceType, "");
+}
+
+TEST_F(MdnsConformance, TestSubscribeHostResolvesAddresses)
+{
+    std::vector<Publisher::DiscoveredHostInfo> hosts;
+
+    FakeDaemon::Get().AddRemoteHostAddress("rhost", Ip6Address("fd00::1"));
+
+    mPublisher->AddSubscriptionCallbacks(
+        nullptr, [&hosts](const std::string &aHostName, const Publisher::DiscoveredHostInfo &aHostInfo) {
+            EXPECT_EQ(aHostName, "rhost");
+            hosts.push_back(aHostInfo);
+        });
+    mPublisher->SubscribeHost("rhost");
+
+    ASSERT_TRUE(RunMainloopUntil([&]() { return !hosts.empty(); }));
+    EXPECT_EQ(hosts[0].mHostName, "rhost.local.");
+    EXPECT_EQ(hosts[0].mAddresses, std::vector<Ip6Address>({Ip6Address("fd00::1")}));
+
+    FakeDaemon::Get().AddRemoteHostAddress("rhost", Ip6Address("fd00::2"));
+    ASSERT_TRUE(RunMainloopUntil([&]() { return hosts.size() == 2; }));
+    EXPECT_EQ(hosts[1].mAddresses.size(), 2u);
+
+    mPublisher->UnsubscribeHost("rhost");
+}
+
+TEST_F(MdnsConformance, TestUnsubscribeFromCallback)
+{
+    std::vector<Publisher::DiscoveredInstanceInfo> instances;
+    std::vector<Publisher::DiscoveredHostInfo>     hosts;
+
+    FakeDaemon::Get().AddRemoteService("remote1", kServiceType, "rhost", 5683, {3, 'a', '=', '1'});
+    FakeDaemon::Get().AddRemoteHostAddress("rhost", Ip6Address("fd00::abcd"));
+
+    // The first subscriber frees the subscriptions which own the arguments the second one receives.
+    mPublisher->AddSubscriptionCallbacks(
+        [this](const std::string &aType, const Publisher::DiscoveredInstanceInfo &) {
+            mPublisher->UnsubscribeService(aType, "");
+        },
+        [this](const std::string &aHostName, const Publisher::DiscoveredHostInfo &) {
+            mPublisher->UnsubscribeHost(aHostName);
+        });
+    mPublisher->AddSubscriptionCallbacks(
+        [&instances](const std::string &aType, const Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
+            EXPECT_EQ(aType, kServiceType);
+            instances.push_back(aInstanceInfo);
+        },
+        [&hosts](const std::string &aHostName, const Publisher::DiscoveredHostInfo &aHostInfo) {
+            EXPECT_EQ(aHostName, "rhost");
+            hosts.push_back(aHostInfo);
+        });
+    mPublisher->SubscribeService(kServiceType, "");
+    mPublisher->SubscribeHost("rhost");
+
+    ASSERT_TRUE(RunMainloopUntil([&]() { return !instances.empty() && !hosts.empty(); }));
+    EXPECT_EQ(instances[0].mName, "remote1");
+    EXPECT_EQ(instances[0].mHostName, "rhost.local.");
+    EXPECT_EQ(hosts[0].mAddresses, std::vector<Ip6Address>({Ip6Address("fd00::abcd")}));
+
+    // Nothing is delivered once unsubscribed.
+    FakeDaemon::Get().RemoveRemoteService("remote1", kServiceType);
+    FakeDaemon::Get().AddRemoteHostAddress("rhost", Ip6Address("fd00::2"));
+    EXPECT_FALSE(RunMainloopUntil([&]() { return instances.size() > 1 || hosts.size() > 1; }, Milliseconds(200)));
+}
+
+TEST_F(MdnsConformance, TestRecoversAfterDaemonRestart)
+{
+    EXPECT_EQ(PublishServiceAndWait("svc1"), OTBR_ERROR_NONE);
+    EXPECT_EQ(mReadyCount, 1u);
+
+    FakeDaemon::Get().SetRunning(false);
+    EXPECT_EQ(FakeDaemon::Get().GetServiceCount(), 0u);
+
+    // The publisher restarts itself once it sees the daemon is gone. Depending on the
+    // backend, it then waits for the daemon or reports ready until the next request fails.
+    EXPECT_TRUE(RunMainloopUntil([this]() { return mStateChangeCount > 1; }));
+    EXPECT_TRUE(mPublisher->IsStarted());
+    EXPECT_NE(PublishServiceAndWait("svc1"), OTBR_ERROR_NONE);
+
+    FakeDaemon::Get().SetRunning(true);
+    EXPECT_TRUE(RunMainloopUntil([this]() { return mState == Publisher::State::kReady; }));
+    EXPECT_EQ(PublishServiceAndWait("svc1"), OTBR_ERROR_NONE);
+    EXPECT_TRUE(FakeDaemon::Get().IsServiceRegistered("svc1", kServiceType));
+}
+
+#if OTBR_GTEST_BENCHMARK
+static std::string MakeInstanceName(uint32_t aIndex)
+{
+    char name[32];
+
+    snprintf(name, sizeof(name), "device-%05u", aIndex);
+
+    return name;
+}
+
+static void BenchmarkRegistration(Publisher &aPublisher, uint32_t aNumServices, Milliseconds aLatency)
+{
+    std::vector<uint8_t> txtData      = {7, 'r', 'v', '=', '1', '.', '0', '0'};
+    uint32_t             numCompleted = 0;
+    uint32_t             numFailed    = 0;
+    size_t               baseHeapBytes;
+    size_t               publishedHeapBytes;
+    Timepoint            begin;
+    uint64_t             publishUs;
+    uint64_t             unpublishUs;
+
+    FakeDaemon::Get().SetLatency(aLatency);
+    baseHeapBytes = sLiveHeapBytes;
+
+    begin = Clock::now();
+    for (uint32_t i = 0; i < aNumServices; i++)
+    {
+        aPublisher.PublishService("", MakeInstanceName(i), kServiceType, {}, 1000, txtData,
+                                  [&numCompleted, &numFailed](otbrError aError) {
+                                      numCompleted++;
+                                      numFailed += (aError != OTBR_ERROR_NONE);
+                                  });
+    }
+    EXPECT_TRUE(RunMainloopUntil([&]() { return numCompleted == aNumServices; }, Milliseconds(60000)));
+    publishUs = ElapsedMicroseconds(begin);
+
+    publishedHeapBytes = sLiveHeapBytes;
+    EXPECT_EQ(numFailed, 0u);
+    EXPECT_EQ(FakeDaemon::Get().GetServiceCount(), aNumServices);
+
+    numCompleted = 0;
+    begin        = Clock::now();
+    for (uint32_t i = 0; i < aNumServices; i++)
+    {
+        aPublisher.UnpublishService(MakeInstanceName(i), kServiceType,
+                                    [&numCompleted](otbrError aError) {
+                                        EXPECT_EQ(aError, OTBR_ERROR_NONE);
+                                        numCompleted++;
+                                    });
+    }
+    EXPECT_TRUE(RunMainloopUntil([&]() { return numCompleted == aNumServices; }));
+    unpublishUs = ElapsedMicroseconds(begin);
+
+    EXPECT_EQ(FakeDaemon::Get().GetServiceCount(), 0u);
+
+    std::cout << "services: " << aNumServices << ", latency: " << aLatency.count() << " ms" << std::endl;
+    std::cout << "publish: " << publishUs << " us, " << (publishUs > 0 ? aNumServices * 1000000ull / publishUs : 0)
+              << " services/s, unpublish: " << unpublishUs << " us" << std::endl;
+    std::cout << "heap: " << (publishedHeapBytes - baseHeapBytes) << " bytes, "
+              << (publishedHeapBytes - baseHeapBytes) / aNumServices << " bytes/service" << std::endl;
+}
+
+static void InitMainloop(MainloopContext &aMainloop)
+{
+    aMainloop.mMaxFd   = -1;
+    aMainloop.mTimeout = {0, 0};
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+}
+
+// Returns the number of fds the mainloop processors add to the select sets.
+static uint32_t CountMainloopFds(void)
+{
+    MainloopContext mainloop;
+    uint32_t        count = 0;
+
+    InitMainloop(mainloop);
+    MainloopManager::GetInstance().Update(mainloop);
+
+    for (int fd = 0; fd <= mainloop.mMaxFd; fd++)
+    {
+        count += (FD_ISSET(fd, &mainloop.mReadFdSet) || FD_ISSET(fd, &mainloop.mWriteFdSet) ||
+                  FD_ISSET(fd, &mainloop.mErrorFdSet));
+    }
+
+    return count;
+}
+
+// Returns the number of fds opened by the process, including the ones of the fake daemon.
+static uint32_t CountOpenFds(void)
+{
+    DIR           *dir   = opendir("/proc/self/fd");
+    uint32_t       count = 0;
+    struct dirent *entry;
+
+    VerifyOrExit(dir != nullptr);
+
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        count += (entry->d_name[0] != '.');
+    }
+
+    // Leaves out the fd of `dir` itself.
+    count--;
+    closedir(dir);
+
+exit:
+    return count;
+}
+
+TEST_F(MdnsConformance, BenchmarkMainloopWith1000Registrations)
+{
+    static constexpr uint32_t kNumServices   = 1000;
+    static constexpr uint32_t kNumIterations = 10000;
+
+    uint32_t  numCompleted = 0;
+    uint32_t  baseMainloopFds;
+    uint32_t  baseOpenFds;
+    uint32_t  mainloopFds;
+    uint32_t  openFds;
+    Timepoint begin;
+    uint64_t  iterationsUs;
+
+    auto publish = [this, &numCompleted](uint32_t aIndex) {
+        mPublisher->PublishService("", MakeInstanceName(aIndex), kServiceType, {}, 1000, {0},
+                                   [&numCompleted](otbrError aError) {
+                                       EXPECT_EQ(aError, OTBR_ERROR_NONE);
+                                       numCompleted++;
+                                   });
+    };
+
+    // The shared connection is created by the first registration, so the
+    // baseline is taken once it completes.
+    publish(0);
+    ASSERT_TRUE(RunMainloopUntil([&]() { return numCompleted == 1; }));
+
+    baseMainloopFds = CountMainloopFds();
+    baseOpenFds     = CountOpenFds();
+
+    for (uint32_t i = 1; i < kNumServices; i++)
+    {
+        publish(i);
+    }
+    ASSERT_TRUE(RunMainloopUntil([&]() { return numCompleted == kNumServices; }, Milliseconds(60000)));
+    ASSERT_EQ(FakeDaemon::Get().GetServiceCount(), kNumServices);
+
+    mainloopFds = CountMainloopFds();
+    openFds     = CountOpenFds();
+
+    // All registrations share the connection of the publisher, so they must
+    // not add any fd to the mainloop.
+    EXPECT_EQ(mainloopFds, 1u);
+    EXPECT_EQ(mainloopFds, baseMainloopFds);
+    EXPECT_EQ(openFds, baseOpenFds);
+
+    // Measures an idle iteration, i.e. Update + select + Process without
+    // any pending reply, which no longer grows with the registrations.
+    begin = Clock::now();
+    for (uint32_t i = 0; i < kNumIterations; i++)
+    {
+        MainloopContext mainloop;
+
+        InitMainloop(mainloop);
+        MainloopManager::GetInstance().Update(mainloop);
+        mainloop.mTimeout = {0, 0};
+
+        if (select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                   &mainloop.mTimeout) >= 0)
+        {
+            MainloopManager::GetInstance().Process(mainloop);
+        }
+    }
+    iterationsUs = ElapsedMicroseconds(begin);
+
+    std::cout << "services: " << kNumServices << ", mainloop fds: " << mainloopFds
+              << ", process fds: " << openFds << std::endl;
+    std::cout << "mainloop iteration: " << iterationsUs * 1000 / kNumIterations << " ns" << std::endl;
+}
+
+TEST_F(MdnsConformance, BenchmarkRegister5000Services)
+{
+    BenchmarkRegistration(*mPublisher, 5000, Milliseconds(0));
+}
+
+TEST_F(MdnsConformance, BenchmarkRegister5000ServicesWith20msLatency)
+{
+    BenchmarkRegistration(*mPublisher, 5000, Milliseconds(20));
+}
+
+TEST_F(MdnsConformance, BenchmarkConflictResolution)
+{
+    static constexpr uint32_t kNumServices    = 2000;
+    static constexpr uint32_t kConflictPeriod = 10;
+
+    std::vector<Timepoint> beginTimes(kNumServices);
+    std::vector<uint32_t>  conflicted;
+    std::vector<uint64_t>  resolutionUs;
+    uint32_t               numCompleted = 0;
+    uint64_t               totalUs      = 0;
+
+    FakeDaemon::Get().SetLatency(Milliseconds(5));
+
+    for (uint32_t i = 0; i < kNumServices; i += kConflictPeriod)
+    {
+        FakeDaemon::Get().AddConflictingName(MakeInstanceName(i) + "." + kServiceType + ".local.");
+    }
+
+    for (uint32_t i = 0; i < kNumServices; i++)
+    {
+        beginTimes[i] = Clock::now();
+        mPublisher->PublishService("", MakeInstanceName(i), kServiceType, {}, 1000, {0},
+                                   [&numCompleted, &conflicted, i](otbrError aError) {
+                                       if (aError == OTBR_ERROR_DUPLICATED)
+                                       {
+                                           conflicted.push_back(i);
+                                       }
+                                       else
+                                       {
+                                           EXPECT_EQ(aError, OTBR_ERROR_NONE);
+                                           numCompleted++;
+                                       }
+                                   });
+    }
+
+    // Conflicting services are renamed and published again from the
+    // mainloop, the way a client would react to the conflict.
+    EXPECT_TRUE(RunMainloopUntil(
+        [&]() {
+            for (uint32_t index : conflicted)
+            {
+                mPublisher->PublishService("", MakeInstanceName(index) + " (2)", kServiceType, {}, 1000, {0},
+                                           [&numCompleted, &resolutionUs, &beginTimes, index](otbrError aError) {
+                                               EXPECT_EQ(aError, OTBR_ERROR_NONE);
+                                               resolutionUs.push_back(ElapsedMicroseconds(beginTimes[index]));
+                                               numCompleted++;
+                                           });
+            }
+            conflicted.clear();
+
+            return numCompleted == kNumServices;
+        },
+        Milliseconds(60000)));
+
+    ASSERT_EQ(resolutionUs.size(), kNumServices / kConflictPeriod);
+    EXPECT_EQ(FakeDaemon::Get().GetStats().mConflicts, kNumServices / kConflictPeriod);
+
+    for (uint64_t us : resolutionUs)
+    {
+        totalUs += us;
+    }
+
+    std::cout << "services: " << kNumServices << ", conflicts: " << resolutionUs.size() << std::endl;
+    std::cout << "conflict resolution: avg " << totalUs / resolutionUs.size() << " us, max "
+              << *std::max_element(resolutionUs.begin(), resolutionUs.end()) << " us" << std::endl;
+}
+#endif // OTBR_GTEST_BENCHMARK
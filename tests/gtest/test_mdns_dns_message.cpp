@@ -0,0 +1,182 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "mdns/dns_message.hpp"
+
+using namespace otbr;
+using namespace otbr::Mdns;
+
+static ResourceRecord MakeSrvRecord(const std::string &aName, const std::string &aTarget, uint16_t aPort)
+{
+    ResourceRecord record;
+
+    record.mName       = aName;
+    record.mType       = kRrTypeSrv;
+    record.mClass      = kRrClassIn;
+    record.mCacheFlush = true;
+    record.mTtl        = 120;
+    record.mTarget     = aTarget;
+    record.mPort       = aPort;
+
+    return record;
+}
+
+TEST(DnsMessage, TestWriteAndParse)
+{
+    MessageWriter  writer(0x1234, Message::kFlagResponse | Message::kFlagAuthoritative, 1440);
+    Message        message;
+    Question       question;
+    ResourceRecord ptr;
+    ResourceRecord txt;
+    ResourceRecord srv = MakeSrvRecord("My\\.Service._meshcop._udp.local", "host.local", 49152);
+
+    question.mName            = "_meshcop._udp.local";
+    question.mType            = kRrTypePtr;
+    question.mClass           = kRrClassIn;
+    question.mUnicastResponse = true;
+
+    ptr.mName   = "_meshcop._udp.local";
+    ptr.mType   = kRrTypePtr;
+    ptr.mClass  = kRrClassIn;
+    ptr.mTtl    = 4500;
+    ptr.mTarget = "My\\.Service._meshcop._udp.local";
+
+    txt.mName  = "My\\.Service._meshcop._udp.local";
+    txt.mType  = kRrTypeTxt;
+    txt.mClass = kRrClassIn;
+    txt.mTtl   = 4500;
+    txt.mData  = {3, 'a', '=', 'b'};
+
+    EXPECT_TRUE(writer.AppendQuestion(question));
+    EXPECT_TRUE(writer.AppendRecord(MessageWriter::kAnswer, ptr));
+    EXPECT_TRUE(writer.AppendRecord(MessageWriter::kAdditional, srv));
+    EXPECT_TRUE(writer.AppendRecord(MessageWriter::kAdditional, txt));
+
+    ASSERT_EQ(message.Parse(writer.GetBuffer().data(), writer.GetBuffer().size()), OTBR_ERROR_NONE);
+
+    EXPECT_EQ(message.mId, 0x1234);
+    EXPECT_TRUE(message.IsResponse());
+    ASSERT_EQ(message.mQuestions.size(), 1u);
+    EXPECT_TRUE(NameEquals(message.mQuestions[0].mName, question.mName));
+    EXPECT_TRUE(message.mQuestions[0].mUnicastResponse);
+
+    ASSERT_EQ(message.mAnswers.size(), 1u);
+    EXPECT_TRUE(message.mAnswers[0].IsSameAs(ptr));
+    EXPECT_FALSE(message.mAnswers[0].mCacheFlush);
+
+    ASSERT_EQ(message.mAdditionals.size(), 2u);
+    EXPECT_TRUE(message.mAdditionals[0].IsSameAs(srv));
+    EXPECT_TRUE(message.mAdditionals[0].mCacheFlush);
+    EXPECT_EQ(message.mAdditionals[0].mPort, 49152);
+    EXPECT_TRUE(message.mAdditionals[1].IsSameAs(txt));
+}
+
+TEST(DnsMessage, TestNameCompression)
+{
+    MessageWriter  single(0, Message::kFlagResponse, 1440);
+    MessageWriter  repeated(0, Message::kFlagResponse, 1440);
+    ResourceRecord srv = MakeSrvRecord("ins._srv._udp.local", "host.local", 1);
+
+    EXPECT_TRUE(single.AppendRecord(MessageWriter::kAnswer, srv));
+
+    srv.mName = "INS._srv._udp.local";
+    EXPECT_TRUE(repeated.AppendRecord(MessageWriter::kAnswer, srv));
+    EXPECT_TRUE(repeated.AppendRecord(MessageWriter::kAnswer, srv));
+
+    // Both names of the second record are compressed into pointers (2 bytes each), leaving
+    // TYPE, CLASS, TTL, RDLENGTH (10 bytes) and priority, weight and port (6 bytes).
+    EXPECT_EQ(repeated.GetBuffer().size() - single.GetBuffer().size(), 20u);
+}
+
+TEST(DnsMessage, TestAppendRollsBackWhenFull)
+{
+    MessageWriter  writer(0, Message::kFlagResponse, 100);
+    ResourceRecord txt;
+    Message        message;
+
+    txt.mName  = "a.local";
+    txt.mType  = kRrTypeTxt;
+    txt.mClass = kRrClassIn;
+    txt.mTtl   = 4500;
+    txt.mData.assign(60, 'x');
+
+    EXPECT_TRUE(writer.AppendRecord(MessageWriter::kAnswer, txt));
+    EXPECT_FALSE(writer.AppendRecord(MessageWriter::kAnswer, txt));
+    EXPECT_EQ(writer.GetCount(MessageWriter::kAnswer), 1);
+
+    writer.AddFlags(Message::kFlagTruncated);
+    ASSERT_EQ(message.Parse(writer.GetBuffer().data(), writer.GetBuffer().size()), OTBR_ERROR_NONE);
+    EXPECT_EQ(message.mAnswers.size(), 1u);
+    EXPECT_TRUE(message.mFlags & Message::kFlagTruncated);
+}
+
+TEST(DnsMessage, TestParseRejectsMalformedMessages)
+{
+    MessageWriter        writer(0, Message::kFlagResponse, 1440);
+    ResourceRecord       srv = MakeSrvRecord("ins._srv._udp.local", "host.local", 1);
+    std::vector<uint8_t> buffer;
+    Message              message;
+
+    EXPECT_TRUE(writer.AppendRecord(MessageWriter::kAnswer, srv));
+    buffer = writer.GetBuffer();
+
+    for (size_t length = 0; length < buffer.size(); length++)
+    {
+        EXPECT_NE(message.Parse(buffer.data(), length), OTBR_ERROR_NONE) << "length " << length;
+    }
+
+    // A compression pointer to itself.
+    buffer = {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0xc0, 12, 0, 1, 0, 1};
+    EXPECT_EQ(message.Parse(buffer.data(), buffer.size()), OTBR_ERROR_PARSE);
+}
+
+TEST(DnsMessage, TestProbeTiebreakOrder)
+{
+    ResourceRecord first  = MakeSrvRecord("ins._srv._udp.local", "host.local", 1);
+    ResourceRecord second = MakeSrvRecord("ins._srv._udp.local", "host.local", 2);
+
+    EXPECT_LT(first.Compare(second), 0);
+    EXPECT_GT(second.Compare(first), 0);
+    EXPECT_EQ(first.Compare(first), 0);
+}
+
+TEST(DnsMessage, TestLabelHelpers)
+{
+    std::string rest;
+
+    EXPECT_EQ(EscapeLabel("a.b\\c"), "a\\.b\\\\c");
+    EXPECT_EQ(SplitFirstLabel("a\\.b\\\\c._srv._udp.local", rest), "a.b\\c");
+    EXPECT_EQ(rest, "_srv._udp.local");
+    EXPECT_TRUE(NameEquals("Host.LOCAL", "host.local"));
+    EXPECT_EQ(ToLowerName("Host.LOCAL"), "host.local");
+}
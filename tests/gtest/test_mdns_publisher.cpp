@@ -0,0 +1,558 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+#include "mdns/mdns.hpp"
+
+using namespace otbr;
+using namespace otbr::Mdns;
+
+#if OTBR_GTEST_BENCHMARK
+// Tracks the heap usage of the test process, so that benchmarks can report the
+// memory footprint of the publisher.
+static std::atomic<size_t> sLiveHeapBytes(0);
+static std::atomic<size_t> sAllocationCount(0);
+
+static constexpr size_t kAllocHeaderSize = alignof(std::max_align_t);
+
+void *operator new(size_t aSize)
+{
+    uint8_t *block = static_cast<uint8_t *>(malloc(aSize + kAllocHeaderSize));
+
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast<size_t *>(block) = aSize;
+    sLiveHeapBytes += aSize;
+    sAllocationCount++;
+
+    return block + kAllocHeaderSize;
+}
+
+void operator delete(void *aPointer) noexcept
+{
+    uint8_t *block;
+
+    VerifyOrExit(aPointer != nullptr);
+
+    block = static_cast<uint8_t *>(aPointer) - kAllocHeaderSize;
+    sLiveHeapBytes -= *reinterpret_cast<size_t *>(block);
+    free(block);
+
+exit:
+    return;
+}
+
+void operator delete(void *aPointer, size_t aSize) noexcept
+{
+    OTBR_UNUSED_VARIABLE(aSize);
+    operator delete(aPointer);
+}
+#endif // OTBR_GTEST_BENCHMARK
+
+/**
+ * This class implements a `Publisher` which completes every operation immediately, so
+ * that the bookkeeping in the `Publisher` base can be tested and measured on its own.
+ *
+ */
+class FakePublisher : public Publisher
+{
+public:
+    using Publisher::FindHostRegistration;
+    using Publisher::FindKeyRegistration;
+    using Publisher::FindServiceRegistration;
+    using Publisher::OnHostResolved;
+    using Publisher::OnServiceResolved;
+
+    ~FakePublisher(void) override { Stop(); }
+
+    otbrError Start(void) override { return OTBR_ERROR_NONE; }
+
+    void Stop(void) override
+    {
+        mServiceRegistrations.clear();
+        mHostRegistrations.clear();
+        mKeyRegistrations.clear();
+    }
+
+    bool IsStarted(void) const override { return true; }
+
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override
+    {
+        RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override
+    {
+        RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override
+    {
+        RemoveKeyRegistration(aName, OTBR_ERROR_ABORTED);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void SubscribeService(const std::string &, const std::string &) override {}
+    void UnsubscribeService(const std::string &, const std::string &) override {}
+    void SubscribeHost(const std::string &) override {}
+    void UnsubscribeHost(const std::string &) override {}
+
+    size_t GetServiceRegistrationCount(void) const { return mServiceRegistrations.size(); }
+    size_t GetHostRegistrationCount(void) const { return mHostRegistrations.size(); }
+    size_t GetKeyRegistrationCount(void) const { return mKeyRegistrations.size(); }
+    size_t GetInternedNameCount(void) const { return mNameTable.GetSize(); }
+    size_t GetSharedTxtDataCount(void) const { return mTxtDataTable.GetSize(); }
+    size_t GetSharedSubTypeListCount(void) const { return mSubTypeListTable.GetSize(); }
+
+protected:
+    otbrError PublishServiceImpl(const std::string &aHostName,
+                                 const std::string &aName,
+                                 const std::string &aType,
+                                 const SubTypeList &aSubTypeList,
+                                 uint16_t           aPort,
+                                 const TxtData     &aTxtData,
+                                 ResultCallback   &&aCallback) override
+    {
+        ServiceRegistration *serviceReg;
+
+        aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, aSubTypeList, aPort, aTxtData,
+                                                       std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        serviceReg = new ServiceRegistration(aHostName, aName, aType, aSubTypeList, aPort, aTxtData,
+                                             std::move(aCallback), this);
+        AddServiceRegistration(ServiceRegistrationPtr(serviceReg));
+        serviceReg->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return OTBR_ERROR_NONE;
+    }
+
+    otbrError PublishHostImpl(const std::string &aName,
+                              const AddressList &aAddresses,
+                              ResultCallback   &&aCallback) override
+    {
+        HostRegistration *hostReg;
+
+        aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        hostReg = new HostRegistration(aName, aAddresses, std::move(aCallback), this);
+        AddHostRegistration(HostRegistrationPtr(hostReg));
+        hostReg->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return OTBR_ERROR_NONE;
+    }
+
+    otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override
+    {
+        KeyRegistration *keyReg;
+
+        aCallback = HandleDuplicateKeyRegistration(aName, aKeyData, std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        keyReg = new KeyRegistration(aName, aKeyData, std::move(aCallback), this);
+        AddKeyRegistration(KeyRegistrationPtr(keyReg));
+        keyReg->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return OTBR_ERROR_NONE;
+    }
+
+    void OnServiceResolveFailedImpl(const std::string &, const std::string &, int32_t) override {}
+    void OnHostResolveFailedImpl(const std::string &, int32_t) override {}
+    otbrError DnsErrorToOtbrError(int32_t aError) override { return aError == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS; }
+};
+
+static Publisher::ResultCallback ExpectResult(otbrError aExpectedError)
+{
+    return [aExpectedError](otbrError aError) { EXPECT_EQ(aError, aExpectedError); };
+}
+
+TEST(MdnsPublisher, TestLookupIsCaseInsensitive)
+{
+    FakePublisher publisher;
+
+    publisher.PublishService("", "Living Room", "_Meshcop._udp", {}, 49154, {0}, ExpectResult(OTBR_ERROR_NONE));
+
+    EXPECT_NE(publisher.FindServiceRegistration("living room", "_meshcop._udp"), nullptr);
+    EXPECT_NE(publisher.FindServiceRegistration("LIVING ROOM._MESHCOP._UDP"), nullptr);
+    EXPECT_EQ(publisher.FindServiceRegistration("Kitchen", "_meshcop._udp"), nullptr);
+    EXPECT_EQ(publisher.FindServiceRegistration("Living Room", "_trel._udp"), nullptr);
+
+    publisher.UnpublishService("living room", "_MESHCOP._udp", ExpectResult(OTBR_ERROR_NONE));
+    EXPECT_EQ(publisher.GetServiceRegistrationCount(), 0u);
+    EXPECT_EQ(publisher.GetInternedNameCount(), 0u);
+}
+
+TEST(MdnsPublisher, TestKeyRegistrationNames)
+{
+    FakePublisher publisher;
+
+    publisher.PublishKey("host1", {1, 2, 3}, ExpectResult(OTBR_ERROR_NONE));
+    publisher.PublishKey("ins1.with.dots._srv._udp", {4, 5, 6}, ExpectResult(OTBR_ERROR_NONE));
+
+    EXPECT_NE(publisher.FindKeyRegistration("host1"), nullptr);
+    EXPECT_NE(publisher.FindKeyRegistration("ins1.with.dots._srv._udp"), nullptr);
+    EXPECT_NE(publisher.FindKeyRegistration("ins1.with.dots", "_srv._udp"), nullptr);
+    EXPECT_EQ(publisher.FindKeyRegistration("ins1", "_srv._udp"), nullptr);
+    EXPECT_EQ(publisher.FindKeyRegistration("host1", "_srv._udp"), nullptr);
+
+    publisher.UnpublishKey("INS1.with.dots._srv._udp", ExpectResult(OTBR_ERROR_NONE));
+    publisher.UnpublishKey("host1", ExpectResult(OTBR_ERROR_NONE));
+    EXPECT_EQ(publisher.GetKeyRegistrationCount(), 0u);
+    EXPECT_EQ(publisher.GetInternedNameCount(), 0u);
+}
+
+TEST(MdnsPublisher, TestPayloadsAreShared)
+{
+    FakePublisher      publisher;
+    Publisher::TxtData txtData = {3, 'a', '=', '1'};
+
+    publisher.PublishService("", "ins1", "_srv._udp", {"_b", "_a"}, 1234, txtData, ExpectResult(OTBR_ERROR_NONE));
+    publisher.PublishService("", "ins2", "_srv._udp", {"_a", "_b"}, 1234, txtData, ExpectResult(OTBR_ERROR_NONE));
+
+    ASSERT_NE(publisher.FindServiceRegistration("ins1", "_srv._udp"), nullptr);
+    EXPECT_EQ(publisher.GetSharedTxtDataCount(), 1u);
+    EXPECT_EQ(publisher.GetSharedSubTypeListCount(), 1u);
+    EXPECT_EQ(publisher.FindServiceRegistration("ins1", "_srv._udp")->mTxtData,
+              publisher.FindServiceRegistration("ins2", "_srv._udp")->mTxtData);
+
+    publisher.Stop();
+    EXPECT_EQ(publisher.GetSharedTxtDataCount(), 0u);
+    EXPECT_EQ(publisher.GetSharedSubTypeListCount(), 0u);
+    EXPECT_EQ(publisher.GetInternedNameCount(), 0u);
+}
+
+TEST(MdnsPublisher, TestFlatIdMap)
+{
+    FlatIdMap<std::unique_ptr<int>> map;
+    size_t                          count = 0;
+
+    EXPECT_TRUE(map.find(1) == map.end());
+
+    for (uint64_t key = 1; key <= 1000; key++)
+    {
+        EXPECT_TRUE(map.emplace(key << 32, std::unique_ptr<int>(new int(static_cast<int>(key)))).second);
+    }
+
+    EXPECT_FALSE(map.emplace(7ull << 32, nullptr).second);
+    EXPECT_EQ(map.size(), 1000u);
+
+    // Leaves tombstones behind which must not break the probe sequences of the other keys.
+    for (uint64_t key = 1; key <= 1000; key += 2)
+    {
+        map.erase(map.find(key << 32));
+    }
+
+    EXPECT_EQ(map.size(), 500u);
+    EXPECT_TRUE(map.find(0) == map.end());
+    EXPECT_TRUE(map.find(3ull << 32) == map.end());
+    ASSERT_TRUE(map.find(4ull << 32) != map.end());
+    EXPECT_EQ(*map.find(4ull << 32)->second, 4);
+
+    for (const auto &entry : map)
+    {
+        EXPECT_EQ(static_cast<uint64_t>(*entry.second) << 32, entry.first);
+        count++;
+    }
+
+    EXPECT_EQ(count, 500u);
+    map.clear();
+    EXPECT_EQ(map.size(), 0u);
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST(MdnsPublisher, TestFlatIdMapValueDestructorMayModifyMap)
+{
+    struct Value
+    {
+        explicit Value(std::function<void(void)> aOnDestroy)
+            : mOnDestroy(std::move(aOnDestroy))
+        {
+        }
+        ~Value(void) { mOnDestroy(); }
+
+        std::function<void(void)> mOnDestroy;
+    };
+
+    FlatIdMap<std::unique_ptr<Value>> map;
+
+    map.emplace(1, std::unique_ptr<Value>(new Value([&map]() { map.emplace(2, nullptr); })));
+    map.erase(map.find(1));
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_TRUE(map.find(2) != map.end());
+
+    map.emplace(3, std::unique_ptr<Value>(new Value([&map]() { map.emplace(4, nullptr); })));
+    map.clear();
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_TRUE(map.find(4) != map.end());
+}
+
+#if OTBR_GTEST_BENCHMARK
+static uint64_t ElapsedMicroseconds(Timepoint aBegin)
+{
+    return std::chrono::duration_cast<Microseconds>(Clock::now() - aBegin).count();
+}
+
+static std::string MakeInstanceName(uint32_t aIndex)
+{
+    char name[32];
+
+    snprintf(name, sizeof(name), "device-%05u", aIndex);
+
+    return name;
+}
+
+TEST(MdnsPublisher, BenchmarkPublishUpdateUnpublish10kServices)
+{
+    static constexpr uint32_t kNumServices = 10000;
+    static constexpr uint32_t kNumTxtKinds = 8;
+
+    FakePublisher                   publisher;
+    std::vector<Publisher::TxtData> txtDataList;
+    size_t                          baseHeapBytes;
+    size_t                          publishedHeapBytes;
+    Timepoint                       begin;
+    uint64_t                        publishUs;
+    uint64_t                        updateUs;
+    uint64_t                        unpublishUs;
+
+    for (uint32_t i = 0; i < kNumTxtKinds * 2; i++)
+    {
+        Publisher::TxtData txtData;
+
+        Publisher::EncodeTxtData({{"rv", "1"}, {"model", std::to_string(i).c_str()}}, txtData);
+        txtDataList.push_back(txtData);
+    }
+
+    baseHeapBytes = sLiveHeapBytes;
+
+    begin = Clock::now();
+    for (uint32_t i = 0; i < kNumServices; i++)
+    {
+        publisher.PublishService("", MakeInstanceName(i), "_bench._udp", {"_sub1"}, 1000,
+                                 txtDataList[i % kNumTxtKinds], ExpectResult(OTBR_ERROR_NONE));
+    }
+    publishUs = ElapsedMicroseconds(begin);
+
+    publishedHeapBytes = sLiveHeapBytes;
+    EXPECT_EQ(publisher.GetServiceRegistrationCount(), kNumServices);
+    EXPECT_EQ(publisher.GetInternedNameCount(), kNumServices + 1);
+    EXPECT_EQ(publisher.GetSharedTxtDataCount(), kNumTxtKinds);
+
+    begin = Clock::now();
+    for (uint32_t i = 0; i < kNumServices; i++)
+    {
+        publisher.PublishService("", MakeInstanceName(i), "_bench._udp", {"_sub1"}, 1000,
+                                 txtDataList[kNumTxtKinds + i % kNumTxtKinds], ExpectResult(OTBR_ERROR_NONE));
+    }
+    updateUs = ElapsedMicroseconds(begin);
+
+    EXPECT_EQ(publisher.GetServiceRegistrationCount(), kNumServices);
+    EXPECT_EQ(publisher.GetSharedTxtDataCount(), kNumTxtKinds);
+
+    begin = Clock::now();
+    for (uint32_t i = 0; i < kNumServices; i++)
+    {
+        publisher.UnpublishService(MakeInstanceName(i), "_bench._udp", ExpectResult(OTBR_ERROR_NONE));
+    }
+    unpublishUs = ElapsedMicroseconds(begin);
+
+    EXPECT_EQ(publisher.GetServiceRegistrationCount(), 0u);
+    EXPECT_EQ(publisher.GetInternedNameCount(), 0u);
+    EXPECT_EQ(publisher.GetSharedTxtDataCount(), 0u);
+    EXPECT_EQ(publisher.GetSharedSubTypeListCount(), 0u);
+
+    std::cout << "services: " << kNumServices << std::endl;
+    std::cout << "publish: " << publishUs << " us, update: " << updateUs << " us, unpublish: " << unpublishUs
+              << " us" << std::endl;
+    std::cout << "heap: " << (publishedHeapBytes - baseHeapBytes) << " bytes, "
+              << (publishedHeapBytes - baseHeapBytes) / kNumServices << " bytes/service" << std::endl;
+}
+#endif // OTBR_GTEST_BENCHMARK
+
+static Publisher::DiscoveredInstanceInfo MakeInstanceInfo(const char *aName)
+{
+    Publisher::DiscoveredInstanceInfo instanceInfo;
+
+    instanceInfo.mName       = aName;
+    instanceInfo.mHostName   = "host.local.";
+    instanceInfo.mNetifIndex = 1;
+    instanceInfo.mPort       = 1234;
+
+    return instanceInfo;
+}
+
+TEST(MdnsPublisher, TestSubscriberDispatchIsMutationSafe)
+{
+    FakePublisher                     publisher;
+    Publisher::DiscoveredInstanceInfo instanceInfo = MakeInstanceInfo("ins1");
+    uint64_t                          firstId;
+    uint64_t                          thirdId = 0;
+    uint64_t                          addedId = 0;
+    std::vector<int>                  invoked;
+    std::function<void(int)>          record = [&invoked](int aIndex) { invoked.push_back(aIndex); };
+
+    firstId = publisher.AddSubscriptionCallbacks(
+        [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) {
+            record(1);
+            // Remove itself and a later subscriber, and add a new one, while being dispatched.
+            publisher.RemoveSubscriptionCallbacks(firstId);
+            publisher.RemoveSubscriptionCallbacks(thirdId);
+            addedId = publisher.AddSubscriptionCallbacks(
+                [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) { record(4); }, nullptr);
+        },
+        nullptr);
+    publisher.AddSubscriptionCallbacks(
+        [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) { record(2); }, nullptr);
+    thirdId = publisher.AddSubscriptionCallbacks(
+        [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) { record(3); }, nullptr);
+
+    publisher.OnServiceResolved("_srv._udp", instanceInfo);
+    EXPECT_EQ(invoked, (std::vector<int>{1, 2}));
+    EXPECT_NE(addedId, 0u);
+
+    invoked.clear();
+    publisher.OnServiceResolved("_srv._udp", instanceInfo);
+    EXPECT_EQ(invoked, (std::vector<int>{2, 4}));
+
+    // Removing an already removed subscriber is harmless.
+    publisher.RemoveSubscriptionCallbacks(firstId);
+    publisher.RemoveSubscriptionCallbacks(addedId);
+
+    invoked.clear();
+    publisher.OnServiceResolved("_srv._udp", instanceInfo);
+    EXPECT_EQ(invoked, (std::vector<int>{2}));
+}
+
+TEST(MdnsPublisher, TestSubscribersOnlyReceiveTheirServiceType)
+{
+    FakePublisher                     publisher;
+    Publisher::DiscoveredInstanceInfo instanceInfo = MakeInstanceInfo("ins1");
+    Publisher::DiscoveredHostInfo     hostInfo;
+    int                               trelEvents = 0;
+    int                               allEvents  = 0;
+    int                               hostEvents = 0;
+
+    publisher.AddSubscriptionCallbacks(
+        "_trel._udp", [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) { trelEvents++; },
+        [&](const std::string &, const Publisher::DiscoveredHostInfo &) { hostEvents++; });
+    publisher.AddSubscriptionCallbacks(
+        [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) { allEvents++; },
+        [&](const std::string &, const Publisher::DiscoveredHostInfo &) { hostEvents++; });
+
+    publisher.OnServiceResolved("_meshcop._udp", instanceInfo);
+    EXPECT_EQ(trelEvents, 0);
+    EXPECT_EQ(allEvents, 1);
+
+    publisher.OnServiceResolved("_TREL._udp", instanceInfo);
+    EXPECT_EQ(trelEvents, 1);
+    EXPECT_EQ(allEvents, 2);
+
+    hostInfo.mHostName   = "host.local.";
+    hostInfo.mNetifIndex = 1;
+    publisher.OnHostResolved("host", hostInfo);
+    EXPECT_EQ(hostEvents, 2);
+}
+
+#if OTBR_GTEST_BENCHMARK
+TEST(MdnsPublisher, BenchmarkDispatch5000EventsTo200Subscribers)
+{
+    static constexpr uint32_t kNumSubscribers        = 200;
+    static constexpr uint32_t kNumAllTypeSubscribers = 10;
+    static constexpr uint32_t kNumServiceTypes       = 19;
+    static constexpr uint32_t kNumEvents             = 5000;
+
+    FakePublisher                     publisher;
+    Publisher::DiscoveredInstanceInfo instanceInfo = MakeInstanceInfo("ins1");
+    std::vector<std::string>          types;
+    uint64_t                          deliveries = 0;
+    size_t                            allocationCount;
+    Timepoint                         begin;
+    uint64_t                          dispatchUs;
+
+    for (uint32_t i = 0; i < kNumServiceTypes; i++)
+    {
+        types.push_back("_type" + std::to_string(i) + "._udp");
+    }
+
+    for (uint32_t i = 0; i < kNumSubscribers; i++)
+    {
+        Publisher::DiscoveredServiceInstanceCallback callback =
+            [&deliveries](const std::string &, const Publisher::DiscoveredInstanceInfo &) { deliveries++; };
+
+        if (i < kNumAllTypeSubscribers)
+        {
+            publisher.AddSubscriptionCallbacks(std::move(callback), nullptr);
+        }
+        else
+        {
+            publisher.AddSubscriptionCallbacks(types[i % kNumServiceTypes], std::move(callback), nullptr);
+        }
+    }
+
+    allocationCount = sAllocationCount;
+    begin           = Clock::now();
+    for (uint32_t i = 0; i < kNumEvents; i++)
+    {
+        publisher.OnServiceResolved(types[i % kNumServiceTypes], instanceInfo);
+    }
+    dispatchUs      = ElapsedMicroseconds(begin);
+    allocationCount = sAllocationCount - allocationCount;
+
+    // Every event reaches the subscribers of all types plus the 10 subscribers of its own type.
+    EXPECT_EQ(deliveries, kNumEvents * (kNumAllTypeSubscribers + (kNumSubscribers - kNumAllTypeSubscribers) /
+                                                                     kNumServiceTypes));
+    EXPECT_EQ(allocationCount, 0u);
+
+    std::cout << "subscribers: " << kNumSubscribers << ", events: " << kNumEvents << std::endl;
+    std::cout << "dispatch: " << dispatchUs << " us, " << dispatchUs * 1000 / kNumEvents << " ns/event, "
+              << deliveries << " deliveries" << std::endl;
+}
+#endif // OTBR_GTEST_BENCHMARK
@@ -0,0 +1,251 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "backbone_router/ns_filter.hpp"
+
+using namespace otbr;
+using namespace otbr::BackboneRouter;
+
+// These tests send Neighbor Solicitations over the loopback interface with raw ICMPv6 sockets and need CAP_NET_RAW.
+static constexpr size_t kBatchSize = 16;
+
+static int OpenIcmp6Socket(void)
+{
+    int fd = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
+
+    if (fd >= 0)
+    {
+        int hops = 255;
+
+        EXPECT_EQ(setsockopt(fd, SOL_SOCKET, SO_BINDTODEVICE, "lo", strlen("lo")), 0);
+        EXPECT_EQ(setsockopt(fd, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops)), 0);
+    }
+
+    return fd;
+}
+
+static int OpenNsReceiver(void)
+{
+    int                 fd = OpenIcmp6Socket();
+    struct icmp6_filter filter;
+
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    ICMP6_FILTER_SETPASS(ND_NEIGHBOR_SOLICIT, &filter);
+    EXPECT_EQ(setsockopt(fd, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)), 0);
+
+    return fd;
+}
+
+static void SendNs(int aSocket, const Ip6Address &aTarget, int aHopLimit = 255)
+{
+    struct nd_neighbor_solicit ns;
+    sockaddr_in6               dst;
+
+    memset(&ns, 0, sizeof(ns));
+    ns.nd_ns_type = ND_NEIGHBOR_SOLICIT;
+    memcpy(&ns.nd_ns_target, aTarget.m8, sizeof(ns.nd_ns_target));
+
+    memset(&dst, 0, sizeof(dst));
+    dst.sin6_family = AF_INET6;
+    dst.sin6_addr   = in6addr_loopback;
+
+    ASSERT_EQ(setsockopt(aSocket, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &aHopLimit, sizeof(aHopLimit)), 0);
+    ASSERT_EQ(sendto(aSocket, &ns, sizeof(ns), 0, reinterpret_cast<const sockaddr *>(&dst), sizeof(dst)),
+              static_cast<ssize_t>(sizeof(ns)));
+}
+
+// Drains the socket the way NdProxyManager does, returns the number of packets and counts the `recvmmsg` calls.
+static size_t Drain(int aSocket, size_t &aNumCalls)
+{
+    uint8_t        packets[kBatchSize][128];
+    struct iovec   iovecs[kBatchSize];
+    struct mmsghdr msgs[kBatchSize];
+    size_t         total = 0;
+    int            received;
+
+    do
+    {
+        memset(msgs, 0, sizeof(msgs));
+        for (size_t i = 0; i < kBatchSize; i++)
+        {
+            iovecs[i].iov_base         = packets[i];
+            iovecs[i].iov_len          = sizeof(packets[i]);
+            msgs[i].msg_hdr.msg_iov    = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        received = recvmmsg(aSocket, msgs, kBatchSize, MSG_DONTWAIT, nullptr);
+        aNumCalls++;
+        total += received > 0 ? received : 0;
+    } while (received == static_cast<int>(kBatchSize));
+
+    return total;
+}
+
+static std::vector<Ip6Address> GetTargets(void)
+{
+    return {Ip6Address("fd00:db8::1"), Ip6Address("fd00:db8::2"), Ip6Address("fd00:db8:0:1::abcd")};
+}
+
+TEST(NsFilter, TestEmptyTargetsDropAll)
+{
+    std::vector<struct sock_filter> program;
+
+    BuildNsFilter({}, program);
+    ASSERT_FALSE(program.empty());
+    EXPECT_EQ(program.back().code, BPF_RET | BPF_K);
+    EXPECT_EQ(program.back().k, 0u);
+
+    BuildNsFilter(GetTargets(), program);
+    EXPECT_EQ(program.size(), 7 + 9 * GetTargets().size());
+
+    // Too many targets to match in the kernel, only the type and hop limit are checked.
+    BuildNsFilter(std::vector<Ip6Address>(kMaxNsFilterTargets + 1, Ip6Address("fd00:db8::1")), program);
+    EXPECT_EQ(program.size(), 7u);
+    EXPECT_NE(program.back().k, 0u);
+}
+
+TEST(NsFilter, TestOnlyProxiedTargetsPass)
+{
+    int    sender   = OpenIcmp6Socket();
+    int    receiver = OpenNsReceiver();
+    size_t numCalls = 0;
+
+    ASSERT_GE(sender, 0) << strerror(errno);
+    ASSERT_GE(receiver, 0) << strerror(errno);
+    ASSERT_EQ(AttachNsFilter(receiver, GetTargets()), OTBR_ERROR_NONE) << strerror(errno);
+
+    for (const Ip6Address &target : GetTargets())
+    {
+        SendNs(sender, target);
+    }
+    SendNs(sender, Ip6Address("fd00:db8::3"));
+    SendNs(sender, Ip6Address("fd00:db8:0:1::abce"));
+    SendNs(sender, Ip6Address("fd00:db8::1"), 64);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(Drain(receiver, numCalls), GetTargets().size());
+
+    // Updating the targets replaces the filter.
+    ASSERT_EQ(AttachNsFilter(receiver, {Ip6Address("fd00:db8::3")}), OTBR_ERROR_NONE);
+    SendNs(sender, Ip6Address("fd00:db8::1"));
+    SendNs(sender, Ip6Address("fd00:db8::3"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(Drain(receiver, numCalls), 1u);
+
+    close(receiver);
+    close(sender);
+}
+
+#if OTBR_GTEST_BENCHMARK
+static uint64_t ElapsedUs(std::chrono::steady_clock::time_point aBegin)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aBegin).count();
+}
+
+TEST(NsFilter, BenchmarkNsFlood)
+{
+    static constexpr size_t kNumBursts       = 100;
+    static constexpr size_t kNumNsPerBurst   = 100;
+    static constexpr size_t kProxiedPerBurst = 2;
+
+    int      sender            = OpenIcmp6Socket();
+    int      unfiltered        = OpenNsReceiver();
+    int      filtered          = OpenNsReceiver();
+    size_t   unfilteredPackets = 0;
+    size_t   filteredPackets   = 0;
+    size_t   unfilteredCalls   = 0;
+    size_t   filteredCalls     = 0;
+    size_t   filteredWakeups   = 0;
+    uint64_t unfilteredUs      = 0;
+    uint64_t filteredUs        = 0;
+
+    ASSERT_GE(sender, 0) << strerror(errno);
+    ASSERT_GE(unfiltered, 0);
+    ASSERT_GE(filtered, 0);
+    ASSERT_EQ(AttachNsFilter(filtered, GetTargets()), OTBR_ERROR_NONE);
+
+    for (size_t burst = 0; burst < kNumBursts; burst++)
+    {
+        size_t packets;
+
+        for (size_t i = 0; i < kNumNsPerBurst; i++)
+        {
+            Ip6Address target = i < kProxiedPerBurst ? GetTargets()[i] : Ip6Address("fd00:db8:ffff::1");
+
+            target.m8[15] = i < kProxiedPerBurst ? target.m8[15] : static_cast<uint8_t>(i);
+            SendNs(sender, target);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+        {
+            auto begin = std::chrono::steady_clock::now();
+
+            unfilteredPackets += Drain(unfiltered, unfilteredCalls);
+            unfilteredUs += ElapsedUs(begin);
+        }
+
+        {
+            auto begin = std::chrono::steady_clock::now();
+
+            packets = Drain(filtered, filteredCalls);
+            filteredPackets += packets;
+            filteredWakeups += packets > 0;
+            filteredUs += ElapsedUs(begin);
+        }
+    }
+
+    EXPECT_EQ(filteredPackets, kNumBursts * kProxiedPerBurst);
+    EXPECT_GT(unfilteredPackets, filteredPackets);
+
+    std::cout << "unfiltered: " << unfilteredPackets << " NS in " << unfilteredCalls << " recvmmsg calls, "
+              << unfilteredUs << " us; filtered: " << filteredPackets << " NS in " << filteredCalls
+              << " recvmmsg calls, " << filteredUs << " us; " << filteredPackets / std::max<size_t>(filteredWakeups, 1)
+              << " NS per wakeup" << std::endl;
+
+    close(filtered);
+    close(unfiltered);
+    close(sender);
+}
+#endif // OTBR_GTEST_BENCHMARK
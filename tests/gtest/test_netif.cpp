@@ -30,19 +30,28 @@
 #include <gtest/gtest.h>
 
 #include <arpa/inet.h>
+#include <chrono>
 #include <cstring>
+#include <deque>
+#include <fcntl.h>
 #include <fstream>
 #include <ifaddrs.h>
 #include <iostream>
 #include <net/if.h>
 #include <netinet/in.h>
+#include <netinet/ip6.h>
+#include <netinet/udp.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <string>
 #include <sys/ioctl.h>
+#include <sys/select.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <termios.h>
+#include <thread>
+#include <unistd.h>
 #include <vector>
 
 #ifdef __linux__
@@ -51,7 +60,11 @@
 
 #include <openthread/ip6.h>
 
+#include "lib/spinel/spinel_driver.hpp"
+#include "lib/spinel/spinel_interface.hpp"
+
 #include "common/types.hpp"
+#include "ncp/ncp_spinel.hpp"
 #include "ncp/posix/netif.hpp"
 #include "utils/socket_utils.hpp"
 
@@ -362,6 +375,60 @@ TEST(Netif, WpanIfHasCorrectUnicastAddresses_AfterUpdatingUnicastAddresses)
     netif.Deinit();
 }
 
+TEST(Netif, WpanIfHasCorrectUnicastAddresses_AfterUpdatingManyUnicastAddresses)
+{
+    const char        *wpan         = "wpan0";
+    static const int   kNumAddrs    = 500;
+    static const int   kNumReplaced = kNumAddrs / 2;
+    const otIp6Address kPrefix      = {
+        {0xfd, 0x0d, 0x07, 0xfc, 0xa1, 0xb9, 0xf0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+    std::vector<otbr::Ip6AddressInfo> addrInfos;
+    std::vector<std::string>          wpanAddrs;
+    char                              addrStr[INET6_ADDRSTRLEN];
+
+    otbr::Netif netif;
+    EXPECT_EQ(netif.Init(wpan), OT_ERROR_NONE);
+
+    for (int i = 0; i < kNumAddrs; i++)
+    {
+        otIp6Address address = kPrefix;
+
+        address.mFields.m8[14] = static_cast<uint8_t>(i >> 8);
+        address.mFields.m8[15] = static_cast<uint8_t>(i & 0xff);
+        addrInfos.emplace_back(address, 64, 0, 1, 0);
+    }
+
+    netif.UpdateIp6UnicastAddresses(addrInfos);
+    wpanAddrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpanAddrs.size(), kNumAddrs);
+    EXPECT_THAT(wpanAddrs, ::testing::Contains("fd0d:7fc:a1b9:f050::"));
+    EXPECT_THAT(wpanAddrs, ::testing::Contains("fd0d:7fc:a1b9:f050::1f3"));
+
+    // Replace the first half of the addresses with new ones, the second half must be left untouched.
+    for (int i = 0; i < kNumReplaced; i++)
+    {
+        addrInfos[i].mAddress.mFields.m8[13] = 1;
+    }
+
+    netif.UpdateIp6UnicastAddresses(addrInfos);
+    wpanAddrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpanAddrs.size(), kNumAddrs);
+    for (const otbr::Ip6AddressInfo &addrInfo : addrInfos)
+    {
+        ASSERT_NE(inet_ntop(AF_INET6, addrInfo.mAddress.mFields.m8, addrStr, sizeof(addrStr)), nullptr);
+        EXPECT_THAT(wpanAddrs, ::testing::Contains(std::string(addrStr)));
+    }
+    EXPECT_THAT(wpanAddrs, ::testing::Not(::testing::Contains("fd0d:7fc:a1b9:f050::")));
+
+    addrInfos.clear();
+    netif.UpdateIp6UnicastAddresses(addrInfos);
+    wpanAddrs = GetAllIp6Addrs(wpan);
+    EXPECT_EQ(wpanAddrs.size(), 0);
+
+    netif.Deinit();
+}
+
 TEST(Netif, WpanIfHasCorrectMulticastAddresses_AfterUpdatingMulticastAddresses)
 {
     const char *wpan = "wpan0";
@@ -452,4 +519,556 @@ TEST(Netif, WpanIfStateChangesCorrectly_AfterSettingNetifState)
     netif.Deinit();
 }
 
+static constexpr uint16_t kHostPort = 12345;
+static constexpr uint16_t kPeerPort = 54321;
+
+static const otIp6Address kHostAddr = {
+    {0xfd, 0x0d, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}};
+
+static bool HasLocalRoute(const char *aHexAddress)
+{
+    std::ifstream file("/proc/net/ipv6_route");
+    std::string   line;
+
+    while (std::getline(file, line))
+    {
+        if (line.compare(0, strlen(aHexAddress), aHexAddress) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Brings up wpan0 with an address whose on-link prefix routes packets for other hosts into the TUN device.
+static void SetUpWpanForForwarding(otbr::Netif &aNetif)
+{
+    std::vector<otbr::Ip6AddressInfo> addrInfos;
+
+    ASSERT_EQ(aNetif.Init("wpan0"), OTBR_ERROR_NONE);
+    aNetif.SetNetifState(true);
+    addrInfos.emplace_back(kHostAddr, 64, 0, 1, 0);
+    aNetif.UpdateIp6UnicastAddresses(addrInfos);
+
+    // The kernel adds the local route of a new address asynchronously, packets to the address are forwarded until then.
+    for (int i = 0; i < 100 && !HasLocalRoute("fd0d07fc000000000000000000000001 80"); i++)
+    {
+        usleep(10000);
+    }
+    ASSERT_TRUE(HasLocalRoute("fd0d07fc000000000000000000000001 80"));
+}
+
+static int OpenHostUdpSocket(void)
+{
+    sockaddr_in6 sin6;
+    int          fd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+
+    memset(&sin6, 0, sizeof(sin6));
+    sin6.sin6_family = AF_INET6;
+    sin6.sin6_port   = htons(kHostPort);
+    memcpy(&sin6.sin6_addr, &kHostAddr, sizeof(sin6.sin6_addr));
+    EXPECT_EQ(bind(fd, reinterpret_cast<sockaddr *>(&sin6), sizeof(sin6)), 0) << strerror(errno);
+
+    return fd;
+}
+
+static ssize_t SendToPeer(int aFd, const void *aPayload, size_t aLength)
+{
+    sockaddr_in6 peer;
+
+    memset(&peer, 0, sizeof(peer));
+    peer.sin6_family = AF_INET6;
+    peer.sin6_port   = htons(kPeerPort);
+    memcpy(&peer.sin6_addr, &kHostAddr, sizeof(peer.sin6_addr));
+    peer.sin6_addr.s6_addr[15] = 2;
+
+    return sendto(aFd, aPayload, aLength, 0, reinterpret_cast<sockaddr *>(&peer), sizeof(peer));
+}
+
+static bool IsUdpPacket(const uint8_t *aData, uint16_t aLength)
+{
+    return aLength >= sizeof(ip6_hdr) + sizeof(udphdr) &&
+           reinterpret_cast<const ip6_hdr *>(aData)->ip6_nxt == IPPROTO_UDP;
+}
+
+// Turns a UDP packet into the reply of its destination, swapping addresses and ports keeps the checksum valid.
+static void ReflectUdpPacket(uint8_t *aData)
+{
+    ip6_hdr *ip6  = reinterpret_cast<ip6_hdr *>(aData);
+    udphdr  *udp  = reinterpret_cast<udphdr *>(aData + sizeof(ip6_hdr));
+    in6_addr addr = ip6->ip6_src;
+    uint16_t port = udp->uh_sport;
+
+    ip6->ip6_src  = ip6->ip6_dst;
+    ip6->ip6_dst  = addr;
+    udp->uh_sport = udp->uh_dport;
+    udp->uh_dport = port;
+}
+
+static void RunMainloopOnce(otbr::Netif &aNetif, int aExtraFd, fd_set &aReadFdSet)
+{
+    otbr::MainloopContext mainloop;
+
+    memset(&mainloop, 0, sizeof(mainloop));
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+    mainloop.mMaxFd           = -1;
+    mainloop.mTimeout.tv_sec  = 0;
+    mainloop.mTimeout.tv_usec = 10000;
+
+    aNetif.Update(mainloop);
+    if (aExtraFd >= 0)
+    {
+        FD_SET(aExtraFd, &mainloop.mReadFdSet);
+        mainloop.mMaxFd = std::max(mainloop.mMaxFd, aExtraFd);
+    }
+
+    ASSERT_GE(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, nullptr, nullptr, &mainloop.mTimeout), 0);
+    aNetif.Process(mainloop);
+    aReadFdSet = mainloop.mReadFdSet;
+}
+
+TEST(Netif, WpanForwardsPacketsBetweenTunAndCoprocessor)
+{
+    otbr::Netif          netif;
+    std::vector<uint8_t> sentPacket;
+    const char           kPayload[] = "hello";
+    char                 reply[sizeof(kPayload)];
+    fd_set               readFdSet;
+    int                  fd;
+
+    SetUpWpanForForwarding(netif);
+    netif.SetIp6SendFunc([&sentPacket](const uint8_t *aData, uint16_t aLength) {
+        if (IsUdpPacket(aData, aLength))
+        {
+            sentPacket.assign(aData, aData + aLength);
+        }
+        return OTBR_ERROR_NONE;
+    });
+
+    fd = OpenHostUdpSocket();
+    ASSERT_EQ(SendToPeer(fd, kPayload, sizeof(kPayload)), static_cast<ssize_t>(sizeof(kPayload)));
+
+    for (int i = 0; i < 100 && sentPacket.empty(); i++)
+    {
+        RunMainloopOnce(netif, -1, readFdSet);
+    }
+    ASSERT_EQ(sentPacket.size(), sizeof(ip6_hdr) + sizeof(udphdr) + sizeof(kPayload));
+    EXPECT_EQ(memcmp(&sentPacket[sizeof(ip6_hdr) + sizeof(udphdr)], kPayload, sizeof(kPayload)), 0);
+    EXPECT_GE(netif.GetCounters().mTxPackets, 1u);
+    EXPECT_GE(netif.GetCounters().mTxBytes, sentPacket.size());
+    EXPECT_EQ(netif.GetCounters().mTxDrops, 0u);
+
+    ReflectUdpPacket(sentPacket.data());
+    netif.Ip6Receive(sentPacket.data(), static_cast<uint16_t>(sentPacket.size()));
+    EXPECT_EQ(netif.GetCounters().mRxPackets, 1u);
+    EXPECT_EQ(netif.GetCounters().mRxBytes, sentPacket.size());
+    EXPECT_EQ(netif.GetCounters().mRxDrops, 0u);
+
+    FD_ZERO(&readFdSet);
+    FD_SET(fd, &readFdSet);
+    {
+        timeval timeout = {1, 0};
+
+        EXPECT_EQ(select(fd + 1, &readFdSet, nullptr, nullptr, &timeout), 1);
+    }
+    EXPECT_EQ(recv(fd, reply, sizeof(reply), 0), static_cast<ssize_t>(sizeof(reply)));
+    EXPECT_STREQ(reply, kPayload);
+
+    close(fd);
+    netif.Deinit();
+}
+
+TEST(Netif, WpanDropsPacketsTheCoprocessorRejects)
+{
+    otbr::Netif netif;
+    uint8_t     oversized[1281];
+    fd_set      readFdSet;
+    int         fd;
+
+    SetUpWpanForForwarding(netif);
+    netif.SetIp6SendFunc([](const uint8_t *, uint16_t) { return OTBR_ERROR_OPENTHREAD; });
+
+    fd = OpenHostUdpSocket();
+    ASSERT_GT(SendToPeer(fd, "x", 1), 0);
+    for (int i = 0; i < 100 && netif.GetCounters().mTxDrops == 0; i++)
+    {
+        RunMainloopOnce(netif, -1, readFdSet);
+    }
+    EXPECT_GE(netif.GetCounters().mTxDrops, 1u);
+    EXPECT_EQ(netif.GetCounters().mTxPackets, 0u);
+
+    memset(oversized, 0, sizeof(oversized));
+    netif.Ip6Receive(oversized, sizeof(oversized));
+    EXPECT_EQ(netif.GetCounters().mRxDrops, 1u);
+    EXPECT_EQ(netif.GetCounters().mRxPackets, 0u);
+
+    close(fd);
+    netif.Deinit();
+}
+
+// A spinel interface which answers the handshake of the SpinelDriver and can be told to reject the frames sent to it.
+class FakeSpinelInterface : public ot::Spinel::SpinelInterface
+{
+public:
+    otError Init(ReceiveFrameCallback aCallback, void *aCallbackContext, RxFrameBuffer &aFrameBuffer) override
+    {
+        mReceiveFrameCallback = aCallback;
+        mReceiveFrameContext  = aCallbackContext;
+        mRxFrameBuffer        = &aFrameBuffer;
+        return OT_ERROR_NONE;
+    }
+
+    void Deinit(void) override {}
+
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength) override
+    {
+        uint8_t      header;
+        unsigned int command;
+        unsigned int key;
+
+        if (mRejectFrames)
+        {
+            return OT_ERROR_FAILED;
+        }
+
+        mSentFrames.emplace_back(aFrame, aFrame + aLength);
+        if (spinel_datatype_unpack(aFrame, aLength, SPINEL_DATATYPE_COMMAND_PROP_S, &header, &command, &key) > 0)
+        {
+            HandleCommand(header, command, key);
+        }
+        return OT_ERROR_NONE;
+    }
+
+    otError WaitForFrame(uint64_t) override
+    {
+        while (!mPendingFrames.empty())
+        {
+            for (uint8_t byte : mPendingFrames.front())
+            {
+                EXPECT_EQ(mRxFrameBuffer->WriteByte(byte), OT_ERROR_NONE);
+            }
+            mPendingFrames.pop_front();
+            mReceiveFrameCallback(mReceiveFrameContext);
+        }
+        return OT_ERROR_NONE;
+    }
+
+    void                         UpdateFdSet(void *) override {}
+    void                         Process(const void *) override {}
+    uint32_t                     GetBusSpeed(void) const override { return 0; }
+    otError                      HardwareReset(void) override { return OT_ERROR_NOT_IMPLEMENTED; }
+    const otRcpInterfaceMetrics *GetRcpInterfaceMetrics(void) const override { return nullptr; }
+
+    void SetRejectFrames(bool aReject) { mRejectFrames = aReject; }
+
+    // Returns the number of IPv6 packets the NCP accepted.
+    size_t GetNumStreamNetFrames(void) const
+    {
+        size_t count = 0;
+
+        for (const std::vector<uint8_t> &frame : mSentFrames)
+        {
+            uint8_t      header;
+            unsigned int command;
+            unsigned int key;
+
+            if (spinel_datatype_unpack(frame.data(), static_cast<spinel_size_t>(frame.size()),
+                                       SPINEL_DATATYPE_COMMAND_PROP_S, &header, &command, &key) > 0 &&
+                command == SPINEL_CMD_PROP_VALUE_SET && key == SPINEL_PROP_STREAM_NET)
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+private:
+    void HandleCommand(uint8_t aHeader, unsigned int aCommand, unsigned int aKey)
+    {
+        uint8_t        frame[64];
+        spinel_ssize_t length = -1;
+
+        if (aCommand == SPINEL_CMD_RESET)
+        {
+            length = spinel_datatype_pack(frame, sizeof(frame),
+                                          SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT_PACKED_S,
+                                          aHeader & ~SPINEL_HEADER_TID_MASK, SPINEL_CMD_PROP_VALUE_IS,
+                                          SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_RESET_SOFTWARE);
+        }
+        else if (aCommand == SPINEL_CMD_PROP_VALUE_GET && aKey == SPINEL_PROP_PROTOCOL_VERSION)
+        {
+            length = spinel_datatype_pack(
+                frame, sizeof(frame),
+                SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S, aHeader,
+                SPINEL_CMD_PROP_VALUE_IS, aKey, SPINEL_PROTOCOL_VERSION_THREAD_MAJOR,
+                SPINEL_PROTOCOL_VERSION_THREAD_MINOR);
+        }
+        else if (aCommand == SPINEL_CMD_PROP_VALUE_GET && aKey == SPINEL_PROP_NCP_VERSION)
+        {
+            length = spinel_datatype_pack(frame, sizeof(frame), SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UTF8_S,
+                                          aHeader, SPINEL_CMD_PROP_VALUE_IS, aKey, "FAKE-NCP/1.0");
+        }
+        else if (aCommand == SPINEL_CMD_PROP_VALUE_GET && aKey == SPINEL_PROP_CAPS)
+        {
+            length = spinel_datatype_pack(frame, sizeof(frame),
+                                          SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT_PACKED_S,
+                                          aHeader, SPINEL_CMD_PROP_VALUE_IS, aKey, SPINEL_CAP_CONFIG_FTD);
+        }
+        else if (SPINEL_HEADER_GET_TID(aHeader) != 0)
+        {
+            length = spinel_datatype_pack(frame, sizeof(frame),
+                                          SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_UINT_PACKED_S,
+                                          aHeader, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_OK);
+        }
+
+        if (length > 0)
+        {
+            mPendingFrames.emplace_back(frame, frame + length);
+        }
+    }
+
+    ReceiveFrameCallback              mReceiveFrameCallback = nullptr;
+    void                             *mReceiveFrameContext  = nullptr;
+    RxFrameBuffer                    *mRxFrameBuffer        = nullptr;
+    bool                              mRejectFrames         = false;
+    std::deque<std::vector<uint8_t>>  mPendingFrames;
+    std::vector<std::vector<uint8_t>> mSentFrames;
+};
+
+class FakePropsObserver : public otbr::Ncp::PropsObserver
+{
+public:
+    void SetDeviceRole(otDeviceRole) override {}
+};
+
+TEST(Netif, WpanCountsPacketsTheSpinelInterfaceRejectsAsDrops)
+{
+    static const spinel_iid_t kIidList[] = {0};
+
+    otbr::Netif              netif;
+    FakeSpinelInterface      spinelInterface;
+    ot::Spinel::SpinelDriver spinelDriver;
+    otbr::Ncp::NcpSpinel     ncpSpinel;
+    FakePropsObserver        observer;
+    fd_set                   readFdSet;
+    int                      fd;
+
+    spinelDriver.Init(spinelInterface, /* aSoftwareReset */ true, kIidList, sizeof(kIidList) / sizeof(kIidList[0]));
+    ncpSpinel.Init(spinelDriver, observer);
+
+    SetUpWpanForForwarding(netif);
+    netif.SetIp6SendFunc(
+        [&ncpSpinel](const uint8_t *aData, uint16_t aLength) { return ncpSpinel.Ip6Send(aData, aLength); });
+    fd = OpenHostUdpSocket();
+
+    spinelInterface.SetRejectFrames(true);
+    ASSERT_GT(SendToPeer(fd, "x", 1), 0);
+    for (int i = 0; i < 100 && netif.GetCounters().mTxDrops == 0; i++)
+    {
+        RunMainloopOnce(netif, -1, readFdSet);
+    }
+    EXPECT_GE(netif.GetCounters().mTxDrops, 1u);
+    EXPECT_EQ(netif.GetCounters().mTxPackets, 0u);
+    EXPECT_EQ(spinelInterface.GetNumStreamNetFrames(), 0u);
+
+    // The rejected frames were removed from the NCP buffer, later packets are still sent.
+    spinelInterface.SetRejectFrames(false);
+    ASSERT_GT(SendToPeer(fd, "y", 1), 0);
+    for (int i = 0; i < 100 && netif.GetCounters().mTxPackets == 0; i++)
+    {
+        RunMainloopOnce(netif, -1, readFdSet);
+    }
+    EXPECT_GE(netif.GetCounters().mTxPackets, 1u);
+    EXPECT_EQ(spinelInterface.GetNumStreamNetFrames(), netif.GetCounters().mTxPackets);
+
+    close(fd);
+    netif.Deinit();
+    ncpSpinel.Deinit();
+    spinelDriver.Deinit();
+}
+
+#if OTBR_GTEST_BENCHMARK
+// A coprocessor simulated over a pty, which reflects every UDP packet framed with a 16-bit length.
+class SimulatedNcp
+{
+public:
+    SimulatedNcp(void)
+        : mHostFd(posix_openpt(O_RDWR | O_NOCTTY))
+        , mNcpFd(-1)
+    {
+        termios tios;
+
+        grantpt(mHostFd);
+        unlockpt(mHostFd);
+        mNcpFd = open(ptsname(mHostFd), O_RDWR | O_NOCTTY);
+
+        for (int fd : {mHostFd, mNcpFd})
+        {
+            tcgetattr(fd, &tios);
+            cfmakeraw(&tios);
+            tcsetattr(fd, TCSANOW, &tios);
+        }
+
+        mThread = std::thread([this]() { Run(); });
+    }
+
+    ~SimulatedNcp(void)
+    {
+        close(mHostFd);
+        mThread.join();
+        close(mNcpFd);
+    }
+
+    int GetHostFd(void) const { return mHostFd; }
+
+    static bool ReadFrame(int aFd, std::vector<uint8_t> &aFrame)
+    {
+        uint8_t header[2];
+
+        if (!ReadAll(aFd, header, sizeof(header)))
+        {
+            return false;
+        }
+        aFrame.resize(static_cast<size_t>(header[0] << 8 | header[1]));
+
+        return ReadAll(aFd, aFrame.data(), aFrame.size());
+    }
+
+    static bool WriteFrame(int aFd, const uint8_t *aData, uint16_t aLength)
+    {
+        uint8_t header[2] = {static_cast<uint8_t>(aLength >> 8), static_cast<uint8_t>(aLength & 0xff)};
+
+        return WriteAll(aFd, header, sizeof(header)) && WriteAll(aFd, aData, aLength);
+    }
+
+private:
+    static bool ReadAll(int aFd, uint8_t *aBuf, size_t aLength)
+    {
+        while (aLength > 0)
+        {
+            ssize_t rval = read(aFd, aBuf, aLength);
+
+            if (rval <= 0)
+            {
+                return false;
+            }
+            aBuf += rval;
+            aLength -= static_cast<size_t>(rval);
+        }
+
+        return true;
+    }
+
+    static bool WriteAll(int aFd, const uint8_t *aBuf, size_t aLength)
+    {
+        while (aLength > 0)
+        {
+            ssize_t rval = write(aFd, aBuf, aLength);
+
+            if (rval <= 0)
+            {
+                return false;
+            }
+            aBuf += rval;
+            aLength -= static_cast<size_t>(rval);
+        }
+
+        return true;
+    }
+
+    void Run(void)
+    {
+        std::vector<uint8_t> frame;
+
+        while (ReadFrame(mNcpFd, frame))
+        {
+            ReflectUdpPacket(frame.data());
+            if (!WriteFrame(mNcpFd, frame.data(), static_cast<uint16_t>(frame.size())))
+            {
+                break;
+            }
+        }
+    }
+
+    int         mHostFd;
+    int         mNcpFd;
+    std::thread mThread;
+};
+
+TEST(Netif, BenchmarkForwardingThroughSimulatedNcp)
+{
+    static constexpr size_t kNumPackets = 20000;
+    static constexpr size_t kWindow     = 64;
+
+    otbr::Netif          netif;
+    SimulatedNcp         ncp;
+    std::vector<uint8_t> frame;
+    uint8_t              payload[64];
+    fd_set               readFdSet;
+    size_t               numSent     = 0;
+    size_t               numReceived = 0;
+    int                  fd;
+
+    SetUpWpanForForwarding(netif);
+    netif.SetIp6SendFunc([&ncp](const uint8_t *aData, uint16_t aLength) {
+        // Packets other than the test traffic, e.g. MLD reports, are not sent to the simulated NCP.
+        if (IsUdpPacket(aData, aLength) && !SimulatedNcp::WriteFrame(ncp.GetHostFd(), aData, aLength))
+        {
+            return OTBR_ERROR_ERRNO;
+        }
+        return OTBR_ERROR_NONE;
+    });
+
+    fd = OpenHostUdpSocket();
+    memset(payload, 0xa5, sizeof(payload));
+
+    auto start    = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::seconds(30);
+
+    while (numReceived < kNumPackets && std::chrono::steady_clock::now() < deadline)
+    {
+        while (numSent < kNumPackets && numSent - numReceived < kWindow)
+        {
+            ASSERT_EQ(SendToPeer(fd, payload, sizeof(payload)), static_cast<ssize_t>(sizeof(payload)));
+            numSent++;
+        }
+
+        RunMainloopOnce(netif, ncp.GetHostFd(), readFdSet);
+
+        if (FD_ISSET(ncp.GetHostFd(), &readFdSet))
+        {
+            int pending;
+
+            do
+            {
+                ASSERT_TRUE(SimulatedNcp::ReadFrame(ncp.GetHostFd(), frame));
+                netif.Ip6Receive(frame.data(), static_cast<uint16_t>(frame.size()));
+                ASSERT_EQ(ioctl(ncp.GetHostFd(), FIONREAD, &pending), 0);
+            } while (pending > 0);
+        }
+
+        while (recv(fd, payload, sizeof(payload), 0) == static_cast<ssize_t>(sizeof(payload)))
+        {
+            numReceived++;
+        }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(numReceived, kNumPackets);
+    EXPECT_EQ(netif.GetCounters().mTxDrops, 0u);
+    EXPECT_EQ(netif.GetCounters().mRxDrops, 0u);
+    EXPECT_GE(netif.GetCounters().mRxPackets, kNumPackets);
+
+    printf("Forwarded %zu packets through the simulated NCP in %lld us (%.0f round trips/s)\n", numReceived,
+           static_cast<long long>(elapsed.count()), numReceived * 1e6 / elapsed.count());
+
+    close(fd);
+    netif.Deinit();
+}
+#endif // OTBR_GTEST_BENCHMARK
+
 #endif // __linux__
@@ -0,0 +1,437 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "common/netlink_monitor.hpp"
+
+using namespace otbr;
+
+// Netlink traffic captured in a fresh network namespace on Linux 6.18 with
+//
+//     ip link add otbr-infra0 type veth peer name otbr-thread0
+//     ip link set otbr-infra0 addrgenmode none
+//     ip link set otbr-thread0 addrgenmode none
+//     ip link set otbr-infra0 up
+//     ip link set otbr-thread0 up
+//     ip -6 addr add fd00:1::1/64 dev otbr-infra0 nodad
+//     ip -6 route add fd00:7d03::/64 dev otbr-infra0 table 88
+//
+// which leaves lo at index 1, otbr-thread0 at index 2 and otbr-infra0 at index 3. Link messages are trimmed to the
+// IFLA_IFNAME and IFLA_MTU attributes, address and route messages are verbatim.
+
+// Dump replies to RTM_GETLINK, RTM_GETADDR and RTM_GETROUTE (AF_INET6) after the setup above.
+static const uint8_t kDump[] = {
+    0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x03, 0x00, 0x6c, 0x6f, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x3c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x43, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x03, 0x00, 0x6f, 0x74, 0x62, 0x72, 0x2d, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcc, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x43, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00,
+    0x6f, 0x74, 0x62, 0x72, 0x2d, 0x69, 0x6e, 0x66, 0x72, 0x61, 0x30, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0xdc, 0x05, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xcc, 0x28, 0x00, 0x00, 0x0a, 0x40, 0x82, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00,
+    0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x14, 0x00, 0x06, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xa0, 0x0e, 0x00,
+    0x85, 0xa0, 0x0e, 0x00, 0x08, 0x00, 0x08, 0x00, 0x82, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0xcc, 0x28, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x00,
+    0x58, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x74, 0x00, 0x00, 0x00, 0x18, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0xcc, 0x28, 0x00, 0x00,
+    0x0a, 0x40, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x18, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xcc, 0x28, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 0xff, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x0f, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x18, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xcc, 0x28, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x00, 0xff, 0x02, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0xcc, 0x28, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x00,
+    0xff, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Events after `ip -6 route add fd00:7d03::/64 dev otbr-thread0 metric 1`.
+static const uint8_t kAddThreadRoute[] = {
+    0x74, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x06, 0x43, 0x9b, 0xd5, 0x6a, 0xda, 0x28, 0x00, 0x00,
+    0x0a, 0x40, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+// Events after `ip -6 addr add fd00:2::1/64 dev otbr-thread0 nodad`.
+static const uint8_t kAddThreadAddress[] = {
+    0x74, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x40, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x40, 0x82, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00,
+    0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x14, 0x00, 0x06, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xa0, 0x0e, 0x00,
+    0xb8, 0xa0, 0x0e, 0x00, 0x08, 0x00, 0x08, 0x00, 0x82, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00,
+    0xff, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Events after `ip link set otbr-infra0 down`.
+static const uint8_t kSetInfraDown[] = {
+    0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x03, 0x00, 0x6f, 0x74, 0x62, 0x72, 0x2d, 0x69, 0x6e, 0x66, 0x72, 0x61, 0x30, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x00, 0x58, 0x03, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x58, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00,
+    0xfd, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x00,
+    0xfe, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x80, 0x00, 0x00, 0xff, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x00, 0xff, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x0f, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x40, 0x82, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x06, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x85, 0xa0, 0x0e, 0x00, 0x85, 0xa0, 0x0e, 0x00, 0x08, 0x00, 0x08, 0x00, 0x82, 0x00, 0x00, 0x00,
+    0x3c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x03, 0x00, 0x6f, 0x74, 0x62, 0x72, 0x2d, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0xdc, 0x05, 0x00, 0x00,
+};
+
+// Events after `ip link del otbr-thread0`.
+static const uint8_t kDeleteThread[] = {
+    0x3c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x03, 0x00, 0x6f, 0x74, 0x62, 0x72, 0x2d, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x00,
+    0xfe, 0x02, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x40, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 0xff, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x0f, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x00, 0xff, 0x02, 0x00, 0x05,
+    0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x40, 0x82, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x06, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xb8, 0xa0, 0x0e, 0x00, 0xb8, 0xa0, 0x0e, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x82, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x11, 0x00, 0x03, 0x00, 0x6f, 0x74, 0x62, 0x72, 0x2d, 0x74, 0x68, 0x72,
+    0x65, 0x61, 0x64, 0x30, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0xdc, 0x05, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x10, 0x00, 0x03, 0x00, 0x6f, 0x74, 0x62, 0x72, 0x2d, 0x69, 0x6e, 0x66, 0x72, 0x61, 0x30, 0x00,
+    0x08, 0x00, 0x04, 0x00, 0xdc, 0x05, 0x00, 0x00,
+};
+
+static constexpr uint32_t kThreadIndex = 2;
+static constexpr uint32_t kInfraIndex  = 3;
+static constexpr uint32_t kTable       = 88;
+
+static const char *ChangeToString(NetlinkMonitor::Change aChange)
+{
+    const char *str = "";
+
+    switch (aChange)
+    {
+    case NetlinkMonitor::kAdded:
+        str = "added";
+        break;
+    case NetlinkMonitor::kChanged:
+        str = "changed";
+        break;
+    case NetlinkMonitor::kRemoved:
+        str = "removed";
+        break;
+    }
+
+    return str;
+}
+
+class NetlinkMonitorReplayTest : public testing::Test
+{
+protected:
+    template <size_t kLength> void Replay(const uint8_t (&aMessages)[kLength])
+    {
+        mEvents.clear();
+        mMonitor.HandleMessages(aMessages, kLength);
+    }
+
+    void Subscribe(void)
+    {
+        mMonitor.AddLinkSubscriber([this](NetlinkMonitor::Change aChange, const NetlinkMonitor::Link &aLink) {
+            mEvents.push_back(std::string("link ") + ChangeToString(aChange) + " " + aLink.mName +
+                              ((aLink.mFlags & IFF_RUNNING) ? " running" : ""));
+        });
+        mMonitor.AddAddressSubscriber(
+            [this](NetlinkMonitor::Change aChange, const NetlinkMonitor::Address &aAddress) {
+                mEvents.push_back(std::string("address ") + ChangeToString(aChange) + " " +
+                                  aAddress.mAddress.ToString() + "/" + std::to_string(aAddress.mPrefixLength) +
+                                  " link " + std::to_string(aAddress.mIfIndex));
+            });
+        mMonitor.AddRouteSubscriber([this](NetlinkMonitor::Change aChange, const NetlinkMonitor::Route &aRoute) {
+            mEvents.push_back(std::string("route ") + ChangeToString(aChange) + " " + aRoute.mDestination.ToString() +
+                              " table " + std::to_string(aRoute.mTable) + " link " + std::to_string(aRoute.mIfIndex));
+        });
+    }
+
+    NetlinkMonitor           mMonitor;
+    std::vector<std::string> mEvents;
+};
+
+TEST_F(NetlinkMonitorReplayTest, DumpPopulatesCache)
+{
+    const NetlinkMonitor::Link *link;
+
+    Replay(kDump);
+
+    link = mMonitor.FindLink("otbr-infra0");
+    ASSERT_NE(link, nullptr);
+    EXPECT_EQ(link->mIndex, kInfraIndex);
+    EXPECT_EQ(link->mMtu, 1500u);
+    EXPECT_TRUE(link->mFlags & IFF_UP);
+    EXPECT_TRUE(link->mFlags & IFF_RUNNING);
+    EXPECT_EQ(mMonitor.FindLink(kThreadIndex)->mName, "otbr-thread0");
+    EXPECT_EQ(mMonitor.FindLink(1)->mName, "lo");
+    EXPECT_EQ(mMonitor.FindLink("otbr-missing"), nullptr);
+
+    {
+        std::vector<NetlinkMonitor::Address> addresses = mMonitor.GetAddresses(kInfraIndex);
+
+        ASSERT_EQ(addresses.size(), 1u);
+        EXPECT_EQ(addresses[0].mAddress, Ip6Address("fd00:1::1"));
+        EXPECT_EQ(addresses[0].mPrefixLength, 64);
+        EXPECT_EQ(addresses[0].mScope, RT_SCOPE_UNIVERSE);
+        EXPECT_TRUE(mMonitor.GetAddresses(kThreadIndex).empty());
+    }
+
+    {
+        std::vector<NetlinkMonitor::Route> routes = mMonitor.GetRoutes(kTable);
+
+        ASSERT_EQ(routes.size(), 1u);
+        EXPECT_EQ(routes[0].mDestination, Ip6Prefix("fd00:7d03::", 64));
+        EXPECT_EQ(routes[0].mIfIndex, kInfraIndex);
+        EXPECT_EQ(routes[0].mPriority, 1024u);
+        EXPECT_EQ(routes[0].mProtocol, RTPROT_BOOT);
+        EXPECT_EQ(routes[0].mType, RTN_UNICAST);
+
+        routes = mMonitor.GetRoutes(RT_TABLE_MAIN);
+        ASSERT_EQ(routes.size(), 1u);
+        EXPECT_EQ(routes[0].mDestination, Ip6Prefix("fd00:1::", 64));
+        EXPECT_EQ(routes[0].mProtocol, RTPROT_KERNEL);
+
+        EXPECT_EQ(mMonitor.GetRoutes(RT_TABLE_LOCAL).size(), 3u);
+    }
+}
+
+TEST_F(NetlinkMonitorReplayTest, EventsAreDispatchedToSubscribers)
+{
+    Subscribe();
+
+    Replay(kDump);
+    EXPECT_EQ(mEvents, (std::vector<std::string>{
+                           "link added lo",
+                           "link added otbr-thread0 running",
+                           "link added otbr-infra0 running",
+                           "address added fd00:1::1/64 link 3",
+                           "route added fd00:7d03::/64 table 88 link 3",
+                           "route added fd00:1::/64 table 254 link 3",
+                           "route added fd00:1::1/128 table 255 link 3",
+                           "route added ff00::/8 table 255 link 2",
+                           "route added ff00::/8 table 255 link 3",
+                       }));
+
+    Replay(kAddThreadRoute);
+    EXPECT_EQ(mEvents, (std::vector<std::string>{
+                           "route added fd00:7d03::/64 table 254 link 2",
+                       }));
+
+    Replay(kAddThreadAddress);
+    EXPECT_EQ(mEvents, (std::vector<std::string>{
+                           "route added fd00:2::/64 table 254 link 2",
+                           "address added fd00:2::1/64 link 2",
+                           "route added fd00:2::1/128 table 255 link 2",
+                       }));
+
+    Replay(kSetInfraDown);
+    EXPECT_EQ(mEvents, (std::vector<std::string>{
+                           "link changed otbr-infra0",
+                           "route removed fd00:7d03::/64 table 88 link 3",
+                           "route removed fd00:1::/64 table 254 link 3",
+                           "route removed fd00:1::1/128 table 255 link 3",
+                           "route removed ff00::/8 table 255 link 3",
+                           "address removed fd00:1::1/64 link 3",
+                           "link changed otbr-thread0",
+                       }));
+
+    Replay(kDeleteThread);
+    EXPECT_EQ(mEvents, (std::vector<std::string>{
+                           "link changed otbr-thread0",
+                           "route removed fd00:2::/64 table 254 link 2",
+                           "route removed fd00:7d03::/64 table 254 link 2",
+                           "route removed fd00:2::1/128 table 255 link 2",
+                           "route removed ff00::/8 table 255 link 2",
+                           "address removed fd00:2::1/64 link 2",
+                           "link removed otbr-thread0",
+                           "link removed otbr-infra0",
+                       }));
+
+    EXPECT_EQ(mMonitor.FindLink("otbr-thread0"), nullptr);
+    EXPECT_TRUE(mMonitor.GetRoutes(RT_TABLE_MAIN).empty());
+}
+
+TEST_F(NetlinkMonitorReplayTest, UnchangedObjectsAreNotReported)
+{
+    Replay(kDump);
+    Subscribe();
+
+    Replay(kDump);
+    EXPECT_TRUE(mEvents.empty());
+}
+
+TEST_F(NetlinkMonitorReplayTest, RemovedLinkTakesItsAddressesAndRoutes)
+{
+    Replay(kDump);
+    Subscribe();
+
+    // Skipping the link down events leaves the kernel's removals of otbr-infra0 addresses and routes unreported.
+    Replay(kDeleteThread);
+
+    EXPECT_EQ(mMonitor.FindLink(kInfraIndex), nullptr);
+    EXPECT_TRUE(mMonitor.GetAddresses(kInfraIndex).empty());
+    EXPECT_TRUE(mMonitor.GetRoutes(kTable).empty());
+    EXPECT_TRUE(mMonitor.GetRoutes(RT_TABLE_MAIN).empty());
+    EXPECT_TRUE(mMonitor.GetRoutes(RT_TABLE_LOCAL).empty());
+    EXPECT_EQ(mEvents.back(), "link removed otbr-infra0 running");
+    EXPECT_EQ(mEvents[mEvents.size() - 2], "address removed fd00:1::1/64 link 3");
+}
+
+TEST_F(NetlinkMonitorReplayTest, SubscribersCanBeRemovedFromCallbacks)
+{
+    NetlinkMonitor::SubscriberId subscriberId;
+    int                          linkEvents  = 0;
+    int                          routeEvents = 0;
+
+    subscriberId = mMonitor.AddLinkSubscriber([&](NetlinkMonitor::Change, const NetlinkMonitor::Link &) {
+        linkEvents++;
+        mMonitor.RemoveSubscriber(subscriberId);
+    });
+    mMonitor.AddRouteSubscriber([&](NetlinkMonitor::Change, const NetlinkMonitor::Route &) { routeEvents++; });
+
+    Replay(kDump);
+
+    EXPECT_EQ(linkEvents, 1);
+    EXPECT_EQ(routeEvents, 5);
+}
@@ -0,0 +1,176 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <netinet/in.h>
+
+#include <linux/netfilter.h>
+
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "backbone_router/nfq_verdict_batcher.hpp"
+#include "common/types.hpp"
+
+using namespace otbr;
+using namespace otbr::BackboneRouter;
+
+using Verdicts = std::vector<std::pair<uint32_t, uint32_t>>;
+
+TEST(NfqVerdictBatcher, TestCoalesceConsecutiveVerdicts)
+{
+    Verdicts          verdicts;
+    NfqVerdictBatcher batcher([&verdicts](uint32_t aPacketId, uint32_t aVerdict) {
+        verdicts.emplace_back(aPacketId, aVerdict);
+        return 0;
+    });
+
+    batcher.Flush();
+    EXPECT_TRUE(verdicts.empty());
+
+    batcher.Add(1, NF_ACCEPT);
+    batcher.Add(2, NF_ACCEPT);
+    batcher.Add(3, NF_ACCEPT);
+    batcher.Add(4, NF_DROP);
+    batcher.Add(5, NF_ACCEPT);
+    EXPECT_EQ(verdicts, (Verdicts{{3, NF_ACCEPT}, {4, NF_DROP}}));
+
+    batcher.Flush();
+    batcher.Flush();
+    EXPECT_EQ(verdicts, (Verdicts{{3, NF_ACCEPT}, {4, NF_DROP}, {5, NF_ACCEPT}}));
+    EXPECT_EQ(batcher.GetNumVerdicts(), 3u);
+    EXPECT_EQ(batcher.GetNumFailedVerdicts(), 0u);
+}
+
+TEST(NfqVerdictBatcher, TestCountFailedVerdicts)
+{
+    NfqVerdictBatcher batcher([](uint32_t, uint32_t) { return -1; });
+
+    batcher.Add(1, NF_ACCEPT);
+    batcher.Add(2, NF_DROP);
+    batcher.Flush();
+    EXPECT_EQ(batcher.GetNumVerdicts(), 2u);
+    EXPECT_EQ(batcher.GetNumFailedVerdicts(), 2u);
+}
+
+#if OTBR_GTEST_BENCHMARK
+static uint64_t ElapsedUs(std::chrono::steady_clock::time_point aBegin)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aBegin).count();
+}
+
+// Simulates the user-space work of `NdProxyManager` for a burst of unicast NS messages: a target lookup and a
+// verdict per packet, one in `kProxiedEvery` being proxied.
+TEST(NfqVerdictBatcher, BenchmarkUnicastNs)
+{
+    static constexpr uint32_t kNumTargets     = 1000;
+    static constexpr uint32_t kNumPackets     = 200000;
+    static constexpr uint32_t kProxiedEvery   = 10;
+    static constexpr uint32_t kPacketsPerWake = 64;
+
+    std::vector<Ip6Address>        packets;
+    std::set<Ip6Address>           orderedSet;
+    std::unordered_set<Ip6Address> hashSet;
+    uint64_t                       perPacketVerdicts = 0;
+    uint64_t                       batchVerdicts     = 0;
+    uint32_t                       orderedProxied    = 0;
+    uint32_t                       hashProxied       = 0;
+    uint64_t                       orderedUs;
+    uint64_t                       hashUs;
+
+    for (uint32_t i = 0; i < kNumTargets; i++)
+    {
+        Ip6Address target("fd00:db8::");
+
+        target.m32[3] = htobe32(i * 7919 + 1);
+        orderedSet.insert(target);
+        hashSet.insert(target);
+    }
+
+    for (uint32_t i = 0; i < kNumPackets; i++)
+    {
+        Ip6Address dst("fd00:db8::");
+
+        dst.m32[3] = htobe32(i % kProxiedEvery == 0 ? (i % kNumTargets) * 7919 + 1 : 0x80000000 + i);
+        packets.push_back(dst);
+    }
+
+    {
+        auto begin = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < kNumPackets; i++)
+        {
+            orderedProxied += orderedSet.find(packets[i]) != orderedSet.end();
+
+            // Before batching, every packet took an `nfq_set_verdict()` call.
+            perPacketVerdicts++;
+        }
+
+        orderedUs = ElapsedUs(begin);
+    }
+
+    {
+        NfqVerdictBatcher batcher([&batchVerdicts](uint32_t, uint32_t) {
+            batchVerdicts++;
+            return 0;
+        });
+        auto              begin = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < kNumPackets; i++)
+        {
+            bool proxied = hashSet.find(packets[i]) != hashSet.end();
+
+            hashProxied += proxied;
+            batcher.Add(i, proxied ? NF_DROP : NF_ACCEPT);
+
+            if ((i + 1) % kPacketsPerWake == 0)
+            {
+                batcher.Flush();
+            }
+        }
+        batcher.Flush();
+
+        hashUs = ElapsedUs(begin);
+    }
+
+    EXPECT_EQ(orderedProxied, kNumPackets / kProxiedEvery);
+    EXPECT_EQ(hashProxied, orderedProxied);
+    EXPECT_EQ(perPacketVerdicts, kNumPackets);
+    EXPECT_LT(batchVerdicts, perPacketVerdicts / 4);
+
+    std::cout << "std::set: " << uint64_t{kNumPackets} * 1000000 / std::max<uint64_t>(orderedUs, 1) << " NS/s with "
+              << perPacketVerdicts << " verdicts; std::unordered_set with batching: "
+              << uint64_t{kNumPackets} * 1000000 / std::max<uint64_t>(hashUs, 1) << " NS/s with " << batchVerdicts
+              << " verdicts" << std::endl;
+}
+#endif // OTBR_GTEST_BENCHMARK
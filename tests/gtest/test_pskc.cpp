@@ -26,6 +26,8 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -63,3 +65,180 @@ TEST(Pskc, Test_TruncatedNetworkNamePskc_OpenThread)
 
     EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), ElementsAreArray(expected));
 }
+
+// The PBKDF2-AES-CMAC-PRF-128 derivation computed with one `mbedtls_aes_cmac_prf_128()` call per iteration.
+static std::vector<uint8_t> ComputeReferencePskc(const uint8_t *aExtPanId,
+                                                 const char    *aNetworkName,
+                                                 const char    *aPassphrase)
+{
+    std::vector<uint8_t> salt = {'T', 'h', 'r', 'e', 'a', 'd'};
+    uint8_t              prfOutput[OT_PSKC_LENGTH];
+    std::vector<uint8_t> pskc;
+
+    salt.insert(salt.end(), aExtPanId, aExtPanId + OT_EXTENDED_PAN_ID_LENGTH);
+    salt.insert(salt.end(), aNetworkName, aNetworkName + strlen(aNetworkName));
+    salt.insert(salt.end(), {0, 0, 0, 1});
+
+    mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), salt.data(),
+                             salt.size(), prfOutput);
+    pskc.assign(prfOutput, prfOutput + sizeof(prfOutput));
+
+    for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
+    {
+        uint8_t prfInput[OT_PSKC_LENGTH];
+
+        memcpy(prfInput, prfOutput, sizeof(prfInput));
+        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
+                                 sizeof(prfInput), prfOutput);
+        for (size_t j = 0; j < sizeof(prfOutput); j++)
+        {
+            pskc[j] ^= prfOutput[j];
+        }
+    }
+
+    return pskc;
+}
+
+static otbr::Psk::PskcParams MakeParams(uint8_t aExtPanIdByte, const char *aNetworkName, const char *aPassphrase)
+{
+    otbr::Psk::PskcParams params;
+
+    memset(params.mExtPanId, aExtPanIdByte, sizeof(params.mExtPanId));
+    params.mNetworkName = aNetworkName;
+    params.mPassphrase  = aPassphrase;
+
+    return params;
+}
+
+TEST(Pskc, TestMatchesPerIterationPrf)
+{
+    otbr::Psk::Pskc pskc;
+    uint8_t         extpanid[] = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+
+    // A 16-byte passphrase is used as the PRF key directly, any other length is hashed into one.
+    for (const char *passphrase : {"J01NME", "0123456789abcdef", "a-much-longer-passphrase-than-sixteen-bytes"})
+    {
+        const uint8_t *actual = pskc.ComputePskc(extpanid, "OTBR-Net", passphrase);
+
+        EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH),
+                    ElementsAreArray(ComputeReferencePskc(extpanid, "OTBR-Net", passphrase)));
+    }
+}
+
+TEST(Pskc, TestBatchMatchesSingle)
+{
+    std::vector<otbr::Psk::PskcParams> params;
+    std::vector<otbr::Psk::PskcValue>  pskcs;
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        params.push_back(MakeParams(i, "OpenThread", std::to_string(123456 + i).c_str()));
+    }
+
+    for (unsigned numThreads : {0u, 1u, 3u, 16u})
+    {
+        otbr::Psk::Pskc::ComputePskcBatch(params, pskcs, numThreads);
+        ASSERT_EQ(pskcs.size(), params.size());
+
+        for (size_t i = 0; i < params.size(); i++)
+        {
+            otbr::Psk::Pskc pskc;
+            const uint8_t  *expected = pskc.ComputePskc(params[i].mExtPanId, params[i].mNetworkName.c_str(),
+                                                        params[i].mPassphrase.c_str());
+
+            EXPECT_EQ(memcmp(pskcs[i].m8, expected, OT_PSKC_LENGTH), 0);
+        }
+    }
+
+    otbr::Psk::Pskc::ComputePskcBatch({}, pskcs);
+    EXPECT_TRUE(pskcs.empty());
+}
+
+TEST(Pskc, TestCacheLeastRecentlyUsedEviction)
+{
+    otbr::Psk::PskcCache cache(2);
+    otbr::Psk::PskcValue value;
+    otbr::Psk::PskcValue found;
+
+    memset(value.m8, 0x11, sizeof(value.m8));
+    cache.Add(MakeParams(1, "OpenThread", "123456"), value);
+    memset(value.m8, 0x22, sizeof(value.m8));
+    cache.Add(MakeParams(2, "OpenThread", "123456"), value);
+
+    // Every part of the key matters.
+    EXPECT_FALSE(cache.Find(MakeParams(1, "OpenThread", "654321"), found));
+    EXPECT_FALSE(cache.Find(MakeParams(1, "OpenThread2", "123456"), found));
+    EXPECT_FALSE(cache.Find(MakeParams(3, "OpenThread", "123456"), found));
+
+    // Using the first entry makes the second one the least recently used.
+    ASSERT_TRUE(cache.Find(MakeParams(1, "OpenThread", "123456"), found));
+    EXPECT_EQ(found.m8[0], 0x11);
+
+    memset(value.m8, 0x33, sizeof(value.m8));
+    cache.Add(MakeParams(3, "OpenThread", "123456"), value);
+    EXPECT_EQ(cache.GetSize(), 2u);
+    EXPECT_FALSE(cache.Find(MakeParams(2, "OpenThread", "123456"), found));
+    EXPECT_TRUE(cache.Find(MakeParams(1, "OpenThread", "123456"), found));
+    ASSERT_TRUE(cache.Find(MakeParams(3, "OpenThread", "123456"), found));
+    EXPECT_EQ(found.m8[0], 0x33);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
+
+static void RunMainloopOnce(otbr::TaskRunner &aTaskRunner)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {10, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    ASSERT_GE(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                     &mainloop.mTimeout),
+              0);
+    aTaskRunner.Process(mainloop);
+}
+
+TEST(Pskc, TestAsyncComputeAndCache)
+{
+    otbr::TaskRunner                  taskRunner;
+    otbr::Psk::AsyncPskcComputer      computer(taskRunner);
+    std::vector<uint8_t>              expected = {0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4,
+                                                  0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69};
+    otbr::Psk::PskcParams             params;
+    std::vector<std::vector<uint8_t>> results;
+    std::thread::id                   mainThread = std::this_thread::get_id();
+
+    params = MakeParams(0, "OpenThread", "123456");
+    for (uint8_t i = 0; i < OT_EXTENDED_PAN_ID_LENGTH; i++)
+    {
+        params.mExtPanId[i] = i;
+    }
+
+    auto handler = [&results, mainThread](const otbr::Psk::PskcValue &aPskc) {
+        EXPECT_EQ(std::this_thread::get_id(), mainThread);
+        results.emplace_back(aPskc.m8, aPskc.m8 + OT_PSKC_LENGTH);
+    };
+
+    computer.ComputePskc(params, handler);
+    EXPECT_TRUE(results.empty());
+
+    while (results.empty())
+    {
+        RunMainloopOnce(taskRunner);
+    }
+    EXPECT_THAT(results[0], ElementsAreArray(expected));
+    EXPECT_EQ(computer.GetCache().GetSize(), 1u);
+
+    // A cached PSKc is still delivered from the mainloop.
+    computer.ComputePskc(params, handler);
+    EXPECT_EQ(results.size(), 1u);
+    RunMainloopOnce(taskRunner);
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_THAT(results[1], ElementsAreArray(expected));
+}
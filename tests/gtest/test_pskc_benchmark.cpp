@@ -0,0 +1,88 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/pskc.hpp"
+
+static constexpr size_t kNumKeys = 16;
+
+template <typename Function> static uint64_t Measure(Function aFunction)
+{
+    auto begin = std::chrono::steady_clock::now();
+
+    aFunction();
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+TEST(PskcBenchmark, BenchmarkSingleAndBatch)
+{
+    std::vector<otbr::Psk::PskcParams> params(kNumKeys);
+    std::vector<otbr::Psk::PskcValue>  single(kNumKeys);
+    std::vector<otbr::Psk::PskcValue>  batch;
+    uint64_t                           singleUs;
+    uint64_t                           batchUs;
+
+    for (size_t i = 0; i < kNumKeys; i++)
+    {
+        memset(params[i].mExtPanId, static_cast<int>(i), sizeof(params[i].mExtPanId));
+        params[i].mNetworkName = "OpenThread";
+        params[i].mPassphrase  = "J01NME" + std::to_string(i);
+    }
+
+    singleUs = Measure([&params, &single]() {
+        otbr::Psk::Pskc pskc;
+
+        for (size_t i = 0; i < kNumKeys; i++)
+        {
+            memcpy(single[i].m8,
+                   pskc.ComputePskc(params[i].mExtPanId, params[i].mNetworkName.c_str(),
+                                    params[i].mPassphrase.c_str()),
+                   OT_PSKC_LENGTH);
+        }
+    });
+
+    batchUs = Measure([&params, &batch]() { otbr::Psk::Pskc::ComputePskcBatch(params, batch); });
+
+    ASSERT_EQ(batch.size(), kNumKeys);
+    for (size_t i = 0; i < kNumKeys; i++)
+    {
+        EXPECT_EQ(memcmp(single[i].m8, batch[i].m8, OT_PSKC_LENGTH), 0);
+    }
+
+    std::cout << "single: " << kNumKeys * 1000000 / std::max<uint64_t>(singleUs, 1)
+              << " keys/s, batch: " << kNumKeys * 1000000 / std::max<uint64_t>(batchUs, 1) << " keys/s on "
+              << std::thread::hardware_concurrency() << " cores" << std::endl;
+}
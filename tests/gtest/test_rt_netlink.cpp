@@ -0,0 +1,219 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <errno.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "utils/rt_netlink.hpp"
+#include "utils/system_utils.hpp"
+
+using namespace otbr;
+using otbr::Utils::RtNetlink;
+
+// These tests need CAP_SYS_ADMIN and CAP_NET_ADMIN. Each test process moves itself to a new network namespace with a
+// veth pair standing in for the Thread and backbone interfaces, so the host routing is left untouched.
+static constexpr uint32_t kTable        = 88;
+static constexpr uint32_t kRulePriority = 1000;
+static constexpr char     kThreadIf[]   = "otbr-thread0";
+static constexpr char     kInfraIf[]    = "otbr-infra0";
+
+static void EnterNetworkNamespace(void)
+{
+    ASSERT_EQ(unshare(CLONE_NEWNET), 0) << strerror(errno);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link set lo up"), 0);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link add %s type veth peer name %s", kThreadIf, kInfraIf), 0);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link set %s up", kThreadIf), 0);
+    ASSERT_EQ(SystemUtils::ExecuteCommand("ip link set %s up", kInfraIf), 0);
+}
+
+static std::string ReadCommand(const std::string &aCommand)
+{
+    std::string output;
+    char        buffer[256];
+    FILE       *pipe = popen(aCommand.c_str(), "r");
+
+    while (pipe != nullptr && fgets(buffer, sizeof(buffer), pipe) != nullptr)
+    {
+        output += buffer;
+    }
+
+    if (pipe != nullptr)
+    {
+        pclose(pipe);
+    }
+
+    return output;
+}
+
+static Ip6Prefix GetDomainPrefix(void)
+{
+    Ip6Prefix prefix;
+
+    prefix.mPrefix = Ip6Address("fd00:7d03:7d03:7d03::");
+    prefix.mLength = 64;
+
+    return prefix;
+}
+
+static RtNetlink::Route GetThreadRoute(void)
+{
+    return {GetDomainPrefix(), if_nametoindex(kThreadIf), RT_TABLE_MAIN, 1};
+}
+
+static RtNetlink::Route GetBackboneRoute(void)
+{
+    return {GetDomainPrefix(), if_nametoindex(kInfraIf), kTable, 0};
+}
+
+static void AddDuaRouting(RtNetlink &aRtNetlink)
+{
+    aRtNetlink.AddRoute(GetThreadRoute());
+    aRtNetlink.AddRule({kThreadIf, kTable, kRulePriority});
+    aRtNetlink.AddRoute(GetBackboneRoute());
+}
+
+static void DelDuaRouting(RtNetlink &aRtNetlink)
+{
+    aRtNetlink.DeleteRoute(GetThreadRoute());
+    aRtNetlink.DeleteRule({kThreadIf, kTable, kRulePriority});
+    aRtNetlink.DeleteRoute(GetBackboneRoute());
+}
+
+TEST(RtNetlink, TestAddAndDeleteRoutesAndRules)
+{
+    RtNetlink rtNetlink;
+
+    EnterNetworkNamespace();
+    ASSERT_EQ(rtNetlink.Open(), OTBR_ERROR_NONE);
+
+    AddDuaRouting(rtNetlink);
+    ASSERT_EQ(rtNetlink.Commit(), OTBR_ERROR_NONE) << strerror(errno);
+
+    EXPECT_NE(ReadCommand("ip -6 route show dev otbr-thread0").find("fd00:7d03:7d03:7d03::/64 proto static metric 1"),
+              std::string::npos);
+    EXPECT_NE(ReadCommand("ip -6 route show table 88").find("fd00:7d03:7d03:7d03::/64 dev otbr-infra0 proto static"),
+              std::string::npos);
+    EXPECT_NE(ReadCommand("ip -6 rule show").find("from all iif otbr-thread0 lookup 88"), std::string::npos);
+
+    // Adding again is not an error and doesn't duplicate the rule.
+    AddDuaRouting(rtNetlink);
+    EXPECT_EQ(rtNetlink.Commit(), OTBR_ERROR_NONE) << strerror(errno);
+    {
+        std::string rules = ReadCommand("ip -6 rule show");
+
+        EXPECT_EQ(rules.find("iif otbr-thread0"), rules.rfind("iif otbr-thread0"));
+    }
+
+    DelDuaRouting(rtNetlink);
+    ASSERT_EQ(rtNetlink.Commit(), OTBR_ERROR_NONE) << strerror(errno);
+
+    EXPECT_EQ(ReadCommand("ip -6 route show dev otbr-thread0").find("fd00:7d03"), std::string::npos);
+    EXPECT_EQ(ReadCommand("ip -6 route show table 88"), "");
+    EXPECT_EQ(ReadCommand("ip -6 rule show").find("otbr-thread0"), std::string::npos);
+
+    // Deleting again is not an error either.
+    DelDuaRouting(rtNetlink);
+    EXPECT_EQ(rtNetlink.Commit(), OTBR_ERROR_NONE) << strerror(errno);
+}
+
+TEST(RtNetlink, TestFailedRequestDoesNotStopBatch)
+{
+    RtNetlink        rtNetlink;
+    RtNetlink::Route badRoute = GetBackboneRoute();
+
+    EnterNetworkNamespace();
+    ASSERT_EQ(rtNetlink.Open(), OTBR_ERROR_NONE);
+
+    badRoute.mIfIndex = 0xffff;
+    rtNetlink.AddRoute(badRoute);
+    rtNetlink.AddRoute(GetThreadRoute());
+    EXPECT_EQ(rtNetlink.Commit(), OTBR_ERROR_ERRNO);
+    EXPECT_EQ(errno, ENODEV);
+
+    EXPECT_NE(ReadCommand("ip -6 route show dev otbr-thread0").find("fd00:7d03:7d03:7d03::/64"), std::string::npos);
+
+    rtNetlink.Close();
+    rtNetlink.AddRoute(GetThreadRoute());
+    EXPECT_EQ(rtNetlink.Commit(), OTBR_ERROR_INVALID_STATE);
+}
+
+#if OTBR_GTEST_BENCHMARK
+// Compares the latency of enabling and disabling DUA routing with `ip` commands, as DuaRoutingManager did before,
+// and with a netlink batch.
+TEST(RtNetlink, BenchmarkEnableDisable)
+{
+    static constexpr uint32_t kNumRounds = 20;
+
+    RtNetlink rtNetlink;
+    auto      begin = std::chrono::steady_clock::now();
+    uint64_t  commandUs;
+    uint64_t  netlinkUs;
+
+    EnterNetworkNamespace();
+    ASSERT_EQ(rtNetlink.Open(), OTBR_ERROR_NONE);
+
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kNumRounds; i++)
+    {
+        SystemUtils::ExecuteCommand("ip -6 route add fd00:7d03:7d03:7d03::/64 dev %s proto static metric 1", kThreadIf);
+        SystemUtils::ExecuteCommand("ip -6 rule add iif %s table %u pref %u", kThreadIf, kTable, kRulePriority);
+        SystemUtils::ExecuteCommand("ip -6 route add fd00:7d03:7d03:7d03::/64 dev %s proto static table %u", kInfraIf,
+                                    kTable);
+        SystemUtils::ExecuteCommand("ip -6 route del fd00:7d03:7d03:7d03::/64 dev %s proto static metric 1", kThreadIf);
+        SystemUtils::ExecuteCommand("ip -6 rule del iif %s table %u pref %u", kThreadIf, kTable, kRulePriority);
+        SystemUtils::ExecuteCommand("ip -6 route del fd00:7d03:7d03:7d03::/64 dev %s proto static table %u", kInfraIf,
+                                    kTable);
+    }
+    commandUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kNumRounds; i++)
+    {
+        AddDuaRouting(rtNetlink);
+        ASSERT_EQ(rtNetlink.Commit(), OTBR_ERROR_NONE);
+        DelDuaRouting(rtNetlink);
+        ASSERT_EQ(rtNetlink.Commit(), OTBR_ERROR_NONE);
+    }
+    netlinkUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "enable + disable: ip commands " << commandUs / kNumRounds << " us, netlink " << netlinkUs / kNumRounds
+              << " us" << std::endl;
+}
+#endif // OTBR_GTEST_BENCHMARK
@@ -0,0 +1,199 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <net/if.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "trel_dnssd/trel_peer_prober.hpp"
+
+using namespace otbr;
+using namespace otbr::TrelDnssd;
+
+// These tests open a raw ICMPv6 socket and need CAP_NET_RAW. By default the peer is the loopback address, the
+// `tests/scripts/trel-probing` script runs them across a veth pair in a network namespace instead.
+static constexpr Milliseconds kProbeInterval = Milliseconds(200);
+static constexpr Milliseconds kProbeTimeout  = Milliseconds(100);
+
+static const char *GetEnv(const char *aName, const char *aDefault)
+{
+    const char *value = getenv(aName);
+
+    return value != nullptr ? value : aDefault;
+}
+
+static uint32_t GetTestNetifIndex(void)
+{
+    return if_nametoindex(GetEnv("OTBR_TEST_TREL_NETIF", ""));
+}
+
+static Ip6Address GetLivePeerAddress(void)
+{
+    return Ip6Address(GetEnv("OTBR_TEST_TREL_PEER", "::1"));
+}
+
+static Ip6Address GetDeadPeerAddress(void)
+{
+    // The discard-only prefix (RFC 6666) never answers.
+    return Ip6Address(GetEnv("OTBR_TEST_TREL_DEAD_PEER", "100::1"));
+}
+
+static void RunMainloopOnce(void)
+{
+    MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 10000};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    MainloopManager::GetInstance().Update(mainloop);
+
+    if (select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+               &mainloop.mTimeout) >= 0)
+    {
+        MainloopManager::GetInstance().Process(mainloop);
+    }
+}
+
+static bool RunMainloopUntil(const std::function<bool(void)> &aCondition, Milliseconds aTimeout = Milliseconds(5000))
+{
+    Timepoint deadline = Clock::now() + aTimeout;
+
+    while (!aCondition() && Clock::now() < deadline)
+    {
+        RunMainloopOnce();
+    }
+
+    return aCondition();
+}
+
+static bool FindStats(const TrelPeerProber      &aProber,
+                      const std::string         &aInstanceName,
+                      const Ip6Address          &aAddress,
+                      TrelPeerProber::PeerStats &aStats)
+{
+    std::vector<TrelPeerProber::PeerStats> allStats;
+
+    aProber.GetPeerStats(allStats);
+
+    for (const auto &stats : allStats)
+    {
+        if (stats.mInstanceName == aInstanceName && stats.mAddress == aAddress)
+        {
+            aStats = stats;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+TEST(TrelPeerProber, MeasuresRoundTripTime)
+{
+    TrelPeerProber            prober(nullptr, nullptr);
+    TrelPeerProber::PeerStats stats;
+    Ip6Address                address = GetLivePeerAddress();
+
+    prober.SetTiming(kProbeInterval, kProbeTimeout);
+    ASSERT_EQ(prober.Start(GetTestNetifIndex()), OTBR_ERROR_NONE);
+
+    EXPECT_EQ(prober.SetPeer("peer", {address}), address);
+    EXPECT_TRUE(RunMainloopUntil([&]() { return FindStats(prober, "peer", address, stats) && stats.mRxReplies >= 3; }));
+
+    EXPECT_GE(stats.mTxProbes, stats.mRxReplies);
+    EXPECT_GT(stats.mSmoothedRtt.count(), 0);
+    EXPECT_TRUE(stats.IsAlive());
+    EXPECT_TRUE(stats.mIsBest);
+
+    prober.RemovePeer("peer");
+    EXPECT_FALSE(FindStats(prober, "peer", address, stats));
+}
+
+TEST(TrelPeerProber, ReportsDeadPeer)
+{
+    std::vector<std::string> deadPeers;
+    TrelPeerProber           prober(nullptr,
+                                    [&](const std::string &aInstanceName) { deadPeers.push_back(aInstanceName); });
+
+    prober.SetTiming(kProbeInterval, kProbeTimeout);
+    ASSERT_EQ(prober.Start(GetTestNetifIndex()), OTBR_ERROR_NONE);
+
+    prober.SetPeer("live", {GetLivePeerAddress()});
+    prober.SetPeer("silent", {GetDeadPeerAddress()});
+    prober.SetPeer("dead", {GetLivePeerAddress()});
+
+    // The peer stops answering after it has answered once.
+    EXPECT_TRUE(RunMainloopUntil([&]() {
+        TrelPeerProber::PeerStats stats;
+
+        return FindStats(prober, "dead", GetLivePeerAddress(), stats) && stats.mRxReplies > 0;
+    }));
+    prober.SetPeer("dead", {GetDeadPeerAddress()});
+
+    EXPECT_TRUE(RunMainloopUntil([&]() { return !deadPeers.empty(); }));
+    EXPECT_EQ(deadPeers, std::vector<std::string>{"dead"});
+
+    // The live peer keeps answering, and the peer which has never answered is not reported.
+    RunMainloopUntil([]() { return false; }, kProbeInterval * 2);
+    EXPECT_EQ(deadPeers, std::vector<std::string>{"dead"});
+}
+
+TEST(TrelPeerProber, SwitchesToAnsweringAddress)
+{
+    std::string    changedPeer;
+    Ip6Address     changedAddress;
+    TrelPeerProber prober(
+        [&](const std::string &aInstanceName, const Ip6Address &aAddress) {
+            changedPeer    = aInstanceName;
+            changedAddress = aAddress;
+        },
+        nullptr);
+
+    prober.SetTiming(kProbeInterval, kProbeTimeout);
+    ASSERT_EQ(prober.Start(GetTestNetifIndex()), OTBR_ERROR_NONE);
+
+    // The first address is preferred until measurements are available.
+    EXPECT_EQ(prober.SetPeer("peer", {GetDeadPeerAddress(), GetLivePeerAddress()}), GetDeadPeerAddress());
+
+    EXPECT_TRUE(RunMainloopUntil([&]() { return !changedPeer.empty(); }));
+    EXPECT_EQ(changedPeer, "peer");
+    EXPECT_EQ(changedAddress, GetLivePeerAddress());
+
+    // The statistics and the best address are kept when the peer is updated.
+    EXPECT_EQ(prober.SetPeer("peer", {GetDeadPeerAddress(), GetLivePeerAddress()}), GetLivePeerAddress());
+    EXPECT_EQ(prober.SetPeer("peer", {GetDeadPeerAddress()}), GetDeadPeerAddress());
+}
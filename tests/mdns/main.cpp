@@ -32,6 +32,7 @@
 #include <errno.h>
 #include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
@@ -54,6 +55,16 @@ static Publisher *sPublisher = nullptr;
 
 typedef std::function<void(void)> TestRunner;
 
+void SetInfraIfFromEnv(void)
+{
+    const char *infraIfName = getenv("OTBR_MDNS_INFRA_IF");
+
+    if (infraIfName != nullptr)
+    {
+        sPublisher->SetInfraIf(infraIfName);
+    }
+}
+
 int RunMainloop(void)
 {
     int rval = 0;
@@ -372,6 +383,7 @@ otbrError Test(TestRunner aTestRunner)
             aTestRunner();
         }
     });
+    SetInfraIfFromEnv();
     SuccessOrExit(error = sPublisher->Start());
     RunMainloop();
 
@@ -404,6 +416,7 @@ otbrError TestStopService(void)
             PublishSingleService();
         }
     });
+    SetInfraIfFromEnv();
     SuccessOrExit(ret = sPublisher->Start());
     signal(SIGUSR1, RecoverSignal);
     signal(SIGUSR2, RecoverSignal);
@@ -468,6 +481,54 @@ exit:
     return error;
 }
 
+otbrError CheckTxtViewAndBuilder(void)
+{
+    otbrError                    error = OTBR_ERROR_NONE;
+    std::vector<uint8_t>         txtData;
+    Publisher::TxtBuilder        builder(txtData);
+    Publisher::TxtView           view(txtData);
+    Publisher::TxtView::Iterator iterator    = Publisher::TxtView::kIteratorInit;
+    const uint8_t                extAddr[]   = {0, 1, 2, 3, 4, 5, 6, 7};
+    const uint8_t                truncated[] = {3, 'a'};
+    std::vector<uint8_t>         tooLong(255, 'x');
+    Publisher::TxtView::Entry    entry;
+
+    SuccessOrExit(error = builder.AppendEntry("rv", "1"));
+    SuccessOrExit(error = builder.AppendBooleanAttribute("b1"));
+    SuccessOrExit(error = builder.AppendEntry("xa", extAddr, sizeof(extAddr)));
+
+    // Replace in place, ignoring case, and append a new entry.
+    SuccessOrExit(error = builder.SetEntry("RV", reinterpret_cast<const uint8_t *>("22"), 2));
+    SuccessOrExit(error = builder.SetEntry("vn", reinterpret_cast<const uint8_t *>("v"), 1));
+    VerifyOrExit(builder.AppendEntry("k", tooLong.data(), tooLong.size()) == OTBR_ERROR_INVALID_ARGS,
+                 error = OTBR_ERROR_PARSE);
+    VerifyOrExit(builder.Finish() == OTBR_ERROR_INVALID_ARGS, error = OTBR_ERROR_PARSE);
+
+    view = Publisher::TxtView(txtData);
+
+    SuccessOrExit(error = view.GetNextEntry(iterator, entry));
+    VerifyOrExit(entry.KeyMatches("rv") && entry.mValueLength == 2, error = OTBR_ERROR_PARSE);
+    SuccessOrExit(error = view.GetNextEntry(iterator, entry));
+    VerifyOrExit(entry.KeyMatches("b1") && entry.mIsBooleanAttribute, error = OTBR_ERROR_PARSE);
+    SuccessOrExit(error = view.GetNextEntry(iterator, entry));
+    VerifyOrExit(entry.KeyMatches("xa"), error = OTBR_ERROR_PARSE);
+    SuccessOrExit(error = view.GetNextEntry(iterator, entry));
+    VerifyOrExit(entry.KeyMatches("vn"), error = OTBR_ERROR_PARSE);
+    VerifyOrExit(view.GetNextEntry(iterator, entry) == OTBR_ERROR_NOT_FOUND, error = OTBR_ERROR_PARSE);
+
+    SuccessOrExit(error = view.FindEntry("XA", entry));
+    VerifyOrExit(entry.mValueLength == sizeof(extAddr), error = OTBR_ERROR_PARSE);
+    VerifyOrExit(memcmp(entry.mValue, extAddr, sizeof(extAddr)) == 0, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(view.FindEntry("x", entry) == OTBR_ERROR_NOT_FOUND, error = OTBR_ERROR_PARSE);
+
+    VerifyOrExit(Publisher::TxtView(truncated, sizeof(truncated)).FindEntry("a", entry) == OTBR_ERROR_PARSE,
+                 error = OTBR_ERROR_PARSE);
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
 int main(int argc, char *argv[])
 {
     int ret = 0;
@@ -477,6 +538,11 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    if (CheckTxtViewAndBuilder() != OTBR_ERROR_NONE)
+    {
+        return 1;
+    }
+
     if (argc < 2)
     {
         return 1;
@@ -32,8 +32,14 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <sysexits.h>
 
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
@@ -53,18 +59,20 @@ void help(void)
     printf("pskc - compute PSKc\n"
            "SYNTAX:\n"
            "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n"
+           "    pskc -b [THREADS]\n"
+           "        Reads one `<PASSPHRASE> <EXTPANID> <NETWORK_NAME>` per line from stdin and prints\n"
+           "        their PSKc in the same order, using THREADS threads (default: one per CPU core).\n"
            "EXAMPLE:\n"
            "    pskc 654321 1122334455667788 OpenThread\n");
 }
 
-int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+int parseParams(const char            *aPassphrase,
+                const char            *aExtPanId,
+                const char            *aNetworkName,
+                otbr::Psk::PskcParams &aParams)
 {
-    uint8_t extpanid[kSizeExtPanId];
-    size_t  length;
-    int     ret = -1;
-
-    otbr::Psk::Pskc pskcComputer;
-    const uint8_t  *pskc;
+    size_t length;
+    int    ret = -1;
 
     length = strlen(aPassphrase);
     VerifyOrExit(length > 0, printf("PASSPHRASE must not be empty.\n"));
@@ -79,20 +87,75 @@ int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetwo
                          (aExtPanId[i] <= 'F' && aExtPanId[i] >= 'A'),
                      printf("EXTPANID must be encoded in hex.\n"));
     }
-    otbr::Utils::Hex2Bytes(aExtPanId, extpanid, sizeof(extpanid));
+    otbr::Utils::Hex2Bytes(aExtPanId, aParams.mExtPanId, sizeof(aParams.mExtPanId));
 
     length = strlen(aNetworkName);
     VerifyOrExit(length > 0, printf("NETWORK_NAME must not be empty.\n"));
     VerifyOrExit(length <= kMaxNetworkName,
                  printf("NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
 
-    pskc = pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
-    for (int i = 0; i < 16; i++)
+    aParams.mNetworkName = aNetworkName;
+    aParams.mPassphrase  = aPassphrase;
+    ret                  = 0;
+
+exit:
+    return ret;
+}
+
+void printValue(const uint8_t *aPskc)
+{
+    for (int i = 0; i < OT_PSKC_LENGTH; i++)
     {
-        printf("%02x", pskc[i]);
+        printf("%02x", aPskc[i]);
     }
     printf("\n");
-    ret = 0;
+}
+
+int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+{
+    int ret;
+
+    otbr::Psk::Pskc       pskcComputer;
+    otbr::Psk::PskcParams params;
+
+    SuccessOrExit(ret = parseParams(aPassphrase, aExtPanId, aNetworkName, params));
+    printValue(pskcComputer.ComputePskc(params.mExtPanId, params.mNetworkName.c_str(), params.mPassphrase.c_str()));
+
+exit:
+    return ret;
+}
+
+int printPSKcBatch(unsigned aNumThreads)
+{
+    int ret = 0;
+
+    std::vector<otbr::Psk::PskcParams> params;
+    std::vector<otbr::Psk::PskcValue>  pskcs;
+    std::string                        line;
+
+    while (std::getline(std::cin, line))
+    {
+        std::istringstream    fields(line);
+        std::string           passphrase;
+        std::string           extPanId;
+        std::string           networkName;
+        otbr::Psk::PskcParams lineParams;
+
+        VerifyOrExit(fields >> passphrase >> extPanId >> networkName,
+                     printf("Line %zu: expected <PASSPHRASE> <EXTPANID> <NETWORK_NAME>.\n", params.size() + 1),
+                     ret = EX_DATAERR);
+        VerifyOrExit(parseParams(passphrase.c_str(), extPanId.c_str(), networkName.c_str(), lineParams) == 0,
+                     printf("Line %zu is invalid.\n", params.size() + 1), ret = EX_DATAERR);
+
+        params.push_back(std::move(lineParams));
+    }
+
+    otbr::Psk::Pskc::ComputePskcBatch(params, pskcs, aNumThreads);
+
+    for (const otbr::Psk::PskcValue &pskc : pskcs)
+    {
+        printValue(pskc.m8);
+    }
 
 exit:
     return ret;
@@ -102,6 +165,13 @@ int main(int argc, char *argv[])
 {
     int ret = 0;
 
+    if (argc >= 2 && strcmp(argv[1], "-b") == 0)
+    {
+        VerifyOrExit(argc <= 3, help(), ret = EX_USAGE);
+        ret = printPSKcBatch(argc == 3 ? static_cast<unsigned>(atoi(argv[2])) : 0);
+        ExitNow();
+    }
+
     VerifyOrExit(argc == 4, help(), ret = EX_USAGE);
     ret = printPSKc(argv[1], argv[2], argv[3]);
 